@@ -1,37 +1,56 @@
-// C++ Ѱ   
-// register(b0) : 0   (Slot) ڴ
-cbuffer TransformBuffer : register(b0)
+// C++ Ѱ Ʈ ϳ  (SpriteInstance, Է  1 νϽ Ʈ)
+// Ʈ   ٲ,  Ʈ  6   
+struct InstanceInput
 {
-   
-    matrix WorldMatrix;      // 簢 ̵ / ȸ / ũ   4 x 4 
-    float4 uvOffsetScale;   // x :  ̵, y :  ̵, z :  ũ, w :  ũ
-    float4 tintColor;      // C++ Ѱ  
-    float objectType;
-    float3 padding;
+    float2 center : CENTER;         // ī޶  ߽ ġ
+    float2 halfSize : HALFSIZE;     //  /   ũ
+    float4 uvOffsetScale : UVRECT;  // x :  ̵, y :  ̵, z :  ũ, w :  ũ
+    float4 tintColor : TINT;        // C++ Ѱ   (RGBA8 0 ~ 1 Ǯ )
+    uint typeFlags : TYPEFLAGS;     //  8Ʈ : objectType, 0x100 : ¿ , 9 ~ 15Ʈ : ȷƮ  + 1,  16Ʈ : ؽó ȣ
 };
 
+static const uint SPRITE_TYPE_MASK = 0xFF;
+static const uint SPRITE_FLIP_X = 0x100;
+static const uint SPRITE_PALETTE_SHIFT = 9;
+static const uint SPRITE_PALETTE_MASK = 0x7F;
+static const uint SPRITE_TEXTURE_SHIFT = 16;
+static const uint PALETTE_TEXTURE = 1;  // GlobalDescriptorHeap::PALETTE_DESCRIPTOR (ٸ ȷƮ 256)
+
 // ؽó ̹ Ʈ (Sampler) 
-Texture2D myTexture : register(t0);
+//    ü ؽó 迭 (0 ؽó , 1 ȷƮ ؽó)
+// ÷  ø̶  ִ ؽó ȭ ũ⿡   ܰ ϳ 
+Texture2D textures[] : register(t0);
 SamplerState mySampler : register(s0);
 
 struct PSInput
 {
     float4 position : SV_POSITION; // ȭ ǥ System Value ˷
     float2 uv : TEXCOORD; // ÷  ؽó ǥ 
+    nointerpolation float4 tintColor : COLOR;   // Ʈ ü  ̹Ƿ  
+    nointerpolation uint objectType : OBJECTTYPE;
+    nointerpolation uint textureIndex : TEXINDEX;
+    nointerpolation uint paletteRow : PALETTEROW;  // 0̸  ؽó, ƴϸ ȷƮ  + 1
 };
 
 
 //  ̴ (Vertex Shader)
 // C++ ۿ  ϳ    Լ 
-PSInput VSMain(float4 position : POSITION, float2 uv : TEXCOORD)
+PSInput VSMain(float4 position : POSITION, float2 uv : TEXCOORD, InstanceInput instance)
 {
     PSInput result;
     
-    //  ġ WorldMatrix ؼ ο ġ ̵ Ŵ
-    result.position = mul(position, WorldMatrix);
+    // ũ 1¥ 簢  (-0.5 ~ 0.5) -1 ~ 1 ø   ũ⸦ ϰ ߽ ̵ (ũ > ̵ İ  )
+    float2 corner = position.xy * 2.0f;
+    if (instance.typeFlags & SPRITE_FLIP_X) corner.x = -corner.x;
+    result.position = float4(instance.center + corner * instance.halfSize, 0.0f, 1.0f);
     
     // C++ Ѱ  ü ̹      ߶
-    result.uv = (uv * uvOffsetScale.zw) + uvOffsetScale.xy;
+    result.uv = (uv * instance.uvOffsetScale.zw) + instance.uvOffsetScale.xy;
+
+    result.tintColor = instance.tintColor;
+    result.objectType = instance.typeFlags & SPRITE_TYPE_MASK;
+    result.textureIndex = instance.typeFlags >> SPRITE_TEXTURE_SHIFT;
+    result.paletteRow = (instance.typeFlags >> SPRITE_PALETTE_SHIFT) & SPRITE_PALETTE_MASK;
     
     return result;  //  ȼ ̴ ѱ
 }
@@ -40,31 +59,38 @@ PSInput VSMain(float4 position : POSITION, float2 uv : TEXCOORD)
 //     ĥ  ȭ  ȼ   Լ 
 float4 PSMain(PSInput input) : SV_Target
 {
-    // float  о  ݿø(round)ؼ ˻
     //   (̻)
-    if (round(objectType) == 1)
+    if (input.objectType == 1)
     {
         float dx = input.uv.x - 0.5f;
         float dy = input.uv.y - 0.5f;
         float dist = sqrt((dx * dx) + (dy * dy));
         
         clip(0.5f - dist);
-        return tintColor;
+        return input.tintColor;
     }
     // ܻ 簢  (HP)
-    else if (round(objectType) == 2)
+    else if (input.objectType == 2)
     {
-        return tintColor;
+        return input.tintColor;
     }
     
     // ؽó  (, ĳ)
     // Ʈ ؽó  
-    float4 color = myTexture.Sample(mySampler, input.uv);
+    //   ο ȿ Ʈ ؽó ȣ ٸǷ NonUniformResourceIndex ˷
+    float4 color = textures[NonUniformResourceIndex(input.textureIndex)].Sample(mySampler, input.uv);
+
+    // 8Ʈ ȷƮ ؽó :   (R8, 0 ~ 1)  ȣ̹Ƿ ȷƮ ؽó  ٿ ¥  
+    if (input.paletteRow != 0)
+    {
+        uint index = (uint)(color.r * 255.0f + 0.5f);
+        color = textures[PALETTE_TEXTURE].Load(int3(index, input.paletteRow - 1, 0));
+    }
     
     // png ̹  κ (İ 0.1) ȼ ƿ ȱ׸  (Clip)
     clip(color.a - 0.1f);
     
     //  ̴ Ѱ  ״ SV_TARGET ĥ
     //   ƾƮ ÷ ؼ  ( ϸ ״,  ϸ Ӱ )
-    return color * tintColor;
+    return color * input.tintColor;
 }
\ No newline at end of file
@@ -0,0 +1,280 @@
+﻿// 에셋 팩 (AssetPack) 로드 시간 벤치마크
+// Assets 폴더로 팩을 만든 뒤, 게임 시작 때처럼 텍스처 / 사운드를 전부 업로드용 버퍼까지 복사하는 시간을
+// PNG를 stb_image로 풀고 WAV를 읽어서 파싱하는 방식과 팩을 메모리 맵으로 열어서 본문 포인터로 바로 복사하는 방식으로 비교
+// 팩 본문이 원본 PNG 해제 결과 / WAV PCM과 바이트 단위로 같은지, 경로 찾기, 잘리거나 깨진 팩을 거부하는지도 검사
+// 시간은 파일이 OS 캐시에 올라간 상태 기준 (처음 한 번은 버리고 나머지 중 가장 빠른 값)
+// 빌드 : g++ -O2 -std=c++14 Bench/AssetPackBench.cpp -o AssetPackBench (Survivors 폴더에서 실행하거나 첫 인자로 에셋 폴더)
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#define STB_IMAGE_IMPLEMENTATION
+#include "../Source/Utils/AssetPackBuilder.h"
+
+static const int kRepeats = 4;
+
+struct LoadResult
+{
+	double ms = 0.0;
+	int textures = 0;
+	int sounds = 0;
+	uint64_t copiedBytes = 0;
+	uint32_t checksum = 0;	// 복사한 내용 요약 (최적화로 복사가 사라지지 않게, 두 방식이 같은 내용을 올렸는지 비교)
+};
+
+// 업로드 버퍼 흉내 : 줄마다 256바이트 정렬된 자리로 복사
+struct UploadStaging
+{
+	std::vector<uint8_t> buffer;
+
+	uint32_t CopyTexture(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t srcPitch)
+	{
+		uint32_t dstPitch = (width * 4 + ASSET_PACK_PITCH_ALIGNMENT - 1) & ~(ASSET_PACK_PITCH_ALIGNMENT - 1);
+		if (buffer.size() < (size_t)dstPitch * height) buffer.resize((size_t)dstPitch * height);
+		for (uint32_t y = 0; y < height; y++) memcpy(&buffer[(size_t)y * dstPitch], pixels + (size_t)y * srcPitch, (size_t)width * 4);
+		return Summarize(width * 4, height, dstPitch);
+	}
+
+	uint32_t CopySound(const uint8_t* pcm, size_t size)
+	{
+		if (buffer.size() < size) buffer.resize(size);
+		memcpy(buffer.data(), pcm, size);
+		return Summarize((uint32_t)size, 1, (uint32_t)size);
+	}
+
+	// 줄마다 첫 바이트 / 마지막 바이트만 섞음 (내용 비교는 CheckContents에서 따로 전부 함)
+	uint32_t Summarize(uint32_t rowBytes, uint32_t rows, uint32_t pitch) const
+	{
+		uint32_t hash = 2166136261u;
+		for (uint32_t y = 0; y < rows && rowBytes > 0; y++)
+		{
+			hash = (hash ^ buffer[(size_t)y * pitch]) * 16777619u;
+			hash = (hash ^ buffer[(size_t)y * pitch + rowBytes - 1]) * 16777619u;
+		}
+		return hash;
+	}
+};
+
+// PNG / WAV 파일을 그대로 읽는 방식 (지금까지의 게임)
+static LoadResult LoadLooseFiles(const std::string& assetsRoot, UploadStaging& staging)
+{
+	LoadResult result;
+	std::vector<uint8_t> bytes;
+	auto start = std::chrono::steady_clock::now();
+
+	for (const std::string& file : ListAssetFiles(assetsRoot + "/Textures", ".png"))
+	{
+		int width = 0, height = 0, channels = 0;
+		unsigned char* pixels = stbi_load((assetsRoot + "/Textures/" + file).c_str(), &width, &height, &channels, STBI_rgb_alpha);
+		if (pixels == nullptr) continue;
+		result.checksum ^= staging.CopyTexture(pixels, width, height, width * 4) + result.textures;
+		result.copiedBytes += (uint64_t)width * height * 4;
+		result.textures++;
+		stbi_image_free(pixels);
+	}
+	for (const std::string& file : ListAssetFiles(assetsRoot + "/Sounds", ".wav"))
+	{
+		WavInfo wav;
+		if (!ReadWholeFile((assetsRoot + "/Sounds/" + file).c_str(), bytes) || !ParseWav(bytes, wav)) continue;
+		result.checksum ^= staging.CopySound(bytes.data() + wav.dataOffset, wav.dataSize) + result.sounds;
+		result.copiedBytes += wav.dataSize;
+		result.sounds++;
+	}
+
+	result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	return result;
+}
+
+// 팩을 메모리 맵으로 열고 게임처럼 경로로 찾아서 본문 포인터에서 바로 복사
+static LoadResult LoadPack(const char* packPath, const std::string& assetsRoot, UploadStaging& staging)
+{
+	LoadResult result;
+	std::vector<std::string> textures = ListAssetFiles(assetsRoot + "/Textures", ".png");
+	std::vector<std::string> sounds = ListAssetFiles(assetsRoot + "/Sounds", ".wav");
+	auto start = std::chrono::steady_clock::now();
+
+	AssetPack pack;
+	if (!pack.Open(packPath)) return result;
+
+	for (const std::string& file : textures)
+	{
+		const AssetPackEntry* entry = pack.Find(("Assets/Textures/" + file).c_str());
+		if (entry == nullptr) continue;
+		result.checksum ^= staging.CopyTexture(pack.GetData(*entry), entry->width, entry->height, entry->rowPitch) + result.textures;
+		result.copiedBytes += (uint64_t)entry->width * entry->height * 4;
+		result.textures++;
+	}
+	for (const std::string& file : sounds)
+	{
+		const AssetPackEntry* entry = pack.Find(("Assets/Sounds/" + file).c_str());
+		if (entry == nullptr) continue;
+		result.checksum ^= staging.CopySound(pack.GetData(*entry), (size_t)entry->dataSize) + result.sounds;
+		result.copiedBytes += entry->dataSize;
+		result.sounds++;
+	}
+
+	result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	return result;
+}
+
+// 팩 본문이 원본을 푼 결과와 전부 같은지
+static bool CheckContents(const AssetPack& pack, const std::string& assetsRoot)
+{
+	for (const std::string& file : ListAssetFiles(assetsRoot + "/Textures", ".png"))
+	{
+		int width = 0, height = 0, channels = 0;
+		unsigned char* pixels = stbi_load((assetsRoot + "/Textures/" + file).c_str(), &width, &height, &channels, STBI_rgb_alpha);
+		const AssetPackEntry* entry = pack.Find(("Assets/Textures/" + file).c_str());
+		bool same = pixels != nullptr && entry != nullptr && entry->type == ASSET_TEXTURE &&
+			entry->width == (uint32_t)width && entry->height == (uint32_t)height && entry->rowPitch % ASSET_PACK_PITCH_ALIGNMENT == 0;
+		for (int y = 0; same && y < height; y++)
+		{
+			same = memcmp(pack.GetData(*entry) + (size_t)y * entry->rowPitch, pixels + (size_t)y * width * 4, (size_t)width * 4) == 0;
+		}
+		if (pixels != nullptr) stbi_image_free(pixels);
+		if (!same)
+		{
+			printf("texture mismatch : %s\n", file.c_str());
+			return false;
+		}
+	}
+
+	std::vector<uint8_t> bytes;
+	for (const std::string& file : ListAssetFiles(assetsRoot + "/Sounds", ".wav"))
+	{
+		WavInfo wav;
+		const AssetPackEntry* entry = pack.Find(("Assets/Sounds/" + file).c_str());
+		bool same = ReadWholeFile((assetsRoot + "/Sounds/" + file).c_str(), bytes) && ParseWav(bytes, wav) && entry != nullptr &&
+			entry->type == ASSET_SOUND && entry->dataSize == wav.dataSize && entry->channels == wav.channels &&
+			entry->samplesPerSec == wav.samplesPerSec && entry->bitsPerSample == wav.bitsPerSample &&
+			memcmp(pack.GetData(*entry), bytes.data() + wav.dataOffset, wav.dataSize) == 0;
+		if (!same)
+		{
+			printf("sound mismatch : %s\n", file.c_str());
+			return false;
+		}
+	}
+
+	for (int i = 0; i < pack.GetEntryCount(); i++)
+	{
+		if ((uintptr_t)pack.GetData(pack.GetEntry(i)) % ASSET_PACK_DATA_ALIGNMENT != 0) return false;
+	}
+	return true;
+}
+
+// 게임 코드가 쓰는 여러 모양의 경로로 찾기
+static bool CheckLookup(const AssetPack& pack)
+{
+	return pack.Find("Assets/Textures/gem.png") != nullptr &&
+		pack.Find("assets\\textures\\GEM.png") == pack.Find("Assets/Textures/gem.png") &&
+		pack.Find("./Assets/Sounds/../Sounds/click.wav") != nullptr &&
+		pack.Find("Assets/Textures/none.png") == nullptr &&
+		pack.Find("") == nullptr;
+}
+
+// 잘리거나 깨진 팩은 열리지 않아야 함
+static bool CheckRejects(const char* packPath, const std::string& scratchPath)
+{
+	std::vector<uint8_t> bytes;
+	if (!ReadWholeFile(packPath, bytes) || bytes.size() < sizeof(AssetPackHeader)) return false;
+
+	auto opens = [&](const std::vector<uint8_t>& data)
+	{
+		FILE* file = fopen(scratchPath.c_str(), "wb");
+		if (file == nullptr) return true;
+		fwrite(data.data(), 1, data.size(), file);
+		fclose(file);
+		AssetPack pack;
+		return pack.Open(scratchPath.c_str());
+	};
+
+	bool ok = opens(bytes);		// 그대로는 열려야 함
+
+	std::vector<uint8_t> truncated(bytes.begin(), bytes.begin() + bytes.size() / 2);
+	ok = ok && !opens(truncated);
+
+	std::vector<uint8_t> badMagic = bytes;
+	badMagic[0] ^= 0xFF;
+	ok = ok && !opens(badMagic);
+
+	std::vector<uint8_t> badEntry = bytes;
+	AssetPackEntry* first = (AssetPackEntry*)&badEntry[sizeof(AssetPackHeader)];
+	first->dataOffset = bytes.size();	// 본문이 파일 밖
+	ok = ok && !opens(badEntry);
+
+	std::vector<uint8_t> headerOnly(bytes.begin(), bytes.begin() + 16);
+	ok = ok && !opens(headerOnly);
+
+	remove(scratchPath.c_str());
+	return ok;
+}
+
+int main(int argc, char** argv)
+{
+	// 에셋 폴더 : 첫 인자, 없으면 이 파일 기준 ../Assets
+	std::string assetsRoot;
+	if (argc > 1)
+	{
+		assetsRoot = argv[1];
+		while (assetsRoot.size() > 1 && (assetsRoot.back() == '/' || assetsRoot.back() == '\\')) assetsRoot.pop_back();
+	}
+	else
+	{
+		std::string self = __FILE__;
+		size_t slash = self.find_last_of("/\\");
+		assetsRoot = (slash == std::string::npos ? std::string(".") : self.substr(0, slash)) + "/../Assets";
+	}
+
+	const char* tempDir = getenv("TMPDIR");
+	std::string packPath = std::string(tempDir != nullptr ? tempDir : "/tmp") + "/AssetPackBench.pack";
+
+	// 블록 압축 / 아틀라스 / 팔레트 / 밉은 BlockCompressBench / SpriteAtlasBench / PaletteMipBench에서 따로 보고,
+	// 여기서는 원본과 바이트 단위로 비교할 수 있게 전부 원래 배치의 RGBA8 한 단계
+	AssetPackOptions options;
+	options.compress = false;
+	options.atlas = false;
+	options.palette = false;
+	options.mips = false;
+
+	AssetPackStats stats;
+	auto packStart = std::chrono::steady_clock::now();
+	if (!BuildAssetPack(assetsRoot, packPath.c_str(), stats, options) || stats.textures == 0)
+	{
+		printf("cannot build pack from %s\n", assetsRoot.c_str());
+		return 1;
+	}
+	double packMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - packStart).count();
+
+	UploadStaging staging;
+	LoadResult loose, packed;
+	for (int r = 0; r < kRepeats; r++)
+	{
+		LoadResult a = LoadLooseFiles(assetsRoot, staging);
+		LoadResult b = LoadPack(packPath.c_str(), assetsRoot, staging);
+		if (r == 1 || (r > 1 && a.ms < loose.ms)) loose = a;	// 0번째는 캐시 데우기
+		if (r == 1 || (r > 1 && b.ms < packed.ms)) packed = b;
+	}
+
+	AssetPack pack;
+	bool openOk = pack.Open(packPath.c_str());
+	bool contentOk = openOk && CheckContents(pack, assetsRoot);
+	bool lookupOk = openOk && CheckLookup(pack);
+	pack.Close();
+	bool rejectOk = CheckRejects(packPath.c_str(), packPath + ".scratch");
+	bool loadOk = loose.textures == packed.textures && loose.sounds == packed.sounds && loose.checksum == packed.checksum;
+	remove(packPath.c_str());
+
+	printf("assets from %s : %d textures, %d sounds (skipped %d)\n", assetsRoot.c_str(), stats.textures, stats.sounds, (int)stats.failed.size());
+	printf("pack %.1f MB from %.1f MB of PNG / WAV, built in %.0f ms\n\n", stats.packBytes / (1024.0 * 1024.0),
+		stats.sourceBytes / (1024.0 * 1024.0), packMs);
+	printf("%-16s %12s %14s %10s\n", "mode", "load ms", "uploaded MB", "speedup");
+	printf("%-16s %12.1f %14.1f %10.2f\n", "png + wav", loose.ms, loose.copiedBytes / (1024.0 * 1024.0), 1.0);
+	printf("%-16s %12.1f %14.1f %10.2f\n", "mapped pack", packed.ms, packed.copiedBytes / (1024.0 * 1024.0), loose.ms / packed.ms);
+	printf("\ncontents %s, lookup %s, rejects %s, load %s\n", contentOk ? "ok" : "FAIL", lookupOk ? "ok" : "FAIL",
+		rejectOk ? "ok" : "FAIL", loadOk ? "ok" : "FAIL");
+
+	return contentOk && lookupOk && rejectOk && loadOk ? 0 : 1;
+}
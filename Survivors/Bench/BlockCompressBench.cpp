@@ -0,0 +1,183 @@
+﻿// 블록 압축기 (BlockCompress) 벤치마크
+// 보스 / 적 / 플레이어 스프라이트 시트를 AssetPacker와 똑같이 프레임 칸으로 다시 배치한 뒤 BC7 / BC3로 압축해서
+// 원본 RGBA와의 PSNR, VRAM, 스레드 하나에서의 압축 속도 (SSE2 / 스칼라)를 비교
+// SSE2와 스칼라 결과가 바이트 단위로 같은지, 프레임 칸이 4픽셀 배수라 블록이 두 프레임에 걸치지 않는지,
+// 모든 프레임의 그림이 칸 안에 그대로 옮겨졌는지, 한 색 블록이 채널마다 1 이내로 왕복되는지도 검사
+// 빌드 : g++ -O2 -std=c++14 -pthread Bench/BlockCompressBench.cpp -o BlockCompressBench (Survivors 폴더에서 실행하거나 첫 인자로 텍스처 폴더)
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <chrono>
+#include <vector>
+#define STB_IMAGE_IMPLEMENTATION
+#include "../Source/Utils/AssetPackBuilder.h"
+
+struct Sheet
+{
+	const char* file;
+	int frames;
+};
+
+// 요청의 대상 : VRAM을 가장 많이 먹는 큰 시트들 (프레임 폭이 정수가 아닌 Enemy4 포함)
+static const Sheet SHEETS[] =
+{
+	{ "Boss1.png", 20 },
+	{ "Enemy1.png", 20 },
+	{ "Enemy4.png", 30 },
+	{ "player_sheet.png", 30 },
+	{ "weapon_bullet_hit.png", 30 },
+};
+
+static const double kMinPsnrBc7 = 38.0;
+static const double kMinPsnrBc3 = 30.0;
+static const int kSpeedWidth = 2048;	// 속도는 시트 앞쪽 이만큼 폭으로만 잼 (스칼라가 느려서)
+
+static double Seconds(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 칸 배치가 원래 프레임을 그대로 옮겼는지 (정수 폭 프레임은 픽셀 단위로 같아야 함)
+static bool CheckLayout(const uint8_t* rgba, int width, int height, int frames, const std::vector<uint8_t>& cells, int cellsWidth, int cellsHeight)
+{
+	int cellWidth = cellsWidth / frames;
+	if (cellWidth % 4 != 0 || cellsHeight % 4 != 0 || cellsHeight < height) return false;
+	if (width % frames != 0) return true;	// 소수 폭은 칸마다 올림한 폭을 가져오므로 픽셀 비교는 생략
+
+	int frameWidth = width / frames;
+	for (int frame = 0; frame < frames; frame++)
+	{
+		for (int y = 0; y < height; y++)
+		{
+			const uint8_t* src = rgba + ((size_t)y * width + (size_t)frame * frameWidth) * 4;
+			const uint8_t* dst = &cells[((size_t)y * cellsWidth + (size_t)frame * cellWidth) * 4];
+			if (memcmp(src, dst, (size_t)frameWidth * 4) != 0) return false;
+		}
+	}
+	return true;
+}
+
+// 한 색 블록은 채널마다 1 이내로 되돌아와야 함 (모드 6의 p비트는 끝점의 네 채널이 같이 써서 홀짝이 섞인 색은 1 차이가 날 수 있음)
+static bool CheckSolidBlocks()
+{
+	const uint8_t colors[][4] = { { 0, 0, 0, 0 }, { 255, 255, 255, 255 }, { 17, 130, 201, 77 }, { 254, 1, 128, 255 } };
+	for (const auto& color : colors)
+	{
+		uint8_t rgba[64];
+		for (int i = 0; i < 16; i++) memcpy(rgba + i * 4, color, 4);
+		BlockTexels texels;
+		LoadBlock(rgba, 16, texels);
+
+		uint8_t block[16], decoded[64];
+		EncodeBc7Block(texels, block, true);
+		if (!DecodeBc7Block(block, decoded)) return false;
+		for (int i = 0; i < 64; i++)
+		{
+			if (decoded[i] - rgba[i] > 1 || rgba[i] - decoded[i] > 1) return false;
+		}
+	}
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	// 텍스처 폴더 : 첫 인자, 없으면 이 파일 기준 ../Assets/Textures/
+	std::string root;
+	if (argc > 1)
+	{
+		root = argv[1];
+		if (!root.empty() && root.back() != '/' && root.back() != '\\') root += '/';
+	}
+	else
+	{
+		std::string self = __FILE__;
+		size_t slash = self.find_last_of("/\\");
+		root = (slash == std::string::npos ? std::string(".") : self.substr(0, slash)) + "/../Assets/Textures/";
+	}
+
+	bool ok = CheckSolidBlocks();
+	if (!ok) printf("solid block round trip FAIL\n");
+
+	printf("%-22s %12s %7s %9s %9s %10s %10s\n", "sheet", "size", "frames", "BC7 dB", "BC3 dB", "RGBA MB", "BC MB");
+
+	double scalarSeconds[2] = {}, simdSeconds[2] = {};
+	double speedPixels = 0.0;
+	uint64_t rgbaBytes = 0, blockBytes = 0;
+	int loaded = 0;
+	for (const Sheet& sheet : SHEETS)
+	{
+		int width = 0, height = 0, channels = 0;
+		unsigned char* pixels = stbi_load((root + sheet.file).c_str(), &width, &height, &channels, STBI_rgb_alpha);
+		if (pixels == nullptr)
+		{
+			printf("%-22s missing\n", sheet.file);
+			ok = false;
+			continue;
+		}
+		loaded++;
+
+		std::vector<uint8_t> cells;
+		int cellsWidth = 0, cellsHeight = 0;
+		float uvScale[2];
+		LayoutFrameCells(pixels, width, height, sheet.frames, cells, cellsWidth, cellsHeight, uvScale);
+		bool layoutOk = CheckLayout(pixels, width, height, sheet.frames, cells, cellsWidth, cellsHeight);
+		ok = ok && layoutOk;
+
+		size_t blockPitch = (size_t)cellsWidth / 4 * BLOCK_BYTES;
+		std::vector<uint8_t> blocks(blockPitch * (cellsHeight / 4));
+		std::vector<uint8_t> decoded(cells.size());
+		double psnr[2];
+		for (int f = 0; f < 2; f++)
+		{
+			BlockFormat format = f == 0 ? BLOCK_BC7 : BLOCK_BC3;
+			CompressImage(cells.data(), cellsWidth, cellsHeight, cellsWidth * 4, format, blocks.data(), blockPitch, true);
+			DecompressImage(blocks.data(), blockPitch, cellsWidth, cellsHeight, format, decoded.data(), cellsWidth * 4);
+			psnr[f] = ComputePsnr(cells.data(), decoded.data(), cellsWidth, cellsHeight, cellsWidth * 4);
+
+			// 속도 / SIMD 일치 : 앞쪽 kSpeedWidth 폭만
+			int speedWidth = (std::min)(kSpeedWidth, cellsWidth) & ~3;
+			size_t speedPitch = (size_t)speedWidth / 4 * BLOCK_BYTES;
+			std::vector<uint8_t> simdBlocks(speedPitch * (cellsHeight / 4)), scalarBlocks(simdBlocks.size());
+
+			auto start = std::chrono::steady_clock::now();
+			CompressImage(cells.data(), speedWidth, cellsHeight, cellsWidth * 4, format, simdBlocks.data(), speedPitch, true);
+			simdSeconds[f] += Seconds(start);
+
+			start = std::chrono::steady_clock::now();
+			CompressImage(cells.data(), speedWidth, cellsHeight, cellsWidth * 4, format, scalarBlocks.data(), speedPitch, false);
+			scalarSeconds[f] += Seconds(start);
+
+			if (simdBlocks != scalarBlocks)
+			{
+				printf("%s : SSE2 and scalar %s output differ\n", sheet.file, f == 0 ? "BC7" : "BC3");
+				ok = false;
+			}
+			if (f == 0) speedPixels += (double)speedWidth * cellsHeight;
+		}
+		ok = ok && psnr[0] >= kMinPsnrBc7 && psnr[1] >= kMinPsnrBc3;
+
+		rgbaBytes += (uint64_t)width * height * 4;
+		blockBytes += (uint64_t)cellsWidth * cellsHeight;
+		char size[32];
+		snprintf(size, sizeof(size), "%dx%d", width, height);
+		printf("%-22s %12s %7d %9.1f %9.1f %10.1f %10.1f%s\n", sheet.file, size, sheet.frames, psnr[0], psnr[1],
+			width * height * 4 / (1024.0 * 1024.0), cellsWidth * cellsHeight / (1024.0 * 1024.0), layoutOk ? "" : "  layout FAIL");
+		stbi_image_free(pixels);
+	}
+
+	printf("\nVRAM %.1f MB -> %.1f MB\n", rgbaBytes / (1024.0 * 1024.0), blockBytes / (1024.0 * 1024.0));
+#ifdef BLOCK_COMPRESS_SSE2
+	const char* simdName = "SSE2";
+#else
+	const char* simdName = "SIMD (off)";
+#endif
+	printf("\n%-8s %16s %16s %10s\n", "format", "scalar Mpix/s", "SSE2 Mpix/s", "speedup");
+	for (int f = 0; f < 2; f++)
+	{
+		printf("%-8s %16.2f %16.2f %10.2f\n", f == 0 ? "BC7" : "BC3", speedPixels / scalarSeconds[f] / 1e6, speedPixels / simdSeconds[f] / 1e6,
+			scalarSeconds[f] / simdSeconds[f]);
+	}
+	printf("\n%s path %s, min PSNR BC7 %.0f dB / BC3 %.0f dB, result %s\n", simdName, loaded > 0 ? "measured" : "skipped",
+		kMinPsnrBc7, kMinPsnrBc3, ok ? "ok" : "FAIL");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+﻿// 서술자 힙 칸 번호 할당기 (DescriptorAllocator) 헤드리스 벤치마크
+// 텍스처를 무작위로 올렸다 내렸다 하면서 번호가 겹치지 않는지, 고정 칸 (0번 : 텍스처 없음)은 안 나가는지,
+// 반납한 번호를 최근 것부터 다시 주는지, 꽉 차면 -1, 잘못된 / 두 번 반납은 거절하는지 검사하고 할당 + 반납 속도를 잼
+// 빌드 : g++ -O2 -std=c++14 Bench/DescriptorAllocatorBench.cpp -o DescriptorAllocatorBench
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <vector>
+#include "../Source/Render/DescriptorAllocator.h"
+
+static bool CheckBasics()
+{
+	DescriptorAllocator allocator;
+	allocator.Initialize(8, 1);
+
+	bool ok = true;
+	for (int i = 1; i < 8; i++) ok = ok && allocator.Allocate() == i;	// 0번은 건너뛰고 앞에서부터
+	ok = ok && allocator.Allocate() == -1;							// 꽉 참
+	ok = ok && allocator.GetUsedCount() == 7;
+
+	ok = ok && !allocator.Free(0);		// 고정 칸
+	ok = ok && !allocator.Free(8);		// 범위 밖
+	ok = ok && allocator.Free(3) && allocator.Free(5);
+	ok = ok && !allocator.Free(5);		// 두 번 반납
+	ok = ok && allocator.Allocate() == 5 && allocator.Allocate() == 3;	// 최근에 반납한 것부터
+	ok = ok && allocator.GetUsedCount() == 7 && allocator.GetPeakCount() == 7;
+	ok = ok && !allocator.IsAllocated(0) && allocator.IsAllocated(3);
+	return ok;
+}
+
+// 텍스처가 무작위로 들어오고 나가는 상황 (살아있는 번호끼리 겹치면 안 되고, 사용 수는 항상 정확해야 함)
+static bool CheckChurn(int capacity, int steps, unsigned int seed)
+{
+	srand(seed);
+	DescriptorAllocator allocator;
+	allocator.Initialize(capacity, 1);
+
+	std::vector<int> live;
+	std::vector<int> owner(capacity, 0);	// 칸마다 지금 쓰는 텍스처 수 (0 또는 1이어야 함)
+	for (int step = 0; step < steps; step++)
+	{
+		bool load = live.empty() || rand() % 100 < 55;
+		if (load)
+		{
+			int index = allocator.Allocate();
+			if (index < 0)
+			{
+				if ((int)live.size() != capacity - 1) return false;	// 빈 칸이 있는데 실패하면 안 됨
+				continue;
+			}
+			if (index < 1 || index >= capacity || owner[index] != 0) return false;
+			owner[index] = 1;
+			live.push_back(index);
+		}
+		else
+		{
+			int pick = rand() % (int)live.size();
+			int index = live[pick];
+			live[pick] = live.back();
+			live.pop_back();
+			if (!allocator.Free(index)) return false;
+			owner[index] = 0;
+		}
+		if (allocator.GetUsedCount() != (int)live.size()) return false;
+	}
+	return true;
+}
+
+// 텍스처 하나 로드 + 언로드를 반복하는 속도
+static double MeasureNsPerPair(int capacity, int live, int repeats)
+{
+	DescriptorAllocator allocator;
+	allocator.Initialize(capacity, 1);
+	std::vector<int> ring(live);
+	for (int i = 0; i < live; i++) ring[i] = allocator.Allocate();
+
+	using Clock = std::chrono::steady_clock;
+	long long checksum = 0;
+	auto start = Clock::now();
+	for (int r = 0; r < repeats; r++)
+	{
+		int slot = r % live;
+		allocator.Free(ring[slot]);
+		ring[slot] = allocator.Allocate();
+		checksum += ring[slot];
+	}
+	double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / repeats;
+	if (checksum == 1) printf(" ");	// 최적화로 통째로 지워지지 않게
+	return ns;
+}
+
+int main()
+{
+	bool basicsOk = CheckBasics();
+	bool churnSmallOk = CheckChurn(64, 200000, 1);
+	bool churnLargeOk = CheckChurn(1024, 200000, 2);
+	bool allOk = basicsOk && churnSmallOk && churnLargeOk;
+
+	printf("%-34s %s\n", "basics (reserved / full / free)", basicsOk ? "ok" : "FAIL");
+	printf("%-34s %s\n", "churn 64 slots", churnSmallOk ? "ok" : "FAIL");
+	printf("%-34s %s\n", "churn 1024 slots", churnLargeOk ? "ok" : "FAIL");
+	printf("%-34s %.2f ns\n", "free + allocate (1024, 900 live)", MeasureNsPerPair(1024, 900, 10000000));
+
+	return allOk ? 0 : 1;
+}
@@ -0,0 +1,283 @@
+﻿// 적 데이터 배치 (AoS vs SoA) 헤드리스 벤치마크
+// 기존 Enemy : GameObject 객체 배열과 EnemyPool의 배열 배치로 이동 / 데미지 / 밀어내기 패스를 돌려 비교
+// 빌드 : g++ -O2 -std=c++14 Bench/EnemyPoolBench.cpp -o EnemyPoolBench
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+#include <chrono>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include "../Source/Utils/SpatialGrid.h"
+#include "../Source/Objects/EnemyPool.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+// 기존 Enemy 객체의 메모리 배치를 그대로 흉내낸 구조체 (vtable, ComPtr 3개, 상수 버퍼 포인터, 애니메이션/UV 상태 포함)
+struct LegacyEnemy
+{
+	void* vtable;
+	float position[3];
+	float scale[3];
+	void* constantBuffer;
+	uint8_t* cbvDataBegin;
+	void* texture;
+	void* textureUploadHeap;
+	void* srvHeap;
+	int currentFrame, maxFrames;
+	float frameTime, frameDuration;
+	bool isFlipped;
+	float tintColor[4];
+	int objectType;
+	float cameraPos[2], uvScroll[2], uvScale[2];
+	float speed, maxHp, hp;
+	bool isDead;
+	int enemyType;
+};
+
+// 하드웨어 캐시 미스 카운터 (리눅스에서 권한이 있을 때만 동작, 없으면 -1)
+class CacheMissCounter
+{
+	int fd = -1;
+public:
+	CacheMissCounter()
+	{
+#if defined(__linux__)
+		perf_event_attr attr;
+		memset(&attr, 0, sizeof(attr));
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.size = sizeof(attr);
+		attr.config = PERF_COUNT_HW_CACHE_MISSES;
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+	}
+	~CacheMissCounter()
+	{
+#if defined(__linux__)
+		if (fd >= 0) close(fd);
+#endif
+	}
+	void Reset()
+	{
+#if defined(__linux__)
+		if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+#endif
+	}
+	// Resume / Pause 사이만 누적 (상태 복원 구간은 빼고 셈)
+	void Resume()
+	{
+#if defined(__linux__)
+		if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+	}
+	void Pause()
+	{
+#if defined(__linux__)
+		if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+	}
+	long long Read()
+	{
+#if defined(__linux__)
+		if (fd < 0) return -1;
+		long long value = 0;
+		if (read(fd, &value, sizeof(value)) != sizeof(value)) return -1;
+		return value;
+#else
+		return -1;
+#endif
+	}
+};
+
+// 한 패스가 건드리는 서로 다른 64바이트 캐시 라인 수 (하드웨어 카운터가 없어도 비교 가능한 지표)
+static size_t CountLines(const std::vector<const void*>& addresses)
+{
+	std::set<uintptr_t> lines;
+	for (const void* p : addresses) lines.insert((uintptr_t)p / 64);
+	return lines.size();
+}
+
+static const float kDt = 1.0f / 60.0f;
+static const float kMinDistance = 0.2f;
+static const float kAuraRadius = 0.5f;
+
+// AoS 패스 (기존 Update 루프와 같은 접근 패턴)
+static void LegacyMove(std::vector<LegacyEnemy>& enemies, float tx, float ty)
+{
+	for (LegacyEnemy& e : enemies)
+	{
+		if (e.isDead) continue;
+		float dx = tx - e.position[0], dy = ty - e.position[1];
+		float d = std::sqrt(dx * dx + dy * dy);
+		if (d > 0.0f) { e.position[0] += dx / d * e.speed * kDt; e.position[1] += dy / d * e.speed * kDt; }
+	}
+}
+
+static void LegacyAura(std::vector<LegacyEnemy>& enemies, float px, float py)
+{
+	for (LegacyEnemy& e : enemies)
+	{
+		if (e.isDead) continue;
+		float dx = e.position[0] - px, dy = e.position[1] - py;
+		if (std::sqrt(dx * dx + dy * dy) < kAuraRadius)
+		{
+			e.hp -= 15.0f * kDt;
+			if (e.hp <= 0.0f) { e.hp = e.maxHp; }	// 벤치가 계속 같은 부하를 유지하도록 즉시 부활
+		}
+	}
+}
+
+// 객체 배열은 격자에 넣기 전에 위치를 모으고, 끝나면 다시 흩어서 써야 함
+static void LegacySeparation(std::vector<LegacyEnemy>& enemies, SpatialGrid& grid, std::vector<float>& xs, std::vector<float>& ys, std::vector<uint8_t>& alive)
+{
+	int n = (int)enemies.size();
+	for (int i = 0; i < n; i++) { xs[i] = enemies[i].position[0]; ys[i] = enemies[i].position[1]; alive[i] = enemies[i].isDead ? 0 : 1; }
+	SolveSeparation(grid, xs.data(), ys.data(), alive.data(), n, kMinDistance, 0.5f * kDt);
+	for (int i = 0; i < n; i++) { if (alive[i]) { enemies[i].position[0] = xs[i]; enemies[i].position[1] = ys[i]; } }
+}
+
+// SoA 패스 (EnemyPool 배열을 그대로 사용)
+static void PoolAura(EnemyPool& pool, float px, float py)
+{
+	for (int i = 0; i < pool.GetCapacity(); i++)
+	{
+		if (!pool.alive[i]) continue;
+		float dx = pool.x[i] - px, dy = pool.y[i] - py;
+		if (std::sqrt(dx * dx + dy * dy) < kAuraRadius)
+		{
+			if (pool.ApplyDamage(i, 15.0f * kDt)) { pool.hp[i] = pool.maxHp[i]; pool.alive[i] = 1; }
+		}
+	}
+}
+
+// 패스가 위치 / 체력을 바꾸므로 매번 reset으로 같은 시작 상태를 되돌린 뒤 fn만 잼
+// AoS / SoA가 같은 횟수, 같은 배치에서 돌도록 반복 횟수는 호출하는 쪽이 정해서 넘김
+template<typename Reset, typename Fn>
+static void Measure(int iterations, Reset&& reset, Fn&& fn, double& outMs, long long& outMisses)
+{
+	using Clock = std::chrono::high_resolution_clock;
+	CacheMissCounter counter;
+	double elapsed = 0.0;
+
+	reset();
+	fn();	// 워밍업
+	counter.Reset();
+	for (int i = 0; i < iterations; i++)
+	{
+		reset();
+		counter.Resume();
+		auto start = Clock::now();
+		fn();
+		auto end = Clock::now();
+		counter.Pause();
+		elapsed += std::chrono::duration<double, std::milli>(end - start).count();
+	}
+	long long misses = counter.Read();
+
+	outMs = elapsed / iterations;
+	outMisses = misses < 0 ? -1 : misses / iterations;
+}
+
+int main()
+{
+	const int counts[] = { 60, 1000, 5000, 20000, 100000 };
+
+	printf("fixed start state restored before every timed call, %d..%d iterations per pass\n", (std::max)(10, 2000000 / counts[4]), 2000000 / counts[0]);
+	printf("sizeof(LegacyEnemy) = %zu bytes, EnemyPool hot bytes/enemy = %zu\n\n",
+		sizeof(LegacyEnemy), sizeof(float) * 4 + sizeof(uint8_t));
+	printf("%8s %-11s %11s %11s %8s %12s %12s %12s %12s\n",
+		"enemies", "pass", "AoS ms", "SoA ms", "speedup", "AoS lines", "SoA lines", "AoS misses", "SoA misses");
+
+	for (int count : counts)
+	{
+		// 플레이어 주변 원판에 흩뿌리기 (두 배치 모두 같은 좌표)
+		std::vector<LegacyEnemy> legacy(count);
+		EnemyPool pool;
+		pool.Initialize(count);
+		float radius = std::sqrt(count * kMinDistance * kMinDistance / 3.14159265f);
+		srand(42);
+
+		for (int i = 0; i < count; i++)
+		{
+			float a = (rand() / (float)RAND_MAX) * 6.2831853f;
+			float r = std::sqrt(rand() / (float)RAND_MAX) * radius;
+			pool.type[i] = i % 3;
+			pool.Spawn(i, std::cos(a) * r, std::sin(a) * r, 0.0f);
+
+			LegacyEnemy& e = legacy[i];
+			e.position[0] = pool.x[i]; e.position[1] = pool.y[i];
+			e.speed = pool.speed[i]; e.hp = pool.hp[i]; e.maxHp = pool.maxHp[i];
+			e.isDead = false;
+		}
+
+		// 측정마다 되돌릴 시작 상태 (EnemyPool 패스가 바꾸는 건 x / y / hp / alive 뿐)
+		const std::vector<LegacyEnemy> legacyStart = legacy;
+		const std::vector<float> startX(pool.x, pool.x + count), startY(pool.y, pool.y + count), startHp(pool.hp, pool.hp + count);
+		const std::vector<uint8_t> startAlive(pool.alive, pool.alive + count);
+		auto resetLegacy = [&]() { std::copy(legacyStart.begin(), legacyStart.end(), legacy.begin()); };
+		auto resetPool = [&]()
+		{
+			std::copy(startX.begin(), startX.end(), pool.x);
+			std::copy(startY.begin(), startY.end(), pool.y);
+			std::copy(startHp.begin(), startHp.end(), pool.hp);
+			std::copy(startAlive.begin(), startAlive.end(), pool.alive);
+		};
+		const int iterations = (std::max)(10, 2000000 / count);
+
+		// 패스별로 읽는 필드 주소를 모아서 캐시 라인 수 계산
+		std::vector<const void*> aosMove, soaMove, aosAura, soaAura, aosSep, soaSep;
+		for (int i = 0; i < count; i++)
+		{
+			aosMove.push_back(&legacy[i].isDead); aosMove.push_back(&legacy[i].position[0]); aosMove.push_back(&legacy[i].position[1]); aosMove.push_back(&legacy[i].speed);
+			soaMove.push_back(&pool.alive[i]); soaMove.push_back(&pool.x[i]); soaMove.push_back(&pool.y[i]); soaMove.push_back(&pool.speed[i]);
+			aosAura.push_back(&legacy[i].isDead); aosAura.push_back(&legacy[i].position[0]); aosAura.push_back(&legacy[i].hp);
+			soaAura.push_back(&pool.alive[i]); soaAura.push_back(&pool.x[i]); soaAura.push_back(&pool.y[i]); soaAura.push_back(&pool.hp[i]);
+		}
+
+		SpatialGrid grid;
+		std::vector<float> xs(count), ys(count);
+		std::vector<uint8_t> alive(count);
+
+		// 밀어내기는 AoS만 객체에서 모으고 흩는 단계가 더 있음 (격자 / 풀이 단계는 둘 다 같은 배열을 씀)
+		for (int i = 0; i < count; i++)
+		{
+			aosSep.push_back(&legacy[i].isDead); aosSep.push_back(&legacy[i].position[0]); aosSep.push_back(&legacy[i].position[1]);
+			aosSep.push_back(&xs[i]); aosSep.push_back(&ys[i]); aosSep.push_back(&alive[i]);
+			soaSep.push_back(&pool.alive[i]); soaSep.push_back(&pool.x[i]); soaSep.push_back(&pool.y[i]);
+		}
+
+		struct Row { const char* name; size_t aosLines, soaLines; double aosMs, soaMs; long long aosMiss, soaMiss; };
+		Row rows[3] =
+		{
+			{ "move", CountLines(aosMove), CountLines(soaMove), 0.0, 0.0, 0, 0 },
+			{ "aura", CountLines(aosAura), CountLines(soaAura), 0.0, 0.0, 0, 0 },
+			{ "separation", CountLines(aosSep), CountLines(soaSep), 0.0, 0.0, 0, 0 },
+		};
+
+		Measure(iterations, resetLegacy, [&]() { LegacyMove(legacy, 0.0f, 0.0f); }, rows[0].aosMs, rows[0].aosMiss);
+		Measure(iterations, resetPool, [&]() { pool.MoveTowards(0.0f, 0.0f, kDt); }, rows[0].soaMs, rows[0].soaMiss);
+		Measure(iterations, resetLegacy, [&]() { LegacyAura(legacy, 0.0f, 0.0f); }, rows[1].aosMs, rows[1].aosMiss);
+		Measure(iterations, resetPool, [&]() { PoolAura(pool, 0.0f, 0.0f); }, rows[1].soaMs, rows[1].soaMiss);
+		Measure(iterations, resetLegacy, [&]() { LegacySeparation(legacy, grid, xs, ys, alive); }, rows[2].aosMs, rows[2].aosMiss);
+		Measure(iterations, resetPool, [&]() { SolveSeparation(grid, pool.x, pool.y, pool.alive, count, kMinDistance, 0.5f * kDt); }, rows[2].soaMs, rows[2].soaMiss);
+
+		for (const Row& r : rows)
+		{
+			printf("%8d %-11s %11.5f %11.5f %7.2fx %12zu %12zu %12lld %12lld\n",
+				count, r.name, r.aosMs, r.soaMs, r.aosMs / r.soaMs, r.aosLines, r.soaLines, r.aosMiss, r.soaMiss);
+		}
+	}
+
+	printf("\n(misses = -1 : perf_event_open 권한이 없어 하드웨어 카운터를 읽지 못함)\n");
+	return 0;
+}
@@ -0,0 +1,110 @@
+﻿// 고정 간격 시뮬레이션 (FixedTimestep) 헤드리스 검증
+// 같은 적 무리를 여러 화면 주사율 (30 / 60 / 144 / 240Hz)로 10초 동안 돌렸을 때
+// 프레임 시간을 그대로 dt로 쓰는 기존 방식은 결과가 주사율마다 달라지고, 고정 틱은 항상 똑같이 나오는지 비교
+// 빌드 : g++ -O2 -std=c++14 Bench/FixedTimestepBench.cpp -o FixedTimestepBench
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include "../Source/Utils/SpatialGrid.h"
+#include "../Source/Utils/FixedTimestep.h"
+#include "../Source/Objects/EnemyPool.h"
+
+static const int kEnemies = 2000;
+static const int kTicks = 600;			// 60Hz로 10초
+
+static void Spawn(EnemyPool& pool)
+{
+	pool.Initialize(kEnemies);
+	srand(5);
+	for (int i = 0; i < kEnemies; i++)
+	{
+		pool.type[i] = i % 3;
+		pool.Spawn(i, (rand() / (float)RAND_MAX) * 8.0f - 4.0f, (rand() / (float)RAND_MAX) * 8.0f - 4.0f, 0.0f);
+	}
+}
+
+// 게임의 적 처리 한 번 (돌격 + 밀어내기)
+static void Step(EnemyPool& pool, SpatialGrid& grid, float dt)
+{
+	pool.MoveTowards(0.0f, 0.0f, dt);
+	SolveSeparation(grid, pool.x, pool.y, pool.alive, kEnemies, 0.2f, 0.5f * dt);
+}
+
+// 기준 결과와 위치 차이의 최대값
+static float MaxDiff(const EnemyPool& a, const EnemyPool& b)
+{
+	float worst = 0.0f;
+	for (int i = 0; i < kEnemies; i++)
+	{
+		worst = std::fmax(worst, std::fabs(a.x[i] - b.x[i]));
+		worst = std::fmax(worst, std::fabs(a.y[i] - b.y[i]));
+	}
+	return worst;
+}
+
+int main()
+{
+	// 기준 : 60Hz 고정 틱 600번
+	EnemyPool reference;
+	SpatialGrid grid;
+	Spawn(reference);
+	for (int t = 0; t < kTicks; t++) Step(reference, grid, 1.0f / 60.0f);
+
+	const double refreshRates[] = { 30.0, 60.0, 144.0, 240.0 };
+	bool ok = true;
+
+	printf("%10s %22s %22s\n", "refresh", "variable dt max diff", "fixed tick max diff");
+
+	for (double hz : refreshRates)
+	{
+		// 기존 방식 : 프레임마다 프레임 시간을 그대로 dt로 사용
+		EnemyPool variable;
+		Spawn(variable);
+		int frames = (int)std::lround(hz * kTicks / 60.0);
+		for (int f = 0; f < frames; f++) Step(variable, grid, (float)(1.0 / hz));
+
+		// 고정 틱 : 프레임 시간을 누적해서 1/60초마다 한 틱
+		EnemyPool fixed;
+		Spawn(fixed);
+		FixedTimestep clock;
+		clock.SetTickRate(60.0);
+		int ticksRun = 0;
+		while (ticksRun < kTicks)
+		{
+			int steps = clock.Advance(1.0 / hz);
+			for (int s = 0; s < steps && ticksRun < kTicks; s++, ticksRun++) Step(fixed, grid, clock.GetTickDt());
+		}
+
+		float fixedDiff = MaxDiff(reference, fixed);
+		ok = ok && fixedDiff == 0.0f;
+		printf("%8.0fHz %22.6f %22.6f\n", hz, MaxDiff(reference, variable), fixedDiff);
+	}
+
+	// 렉 : 2초 동안 멈췄다가 돌아와도 한 프레임에 최대 틱 수까지만 따라잡음
+	{
+		FixedTimestep clock;
+		clock.SetTickRate(60.0);
+		clock.SetMaxStepsPerFrame(5);
+		int hitchSteps = clock.Advance(2.0);
+		float alpha = clock.GetAlpha();
+		bool hitchOk = hitchSteps == 5 && alpha >= 0.0f && alpha < 1.0f && clock.GetDroppedTime() > 1.9;
+		ok = ok && hitchOk;
+		printf("\n2s hitch -> %d ticks, alpha %.3f, dropped %.3fs : %s\n", hitchSteps, alpha, clock.GetDroppedTime(), hitchOk ? "OK" : "FAIL");
+	}
+
+	// 틱 속도보다 빠른 화면 : 틱 없이 지나가는 프레임에서 alpha가 0 -> 1로 차오르는지
+	{
+		FixedTimestep clock;
+		clock.SetTickRate(60.0);
+		printf("240Hz frames alpha :");
+		for (int f = 0; f < 8; f++)
+		{
+			int steps = clock.Advance(1.0 / 240.0);
+			printf(" %d/%.2f", steps, clock.GetAlpha());
+		}
+		printf("\n");
+	}
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,174 @@
+﻿// 흐름장 (FlowField) 적 조향 헤드리스 벤치마크
+// 1만 마리 기준으로 흐름장 방향 읽기와 직선 추적 (SIMD SeekBatch)의 마리당 시간, 흐름장 재계산 시간을 비교하고
+// 빈 맵에서는 예전 직선 추적과 결과가 똑같은지, 벽이 있을 때 모든 칸에서 벽을 돌아 목표까지 가는지 검사
+// 빌드 : g++ -O2 -std=c++14 Bench/FlowFieldBench.cpp -o FlowFieldBench
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <vector>
+#include "../Source/Utils/FlowField.h"
+#include "../Source/Objects/EnemyPool.h"
+
+static const int kEnemies = 10000;
+static const int kRepeats = 200;
+static const float kDt = 1.0f / 60.0f;
+static const float kExtent = 8.0f;
+static const float kCellSize = 0.25f;
+static const int kCells = 64;
+
+static void Fill(EnemyPool& pool, unsigned int seed)
+{
+	srand(seed);
+	for (int i = 0; i < kEnemies; i++)
+	{
+		pool.type[i] = i % 3;
+		pool.Spawn(i, (rand() / (float)RAND_MAX) * 14.0f - 7.0f, (rand() / (float)RAND_MAX) * 14.0f - 7.0f, 0.0f);
+	}
+}
+
+static void BuildWall(FlowField& field)
+{
+	for (int cy = 4; cy < kCells; cy++) field.SetBlocked(32, cy, true);
+}
+
+// 가운데 세로 벽 (아래쪽 끝에만 틈) 뒤에 목표를 두고, 갈 수 있는 모든 칸 중심에서 출발한 적이 벽을 뚫지 않고 목표에 닿는지
+static bool CheckWallDetour(int& outMaxSteps)
+{
+	FlowField field;
+	field.Initialize(-kExtent, -kExtent, kCells, kCells, kCellSize);
+	BuildWall(field);
+
+	const float targetX = 3.0f, targetY = 3.0f;
+	field.Update(targetX, targetY);
+
+	const float speed = 1.0f;
+	const int stepLimit = 60 * 60;
+	outMaxSteps = 0;
+
+	for (int cy = 0; cy < kCells; cy++)
+	{
+		for (int cx = 0; cx < kCells; cx++)
+		{
+			if (field.GetIntegration(cx, cy) >= FlowField::UNREACHABLE) continue;
+
+			float x = -kExtent + (cx + 0.5f) * kCellSize;
+			float y = -kExtent + (cy + 0.5f) * kCellSize;
+			uint8_t alive = 1;
+
+			int steps = 0;
+			for (; steps < stepLimit; steps++)
+			{
+				float dx = targetX - x, dy = targetY - y;
+				if (dx * dx + dy * dy < 0.05f * 0.05f) break;
+
+				field.SteerRange(&x, &y, &speed, &alive, 0, 1, targetX, targetY, kDt);
+
+				int wx = (int)std::floor((x + kExtent) / kCellSize);
+				int wy = (int)std::floor((y + kExtent) / kCellSize);
+				if (wx == 32 && wy >= 4)
+				{
+					printf("  walker from cell (%d, %d) entered the wall at step %d\n", cx, cy, steps);
+					return false;
+				}
+			}
+
+			if (steps == stepLimit)
+			{
+				printf("  walker from cell (%d, %d) never reached the target\n", cx, cy);
+				return false;
+			}
+			if (steps > outMaxSteps) outMaxSteps = steps;
+		}
+	}
+	return true;
+}
+
+int main()
+{
+	using Clock = std::chrono::steady_clock;
+	bool allOk = true;
+
+	FlowField field;
+	field.Initialize(-kExtent, -kExtent, kCells, kCells, kCellSize);
+
+	// 재계산 비용 (매번 다른 칸으로 목표를 옮겨서 강제로 재계산)
+	auto start = Clock::now();
+	for (int r = 0; r < kRepeats; r++) field.Update(-4.0f + (r % 32) * kCellSize, 1.0f);
+	double rebuildMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / kRepeats;
+
+	// 같은 칸 안에서만 움직이면 재계산하지 않아야 함
+	field.Update(0.01f, 0.01f);
+	int rebuildsBefore = field.GetRebuildCount();
+	for (int r = 0; r < 100; r++) field.Update(0.01f + r * 0.002f, 0.01f + r * 0.001f);
+	bool isCached = field.GetRebuildCount() == rebuildsBefore;
+	allOk = allOk && isCached;
+
+	// 1만 마리 조향 : 흐름장 읽기 vs 직선 추적
+	EnemyPool flowPool, seekPool, referencePool;
+	flowPool.Initialize(kEnemies);
+	seekPool.Initialize(kEnemies);
+	referencePool.Initialize(kEnemies);
+	Fill(flowPool, 7);
+	Fill(seekPool, 7);
+	Fill(referencePool, 7);
+
+	const float targetX = 0.1f, targetY = 0.1f;
+	field.Update(targetX, targetY);
+
+	start = Clock::now();
+	for (int r = 0; r < kRepeats; r++)
+	{
+		field.SteerRange(flowPool.x, flowPool.y, flowPool.speed, flowPool.alive, 0, kEnemies, targetX, targetY, kDt);
+	}
+	double flowNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ((double)kRepeats * kEnemies);
+
+	start = Clock::now();
+	for (int r = 0; r < kRepeats; r++) seekPool.MoveTowards(targetX, targetY, kDt);
+	double seekNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ((double)kRepeats * kEnemies);
+
+	// 빈 맵에서는 모든 칸이 목표를 볼 수 있으므로 스칼라 직선 추적 (SeekBatchScalar)과 같아야 함
+	for (int r = 0; r < kRepeats; r++)
+	{
+		SeekBatchScalar(referencePool.x, referencePool.y, referencePool.speed, referencePool.alive, kEnemies, targetX, targetY, kDt);
+	}
+	bool isSameAsSeek = true;
+	for (int i = 0; i < kEnemies; i++)
+	{
+		if (flowPool.x[i] != referencePool.x[i] || flowPool.y[i] != referencePool.y[i]) isSameAsSeek = false;
+	}
+	allOk = allOk && isSameAsSeek;
+
+	// 벽이 있는 맵 (벽 뒤의 적은 흐름장 방향, 나머지는 직선)
+	FlowField wallField;
+	wallField.Initialize(-kExtent, -kExtent, kCells, kCells, kCellSize);
+	BuildWall(wallField);
+	wallField.Update(3.0f, 3.0f);
+	start = Clock::now();
+	wallField.Update(3.3f, 3.0f);
+	double wallRebuildMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+	Fill(flowPool, 7);
+	start = Clock::now();
+	for (int r = 0; r < kRepeats; r++)
+	{
+		wallField.SteerRange(flowPool.x, flowPool.y, flowPool.speed, flowPool.alive, 0, kEnemies, 3.3f, 3.0f, kDt);
+	}
+	double wallNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ((double)kRepeats * kEnemies);
+
+	printf("flow field %dx%d (cell %.2f), %d enemies, %d ticks\n\n", kCells, kCells, kCellSize, kEnemies, kRepeats);
+	printf("%-30s %10.4f ms\n", "field rebuild (open)", rebuildMs);
+	printf("%-30s %10.4f ms\n", "field rebuild (wall, sight)", wallRebuildMs);
+	printf("%-30s %10s\n", "rebuild skipped in same cell", isCached ? "yes" : "NO");
+	printf("%-30s %10.2f ns / enemy\n", "steer flow field (open)", flowNs);
+	printf("%-30s %10.2f ns / enemy\n", "steer flow field (wall)", wallNs);
+	printf("%-30s %10.2f ns / enemy\n", "steer straight seek (SIMD)", seekNs);
+	printf("%-30s %10s\n", "open field == scalar seek", isSameAsSeek ? "ok" : "FAIL");
+
+	int maxSteps = 0;
+	bool isDetourOk = CheckWallDetour(maxSteps);
+	allOk = allOk && isDetourOk;
+	printf("%-30s %10s (longest %d ticks)\n", "wall detour reaches target", isDetourOk ? "ok" : "FAIL", maxSteps);
+
+	return allOk ? 0 : 1;
+}
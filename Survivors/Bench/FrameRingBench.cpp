@@ -0,0 +1,178 @@
+﻿// 프레임 링 (FrameRing) 헤드리스 벤치마크
+// GPU 대신 가상 시간으로 일을 처리하는 SimulatedFence로 게임 루프 (BeginFrame -> CPU 일 -> 제출 -> EndFrame)를 돌려서
+// 동시에 올라가는 프레임 수 (1 = 예전처럼 매 프레임 기다림, 2, 3)마다 한 프레임 시간과 CPU가 기다린 비율을 비교
+// 칸을 다시 쓸 때 그 칸의 예전 프레임이 항상 끝나 있는지, GPU에 올라간 프레임이 칸 수를 넘지 않는지,
+// CPU가 느리면 한 번도 안 기다리는지, 업로드 링 조각이 아직 안 끝난 프레임의 조각과 겹치지 않는지도 검사
+// 빌드 : g++ -O2 -std=c++14 Bench/FrameRingBench.cpp -o FrameRingBench
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <vector>
+#include <deque>
+#include "../Source/Render/FrameRing.h"
+#include "../Source/Render/UploadRing.h"
+
+static const int kFrames = 2000;
+static const uint64_t kMaxFrameUploadBytes = 64 * 1024;
+
+struct Workload
+{
+	const char* name;
+	double cpuMs;		// 프레임마다 CPU 시간 (업데이트 + 명령 기록)
+	double gpuMs;		// 프레임마다 GPU 시간
+	double jitterMs;	// 둘 다 0 ~ 이만큼 무작위로 더함
+};
+
+static const Workload WORKLOADS[] =
+{
+	{ "gpu bound", 4.0, 6.0, 0.0 },
+	{ "cpu bound", 6.0, 4.0, 0.0 },
+	{ "balanced", 5.0, 5.0, 0.0 },
+	{ "jittery", 3.0, 3.0, 4.0 },
+};
+
+struct RunResult
+{
+	double msPerFrame = 0.0;
+	double waitShare = 0.0;		// CPU가 기다린 시간 비율
+	uint64_t waits = 0;
+	int maxInFlight = 0;		// BeginFrame 직후 GPU에 남아있던 프레임 수의 최대
+	bool ok = true;
+};
+
+struct Slice
+{
+	uint64_t offset;
+	uint64_t size;
+};
+
+struct UploadFrame
+{
+	uint64_t fenceValue;
+	std::vector<Slice> slices;
+};
+
+// 아직 GPU가 안 끝낸 프레임의 조각과 겹치는지
+static bool Overlaps(const std::deque<UploadFrame>& live, const Slice& slice)
+{
+	for (const UploadFrame& frame : live)
+	{
+		for (const Slice& other : frame.slices)
+		{
+			if (slice.offset < other.offset + other.size && other.offset < slice.offset + slice.size) return true;
+		}
+	}
+	return false;
+}
+
+static RunResult RunLoop(const Workload& workload, int framesInFlight, unsigned int seed)
+{
+	srand(seed);
+	SimulatedFence fence;
+	FrameRing ring;
+	ring.Initialize(&fence, framesInFlight);
+
+	UploadRing uploads;
+	uploads.Initialize((uint64_t)(framesInFlight + 1) * kMaxFrameUploadBytes);
+	std::deque<UploadFrame> liveUploads;
+	std::vector<uint64_t> slotFences(framesInFlight, 0);
+
+	RunResult result;
+	const int warmup = 10;
+	double startTime = 0.0, startWaited = 0.0;
+	for (int f = 0; f < kFrames + warmup; f++)
+	{
+		if (f == warmup)
+		{
+			startTime = fence.GetTime();
+			startWaited = fence.GetWaitedTime();
+		}
+
+		int slot = ring.BeginFrame();
+		uint64_t completed = ring.GetCompletedValue();
+		if (slot != f % framesInFlight || completed < slotFences[slot]) result.ok = false;
+		result.maxInFlight = (std::max)(result.maxInFlight, fence.GetPendingCount());
+		if (fence.GetPendingCount() > framesInFlight - 1) result.ok = false;
+
+		// 끝난 프레임의 업로드 조각 반납
+		uploads.Retire(completed);
+		while (!liveUploads.empty() && liveUploads.front().fenceValue <= completed) liveUploads.pop_front();
+
+		// CPU 일 : 업로드 조각 몇 개 떼어서 쓰고 명령 기록
+		UploadFrame frame;
+		uint64_t frameBytes = 0;
+		while (true)
+		{
+			Slice slice;
+			slice.size = 256 + (uint64_t)(rand() % 8192);
+			if (frameBytes + slice.size > kMaxFrameUploadBytes) break;
+			if (!uploads.Allocate(slice.size, slice.offset) || Overlaps(liveUploads, slice)) result.ok = false;
+			frameBytes += slice.size;
+			frame.slices.push_back(slice);
+		}
+		double jitter = workload.jitterMs * (rand() / (double)RAND_MAX);
+		fence.Advance(workload.cpuMs + jitter);
+
+		// 제출
+		fence.SubmitWork(workload.gpuMs + workload.jitterMs * (rand() / (double)RAND_MAX));
+		frame.fenceValue = ring.EndFrame();
+		uploads.FinishFrame(frame.fenceValue);
+		liveUploads.push_back(frame);
+		slotFences[slot] = frame.fenceValue;
+	}
+
+	double elapsed = fence.GetTime() - startTime;
+	result.msPerFrame = elapsed / kFrames;
+	result.waitShare = (fence.GetWaitedTime() - startWaited) / elapsed;
+	result.waits = ring.GetWaits();
+
+	// 끝낼 때 전부 기다리면 남은 일이 없어야 함
+	ring.WaitForIdle();
+	if (fence.GetPendingCount() != 0 || fence.GetCompletedValue() != ring.GetLastSignaledValue()) result.ok = false;
+	return result;
+}
+
+int main()
+{
+	bool ok = true;
+	printf("%-10s %8s %8s %6s %11s %8s %9s %10s %8s %s\n", "workload", "cpu ms", "gpu ms", "ring", "ms / frame", "wait", "waits", "in flight", "speedup", "check");
+	for (const Workload& workload : WORKLOADS)
+	{
+		double serial = 0.0;
+		for (int framesInFlight = 1; framesInFlight <= MAX_FRAMES_IN_FLIGHT; framesInFlight++)
+		{
+			RunResult result = RunLoop(workload, framesInFlight, 11);
+			if (framesInFlight == 1) serial = result.msPerFrame;
+
+			// 고정 시간이면 기대값이 정해짐 : 1칸은 CPU + GPU, 2칸 이상은 둘 중 느린 쪽 (느린 쪽이 CPU면 한 번도 안 기다림)
+			if (workload.jitterMs == 0.0)
+			{
+				double expected = framesInFlight == 1 ? workload.cpuMs + workload.gpuMs : (std::max)(workload.cpuMs, workload.gpuMs);
+				if (std::fabs(result.msPerFrame - expected) > expected * 0.01) result.ok = false;
+				if (framesInFlight > 1 && workload.cpuMs >= workload.gpuMs && result.waits != 0) result.ok = false;
+			}
+			ok = ok && result.ok;
+
+			printf("%-10s %8.1f %8.1f %6d %11.2f %7.1f%% %9llu %10d %7.2fx %s\n", workload.name, workload.cpuMs, workload.gpuMs, framesInFlight,
+				result.msPerFrame, result.waitShare * 100.0, (unsigned long long)result.waits, result.maxInFlight, serial / result.msPerFrame,
+				result.ok ? "ok" : "FAIL");
+		}
+	}
+
+	// 링 자체의 비용 (GPU 일이 0인 가짜 펜스로 BeginFrame + EndFrame만)
+	SimulatedFence fence;
+	FrameRing ring;
+	ring.Initialize(&fence, 2);
+	const int iterations = 5000000;
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; i++)
+	{
+		ring.BeginFrame();
+		fence.Advance(1.0);
+		ring.EndFrame();
+	}
+	double ns = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e9 / iterations;
+	printf("\nBeginFrame + EndFrame : %.1f ns per frame, result %s\n", ns, ok ? "ok" : "FAIL");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,131 @@
+﻿// 시작 시 이미지 병렬 해제 (DecodeImages) 헤드리스 벤치마크
+// Assets/Textures 폴더의 PNG 전부를 부른 스레드 하나로 차례로 풀 때와 JobSystem 워커 수를 바꿔가며 동시에 풀 때의 벽시계 시간을 비교
+// 워커 수와 상관없이 파일마다 풀린 픽셀이 직렬 결과와 바이트 단위로 같은지도 검사
+// 빌드 : g++ -O2 -std=c++14 -pthread Bench/ImageDecodeBench.cpp -o ImageDecodeBench (Survivors 폴더에서 실행하거나 첫 인자로 텍스처 폴더)
+#include <cstdio>
+#include <cstring>
+#include <cctype>
+#include <string>
+#include <chrono>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <dirent.h>
+#define STB_IMAGE_IMPLEMENTATION
+#include "../Source/Render/ImageDecoder.h"
+
+static const int kRepeats = 3;	// 반복해서 가장 빠른 시간 (디스크 캐시가 데워진 상태)
+
+// 폴더 안의 .png 파일 (이름순, 실행마다 같은 순서)
+static std::vector<std::string> ListPngs(const std::string& root)
+{
+	std::vector<std::string> paths;
+	DIR* dir = opendir(root.c_str());
+	if (dir == nullptr) return paths;
+
+	while (dirent* entry = readdir(dir))
+	{
+		std::string name = entry->d_name;
+		if (name.size() <= 4) continue;
+
+		std::string extension = name.substr(name.size() - 4);
+		for (char& c : extension) c = (char)tolower((unsigned char)c);
+		if (extension == ".png") paths.push_back(root + name);
+	}
+	closedir(dir);
+	std::sort(paths.begin(), paths.end());
+	return paths;
+}
+
+static bool SameImages(const std::vector<DecodedImage>& a, const std::vector<DecodedImage>& b)
+{
+	if (a.size() != b.size()) return false;
+	for (size_t i = 0; i < a.size(); i++)
+	{
+		if (a[i].width != b[i].width || a[i].height != b[i].height || a[i].IsValid() != b[i].IsValid()) return false;
+		if (a[i].IsValid() && memcmp(a[i].pixels, b[i].pixels, (size_t)a[i].width * a[i].height * 4) != 0) return false;
+	}
+	return true;
+}
+
+// jobs가 nullptr이면 직렬
+static double TimeDecode(const std::vector<std::string>& paths, JobSystem* jobs, std::vector<DecodedImage>& keep)
+{
+	double best = 1e30;
+	for (int r = 0; r < kRepeats; r++)
+	{
+		std::vector<DecodedImage> images;
+		auto start = std::chrono::steady_clock::now();
+		DecodeImages(paths, images, jobs);
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		best = (std::min)(best, ms);
+
+		if (r == 0) keep.swap(images);
+		FreeDecodedImages(images);
+	}
+	return best;
+}
+
+int main(int argc, char** argv)
+{
+	// 텍스처 폴더 : 첫 인자, 없으면 이 파일 기준 ../Assets/Textures/
+	std::string root;
+	if (argc > 1)
+	{
+		root = argv[1];
+		if (!root.empty() && root.back() != '/' && root.back() != '\\') root += '/';
+	}
+	else
+	{
+		std::string self = __FILE__;
+		size_t slash = self.find_last_of("/\\");
+		root = (slash == std::string::npos ? std::string(".") : self.substr(0, slash)) + "/../Assets/Textures/";
+	}
+
+	std::vector<std::string> paths = ListPngs(root);
+	if (paths.empty())
+	{
+		printf("no png files in %s\n", root.c_str());
+		return 1;
+	}
+
+	std::vector<DecodedImage> serial;
+	double serialMs = TimeDecode(paths, nullptr, serial);
+
+	size_t pixelBytes = 0;
+	int failed = 0;
+	for (const DecodedImage& image : serial)
+	{
+		if (image.IsValid()) pixelBytes += (size_t)image.width * image.height * 4;
+		else failed++;
+	}
+
+	int cores = (int)std::thread::hardware_concurrency();
+	printf("%d png files from %s (%.1f MB RGBA8), %d hardware threads\n\n", (int)paths.size(), root.c_str(),
+		pixelBytes / (1024.0 * 1024.0), cores);
+	printf("%-10s %12s %10s %10s\n", "workers", "wall ms", "speedup", "pixels");
+	printf("%-10s %12.1f %10.2f %10s\n", "serial", serialMs, 1.0, "-");
+
+	// -1 : 게임과 같은 기본값 (코어 수 - 1)
+	const int workerCounts[] = { -1, 1, 3, 7 };
+	bool allSame = failed == 0;
+	for (int workers : workerCounts)
+	{
+		JobSystem jobs;
+		jobs.Initialize(workers);
+
+		std::vector<DecodedImage> parallel;
+		double ms = TimeDecode(paths, &jobs, parallel);
+		bool same = SameImages(serial, parallel);
+		allSame = allSame && same;
+		FreeDecodedImages(parallel);
+
+		char label[32];
+		snprintf(label, sizeof(label), workers < 0 ? "%d (auto)" : "%d", jobs.GetWorkerCount());
+		printf("%-10s %12.1f %10.2f %10s\n", label, ms, serialMs / ms, same ? "same" : "DIFF");
+	}
+	FreeDecodedImages(serial);
+
+	printf("\nfailed files %d, parallel decode %s\n", failed, allSame ? "ok" : "FAIL");
+	return allSame ? 0 : 1;
+}
@@ -0,0 +1,107 @@
+﻿// 잡 시스템 (JobSystem) 병렬 틱 헤드리스 벤치마크
+// 같은 시드로 워커 수만 바꿔가며 대규모 웨이브를 돌려서, 매 틱 상태 해시가 워커 0개 (직렬)와 같은지와 틱 시간을 비교
+// 빌드 : g++ -O2 -std=c++14 -pthread Bench/JobSystemBench.cpp -o JobSystemBench
+#include <cstdio>
+#include <chrono>
+#include <vector>
+#include <thread>
+#include "../Source/Sim/SimWorld.h"
+
+static const int kTicks = 1200;
+
+struct RunResult
+{
+	std::vector<uint32_t> hashes;	// 틱마다 상태 해시
+	double msPerTick = 0.0;
+	int peakEnemies = 0;
+};
+
+static RunResult Run(int workerCount)
+{
+	JobSystem jobs;
+	jobs.Initialize(workerCount);
+
+	SimConfig config;
+	config.enemyCapacity = 20000;
+	config.bulletCapacity = 2000;
+	config.gemCapacity = 4000;
+	config.damageTextCapacity = 4000;
+	config.spawnMultiplier = 150;
+	config.seed = 1234;
+
+	SimWorld world;
+	world.Initialize(config);
+	world.SetJobSystem(workerCount >= 0 ? &jobs : nullptr);
+	world.Reset();
+	world.selectedWeapon = 1;
+	world.attackCooldown = 0.02f;	// 미사일을 많이 띄워서 유도탄 단계도 병렬로 돌게 함
+
+	RunResult result;
+	result.hashes.reserve(kTicks);
+
+	using Clock = std::chrono::steady_clock;
+	double totalMs = 0.0;
+
+	for (int tick = 0; tick < kTicks; tick++)
+	{
+		// 1초마다 방향을 바꾸며 원을 그리듯 이동
+		SimInput input;
+		int dir = (tick / 60) % 4;
+		input.right = dir == 0;
+		input.up = dir == 1;
+		input.left = dir == 2;
+		input.down = dir == 3;
+
+		auto start = Clock::now();
+		world.Tick(input, 1.0f / 60.0f);
+		totalMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+		for (const SimEvent& e : world.events)
+		{
+			if (e.type == SimEventType::LevelUp) world.ApplyUpgrade(world.player.level % 5);
+		}
+
+		result.hashes.push_back(world.GetStateHash());
+		int alive = world.GetAliveEnemyCount();
+		if (alive > result.peakEnemies) result.peakEnemies = alive;
+	}
+
+	result.msPerTick = totalMs / kTicks;
+	return result;
+}
+
+int main()
+{
+	int cores = (int)std::thread::hardware_concurrency();
+	printf("hardware threads : %d, %d ticks, 20000 enemy slots, homing weapon\n\n", cores, kTicks);
+
+	// -1 : 잡 시스템 없이 (SimWorld 기본 경로), 0 이상 : 그 수만큼 워커를 띄운 잡 시스템
+	const int workerCounts[] = { -1, 0, 1, 3, 7 };
+
+	RunResult reference = Run(-1);
+	printf("%-12s %12s %10s %12s %s\n", "workers", "ms / tick", "speedup", "peak enemy", "state");
+	printf("%-12s %12.3f %10s %12d %s\n", "none", reference.msPerTick, "1.00x", reference.peakEnemies, "reference");
+
+	bool allOk = true;
+	for (int w = 1; w < (int)(sizeof(workerCounts) / sizeof(workerCounts[0])); w++)
+	{
+		RunResult result = Run(workerCounts[w]);
+
+		int firstMismatch = -1;
+		for (int tick = 0; tick < kTicks && firstMismatch == -1; tick++)
+		{
+			if (result.hashes[tick] != reference.hashes[tick]) firstMismatch = tick;
+		}
+		allOk = allOk && firstMismatch == -1;
+
+		char label[32];
+		snprintf(label, sizeof(label), "%d", workerCounts[w]);
+		char speedup[32];
+		snprintf(speedup, sizeof(speedup), "%.2fx", reference.msPerTick / result.msPerTick);
+
+		if (firstMismatch == -1) printf("%-12s %12.3f %10s %12d %s\n", label, result.msPerTick, speedup, result.peakEnemies, "identical");
+		else printf("%-12s %12.3f %10s %12d MISMATCH at tick %d\n", label, result.msPerTick, speedup, result.peakEnemies, firstMismatch);
+	}
+
+	return allOk ? 0 : 1;
+}
@@ -0,0 +1,134 @@
+﻿// 유도탄 타겟 찾기 (가장 가까운 적) 헤드리스 벤치마크
+// 미사일마다 모든 적을 훑던 기존 방식과 격자 링 탐색 (SpatialGrid::FindNearest)을 비교하고 결과가 같은지 검사
+// 빌드 : g++ -O2 -std=c++14 Bench/NearestEnemyBench.cpp -o NearestEnemyBench
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <vector>
+#include "../Source/Utils/SpatialGrid.h"
+
+// 기존 미사일 루프의 타겟 찾기 (비교 기준)
+static int BruteForceNearest(const std::vector<float>& xs, const std::vector<float>& ys, const std::vector<unsigned char>& alive, float x, float y)
+{
+	float minDist = 9999.0f;
+	int targetIdx = -1;
+
+	for (int j = 0; j < (int)xs.size(); j++)
+	{
+		if (!alive[j]) continue;
+
+		float dx = xs[j] - x;
+		float dy = ys[j] - y;
+		float dist = std::sqrt((dx * dx) + (dy * dy));
+
+		if (dist < minDist)
+		{
+			minDist = dist;
+			targetIdx = j;
+		}
+	}
+	return targetIdx;
+}
+
+template<typename Fn>
+static double MeasureMs(Fn&& fn)
+{
+	using Clock = std::chrono::high_resolution_clock;
+	int iterations = 0;
+	auto start = Clock::now();
+	double elapsed = 0.0;
+
+	while (iterations < 5 || elapsed < 200.0)
+	{
+		fn();
+		iterations++;
+		elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+	return elapsed / iterations;
+}
+
+int main()
+{
+	const float cellSize = 0.5f;
+	const int enemyCounts[] = { 60, 1000, 5000, 20000 };
+	const int bulletCounts[] = { 50, 500, 2000 };
+
+	printf("%8s %8s %14s %14s %10s %10s\n", "enemies", "bullets", "brute ms/tick", "grid ms/tick", "speedup", "mismatch");
+
+	int totalMismatch = 0;
+
+	for (int enemyCount : enemyCounts)
+	{
+		// 적은 플레이어 주변 원판에, 죽은 적도 군데군데 섞음
+		std::vector<float> xs(enemyCount), ys(enemyCount);
+		std::vector<unsigned char> alive(enemyCount);
+		float radius = 1.5f + std::sqrt((float)enemyCount) * 0.05f;
+		srand(99);
+
+		for (int i = 0; i < enemyCount; i++)
+		{
+			float a = (rand() / (float)RAND_MAX) * 6.2831853f;
+			float r = std::sqrt(rand() / (float)RAND_MAX) * radius;
+			xs[i] = std::cos(a) * r;
+			ys[i] = std::sin(a) * r;
+			alive[i] = (rand() % 5 != 0) ? 1 : 0;
+		}
+
+		for (int bulletCount : bulletCounts)
+		{
+			// 미사일은 플레이어 근처부터 화면 밖까지 퍼져 있음
+			std::vector<float> bx(bulletCount), by(bulletCount);
+			for (int b = 0; b < bulletCount; b++)
+			{
+				bx[b] = ((rand() / (float)RAND_MAX) * 2.0f - 1.0f) * radius * 1.5f;
+				by[b] = ((rand() / (float)RAND_MAX) * 2.0f - 1.0f) * radius * 1.5f;
+			}
+
+			SpatialGrid grid;
+			std::vector<int> bruteResult(bulletCount), gridResult(bulletCount);
+
+			double bruteMs = MeasureMs([&]()
+				{
+					for (int b = 0; b < bulletCount; b++) bruteResult[b] = BruteForceNearest(xs, ys, alive, bx[b], by[b]);
+				});
+
+			// 격자 빌드 비용까지 포함해서 측정 (게임에서도 매 틱 한 번 빌드)
+			double gridMs = MeasureMs([&]()
+				{
+					grid.Build(xs.data(), ys.data(), alive.data(), enemyCount, cellSize);
+					for (int b = 0; b < bulletCount; b++)
+					{
+						gridResult[b] = grid.FindNearest(bx[b], by[b], 9999.0f, [&](int j) { return alive[j] != 0; });
+					}
+				});
+
+			int mismatch = 0;
+			for (int b = 0; b < bulletCount; b++)
+			{
+				if (bruteResult[b] != gridResult[b]) mismatch++;
+			}
+			totalMismatch += mismatch;
+
+			printf("%8d %8d %14.4f %14.4f %9.1fx %10d\n", enemyCount, bulletCount, bruteMs, gridMs, bruteMs / gridMs, mismatch);
+		}
+	}
+
+	// 이번 틱에 이미 죽은 적을 걸러내는 필터와 탐색 반경 확인
+	{
+		float xs[3] = { 0.1f, 0.3f, 5.0f };
+		float ys[3] = { 0.0f, 0.0f, 0.0f };
+		unsigned char alive[3] = { 1, 1, 1 };
+		SpatialGrid grid;
+		grid.Build(xs, ys, alive, 3, cellSize);
+
+		bool ok = grid.FindNearest(0.0f, 0.0f, 9999.0f, [](int) { return true; }) == 0
+			&& grid.FindNearest(0.0f, 0.0f, 9999.0f, [](int j) { return j != 0; }) == 1
+			&& grid.FindNearest(0.0f, 0.0f, 1.0f, [](int j) { return j == 2; }) == -1
+			&& grid.FindNearest(100.0f, 0.0f, 9999.0f, [](int) { return true; }) == 2;
+		if (!ok) totalMismatch++;
+		printf("\nfilter / radius check : %s\n", ok ? "OK" : "FAIL");
+	}
+
+	return totalMismatch == 0 ? 0 : 1;
+}
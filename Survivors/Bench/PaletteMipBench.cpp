@@ -0,0 +1,249 @@
+﻿// 팔레트 텍스처 (PaletteTexture) / 밉맵 (TextureMips) 벤치마크
+// 텍스처 폴더의 PNG마다 색 수를 세고, 256색 이하인 그림은 8비트 팔레트로 바꿨다가 CPU 디코더 (셰이더와 같은 계산)로 되살려서
+// 원본과 픽셀 단위로 같은지와 VRAM (RGBA8 / 팔레트)을 비교, AssetPacker와 같은 경로 (EncodePackTexture)로 만든 팩 본문도 되살려서 검사
+// 밉은 단계 크기가 D3D 규칙 (max(1, 위 / 2))대로인지, 투명 픽셀이 색을 어둡게 끌어내리지 않는지 (알파 가중) 검사하고,
+// 작게 그리는 스프라이트 (젬 약 26픽셀, 적 프레임)를 점 샘플링할 때 원본 (0단계)과 GPU가 고르는 단계가 건드리는 캐시 줄 수를 비교
+// 빌드 : g++ -O2 -std=c++14 -pthread Bench/PaletteMipBench.cpp -o PaletteMipBench (Survivors 폴더에서 실행하거나 첫 인자로 텍스처 폴더)
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <string>
+#include <chrono>
+#include <vector>
+#include <unordered_set>
+#define STB_IMAGE_IMPLEMENTATION
+#include "../Source/Utils/AssetPackBuilder.h"
+
+static const int kScreenWidth = 1280;	// 게임 창 크기 (스프라이트 크기 1.0 = 화면 절반)
+static const int kScreenHeight = 720;
+static const int kCacheLineBytes = 64;
+
+static double Seconds(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 원본과 디코드 결과가 같은지 (알파 0 픽셀은 색을 버리므로 (0, 0, 0, 0)이어야 함)
+static bool SameAsSource(const uint8_t* rgba, const uint8_t* decoded, int width, int height, size_t pitch)
+{
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			const uint8_t* a = rgba + (size_t)y * pitch + (size_t)x * 4;
+			const uint8_t* b = decoded + ((size_t)y * width + x) * 4;
+			uint32_t expected = LoadPaletteColor(a), actual;
+			memcpy(&actual, b, 4);
+			if (expected != actual) return false;
+		}
+	}
+	return true;
+}
+
+// 팩 본문 (EncodePackTexture)의 팔레트 텍스처 0단계를 되살려서 원본과 비교, 아래 단계는 번호가 팔레트 안에 있는지만
+static bool CheckPackedPalette(const uint8_t* rgba, int width, int height)
+{
+	AssetPackOptions options;
+	TextureSettings settings;
+	settings.mips = true;
+	AssetPackEntry entry = {};
+	std::vector<uint8_t> payload;
+	AssetPackTextureReport report;
+	PackTextureScratch scratch;
+	EncodePackTexture(rgba, width, height, settings, options, entry, payload, report, scratch);
+	if (entry.format != ASSET_FORMAT_PALETTE8 || entry.mipLevels != (uint32_t)GetFullMipCount(width, height)) return false;
+	if (GetTextureContentEnd(entry) > entry.dataSize || entry.dataSize != payload.size()) return false;
+
+	const uint32_t* palette = (const uint32_t*)&payload[(size_t)GetTexturePaletteOffset(entry)];
+	AssetTextureLevel level0 = GetTextureLevel(entry, 0);
+	std::vector<uint8_t> decoded((size_t)width * height * 4);
+	DecodePaletteImage(&payload[(size_t)level0.offset], level0.rowPitch, width, height, palette, decoded.data(), (size_t)width * 4);
+	if (!SameAsSource(rgba, decoded.data(), width, height, (size_t)width * 4)) return false;
+
+	for (uint32_t i = 1; i < entry.mipLevels; i++)
+	{
+		AssetTextureLevel level = GetTextureLevel(entry, i);
+		if (level.offset % ASSET_PACK_DATA_ALIGNMENT != 0 || level.rowPitch % ASSET_PACK_PITCH_ALIGNMENT != 0) return false;
+		for (uint32_t y = 0; y < level.height; y++)
+		{
+			for (uint32_t x = 0; x < level.width; x++)
+			{
+				if (payload[(size_t)(level.offset + (uint64_t)y * level.rowPitch + x)] >= report.colors) return false;
+			}
+		}
+	}
+	return true;
+}
+
+// 밉 단계 크기 (홀수 / 1픽셀 가장자리 포함)와 알파 가중 평균
+static bool CheckMipChain()
+{
+	const int sizes[][2] = { { 265, 265 }, { 160, 160 }, { 7, 3 }, { 1, 9 }, { 3840, 2160 } };
+	for (const auto& size : sizes)
+	{
+		std::vector<uint8_t> rgba((size_t)size[0] * size[1] * 4, 255);
+		std::vector<MipLevel> mips;
+		BuildMipChain(rgba.data(), size[0], size[1], (size_t)size[0] * 4, 99, mips);
+		if ((int)mips.size() != GetFullMipCount(size[0], size[1])) return false;
+		if (mips.back().width != 1 || mips.back().height != 1) return false;
+		for (size_t i = 1; i < mips.size(); i++)
+		{
+			if (mips[i].width != (std::max)(1, mips[i - 1].width / 2) || mips[i].height != (std::max)(1, mips[i - 1].height / 2)) return false;
+			if (mips[i].pixels.size() != (size_t)mips[i].width * mips[i].height * 4 || mips[i].pixels[0] != 255) return false;
+		}
+	}
+	if (GetFullMipCount(265, 265) != 9 || GetFullMipCount(1, 1) != 1 || GetFullMipCount(16384, 1) != 15) return false;
+
+	// 불투명한 빨강 하나 + 투명 검정 셋 : 색은 빨강 그대로, 알파만 1/4 (가중하지 않으면 색이 64로 어두워짐)
+	const uint8_t quad[16] = { 255, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+	MipLevel out;
+	DownsampleBox(quad, 2, 2, 8, out);
+	return out.width == 1 && out.height == 1 && out.pixels[0] == 255 && out.pixels[1] == 0 && out.pixels[2] == 0 && out.pixels[3] == 64;
+}
+
+// 점 샘플링 + 가장 가까운 밉 (D3D12_FILTER_MIN_MAG_MIP_POINT)이 고르는 단계 : round(log2(화면 픽셀당 텍셀 수))
+static int SelectMipLevel(double texelsPerPixel, int levels)
+{
+	if (texelsPerPixel <= 1.0) return 0;
+	int level = (int)std::floor(std::log2(texelsPerPixel) + 0.5);
+	return (std::min)(level, levels - 1);
+}
+
+// 캐시 줄 하나가 덮는 텍셀 타일 (GPU 텍스처는 타일 배치라 줄 하나가 가로 한 줄이 아닌 작은 사각형)
+// RGBA8 : 4x4 (64바이트), R8 팔레트 번호 : 8x8, BC7 : 4x4 블록 (16바이트) 4개 = 16x4
+struct TexelTile
+{
+	const char* name;
+	int width;
+	int height;
+	double bytesPerTexel;
+};
+
+static const TexelTile TILES[] = { { "RGBA8", 4, 4, 4.0 }, { "BC7", 16, 4, 1.0 }, { "PAL8", 8, 8, 1.0 } };
+
+// screenWidth x screenHeight로 그린 스프라이트가 textureWidth x textureHeight 단계에서 건드리는 캐시 줄 수 (식은 캐시에서 처음 한 번씩)
+static size_t CountCacheLines(int screenWidth, int screenHeight, int textureWidth, int textureHeight, const TexelTile& tile)
+{
+	std::unordered_set<uint64_t> lines;
+	for (int y = 0; y < screenHeight; y++)
+	{
+		int v = (int)((y + 0.5) * textureHeight / screenHeight);
+		for (int x = 0; x < screenWidth; x++)
+		{
+			int u = (int)((x + 0.5) * textureWidth / screenWidth);
+			lines.insert(((uint64_t)(v / tile.height) << 32) | (uint32_t)(u / tile.width));
+		}
+	}
+	return lines.size();
+}
+
+struct SmallSprite
+{
+	const char* name;
+	int frameWidth;		// 프레임 하나의 텍스처 크기
+	int frameHeight;
+	float scaleX;		// 게임 안 크기 (Survivors.cpp / EnemyPool.h)
+	float scaleY;
+	int levels;			// 팩의 밉 단계 수
+	int tile;			// TILES 번호 (팩에 들어가는 형식)
+};
+
+// 젬 : 160x160을 0.04 x 0.06 (약 26 x 22픽셀), 기본 적 : Enemy1 한 프레임 (788x504)을 0.45 x 0.6, 플레이어 : 500x319를 0.45
+static const SmallSprite SPRITES[] =
+{
+	{ "gem", 160, 160, 0.04f, 0.06f, 8, 0 },
+	{ "Enemy1 frame", 788, 504, 0.45f, 0.6f, 3, 1 },
+	{ "player frame", 500, 319, 0.45f, 0.45f, 3, 1 },
+};
+
+int main(int argc, char** argv)
+{
+	// 텍스처 폴더 : 첫 인자, 없으면 이 파일 기준 ../Assets/Textures/
+	std::string root;
+	if (argc > 1)
+	{
+		root = argv[1];
+		if (!root.empty() && root.back() != '/' && root.back() != '\\') root += '/';
+	}
+	else
+	{
+		std::string self = __FILE__;
+		size_t slash = self.find_last_of("/\\");
+		root = (slash == std::string::npos ? std::string(".") : self.substr(0, slash)) + "/../Assets/Textures/";
+	}
+
+	bool ok = CheckMipChain();
+	printf("%-34s %s\n\n", "mip chain (sizes / alpha weight)", ok ? "ok" : "FAIL");
+
+	// 1. 팔레트 : 256색 이하인 텍스처 찾기와 왕복
+	printf("%-22s %12s %7s %10s %10s %8s %8s %s\n", "texture", "size", "colors", "RGBA MB", "PAL8 MB", "change", "ms", "round trip");
+	uint64_t rgbaBytes = 0, paletteBytes = 0;
+	int paletted = 0, files = 0;
+	for (const std::string& file : ListAssetFiles(root, ".png"))
+	{
+		int width = 0, height = 0, channels = 0;
+		unsigned char* pixels = stbi_load((root + file).c_str(), &width, &height, &channels, STBI_rgb_alpha);
+		if (pixels == nullptr) continue;
+		files++;
+
+		uint32_t palette[PALETTE_SIZE];
+		int colors = 0;
+		auto start = std::chrono::steady_clock::now();
+		bool fits = BuildPalette(pixels, width, height, (size_t)width * 4, palette, colors);
+		if (!fits)
+		{
+			stbi_image_free(pixels);
+			continue;
+		}
+		std::vector<uint8_t> indices((size_t)width * height);
+		IndexPaletteImage(pixels, width, height, (size_t)width * 4, palette, colors, indices.data(), width);
+		double ms = Seconds(start) * 1000.0;
+
+		std::vector<uint8_t> decoded((size_t)width * height * 4);
+		DecodePaletteImage(indices.data(), width, width, height, palette, decoded.data(), (size_t)width * 4);
+		bool same = SameAsSource(pixels, decoded.data(), width, height, (size_t)width * 4) && CheckPackedPalette(pixels, width, height);
+		ok = ok && same;
+
+		uint64_t rgba = (uint64_t)width * height * 4, packed = (uint64_t)width * height + PALETTE_SIZE * 4;
+		rgbaBytes += rgba;
+		paletteBytes += packed;
+		paletted++;
+
+		char size[32];
+		snprintf(size, sizeof(size), "%dx%d", width, height);
+		printf("%-22s %12s %7d %10.3f %10.3f %7.0f%% %8.1f %s\n", file.c_str(), size, colors, rgba / (1024.0 * 1024.0), packed / (1024.0 * 1024.0),
+			100.0 * packed / rgba - 100.0, ms, same ? "ok" : "FAIL");
+		stbi_image_free(pixels);
+	}
+	printf("\n%d of %d textures fit 256 colors, RGBA8 %.2f MB -> %.2f MB\n\n", paletted, files, rgbaBytes / (1024.0 * 1024.0), paletteBytes / (1024.0 * 1024.0));
+	if (files == 0)
+	{
+		printf("no textures in %s\n", root.c_str());
+		return 1;
+	}
+
+	// 2. 밉 : 작게 그린 스프라이트 하나가 읽는 캐시 줄 (0단계 vs GPU가 고르는 단계)
+	printf("%-14s %11s %10s %6s %5s %11s %11s %11s %8s\n", "sprite", "texture", "screen", "format", "mip", "mip0 lines", "mip lines", "texels/px", "traffic");
+	for (const SmallSprite& sprite : SPRITES)
+	{
+		const TexelTile& tile = TILES[sprite.tile];
+		int screenWidth = (int)std::lround(sprite.scaleX * kScreenWidth * 0.5);
+		int screenHeight = (int)std::lround(sprite.scaleY * kScreenHeight * 0.5);
+		double texelsPerPixel = (std::max)((double)sprite.frameWidth / screenWidth, (double)sprite.frameHeight / screenHeight);
+		int level = SelectMipLevel(texelsPerPixel, sprite.levels);
+		int levelWidth = (std::max)(1, sprite.frameWidth >> level), levelHeight = (std::max)(1, sprite.frameHeight >> level);
+
+		size_t baseLines = CountCacheLines(screenWidth, screenHeight, sprite.frameWidth, sprite.frameHeight, tile);
+		size_t mipLines = CountCacheLines(screenWidth, screenHeight, levelWidth, levelHeight, tile);
+		ok = ok && level > 0 && mipLines < baseLines;
+
+		char texture[32], screen[32];
+		snprintf(texture, sizeof(texture), "%dx%d", sprite.frameWidth, sprite.frameHeight);
+		snprintf(screen, sizeof(screen), "%dx%d", screenWidth, screenHeight);
+		printf("%-14s %11s %10s %6s %5d %11zu %11zu %11.1f %7.1fx\n", sprite.name, texture, screen, tile.name, level, baseLines, mipLines,
+			texelsPerPixel, (double)baseLines / mipLines);
+	}
+
+	printf("\n%d-byte lines, texel tiles RGBA8 4x4 / BC7 16x4 / PAL8 8x8, result %s\n", kCacheLineBytes, ok ? "ok" : "FAIL");
+	return ok ? 0 : 1;
+}
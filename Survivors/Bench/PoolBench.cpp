@@ -0,0 +1,183 @@
+﻿// 오브젝트 풀 (Pool<T>) 헤드리스 벤치마크
+// 200마리가 한 번에 죽는 웨이브처럼 젬 / 데미지 텍스트를 몰아서 꺼낼 때
+// 기존 배열 선형 탐색 (isDead 검사)과 Free List 풀의 꺼내기 + 순회 비용을 비교하고, 넘침 정책과 세대 핸들 동작을 검사
+// 빌드 : g++ -O2 -std=c++14 Bench/PoolBench.cpp -o PoolBench
+#include <cstdio>
+#include <chrono>
+#include <vector>
+#include "../Source/Utils/Pool.h"
+#include "../Source/Objects/EnemyPool.h"
+
+// 렌더링용 멤버까지 포함된 기존 Gem 객체 크기와 비슷하게 맞춘 더미
+struct FakeGem
+{
+	bool isDead = true;
+	float x = 0.0f, y = 0.0f;
+	char padding[150];
+};
+
+// 기존 방식 : 배열을 처음부터 훑어서 죽은 칸을 찾음
+static bool LinearAcquire(std::vector<FakeGem>& gems, float x, float y)
+{
+	for (FakeGem& g : gems)
+	{
+		if (g.isDead)
+		{
+			g.isDead = false;
+			g.x = x; g.y = y;
+			return true;
+		}
+	}
+	return false;
+}
+
+template<typename Fn>
+static double MeasureUs(Fn&& fn)
+{
+	using Clock = std::chrono::high_resolution_clock;
+	int iterations = 0;
+	auto start = Clock::now();
+	double elapsed = 0.0;
+
+	while (iterations < 20 || elapsed < 200.0)
+	{
+		fn();
+		iterations++;
+		elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+	return elapsed * 1000.0 / iterations;
+}
+
+static bool CheckPolicies()
+{
+	bool ok = true;
+
+	// Drop : 가득 차면 nullptr
+	Pool<FakeGem> drop;
+	drop.Initialize(2, PoolOverflow::Drop);
+	drop.Acquire(); drop.Acquire();
+	ok = ok && drop.Acquire() == nullptr && drop.GetDroppedCount() == 1;
+
+	// RecycleOldest : 가장 먼저 꺼낸 객체가 다시 나옴
+	Pool<FakeGem> recycle;
+	recycle.Initialize(2, PoolOverflow::RecycleOldest);
+	FakeGem* first = recycle.Acquire();
+	FakeGem* second = recycle.Acquire();
+	ok = ok && recycle.Acquire() == first && recycle.Acquire() == second && recycle.GetLiveCount() == 2;
+
+	// Grow : 용량이 늘어나도 이미 꺼낸 포인터는 그대로이고 새 칸은 초기화 함수를 거침
+	Pool<FakeGem> grow;
+	int created = 0;
+	grow.Initialize(2, PoolOverflow::Grow);
+	grow.SetOnCreate([&](FakeGem&) { created++; });
+	FakeGem* kept = grow.Acquire();
+	kept->x = 7.0f;
+	grow.Acquire(); grow.Acquire();
+	ok = ok && grow.GetCapacity() == 4 && created == 2 && kept == &grow.Slot(0) && kept->x == 7.0f;
+
+	// 반환 후 살아있는 목록이 빽빽하게 유지되는지
+	grow.ReleaseIf([&](FakeGem& g) { return &g == kept; });
+	ok = ok && grow.GetLiveCount() == 2;
+	for (int n = 0; n < grow.GetLiveCount(); n++) ok = ok && &grow.Live(n) != kept;
+
+	return ok;
+}
+
+// 칸이 반환 / 재사용 / 강제 회수되거나 적이 죽었다 다시 스폰되면 예전 핸들은 무효가 되어야 함
+static bool CheckHandles()
+{
+	bool ok = true;
+
+	Pool<FakeGem> pool;
+	pool.Initialize(2, PoolOverflow::Drop);
+	EntityHandle handle;
+	FakeGem* gem = pool.Acquire(&handle);
+	gem->isDead = false;
+	ok = ok && pool.Get(handle) == gem && !handle.IsNull();
+
+	// 같은 칸이 다른 젬으로 재사용됨
+	pool.ReleaseIf([](FakeGem& g) { return !g.isDead; });
+	EntityHandle reused;
+	ok = ok && pool.Acquire(&reused) == gem && reused.index == handle.index;
+	ok = ok && pool.Get(handle) == nullptr && pool.Get(reused) == gem;
+
+	// RecycleOldest로 살아있는 채로 덮어써진 칸
+	Pool<FakeGem> recycle;
+	recycle.Initialize(1, PoolOverflow::RecycleOldest);
+	EntityHandle oldest, newest;
+	recycle.Acquire(&oldest);
+	recycle.Acquire(&newest);
+	ok = ok && !recycle.IsValid(oldest) && recycle.IsValid(newest) && !recycle.IsValid(EntityHandle());
+
+	// 적 : 죽으면 무효, 같은 칸에 다시 스폰돼도 예전 핸들은 새 적을 가리키지 않음
+	EnemyPool enemies;
+	enemies.Initialize(4);
+	enemies.Spawn(2, 0.0f, 0.0f, 0.0f);
+	EntityHandle enemy = enemies.GetHandle(2);
+	ok = ok && enemies.Resolve(enemy) == 2;
+	enemies.ApplyDamage(2, 1000.0f);
+	ok = ok && enemies.Resolve(enemy) == -1;
+	enemies.Spawn(2, 1.0f, 1.0f, 0.0f);
+	ok = ok && enemies.Resolve(enemy) == -1 && enemies.Resolve(enemies.GetHandle(2)) == 2;
+
+	return ok;
+}
+
+int main()
+{
+	bool ok = CheckPolicies();
+	printf("overflow policy check : %s\n", ok ? "OK" : "FAIL");
+	bool handlesOk = CheckHandles();
+	printf("handle check          : %s\n\n", handlesOk ? "OK" : "FAIL");
+	ok = ok && handlesOk;
+
+	const int capacities[] = { 200, 1000, 5000 };
+	printf("%9s %8s %16s %16s %16s %16s %9s\n", "capacity", "kills", "linear spawn us", "pool spawn us", "linear iter us", "pool iter us", "speedup");
+
+	for (int capacity : capacities)
+	{
+		// 풀의 절반이 이미 차 있는 상태에서 capacity / 2 마리가 한꺼번에 죽는 웨이브
+		int kills = capacity / 2;
+		std::vector<FakeGem> linear(capacity);
+		Pool<FakeGem> pool;
+		pool.Initialize(capacity, PoolOverflow::Grow);
+
+		double linearSpawn = MeasureUs([&]()
+			{
+				for (int i = 0; i < capacity; i++) linear[i].isDead = (i % 2 == 0);
+				for (int k = 0; k < kills; k++) LinearAcquire(linear, (float)k, 0.0f);
+			});
+
+		double poolSpawn = MeasureUs([&]()
+			{
+				pool.ReleaseAll();
+				for (int k = 0; k < capacity / 2; k++) pool.Acquire()->isDead = false;
+				for (int k = 0; k < kills; k++)
+				{
+					FakeGem* g = pool.Acquire();
+					g->isDead = false;
+					g->x = (float)k; g->y = 0.0f;
+				}
+			});
+
+		// 젬 1/4만 살아있을 때 매 틱 업데이트 순회 비용
+		for (int i = 0; i < capacity; i++) linear[i].isDead = (i % 4 != 0);
+		pool.ReleaseAll();
+		for (int k = 0; k < capacity / 4; k++) pool.Acquire()->isDead = false;
+
+		float sink = 0.0f;
+		double linearIter = MeasureUs([&]()
+			{
+				for (FakeGem& g : linear) { if (g.isDead) continue; g.y += 0.01f; sink += g.y; }
+			});
+		double poolIter = MeasureUs([&]()
+			{
+				for (int n = 0; n < pool.GetLiveCount(); n++) { pool.Live(n).y += 0.01f; sink += pool.Live(n).y; }
+			});
+
+		printf("%9d %8d %16.2f %16.2f %16.2f %16.2f %8.1fx%s\n", capacity, kills, linearSpawn, poolSpawn, linearIter, poolIter,
+			linearSpawn / poolSpawn, sink < 0.0f ? " " : "");
+	}
+
+	return ok ? 0 : 1;
+}
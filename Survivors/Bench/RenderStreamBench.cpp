@@ -0,0 +1,176 @@
+﻿// 그리기 명령 스트림 (RenderCommandStream / RenderCommandMerger) 헤드리스 벤치마크
+// 게임 한 프레임처럼 배경 / 젬 / 적 / 이펙트 / UI를 레이어 묶음별 스트림으로 나눠서 잡 시스템으로 동시에 기록하고,
+// 레이어 순서로 합쳐서 GPU 없는 백엔드 (NullRenderBackend)로 "올리는" 시간을 예전처럼 SpriteBatch 하나에 전부 넣고 정렬하던 것과 비교
+// 적이 많으면 적 레이어를 여러 스트림이 나눠서 기록 (같은 레이어를 나눠도 스트림 번호 순서로 합쳐지는지 확인)
+// 합친 인스턴스가 SpriteBatch의 결과와 비트 단위로 같은지, 묶음 (SpriteRun)이 같은지, 드로우 콜이 하나인지 검사
+// 빌드 : g++ -O2 -std=c++14 -pthread Bench/RenderStreamBench.cpp -o RenderStreamBench
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <vector>
+#include "../Source/Render/RenderCommandStream.h"
+#include "../Source/Render/NullRenderBackend.h"
+
+// 게임 객체 대신 (Render 때 PackSprite로 인스턴스를 만듦)
+struct FakeObject
+{
+	float x, y, scale;
+	uint32_t tint;
+	int layer;
+	int texture;
+};
+
+enum BenchLayer { L_BACKGROUND, L_GEMS, L_ENEMIES, L_PLAYER, L_BULLETS, L_EFFECTS, L_HUD, L_DAMAGE_TEXTS, L_OVERLAY };
+
+struct Scene
+{
+	std::vector<std::vector<FakeObject>> streams;	// 스트림마다 기록할 객체 (기록 순서 그대로)
+	int spriteCount = 0;
+};
+
+static float Random01() { return rand() / (float)RAND_MAX; }
+
+static void Add(std::vector<FakeObject>& stream, int layer, int texture)
+{
+	FakeObject object = { Random01() * 1280.0f, Random01() * 720.0f, 16.0f + Random01() * 48.0f, 0xFFFFFFFFu - (uint32_t)(rand() & 0xFF), layer, texture };
+	stream.push_back(object);
+}
+
+// 적 enemies마리 장면 (적 레이어는 enemyStreams개 스트림으로 나눔, 텍스처 번호는 게임처럼 종류별)
+static Scene MakeScene(int enemies, int enemyStreams, unsigned int seed)
+{
+	srand(seed);
+	Scene scene;
+	scene.streams.resize(3 + enemyStreams);
+
+	std::vector<FakeObject>& world = scene.streams[0];
+	Add(world, L_BACKGROUND, 1);
+	for (int i = 0; i < enemies / 4; i++) Add(world, L_GEMS, 2);
+
+	for (int i = 0; i < enemies; i++) Add(scene.streams[1 + i * enemyStreams / enemies], L_ENEMIES, 3 + rand() % 7);
+
+	std::vector<FakeObject>& combat = scene.streams[1 + enemyStreams];
+	Add(combat, L_PLAYER, 10);
+	for (int i = 0; i < enemies / 8; i++) Add(combat, L_BULLETS, 11);
+	for (int i = 0; i < enemies / 8; i++) Add(combat, L_EFFECTS, 12 + rand() % 2);
+
+	// UI : 바 / 숫자 / 팝업이 레이어를 오가며 섞여 있음
+	std::vector<FakeObject>& ui = scene.streams[2 + enemyStreams];
+	for (int i = 0; i < 12; i++) Add(ui, L_HUD, i % 3 == 0 ? 0 : 14);
+	for (int i = 0; i < enemies / 10; i++) Add(ui, L_DAMAGE_TEXTS, 15 + rand() % 10);
+	for (int i = 0; i < 8; i++) Add(ui, i % 2 == 0 ? L_OVERLAY : L_HUD, 25 + i % 3);
+
+	for (const std::vector<FakeObject>& stream : scene.streams) scene.spriteCount += (int)stream.size();
+	return scene;
+}
+
+static SpriteInstance MakeInstance(const FakeObject& object)
+{
+	static const float uv[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+	SpriteInstance instance;
+	PackSprite(instance, object.x, object.y, object.scale, object.scale, object.x > 640.0f, uv, object.tint, 0);
+	return instance;
+}
+
+// 예전 방식 : 한 스레드가 SpriteBatch 하나에 전부 넣고 정렬한 뒤 업로드 버퍼로 복사
+static void RecordSingle(const Scene& scene, SpriteBatch& batch, std::vector<SpriteInstance>& upload)
+{
+	batch.Begin();
+	for (const std::vector<FakeObject>& stream : scene.streams)
+	{
+		for (const FakeObject& object : stream) batch.Draw(object.layer, object.texture, MakeInstance(object));
+	}
+	batch.End();
+	upload.resize(batch.GetSpriteCount());
+	if (!upload.empty()) memcpy(upload.data(), batch.GetInstances().data(), sizeof(SpriteInstance) * upload.size());
+}
+
+// 스트림 방식 : 스트림마다 동시에 기록 + 스트림 안 정렬 -> 명령만 합치기 -> 백엔드가 병렬로 복사
+static void RecordStreams(const Scene& scene, std::vector<RenderCommandStream>& streams, RenderCommandMerger& merger,
+	NullRenderBackend& backend, JobSystem& jobs)
+{
+	int streamCount = (int)scene.streams.size();
+	jobs.ParallelFor(0, streamCount, 1, [&](int begin, int end)
+		{
+			for (int s = begin; s < end; s++)
+			{
+				streams[s].Begin();
+				for (const FakeObject& object : scene.streams[s]) streams[s].Draw(object.layer, object.texture, MakeInstance(object));
+				streams[s].End();
+			}
+		});
+	merger.Merge(streams.data(), streamCount);
+	backend.Flush(merger, &jobs);
+}
+
+static bool SameRuns(const std::vector<SpriteRun>& a, const std::vector<SpriteRun>& b)
+{
+	if (a.size() != b.size()) return false;
+	for (size_t r = 0; r < a.size(); r++)
+	{
+		if (a[r].texture != b[r].texture || a[r].layer != b[r].layer || a[r].firstInstance != b[r].firstInstance || a[r].instanceCount != b[r].instanceCount) return false;
+	}
+	return true;
+}
+
+template<typename Fn>
+static double MeasureUs(int repeats, Fn&& fn)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (int r = 0; r < repeats; r++) fn();
+	return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / repeats;
+}
+
+int main()
+{
+	const int enemyCounts[] = { 500, 5000, 50000 };
+	const int workerCounts[] = { 0, 1, 3 };
+
+	bool ok = true;
+	printf("%8s %8s %8s %9s %10s %11s %9s %10s %6s %8s %s\n", "enemies", "sprites", "streams", "workers", "commands", "cmd bytes",
+		"single us", "streams us", "runs", "speedup", "check");
+	for (int enemies : enemyCounts)
+	{
+		int enemyStreams = enemies >= 5000 ? 4 : 1;
+		Scene scene = MakeScene(enemies, enemyStreams, 5);
+		int repeats = (std::max)(3, 2000000 / scene.spriteCount);
+
+		SpriteBatch batch;
+		std::vector<SpriteInstance> upload;
+		RecordSingle(scene, batch, upload);
+		double singleUs = MeasureUs(repeats, [&]() { RecordSingle(scene, batch, upload); });
+
+		for (int workers : workerCounts)
+		{
+			JobSystem jobs;
+			jobs.Initialize(workers);
+			std::vector<RenderCommandStream> streams(scene.streams.size());
+			RenderCommandMerger merger;
+			NullRenderBackend backend;
+
+			RecordStreams(scene, streams, merger, backend, jobs);
+			bool valid = backend.GetLastDrawCount() == 1 && (int)backend.GetInstances().size() == scene.spriteCount &&
+				memcmp(backend.GetInstances().data(), upload.data(), sizeof(SpriteInstance) * upload.size()) == 0 &&
+				SameRuns(merger.GetRuns(), batch.GetRuns()) && backend.GetLastRunCount() == (int)batch.GetRuns().size();
+			ok = ok && valid;
+
+			double streamUs = MeasureUs(repeats, [&]() { RecordStreams(scene, streams, merger, backend, jobs); });
+			int commands = (int)merger.GetEntries().size();
+			printf("%8d %8d %8d %9d %10d %11d %9.1f %10.1f %6d %7.2fx %s\n", enemies, scene.spriteCount, (int)streams.size(), jobs.GetWorkerCount(),
+				commands, commands * (int)sizeof(RenderCommand), singleUs, streamUs, (int)merger.GetRuns().size(), singleUs / streamUs, valid ? "ok" : "FAIL");
+		}
+	}
+
+	// 비어있는 스트림만 있어도 (타이틀 화면의 적 스트림 등) 아무것도 안 그려야 함
+	std::vector<RenderCommandStream> empty(4);
+	RenderCommandMerger merger;
+	NullRenderBackend backend;
+	merger.Merge(empty.data(), (int)empty.size());
+	backend.Flush(merger);
+	bool emptyOk = merger.GetSpriteCount() == 0 && merger.GetRuns().empty() && backend.GetLastDrawCount() == 0;
+	ok = ok && emptyOk;
+
+	printf("\nempty streams : %s\nresult %s\n", emptyOk ? "ok" : "FAIL", ok ? "ok" : "FAIL");
+	return ok ? 0 : 1;
+}
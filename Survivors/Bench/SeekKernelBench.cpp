@@ -0,0 +1,126 @@
+﻿// 적 추적 이동 배치 커널 (SeekBatch) 헤드리스 벤치마크
+// 스칼라 / SSE / AVX2 커널의 마리당 시간과, 스칼라 결과 대비 오차가 허용 범위 안인지 검사
+// 빌드 : g++ -O2 -std=c++14 Bench/SeekKernelBench.cpp -o SeekKernelBench
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <algorithm>
+#include "../Source/Objects/EnemyPool.h"
+
+static const float kDt = 1.0f / 60.0f;
+
+static void Fill(EnemyPool& pool, int count, unsigned int seed)
+{
+	srand(seed);
+	for (int i = 0; i < count; i++)
+	{
+		pool.type[i] = i % 7;
+		pool.Spawn(i, (rand() / (float)RAND_MAX) * 20.0f - 10.0f, (rand() / (float)RAND_MAX) * 20.0f - 10.0f, 0.0f);
+
+		// 4마리 중 1마리는 죽은 상태 (실제 풀처럼 군데군데 비어있게)
+		if (rand() % 4 == 0) pool.Kill(i);
+	}
+}
+
+static void Run(SimdLevel level, EnemyPool& pool, float targetX, float targetY)
+{
+	SeekKernelLevel() = level;
+	pool.MoveTowards(targetX, targetY, kDt);
+}
+
+// 같은 상태에서 한 번 이동시켜 스칼라 결과와 비교, 허용 오차를 넘으면 false
+static bool CheckTolerance(SimdLevel level, int count, double& outWorstRatio)
+{
+	EnemyPool reference, candidate;
+	reference.Initialize(count);
+	candidate.Initialize(count);
+	Fill(reference, count, 7);
+	Fill(candidate, count, 7);
+
+	// 플레이어와 완전히 겹친 적도 하나 섞어서 0 나누기 처리까지 확인
+	reference.x[0] = candidate.x[0] = 1.0f;
+	reference.y[0] = candidate.y[0] = 2.0f;
+
+	Run(SimdLevel::Scalar, reference, 1.0f, 2.0f);
+	Run(level, candidate, 1.0f, 2.0f);
+
+	bool ok = true;
+	outWorstRatio = 0.0;
+
+	for (int i = 0; i < count; i++)
+	{
+		float step = reference.speed[i] * kDt;
+		float diffs[2] = { std::fabs(reference.x[i] - candidate.x[i]), std::fabs(reference.y[i] - candidate.y[i]) };
+		float values[2] = { reference.x[i], reference.y[i] };
+
+		for (int axis = 0; axis < 2; axis++)
+		{
+			float ulp = std::nextafter(std::fabs(values[axis]), INFINITY) - std::fabs(values[axis]);
+			float allowed = SEEK_KERNEL_TOLERANCE * step + 2.0f * ulp;
+			if (diffs[axis] > allowed) ok = false;
+
+			// 위치 자체의 반올림 (ulp)을 뺀 나머지가 rsqrt 근사 때문에 생긴 오차
+			double excess = (std::max)(0.0f, diffs[axis] - 2.0f * ulp);
+			double ratio = step > 0.0f ? excess / step : 0.0;
+			if (ratio > outWorstRatio) outWorstRatio = ratio;
+		}
+	}
+
+	return ok;
+}
+
+int main()
+{
+	SimdLevel best = DetectSimdLevel();
+	SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE, SimdLevel::AVX2 };
+	int levelCount = best == SimdLevel::AVX2 ? 3 : (best == SimdLevel::SSE ? 2 : 1);
+
+	printf("detected kernel : %s, tolerance = %.1e * speed * dt + 2 ulp\n\n", GetSimdLevelName(best), SEEK_KERNEL_TOLERANCE);
+
+	bool allOk = true;
+	for (int l = 1; l < levelCount; l++)
+	{
+		double worst = 0.0;
+		bool ok = CheckTolerance(levels[l], 20000, worst);
+		allOk = allOk && ok;
+		printf("%-6s vs Scalar : worst (|diff| - 2ulp) / (speed*dt) = %.3e  %s\n", GetSimdLevelName(levels[l]), worst, ok ? "OK" : "FAIL");
+	}
+
+	const int counts[] = { 60, 1000, 10000, 20000, 100000 };
+	printf("\n%8s", "enemies");
+	for (int l = 0; l < levelCount; l++) printf(" %13s", GetSimdLevelName(levels[l]));
+	printf("   (ns / enemy)\n");
+
+	for (int count : counts)
+	{
+		printf("%8d", count);
+
+		for (int l = 0; l < levelCount; l++)
+		{
+			EnemyPool pool;
+			pool.Initialize(count);
+			Fill(pool, count, 11);
+
+			using Clock = std::chrono::high_resolution_clock;
+			int iterations = 0;
+			double elapsed = 0.0;
+			auto start = Clock::now();
+
+			// 목표가 원을 그리며 움직여서 적들이 한 점으로 뭉치지 않게 함
+			while (iterations < 20 || elapsed < 200.0)
+			{
+				float angle = iterations * 0.01f;
+				Run(levels[l], pool, std::cos(angle) * 5.0f, std::sin(angle) * 5.0f);
+				iterations++;
+				elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+			}
+
+			printf(" %13.2f", elapsed * 1e6 / iterations / count);
+		}
+		printf("\n");
+	}
+
+	SeekKernelLevel() = best;
+	return allOk ? 0 : 1;
+}
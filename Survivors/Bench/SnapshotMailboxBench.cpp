@@ -0,0 +1,178 @@
+﻿// 렌더 스냅샷 우편함 (SnapshotMailbox) 헤드리스 스트레스 테스트
+// 시뮬레이션 스레드처럼 그리기 명령 스트림 (RenderSnapshot)을 계속 만들어 넣는 스레드와, 렌더 스레드처럼 가장 최근 것만 받아서 읽는 스레드를 동시에 돌림
+// 한 스레드에서 업데이트 -> 그리기 -> vsync 대기를 번갈아 하던 예전 방식과, 나눈 뒤 (렌더 60Hz / 렌더도 쉬지 않음)의 초당 업데이트 수를 비교
+// 받은 스냅샷이 중간에 섞이지 않았는지 (모든 인스턴스가 같은 번호), 쓰는 칸과 읽는 칸이 겹치지 않는지,
+// 번호가 항상 늘어나는지, 쓰기를 멈추면 마지막 것을 받는지, 넣은 수 = 받은 수 + 버려진 수인지 검사
+// 빌드 : g++ -O2 -std=c++14 -pthread Bench/SnapshotMailboxBench.cpp -o SnapshotMailboxBench (첫 인자로 경우마다 돌릴 초)
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "../Source/Utils/SnapshotMailbox.h"
+#include "../Source/Render/RenderSnapshot.h"
+
+// 칸마다 지금 쓰는 / 읽는 스레드 수 (겹치면 우편함이 틀린 것)
+struct StressSlot
+{
+	RenderSnapshot snapshot;
+	mutable std::atomic<int> writers{ 0 };
+	mutable std::atomic<int> readers{ 0 };
+};
+
+static const double kVsyncSeconds = 1.0 / 60.0;
+
+// 번호마다 스프라이트 수를 바꿔서 (벡터 크기가 계속 바뀌게) 채움, 모든 인스턴스의 tint는 번호
+static int SpriteCountFor(uint64_t sequence) { return 200 + (int)(sequence * 7919 % 1800); }
+
+static void FillSnapshot(RenderSnapshot& out, uint64_t sequence)
+{
+	for (RenderCommandStream& stream : out.streams) stream.Begin();
+	int count = SpriteCountFor(sequence);
+	for (int i = 0; i < count; i++)
+	{
+		SpriteInstance instance = {};
+		const float uv[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+		PackSprite(instance, (float)i, (float)sequence, 0.1f, 0.1f, false, uv, (uint32_t)sequence, 0);
+		out.streams[i % RENDER_STREAM_COUNT].Draw(i % 5, 1 + (int)((sequence + i) % 8), instance);
+	}
+	for (RenderCommandStream& stream : out.streams) stream.End();
+	out.merged.Merge(out.streams, RENDER_STREAM_COUNT);
+	out.simTick = (long long)sequence;
+	out.sequence = sequence;
+}
+
+// 받은 스냅샷이 한 번호로만 채워져 있는지
+static bool CheckSnapshot(const RenderSnapshot& snapshot)
+{
+	if (snapshot.merged.GetSpriteCount() != SpriteCountFor(snapshot.sequence) || snapshot.simTick != (long long)snapshot.sequence) return false;
+	for (const RenderCommandStream& stream : snapshot.streams)
+	{
+		for (const SpriteInstance& instance : stream.GetInstances())
+		{
+			if (instance.tint != (uint32_t)snapshot.sequence || instance.center[1] != (float)snapshot.sequence) return false;
+		}
+	}
+	return true;
+}
+
+struct StressResult
+{
+	double updatesPerSecond = 0.0;
+	double framesPerSecond = 0.0;
+	double droppedShare = 0.0;
+	double averageLag = 0.0;	// 받을 때 이미 더 새로 나온 스냅샷 수 평균
+	bool ok = true;
+};
+
+// 한 스레드 : 업데이트 (스냅샷 만들기) -> 그리기 (읽기) -> vsync까지 기다림
+static StressResult RunCoupled(double seconds)
+{
+	StressResult result;
+	RenderSnapshot snapshot;
+	uint64_t sequence = 0;
+	auto start = std::chrono::steady_clock::now();
+	auto next = start;
+	while (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() < seconds)
+	{
+		FillSnapshot(snapshot, ++sequence);
+		result.ok = result.ok && CheckSnapshot(snapshot);
+		next += std::chrono::microseconds((long long)(kVsyncSeconds * 1e6));
+		std::this_thread::sleep_until(next);
+	}
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	result.updatesPerSecond = result.framesPerSecond = sequence / elapsed;
+	return result;
+}
+
+// 두 스레드 : 쓰는 쪽은 쉬지 않고, 읽는 쪽은 vsync마다 (vsync가 false면 쉬지 않고) 가장 최근 것을 받음
+static StressResult RunDecoupled(double seconds, bool vsync)
+{
+	StressResult result;
+	SnapshotMailbox<StressSlot> mailbox;
+	std::atomic<bool> stop{ false };
+	std::atomic<uint64_t> latest{ 0 };
+	std::atomic<bool> writerOk{ true };
+
+	auto start = std::chrono::steady_clock::now();
+	std::thread producer([&]()
+		{
+			uint64_t sequence = 0;
+			while (!stop.load(std::memory_order_relaxed))
+			{
+				StressSlot& slot = mailbox.BeginWrite();
+				slot.writers++;
+				if (slot.readers.load() != 0) writerOk = false;
+				FillSnapshot(slot.snapshot, ++sequence);
+				slot.writers--;
+				mailbox.Publish();
+				latest.store(sequence, std::memory_order_relaxed);
+			}
+		});
+
+	uint64_t frames = 0, lastSequence = 0, lagSum = 0;
+	auto next = start;
+	while (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() < seconds)
+	{
+		if (mailbox.Acquire())
+		{
+			const StressSlot& slot = mailbox.Read();
+			slot.readers++;
+			if (slot.writers.load() != 0 || slot.snapshot.sequence <= lastSequence || !CheckSnapshot(slot.snapshot)) result.ok = false;
+			lastSequence = slot.snapshot.sequence;
+			uint64_t now = latest.load(std::memory_order_relaxed);
+			lagSum += now > lastSequence ? now - lastSequence : 0;
+			slot.readers--;
+			frames++;
+		}
+		if (vsync)
+		{
+			next += std::chrono::microseconds((long long)(kVsyncSeconds * 1e6));
+			std::this_thread::sleep_until(next);
+		}
+	}
+	stop = true;
+	producer.join();
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	// 쓰기가 멈췄으면 마지막 것을 받아야 하고, 넣은 수 = 받은 수 + 버려진 수 (+ 아직 안 받은 1개)
+	uint64_t published = mailbox.GetPublished();
+	bool gotLast = mailbox.Acquire() ? mailbox.Read().snapshot.sequence == published : lastSequence == published;
+	bool counted = mailbox.GetAcquired() + mailbox.GetDropped() == published;
+	result.ok = result.ok && writerOk && gotLast && counted && published > 0;
+
+	result.updatesPerSecond = published / elapsed;
+	result.framesPerSecond = frames / elapsed;
+	result.droppedShare = (double)mailbox.GetDropped() / published;
+	result.averageLag = frames > 0 ? (double)lagSum / frames : 0.0;
+	return result;
+}
+
+int main(int argc, char** argv)
+{
+	double seconds = argc > 1 ? atof(argv[1]) : 1.0;
+	if (seconds <= 0.0) seconds = 1.0;
+
+	struct Case
+	{
+		const char* name;
+		StressResult result;
+	};
+	Case cases[] =
+	{
+		{ "one thread, 60Hz vsync", RunCoupled(seconds) },
+		{ "sim + render 60Hz", RunDecoupled(seconds, true) },
+		{ "sim + render unthrottled", RunDecoupled(seconds, false) },
+	};
+
+	bool ok = true;
+	printf("%-26s %12s %10s %9s %8s %s\n", "mode", "updates/s", "frames/s", "dropped", "lag", "check");
+	for (const Case& c : cases)
+	{
+		ok = ok && c.result.ok;
+		printf("%-26s %12.0f %10.1f %8.1f%% %8.2f %s\n", c.name, c.result.updatesPerSecond, c.result.framesPerSecond,
+			c.result.droppedShare * 100.0, c.result.averageLag, c.result.ok ? "ok" : "FAIL");
+	}
+	printf("\nsim rate vs one thread : %.1fx, result %s\n", cases[1].result.updatesPerSecond / cases[0].result.updatesPerSecond, ok ? "ok" : "FAIL");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,350 @@
+﻿// CPU 스프라이트 래스터라이저 (SoftwareRasterizer) 헤드리스 벤치마크
+// 배경 + 젬 + 적 무리 + 미사일 (원형) + HP바 (단색) + 팔레트 텍스처 적으로 이루어진 1280x720 화면을
+// 스칼라 1스레드 / SSE2 1스레드 / SSE2 + 타일 병렬로 그려서 한 프레임 시간과 초당 프레임을 비교
+// 검사 : SSE2와 스칼라, 스레드 수와 상관없이 화면이 비트 단위로 같은지
+//        셰이더를 그대로 옮긴 픽셀 단위 기준 구현 (타일 / 1차식 없이 픽셀마다 모든 스프라이트의 정점 셰이더 역변환 + 픽셀 셰이더)과
+//        작은 화면에서 모든 픽셀이 같은지 (점 샘플링 / 가장자리 경계에 딱 걸린 픽셀은 1/1000 픽셀 옮긴 기준 결과 중 하나와 같으면 허용)
+//        PNG로 저장한 화면을 stb_image로 다시 읽었을 때 같은지
+// 빌드 : g++ -O2 -std=c++14 -pthread Bench/SoftwareRasterBench.cpp -o SoftwareRasterBench (첫 인자로 PNG 경로를 주면 남기고, 없으면 $TMPDIR에 썼다가 확인 후 지움)
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <cmath>
+#include <chrono>
+#include <vector>
+#define STB_IMAGE_IMPLEMENTATION
+#include "../Source/Utils/stb_image.h"
+#include "../Source/Render/SoftwareRasterizer.h"
+#include "../Source/Render/TextureMips.h"
+
+static const float kClearColor[4] = { 0.1f, 0.1f, 0.3f, 1.0f };
+
+struct BenchTextures
+{
+	SoftwareTextureTable table;
+	int background = 0;
+	int character = 0;
+	int sheet = 0;		// 가로 4프레임
+	int paletted = 0;
+	int paletteRow = -1;
+	int gem = 0;
+};
+
+// RGBA 텍스처 + 전체 밉
+static int AddRgbaTexture(SoftwareTextureTable& table, const std::vector<uint8_t>& rgba, int width, int height)
+{
+	std::vector<MipLevel> mips;
+	BuildMipChain(rgba.data(), width, height, (size_t)width * 4, GetFullMipCount(width, height), mips);
+	int index = table.AddTexture(width, height, (int)mips.size(), false);
+	SoftwareTexture& texture = const_cast<SoftwareTexture&>(*table.Get(index));
+	memcpy(texture.GetLevelPixels(0), rgba.data(), rgba.size());
+	for (int level = 1; level < (int)mips.size(); level++) memcpy(texture.GetLevelPixels(level), mips[level].pixels.data(), mips[level].pixels.size());
+	return index;
+}
+
+// 가운데가 불투명하고 가장자리로 갈수록 알파가 0까지 내려가는 무늬 (알파 0.1 경계가 많이 생기게)
+static std::vector<uint8_t> MakeBlob(int width, int height, int frames, unsigned int seed)
+{
+	srand(seed);
+	std::vector<uint8_t> rgba((size_t)width * height * 4);
+	int frameWidth = width / frames;
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			float fx = ((x % frameWidth) + 0.5f) / frameWidth - 0.5f;
+			float fy = (y + 0.5f) / height - 0.5f;
+			float edge = 1.0f - std::sqrt(fx * fx + fy * fy) * 2.0f;
+			uint8_t* p = &rgba[((size_t)y * width + x) * 4];
+			p[0] = (uint8_t)(x * 255 / width);
+			p[1] = (uint8_t)(y * 255 / height);
+			p[2] = (uint8_t)(rand() & 0xFF);
+			p[3] = (uint8_t)(edge <= 0.0f ? 0 : (edge >= 0.5f ? 255 : edge * 510.0f));
+		}
+	}
+	return rgba;
+}
+
+static BenchTextures MakeTextures()
+{
+	BenchTextures textures;
+	SoftwareTextureTable& table = textures.table;
+
+	std::vector<uint8_t> checker(256 * 256 * 4);
+	for (int y = 0; y < 256; y++)
+	{
+		for (int x = 0; x < 256; x++)
+		{
+			bool dark = ((x / 32) + (y / 32)) % 2 == 0;
+			uint8_t* p = &checker[((size_t)y * 256 + x) * 4];
+			p[0] = dark ? 40 : 70;
+			p[1] = dark ? 90 : 120;
+			p[2] = (uint8_t)(x ^ y);
+			p[3] = 255;
+		}
+	}
+	textures.background = AddRgbaTexture(table, checker, 256, 256);
+	textures.character = AddRgbaTexture(table, MakeBlob(64, 64, 1, 1), 64, 64);
+	textures.sheet = AddRgbaTexture(table, MakeBlob(256, 64, 4, 2), 256, 64);
+	textures.gem = AddRgbaTexture(table, MakeBlob(16, 16, 1, 3), 16, 16);
+
+	// 팔레트 텍스처 : 0번 색은 투명, 나머지는 번호마다 다른 색
+	uint32_t palette[ASSET_PACK_PALETTE_SIZE];
+	for (int i = 0; i < (int)ASSET_PACK_PALETTE_SIZE; i++) palette[i] = i == 0 ? 0u : PackTint((i % 7) / 6.0f, (i % 5) / 4.0f, (i % 3) / 2.0f, 1.0f);
+	textures.paletteRow = table.AddPaletteRow(palette);
+	textures.paletted = table.AddTexture(48, 48, 1, true);
+	uint8_t* indices = const_cast<SoftwareTexture&>(*table.Get(textures.paletted)).GetLevelPixels(0);
+	for (int y = 0; y < 48; y++)
+	{
+		for (int x = 0; x < 48; x++) indices[y * 48 + x] = (uint8_t)((x - 24) * (x - 24) + (y - 24) * (y - 24) < 22 * 22 ? 1 + (x / 4 + y / 4) % 200 : 0);
+	}
+	return textures;
+}
+
+static float Random(float low, float high) { return low + (high - low) * (rand() / (float)RAND_MAX); }
+
+static void Push(std::vector<SpriteInstance>& out, float x, float y, float sizeX, float sizeY, bool flipped, const float uv[4], uint32_t tint, int type, int texture, int paletteRow = -1)
+{
+	SpriteInstance instance;
+	PackSprite(instance, x, y, sizeX, sizeY, flipped, uv, tint, type);
+	instance.typeFlags |= PackPaletteRow(paletteRow) | ((uint32_t)texture << SPRITE_TEXTURE_SHIFT);
+	out.push_back(instance);
+}
+
+// 게임 한 화면처럼 그리는 순서 (레이어 순서)대로 인스턴스를 만듦
+static std::vector<SpriteInstance> MakeScene(const BenchTextures& textures, int enemies, unsigned int seed)
+{
+	srand(seed);
+	std::vector<SpriteInstance> scene;
+	const float full[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+	// 배경 : 화면보다 훨씬 크고 uv를 여러 번 반복 (WRAP)
+	const float tiled[4] = { 0.13f, -0.27f, 11.3f, 11.7f };
+	Push(scene, 0.05f, -0.03f, 9.7f, 9.9f, false, tiled, 0xFFFFFFFF, 0, textures.background);
+
+	for (int i = 0; i < enemies / 2; i++) Push(scene, Random(-1.1f, 1.1f), Random(-1.1f, 1.1f), 0.04f, 0.06f, false, full, 0xFFFFFFFF, 0, textures.gem);
+
+	// 적 : 크기 / 프레임 / 좌우 / 틴트가 제각각, 일부는 팔레트 텍스처, 아주 작은 것은 밉을 탐
+	for (int i = 0; i < enemies; i++)
+	{
+		float size = Random(0.02f, 0.3f);
+		bool flipped = rand() % 2 == 0;
+		uint32_t tint = PackTint(Random(0.5f, 1.0f), Random(0.5f, 1.0f), Random(0.5f, 1.0f), 1.0f);
+		float x = Random(-1.1f, 1.1f), y = Random(-1.1f, 1.1f);
+		int kind = rand() % 4;
+		if (kind == 0)
+		{
+			float frame[4] = { (rand() % 4) * 0.25f, 0.0f, 0.25f, 1.0f };
+			Push(scene, x, y, size, size * 1.3f, flipped, frame, tint, 0, textures.sheet);
+		}
+		else if (kind == 1) Push(scene, x, y, size, size * 1.3f, flipped, full, tint, 0, textures.paletted, textures.paletteRow);
+		else Push(scene, x, y, size, size * 1.3f, flipped, full, tint, 0, textures.character);
+	}
+
+	Push(scene, 0.0f, 0.0f, 0.45f, 0.6f, true, full, 0xFFFFFFFF, 0, textures.character);	// 플레이어
+
+	for (int i = 0; i < enemies / 4; i++) Push(scene, Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), 0.05f, 0.05f, false, full, 0xFF30C0FF, 1, 0);
+
+	// UI : HP바 (단색), 텍스처 없는 텍스처 모드 (안 그려져야 함)
+	Push(scene, 0.0f, -0.2f, 0.2f, 0.03f, false, full, 0xFF202020, 2, 0);
+	Push(scene, -0.02f, -0.2f, 0.16f, 0.02f, false, full, 0xFF2020E0, 2, 0);
+	Push(scene, 0.5f, 0.5f, 0.3f, 0.3f, false, full, 0xFFFFFFFF, 0, 0);
+	return scene;
+}
+
+// ---- 기준 구현 : shaders.hlsl을 픽셀마다 그대로 (정점 셰이더 역변환 + 픽셀 셰이더, double) ----
+
+static bool ReferenceSample(const SoftwareTextureTable& table, const SpriteInstance& instance, double u, double v, double rho, uint32_t& out)
+{
+	const SoftwareTexture* texture = table.Get((int)(instance.typeFlags >> SPRITE_TEXTURE_SHIFT));
+	if (texture == nullptr) return false;
+
+	int level = rho > 1.0 ? (std::min)((int)std::floor(std::log2(rho) + 0.5), texture->mipLevels - 1) : 0;
+	int width = texture->levels[level].width, height = texture->levels[level].height;
+	int tx = (int)std::floor((u - std::floor(u)) * width) % width;
+	int ty = (int)std::floor((v - std::floor(v)) * height) % height;
+
+	// 보통 텍스처는 RGBA, R8 팔레트 텍스처는 (번호, 0, 0, 1)
+	double color[4];
+	if (texture->paletted)
+	{
+		uint8_t index = texture->GetLevelPixels(level)[ty * width + tx];
+		color[0] = index / 255.0; color[1] = 0.0; color[2] = 0.0; color[3] = 1.0;
+	}
+	else
+	{
+		const uint8_t* p = texture->GetLevelPixels(level) + ((size_t)ty * width + tx) * 4;
+		for (int c = 0; c < 4; c++) color[c] = p[c] / 255.0;
+	}
+
+	uint32_t paletteRow = (instance.typeFlags >> SPRITE_PALETTE_SHIFT) & SPRITE_PALETTE_MASK;
+	if (paletteRow != 0)
+	{
+		const SoftwareTexture* palette = table.Get(SOFTWARE_PALETTE_TEXTURE);
+		if (palette == nullptr || (int)paletteRow > palette->levels[0].height) return false;
+		uint32_t index = (uint32_t)(color[0] * 255.0 + 0.5);
+		const uint8_t* p = palette->GetLevelPixels(0) + ((size_t)(paletteRow - 1) * palette->levels[0].width + index) * 4;
+		for (int c = 0; c < 4; c++) color[c] = p[c] / 255.0;
+	}
+
+	if (color[3] - 0.1 < 0.0) return false;	// clip(color.a - 0.1)
+	out = 0;
+	for (int c = 0; c < 4; c++)
+	{
+		double tint = ((instance.tint >> (c * 8)) & 0xFF) / 255.0;
+		out |= (uint32_t)std::floor(color[c] * tint * 255.0 + 0.5) << (c * 8);
+	}
+	return true;
+}
+
+// 픽셀 중심을 (shiftX, shiftY) 픽셀만큼 옮겨서 그림 (점 샘플링 / 가장자리 경계에 딱 걸린 픽셀은 어느 쪽이 맞는지 정할 수 없으므로 양쪽을 다 구함)
+static void RenderReference(const std::vector<SpriteInstance>& scene, const SoftwareTextureTable& table, int width, int height,
+	double shiftX, double shiftY, std::vector<uint32_t>& out)
+{
+	out.assign((size_t)width * height, PackTint(kClearColor[0], kClearColor[1], kClearColor[2], kClearColor[3]));
+	for (const SpriteInstance& instance : scene)
+	{
+		double hx = instance.halfSize[0], hy = instance.halfSize[1];
+		if (hx == 0.0 || hy == 0.0) continue;
+		bool flipped = (instance.typeFlags & SPRITE_FLIP_X) != 0;
+		int type = (int)(instance.typeFlags & SPRITE_TYPE_MASK);
+
+		// 정점 셰이더가 만든 모서리의 픽셀 좌표
+		double xa = (instance.center[0] - hx + 1.0) * 0.5 * width, xb = (instance.center[0] + hx + 1.0) * 0.5 * width;
+		double ya = (1.0 - (instance.center[1] + hy)) * 0.5 * height, yb = (1.0 - (instance.center[1] - hy)) * 0.5 * height;
+		double left = (std::min)(xa, xb), right = (std::max)(xa, xb), top = (std::min)(ya, yb), bottom = (std::max)(ya, yb);
+
+		// 픽셀 하나 옆으로 갈 때 uv 변화 (셰이더의 ddx / ddy)
+		const SoftwareTexture* texture = table.Get((int)(instance.typeFlags >> SPRITE_TEXTURE_SHIFT));
+		double rho = texture == nullptr ? 0.0 : (std::max)(std::fabs(instance.uvRect[2] / (hx * width)) * texture->levels[0].width, std::fabs(instance.uvRect[3] / (hy * height)) * texture->levels[0].height);
+
+		for (int py = 0; py < height; py++)
+		{
+			double cy = py + 0.5 + shiftY;
+			if (cy < top || cy >= bottom) continue;
+			for (int px = 0; px < width; px++)
+			{
+				double cx = px + 0.5 + shiftX;
+				if (cx < left || cx >= right) continue;
+
+				// 화면 좌표 -> 모서리 (-1 ~ 1) -> 크기 1 사각형 -> uv
+				double ndcX = cx / width * 2.0 - 1.0, ndcY = 1.0 - cy / height * 2.0;
+				double cornerX = (ndcX - instance.center[0]) / hx, cornerY = (ndcY - instance.center[1]) / hy;
+				if (flipped) cornerX = -cornerX;
+				double u = (cornerX * 0.5 + 0.5) * instance.uvRect[2] + instance.uvRect[0];
+				double v = (0.5 - cornerY * 0.5) * instance.uvRect[3] + instance.uvRect[1];
+
+				uint32_t color;
+				if (type == 1)
+				{
+					if (0.5 - std::sqrt((u - 0.5) * (u - 0.5) + (v - 0.5) * (v - 0.5)) < 0.0) continue;
+					color = instance.tint;
+				}
+				else if (type == 2) color = instance.tint;
+				else if (!ReferenceSample(table, instance, u, v, rho, color)) continue;
+				out[(size_t)py * width + px] = color;
+			}
+		}
+	}
+}
+
+template<typename Fn>
+static double BestMs(int repeats, Fn&& fn)
+{
+	double best = 1e30;
+	for (int r = 0; r < repeats; r++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		fn();
+		best = (std::min)(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
+	return best;
+}
+
+int main(int argc, char** argv)
+{
+	// 경로를 안 주면 작업 폴더를 더럽히지 않게 임시 폴더에 씀
+	bool keepPng = argc > 1;
+	const char* tempDir = getenv("TMPDIR");
+	std::string pngPathStorage = keepPng ? argv[1] : std::string(tempDir != nullptr ? tempDir : "/tmp") + "/SoftwareRasterBench.png";
+	const char* pngPath = pngPathStorage.c_str();
+	BenchTextures textures = MakeTextures();
+	bool ok = true;
+
+	// 기준 구현과 비교 (작은 화면, 적 300)
+	{
+		const int width = 320, height = 180;
+		std::vector<SpriteInstance> scene = MakeScene(textures, 300, 7);
+		SoftwareRasterizer rasterizer;
+		rasterizer.Initialize(width, height);
+		rasterizer.Render(scene.data(), (int)scene.size(), kClearColor, textures.table);
+
+		// 경계에서 1/1000 픽셀 옮긴 결과 중 하나와 같으면 경계 차이 (GPU도 어느 쪽일지 정해지지 않음), 어느 것과도 다르면 틀린 것
+		const double shift = 1e-3;
+		std::vector<std::vector<uint32_t>> references(9);
+		for (int r = 0; r < 9; r++) RenderReference(scene, textures.table, width, height, (r % 3 - 1) * shift, (r / 3 - 1) * shift, references[r]);
+
+		int exact = 0, boundary = 0, wrong = 0;
+		for (int i = 0; i < width * height; i++)
+		{
+			uint32_t pixel = rasterizer.GetPixels()[i];
+			if (pixel == references[4][i])
+			{
+				exact++;
+				continue;
+			}
+			bool near = false;
+			for (int r = 0; r < 9 && !near; r++) near = pixel == references[r][i];
+			if (near) boundary++;
+			else wrong++;
+		}
+		bool match = wrong == 0 && boundary < width * height / 100;
+		ok = ok && match;
+		printf("reference %dx%d, %d sprites : exact %d, boundary %d, wrong %d %s\n\n", width, height, (int)scene.size(), exact, boundary, wrong,
+			match ? "ok" : "FAIL");
+	}
+
+	const int width = 1280, height = 720;
+	const int enemyCounts[] = { 60, 500, 2000 };
+	JobSystem jobs;
+	jobs.Initialize();
+
+	printf("%8s %8s %8s %12s %11s %11s %8s %7s %s\n", "enemies", "sprites", "binned", "scalar ms", "sse2 ms", "tiles ms", "fps", "speedup", "check");
+	for (int enemies : enemyCounts)
+	{
+		std::vector<SpriteInstance> scene = MakeScene(textures, enemies, 11);
+		int count = (int)scene.size();
+
+		SoftwareRasterizer scalar, simd, tiled;
+		scalar.Initialize(width, height);
+		simd.Initialize(width, height);
+		tiled.Initialize(width, height);
+		scalar.SetSimd(false);
+
+		double scalarMs = BestMs(3, [&]() { scalar.Render(scene.data(), count, kClearColor, textures.table); });
+		double simdMs = BestMs(3, [&]() { simd.Render(scene.data(), count, kClearColor, textures.table); });
+		double tiledMs = BestMs(3, [&]() { tiled.Render(scene.data(), count, kClearColor, textures.table, &jobs); });
+
+		size_t bytes = (size_t)width * height * 4;
+		bool same = memcmp(scalar.GetPixels(), simd.GetPixels(), bytes) == 0 && memcmp(simd.GetPixels(), tiled.GetPixels(), bytes) == 0;
+		ok = ok && same;
+		printf("%8d %8d %8d %12.2f %11.2f %11.2f %8.1f %6.2fx %s\n", enemies, count, tiled.GetBinnedCount(), scalarMs, simdMs, tiledMs,
+			1000.0 / tiledMs, scalarMs / tiledMs, same ? "ok" : "FAIL");
+
+		// 가장 많은 화면을 PNG로 저장하고 다시 읽어서 비교
+		if (enemies == enemyCounts[2])
+		{
+			bool saved = tiled.SavePng(pngPath);
+			int loadedWidth = 0, loadedHeight = 0, channels = 0;
+			unsigned char* loaded = saved ? stbi_load(pngPath, &loadedWidth, &loadedHeight, &channels, STBI_rgb_alpha) : nullptr;
+			bool roundTrip = loaded != nullptr && loadedWidth == width && loadedHeight == height && memcmp(loaded, tiled.GetPixels(), bytes) == 0;
+			if (loaded != nullptr) stbi_image_free(loaded);
+			ok = ok && roundTrip;
+			printf("\npng %s (%dx%d) : %s\n", pngPath, width, height, roundTrip ? "ok" : "FAIL");
+			if (!keepPng) remove(pngPath);
+		}
+	}
+
+	printf("workers %d, result %s\n", jobs.GetWorkerCount(), ok ? "ok" : "FAIL");
+	return ok ? 0 : 1;
+}
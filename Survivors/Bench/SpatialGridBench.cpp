@@ -0,0 +1,97 @@
+﻿// 적 밀어내기 (Separation) 헤드리스 벤치마크
+// 격자 브로드페이즈 (SolveSeparation)와 기존 O(n²) 전수 비교를 같은 배치에서 비교
+// 빌드 : g++ -O2 -std=c++14 Bench/SpatialGridBench.cpp -o SpatialGridBench
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <vector>
+#include "../Source/Utils/SpatialGrid.h"
+
+// 기존 D3D12Manager::Update에 있던 이중 for 밀어내기 (비교 기준)
+static void BruteForceSeparation(float* xs, float* ys, const unsigned char* alive, int count, float minDistance, float pushStrength)
+{
+	for (int i = 0; i < count; i++)
+	{
+		if (!alive[i]) continue;
+
+		for (int j = i + 1; j < count; j++)
+		{
+			if (!alive[j]) continue;
+
+			float dx = xs[j] - xs[i];
+			float dy = ys[j] - ys[i];
+			float dist = std::sqrt((dx * dx) + (dy * dy));
+
+			if (dist < minDistance && dist > 0.0001f)
+			{
+				float overlap = minDistance - dist;
+				float pushX = (dx / dist) * (overlap * pushStrength);
+				float pushY = (dy / dist) * (overlap * pushStrength);
+
+				xs[i] -= pushX; ys[i] -= pushY;
+				xs[j] += pushX; ys[j] += pushY;
+			}
+		}
+	}
+}
+
+// 플레이어를 둘러싼 무리처럼 원판 안에 적을 흩뿌림 (적 1마리당 면적을 일정하게 유지)
+static void Scatter(std::vector<float>& xs, std::vector<float>& ys, int count, float minDistance)
+{
+	float radius = std::sqrt(count * minDistance * minDistance / 3.14159265f);
+	srand(1234);
+
+	for (int i = 0; i < count; i++)
+	{
+		float a = (rand() / (float)RAND_MAX) * 6.2831853f;
+		float r = std::sqrt(rand() / (float)RAND_MAX) * radius;
+		xs[i] = std::cos(a) * r;
+		ys[i] = std::sin(a) * r;
+	}
+}
+
+template<typename Fn>
+static double MeasureMs(int minIterations, Fn&& fn)
+{
+	using Clock = std::chrono::high_resolution_clock;
+	int iterations = 0;
+	auto start = Clock::now();
+	double elapsed = 0.0;
+
+	// 최소 반복 횟수와 최소 0.2초 중 더 긴 쪽만큼 반복해서 평균
+	while (iterations < minIterations || elapsed < 200.0)
+	{
+		fn();
+		iterations++;
+		elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	return elapsed / iterations;
+}
+
+int main()
+{
+	const float minDistance = 0.2f;
+	const float pushStrength = 0.5f * (1.0f / 60.0f);
+	const int counts[] = { 60, 250, 1000, 2500, 5000, 10000, 20000 };
+
+	printf("%8s %14s %14s %14s %10s\n", "enemies", "grid ms/tick", "brute ms/tick", "grid ns/enemy", "speedup");
+
+	for (int count : counts)
+	{
+		std::vector<float> xs(count), ys(count);
+		std::vector<unsigned char> alive(count, 1);
+		SpatialGrid grid;
+
+		Scatter(xs, ys, count, minDistance);
+		double gridMs = MeasureMs(20, [&]() { SolveSeparation(grid, xs.data(), ys.data(), alive.data(), count, minDistance, pushStrength); });
+
+		Scatter(xs, ys, count, minDistance);
+		double bruteMs = MeasureMs(3, [&]() { BruteForceSeparation(xs.data(), ys.data(), alive.data(), count, minDistance, pushStrength); });
+
+		printf("%8d %14.4f %14.4f %14.1f %9.1fx\n", count, gridMs, bruteMs, gridMs * 1e6 / count, bruteMs / gridMs);
+	}
+
+	return 0;
+}
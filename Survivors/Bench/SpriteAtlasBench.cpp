@@ -0,0 +1,226 @@
+﻿// 스프라이트 아틀라스 (SpriteAtlas) 벤치마크
+// Assets/Textures/frames.txt에 있는 시트마다 프레임을 트림 / 중복 제거해서 MaxRects로 아틀라스 페이지 하나에 채우고
+// 가로 한 줄 시트 그대로 올릴 때와 아틀라스로 올릴 때의 텍스처 메모리 (RGBA8), 페이지 채움률, 만드는 시간을 비교
+// 칸이 4픽셀 단위로 겹치지 않고 페이지 안에 있는지, 모든 프레임의 그림이 아틀라스에서 픽셀 단위로 되살아나는지,
+// 잘라낸 바깥이 정말 투명한지, uv / 사각형 비율이 칸 자리와 맞는지, 같은 프레임이 하나로 합쳐지는지도 검사
+// 빌드 : g++ -O2 -std=c++14 -pthread Bench/SpriteAtlasBench.cpp -o SpriteAtlasBench (Survivors 폴더에서 실행하거나 첫 인자로 텍스처 폴더)
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <string>
+#include <chrono>
+#include <vector>
+#define STB_IMAGE_IMPLEMENTATION
+#include "../Source/Utils/AssetPackBuilder.h"
+
+static double Seconds(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static bool Overlaps(const AtlasRect& a, const AtlasRect& b)
+{
+	return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+// 아틀라스가 시트를 그대로 담았는지 (칸 배치, 그림 픽셀, 트림 바깥 투명, uv / 사각형 비율)
+static bool CheckAtlas(const uint8_t* rgba, int width, int height, int frames, const SpriteAtlas& atlas, const SpriteAtlasOptions& options)
+{
+	if (atlas.width % 4 != 0 || atlas.height % 4 != 0 || atlas.width > options.maxSize || atlas.height > options.maxSize) return false;
+	for (size_t i = 0; i < atlas.cells.size(); i++)
+	{
+		const AtlasRect& cell = atlas.cells[i];
+		if (cell.x % 4 != 0 || cell.y % 4 != 0 || cell.width % 4 != 0 || cell.height % 4 != 0) return false;
+		if (cell.x < 0 || cell.y < 0 || cell.x + cell.width > atlas.width || cell.y + cell.height > atlas.height) return false;
+		for (size_t j = 0; j < i; j++)
+		{
+			if (Overlaps(cell, atlas.cells[j])) return false;
+		}
+	}
+
+	double frameWidth = (double)width / frames;
+	for (int frame = 0; frame < frames; frame++)
+	{
+		const AtlasFrame& out = atlas.frames[frame];
+		int x0, x1;
+		GetSheetFrameSpan(width, frames, frame, x0, x1);
+
+		// 트림 바깥은 투명해야 함
+		for (int y = 0; y < height; y++)
+		{
+			for (int x = x0; x < x1; x++)
+			{
+				bool inside = out.unique >= 0 && x >= out.trim.x && x < out.trim.x + out.trim.width && y >= out.trim.y && y < out.trim.y + out.trim.height;
+				if (!inside && rgba[((size_t)y * width + x) * 4 + 3] > options.alphaThreshold) return false;
+			}
+		}
+		if (out.unique < 0) continue;
+		if (out.unique >= (int)atlas.cells.size()) return false;
+
+		// 그림이 칸 안 padding 자리부터 그대로 있어야 함
+		const AtlasRect& cell = atlas.cells[out.unique];
+		if (out.trim.width + options.padding * 2 > cell.width || out.trim.height + options.padding * 2 > cell.height) return false;
+		for (int y = 0; y < out.trim.height; y++)
+		{
+			const uint8_t* src = rgba + ((size_t)(out.trim.y + y) * width + out.trim.x) * 4;
+			const uint8_t* dst = &atlas.pixels[((size_t)(cell.y + options.padding + y) * atlas.width + cell.x + options.padding) * 4];
+			if (memcmp(src, dst, (size_t)out.trim.width * 4) != 0) return false;
+		}
+
+		// uv는 칸 자리, 사각형 비율은 원래 프레임 안의 자리
+		const float eps = 1e-4f;
+		if (std::fabs(out.uvRect[0] * atlas.width - (cell.x + options.padding)) > eps * atlas.width) return false;
+		if (std::fabs(out.uvRect[1] * atlas.height - (cell.y + options.padding)) > eps * atlas.height) return false;
+		if (std::fabs(out.uvRect[2] * atlas.width - out.trim.width) > eps * atlas.width) return false;
+		if (std::fabs(out.uvRect[3] * atlas.height - out.trim.height) > eps * atlas.height) return false;
+		if (std::fabs(out.quadRect[0] * frameWidth + frame * frameWidth - out.trim.x) > 1e-2) return false;
+		if (std::fabs(out.quadRect[2] * frameWidth - out.trim.width) > 1e-2) return false;
+		if (std::fabs(out.quadRect[1] * height - out.trim.y) > 1e-2 || std::fabs(out.quadRect[3] * height - out.trim.height) > 1e-2) return false;
+	}
+	return true;
+}
+
+// 만든 시트 : 8프레임 (40x32), 4번은 1번과 같은 그림을 3픽셀 옮긴 것 (하나로 합쳐지고 사각형 자리만 다름), 7번은 비어있음
+static bool CheckSyntheticSheet()
+{
+	const int frames = 8, frameWidth = 40, height = 32, width = frames * frameWidth;
+	std::vector<uint8_t> rgba((size_t)width * height * 4, 0);
+	auto fill = [&](int frame, int x, int y, int size, uint8_t shade)
+	{
+		for (int dy = 0; dy < size; dy++)
+		{
+			for (int dx = 0; dx < size; dx++)
+			{
+				uint8_t* p = &rgba[((size_t)(y + dy) * width + frame * frameWidth + x + dx) * 4];
+				p[0] = shade;
+				p[1] = (uint8_t)(dx * 8);
+				p[2] = (uint8_t)(dy * 8);
+				p[3] = 255;
+			}
+		}
+	};
+	for (int frame = 0; frame < 7; frame++)
+	{
+		if (frame == 4) fill(4, 8, 6, 12, 40);		// 1번과 같은 그림
+		else fill(frame, 2 + frame, 3, 10 + frame * 2, (uint8_t)(frame * 40));
+	}
+
+	SpriteAtlasOptions options;
+	SpriteAtlas atlas;
+	if (!BuildSpriteAtlas(rgba.data(), width, height, frames, atlas, options)) return false;
+	if (atlas.uniqueFrames != 6 || atlas.emptyFrames != 1 || atlas.frames[4].unique != atlas.frames[1].unique) return false;
+	if (atlas.frames[7].quadRect[2] != 0.0f || atlas.frames[1].quadRect[0] == atlas.frames[4].quadRect[0]) return false;
+	return CheckAtlas(rgba.data(), width, height, frames, atlas, options);
+}
+
+// MaxRects : 임의 크기 사각형을 넣어서 겹치지 않고 안에 있는지
+static bool CheckMaxRects()
+{
+	srand(7);
+	MaxRectsPacker packer;
+	packer.Initialize(512, 512);
+	std::vector<AtlasRect> placed;
+	for (int i = 0; i < 400; i++)
+	{
+		AtlasRect rect;
+		if (!packer.Insert(4 + rand() % 60, 4 + rand() % 60, rect)) continue;
+		if (rect.x < 0 || rect.y < 0 || rect.x + rect.width > 512 || rect.y + rect.height > 512) return false;
+		for (const AtlasRect& other : placed)
+		{
+			if (Overlaps(rect, other)) return false;
+		}
+		placed.push_back(rect);
+	}
+	return placed.size() > 50;
+}
+
+int main(int argc, char** argv)
+{
+	// 텍스처 폴더 : 첫 인자, 없으면 이 파일 기준 ../Assets/Textures/
+	std::string root;
+	if (argc > 1)
+	{
+		root = argv[1];
+		if (!root.empty() && root.back() != '/' && root.back() != '\\') root += '/';
+	}
+	else
+	{
+		std::string self = __FILE__;
+		size_t slash = self.find_last_of("/\\");
+		root = (slash == std::string::npos ? std::string(".") : self.substr(0, slash)) + "/../Assets/Textures/";
+	}
+
+	bool maxRectsOk = CheckMaxRects();
+	bool syntheticOk = CheckSyntheticSheet();
+	printf("%-34s %s\n", "max rects (no overlap, in bounds)", maxRectsOk ? "ok" : "FAIL");
+	printf("%-34s %s\n\n", "synthetic sheet (trim / dedupe)", syntheticOk ? "ok" : "FAIL");
+	bool ok = maxRectsOk && syntheticOk;
+
+	std::map<std::string, TextureSettings> settings = LoadTextureSettings(root + "frames.txt");
+	if (settings.empty())
+	{
+		printf("frames.txt missing in %s\n", root.c_str());
+		return 1;
+	}
+
+	printf("%-22s %12s %9s %6s %10s %11s %10s %8s %7s %8s\n", "sheet", "size", "frames", "empty", "strip MB", "atlas", "atlas MB", "change", "fill", "ms");
+	SpriteAtlasOptions options;
+	uint64_t stripBytes = 0, atlasBytes = 0;
+	int sheets = 0;
+	for (const std::string& file : ListAssetFiles(root, ".png"))
+	{
+		std::string key = file;
+		for (char& c : key) c = (char)tolower((unsigned char)c);
+		auto found = settings.find(key);
+		if (found == settings.end() || found->second.frames < 2) continue;
+
+		int width = 0, height = 0, channels = 0;
+		unsigned char* pixels = stbi_load((root + file).c_str(), &width, &height, &channels, STBI_rgb_alpha);
+		if (pixels == nullptr)
+		{
+			printf("%-22s missing\n", file.c_str());
+			ok = false;
+			continue;
+		}
+		int frames = (std::min)(found->second.frames, width);
+
+		SpriteAtlas atlas;
+		auto start = std::chrono::steady_clock::now();
+		bool built = BuildSpriteAtlas(pixels, width, height, frames, atlas, options);
+		double ms = Seconds(start) * 1000.0;
+		bool sheetOk = built && CheckAtlas(pixels, width, height, frames, atlas, options);
+		ok = ok && sheetOk;
+
+		uint64_t trimmedArea = 0;
+		for (size_t cell = 0; cell < atlas.cells.size(); cell++)
+		{
+			for (const AtlasFrame& frame : atlas.frames)
+			{
+				if (frame.unique == (int)cell)
+				{
+					trimmedArea += (uint64_t)frame.trim.width * frame.trim.height;
+					break;
+				}
+			}
+		}
+
+		uint64_t strip = (uint64_t)width * height * 4, packed = (uint64_t)atlas.width * atlas.height * 4;
+		stripBytes += strip;
+		atlasBytes += packed;
+		sheets++;
+
+		char size[32], counts[32], page[32];
+		snprintf(size, sizeof(size), "%dx%d", width, height);
+		snprintf(counts, sizeof(counts), "%d -> %d", frames, atlas.uniqueFrames);
+		snprintf(page, sizeof(page), "%dx%d", atlas.width, atlas.height);
+		printf("%-22s %12s %9s %6d %10.2f %11s %10.2f %7.0f%% %6.1f%% %8.1f%s\n", file.c_str(), size, counts, atlas.emptyFrames,
+			strip / (1024.0 * 1024.0), page, packed / (1024.0 * 1024.0), 100.0 * packed / strip - 100.0,
+			packed > 0 ? 400.0 * trimmedArea / packed : 0.0, ms, sheetOk ? "" : "  FAIL");
+		stbi_image_free(pixels);
+	}
+
+	printf("\n%d sheets, RGBA8 %.1f MB -> %.1f MB (%.0f%%), result %s\n", sheets, stripBytes / (1024.0 * 1024.0), atlasBytes / (1024.0 * 1024.0),
+		stripBytes > 0 ? 100.0 * atlasBytes / stripBytes - 100.0 : 0.0, ok ? "ok" : "FAIL");
+	return ok ? 0 : 1;
+}
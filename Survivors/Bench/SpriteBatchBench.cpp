@@ -0,0 +1,163 @@
+﻿// 스프라이트 배치 빌더 (SpriteBatch) 헤드리스 벤치마크
+// 실제 게임 한 프레임 구성과 1만 개 무작위 스프라이트로 정렬 + 묶음 나누기 + 인스턴스 채우기 시간과 텍스처 묶음 수를 재고
+// 정렬 결과가 std::stable_sort와 같은지, 인스턴스에 텍스처 번호가 새겨졌는지, 묶음이 빠짐없이 이어지고 같은 텍스처끼리만 묶였는지 검사
+// (묶음 수는 텍스처마다 힙을 따로 쓰던 때의 힙 교체 / 드로우 콜 수, 지금은 전역 서술자 힙이라 드로우 콜 하나)
+// 빌드 : g++ -O2 -std=c++14 Bench/SpriteBatchBench.cpp -o SpriteBatchBench
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include "../Source/Render/SpriteBatch.h"
+
+struct Submit
+{
+	int layer;
+	int texture;
+};
+
+static SpriteInstance MakeInstance(int id)
+{
+	SpriteInstance instance = {};
+	instance.center[0] = (float)id;	// 정렬 후에도 어떤 스프라이트였는지 알 수 있게 표시
+	instance.tint = 0xFFFFFFFF;
+	return instance;
+}
+
+// 정렬 순서, 인스턴스 복사, 묶음 규칙 검사
+static bool Validate(const SpriteBatch& batch, const std::vector<Submit>& submits)
+{
+	int count = (int)submits.size();
+	if (batch.GetSpriteCount() != count) return false;
+
+	// 기준 : (레이어, 텍스처) 안정 정렬
+	std::vector<int> expected(count);
+	for (int i = 0; i < count; i++) expected[i] = i;
+	std::stable_sort(expected.begin(), expected.end(), [&](int a, int b)
+		{
+			if (submits[a].layer != submits[b].layer) return submits[a].layer < submits[b].layer;
+			return submits[a].texture < submits[b].texture;
+		});
+
+	for (int n = 0; n < count; n++)
+	{
+		if (batch.GetSubmitIndex(n) != expected[n]) return false;
+		if (batch.GetInstances()[n].center[0] != (float)expected[n]) return false;
+		if ((int)(batch.GetInstances()[n].typeFlags >> SPRITE_TEXTURE_SHIFT) != submits[expected[n]].texture) return false;
+	}
+
+	// 묶음 : 빈틈없이 이어지고, 묶음 안은 전부 같은 텍스처, 이웃한 묶음은 텍스처가 다름
+	int next = 0;
+	const std::vector<SpriteRun>& runs = batch.GetRuns();
+	for (size_t r = 0; r < runs.size(); r++)
+	{
+		const SpriteRun& run = runs[r];
+		if (run.firstInstance != next || run.instanceCount <= 0) return false;
+		if (r > 0 && runs[r - 1].texture == run.texture) return false;
+
+		for (int n = run.firstInstance; n < run.firstInstance + run.instanceCount; n++)
+		{
+			if (submits[expected[n]].texture != run.texture) return false;
+		}
+		next += run.instanceCount;
+	}
+	return next == count;
+}
+
+static void Fill(SpriteBatch& batch, const std::vector<Submit>& submits)
+{
+	batch.Begin();
+	for (int i = 0; i < (int)submits.size(); i++) batch.Draw(submits[i].layer, submits[i].texture, MakeInstance(i));
+	batch.End();
+}
+
+// 한 프레임 분량을 여러 번 채워서 스프라이트당 평균 시간 (ns)
+static double MeasureNs(SpriteBatch& batch, const std::vector<Submit>& submits, int repeats)
+{
+	using Clock = std::chrono::steady_clock;
+	auto start = Clock::now();
+	for (int r = 0; r < repeats; r++) Fill(batch, submits);
+	return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ((double)repeats * submits.size());
+}
+
+// 실제 게임 플레이 화면 구성 (Survivors.cpp Render 순서와 같은 레이어, 텍스처 번호는 로드 순서 흉내)
+static std::vector<Submit> GameFrame()
+{
+	enum { BG, GEMS, AURA, ENEMIES, PLAYER, BULLETS, MELEE, HIT, HP_BG, HP_FILL, TEXTS, EXP_BG, EXP_FILL, LEVEL_BG, LEVEL_TEXTS, TIMER, COLON_BG, COLON };
+	const int mapTexture = 1, playerTexture = 2, gemTexture = 3, fontTexture = 4, auraTexture = 5, meleeTexture = 6, hitTexture = 7;
+	const int firstEnemyTexture = 8;	// 8 ~ 17 : 일반 6종 + 보스 4종
+
+	std::vector<Submit> s;
+	s.push_back({ BG, mapTexture });
+	for (int i = 0; i < 200; i++) s.push_back({ GEMS, gemTexture });
+	s.push_back({ AURA, auraTexture });
+	for (int i = 0; i < 60; i++) s.push_back({ ENEMIES, firstEnemyTexture + (i < 56 ? i % 6 : 6 + (i - 56)) });
+	s.push_back({ PLAYER, playerTexture });
+	for (int i = 0; i < 50; i++) s.push_back({ BULLETS, mapTexture });		// 미사일은 셰이더에서 원으로 그림 (텍스처는 배경 것을 공유)
+	for (int i = 0; i < 30; i++) s.push_back({ MELEE, meleeTexture });
+	for (int i = 0; i < 30; i++) s.push_back({ HIT, hitTexture });
+	s.push_back({ HP_BG, mapTexture });
+	s.push_back({ HP_FILL, mapTexture });
+	for (int i = 0; i < 50; i++) s.push_back({ TEXTS, fontTexture });
+	s.push_back({ EXP_BG, mapTexture });
+	s.push_back({ EXP_FILL, mapTexture });
+	s.push_back({ LEVEL_BG, mapTexture });
+	for (int i = 0; i < 2; i++) s.push_back({ LEVEL_TEXTS, fontTexture });
+	for (int i = 0; i < 4; i++) s.push_back({ TIMER, fontTexture });
+	for (int i = 0; i < 2; i++) { s.push_back({ COLON_BG, mapTexture }); s.push_back({ COLON, mapTexture }); }
+	return s;
+}
+
+// 무작위 스프라이트 (레이어 8개, 텍스처 32개, Draw 순서도 뒤죽박죽)
+static std::vector<Submit> RandomFrame(int count, unsigned int seed)
+{
+	srand(seed);
+	std::vector<Submit> s(count);
+	for (Submit& submit : s)
+	{
+		submit.layer = rand() % 8;
+		submit.texture = rand() % 32;
+	}
+	return s;
+}
+
+int main()
+{
+	bool allOk = true;
+	SpriteBatch batch;
+
+	printf("%-22s %8s %8s %10s %14s %s\n", "scene", "sprites", "runs", "ratio", "ns / sprite", "check");
+
+	struct Scene
+	{
+		const char* name;
+		std::vector<Submit> submits;
+		int repeats;
+	};
+	Scene scenes[] =
+	{
+		{ "game frame (play)", GameFrame(), 2000 },
+		{ "random 1k", RandomFrame(1000, 1), 500 },
+		{ "random 10k", RandomFrame(10000, 2), 100 },
+		{ "random 100k", RandomFrame(100000, 3), 10 },
+	};
+
+	for (Scene& scene : scenes)
+	{
+		Fill(batch, scene.submits);
+		bool ok = Validate(batch, scene.submits);
+		allOk = allOk && ok;
+
+		int runs = (int)batch.GetRuns().size();
+		double ns = MeasureNs(batch, scene.submits, scene.repeats);
+		printf("%-22s %8d %8d %9.1fx %14.2f %s\n", scene.name, (int)scene.submits.size(), runs,
+			(double)scene.submits.size() / runs, ns, ok ? "ok" : "FAIL");
+	}
+
+	// 빈 프레임도 문제없이 지나가야 함
+	batch.Begin();
+	batch.End();
+	allOk = allOk && batch.GetSpriteCount() == 0 && batch.GetRuns().empty();
+
+	return allOk ? 0 : 1;
+}
@@ -0,0 +1,189 @@
+﻿// 스프라이트 인스턴스 압축 (PackSprite) 헤드리스 벤치마크
+// 예전 방식 (크기 행렬 * 이동 행렬을 전치해서 112바이트, 그 전에는 객체마다 256바이트 상수 버퍼)과
+// 40바이트 압축 인스턴스의 프레임당 업로드 바이트와 1만 개 압축 속도를 비교하고
+// 정점 셰이더가 펼친 사각형 꼭짓점 / UV가 예전 행렬 계산과 똑같은지, 색상 오차가 RGBA8 반올림 안인지 검사
+// 빌드 : g++ -O2 -std=c++14 Bench/SpritePackBench.cpp -o SpritePackBench
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <vector>
+#include "../Source/Render/SpriteBatch.h"
+
+// 예전 인스턴스 (전치된 월드 행렬 + UV + 색상 + 타입)
+struct LegacyInstance
+{
+	float world[16];
+	float uvOffsetScale[4];
+	float tintColor[4];
+	float objectType;
+	float padding[3];
+};
+
+// GameObject가 매 프레임 들고 있는 그리기 값
+struct SpriteSource
+{
+	float x, y;
+	float scaleX, scaleY;
+	bool flipped;
+	float uvRect[4];
+	float tint[4];
+	uint32_t packedTint;	// SetTintColor 때 한 번만 압축
+	int objectType;
+};
+
+// 예전 WriteConstants : XMMatrixScaling * XMMatrixTranslation을 4x4 곱셈으로 만들고 전치
+static void PackLegacy(LegacyInstance& out, const SpriteSource& s)
+{
+	float scaling[16] = { s.flipped ? -s.scaleX : s.scaleX, 0, 0, 0,  0, s.scaleY, 0, 0,  0, 0, 0.1f, 0,  0, 0, 0, 1 };
+	float translation[16] = { 1, 0, 0, 0,  0, 1, 0, 0,  0, 0, 1, 0,  s.x, s.y, 0, 1 };
+	float world[16];
+	for (int r = 0; r < 4; r++)
+	{
+		for (int c = 0; c < 4; c++)
+		{
+			float sum = 0.0f;
+			for (int k = 0; k < 4; k++) sum += scaling[r * 4 + k] * translation[k * 4 + c];
+			world[r * 4 + c] = sum;
+		}
+	}
+	for (int r = 0; r < 4; r++)
+	{
+		for (int c = 0; c < 4; c++) out.world[r * 4 + c] = world[c * 4 + r];
+	}
+	for (int i = 0; i < 4; i++)
+	{
+		out.uvOffsetScale[i] = s.uvRect[i];
+		out.tintColor[i] = s.tint[i];
+	}
+	out.objectType = (float)s.objectType;
+}
+
+// 정점 셰이더 흉내 (shaders.hlsl VSMain)
+static void ExpandLegacy(const LegacyInstance& in, float px, float py, float& outX, float& outY)
+{
+	const float position[4] = { px, py, 0.0f, 1.0f };
+	outX = outY = 0.0f;
+	for (int k = 0; k < 4; k++)
+	{
+		outX += position[k] * in.world[0 * 4 + k];
+		outY += position[k] * in.world[1 * 4 + k];
+	}
+}
+
+static void ExpandCompact(const SpriteInstance& in, float px, float py, float& outX, float& outY)
+{
+	float cornerX = px * 2.0f;
+	float cornerY = py * 2.0f;
+	if (in.typeFlags & SPRITE_FLIP_X) cornerX = -cornerX;
+	outX = in.center[0] + cornerX * in.halfSize[0];
+	outY = in.center[1] + cornerY * in.halfSize[1];
+}
+
+static std::vector<SpriteSource> RandomSprites(int count, unsigned int seed)
+{
+	srand(seed);
+	std::vector<SpriteSource> sprites(count);
+	for (SpriteSource& s : sprites)
+	{
+		s.x = (rand() % 2001 - 1000) / 500.0f;
+		s.y = (rand() % 2001 - 1000) / 500.0f;
+		s.scaleX = 0.01f + (rand() % 1000) / 1000.0f;
+		s.scaleY = 0.01f + (rand() % 1000) / 1000.0f;
+		s.flipped = (rand() % 2) != 0;
+		int frames = 1 + rand() % 30;
+		float frameWidth = 1.0f / frames;
+		s.uvRect[0] = (rand() % frames) * frameWidth;
+		s.uvRect[1] = 0.0f;
+		s.uvRect[2] = frameWidth;
+		s.uvRect[3] = 1.0f;
+		for (int c = 0; c < 4; c++) s.tint[c] = (rand() % 1001) / 1000.0f;
+		s.packedTint = PackTint(s.tint[0], s.tint[1], s.tint[2], s.tint[3]);
+		s.objectType = rand() % 3;
+	}
+	return sprites;
+}
+
+// 펼친 꼭짓점 위치, UV, 타입, 뒤집기, 색상 검사
+static bool Validate(const std::vector<SpriteSource>& sprites)
+{
+	const float corners[6][2] = { { -0.5f, 0.5f }, { 0.5f, 0.5f }, { -0.5f, -0.5f }, { -0.5f, -0.5f }, { 0.5f, 0.5f }, { 0.5f, -0.5f } };
+	for (const SpriteSource& s : sprites)
+	{
+		LegacyInstance legacy;
+		SpriteInstance compact;
+		PackLegacy(legacy, s);
+		PackSprite(compact, s.x, s.y, s.scaleX, s.scaleY, s.flipped, s.uvRect, s.packedTint, s.objectType);
+
+		for (const float* corner : corners)
+		{
+			float lx, ly, cx, cy;
+			ExpandLegacy(legacy, corner[0], corner[1], lx, ly);
+			ExpandCompact(compact, corner[0], corner[1], cx, cy);
+			if (lx != cx || ly != cy) return false;
+		}
+		for (int i = 0; i < 4; i++)
+		{
+			if (compact.uvRect[i] != legacy.uvOffsetScale[i]) return false;
+
+			float unpacked = ((compact.tint >> (i * 8)) & 0xFF) / 255.0f;
+			if (std::fabs(unpacked - s.tint[i]) > 0.5f / 255.0f + 1e-6f) return false;
+		}
+		if ((int)(compact.typeFlags & SPRITE_TYPE_MASK) != s.objectType) return false;
+		if (((compact.typeFlags & SPRITE_FLIP_X) != 0) != s.flipped) return false;
+	}
+	return true;
+}
+
+// 결과에서 x 위치가 들어간 값 하나 (반복마다 결과를 읽어서 최적화가 반복을 합치지 못하게 함)
+static float ReadX(const LegacyInstance& in) { return in.world[3]; }
+static float ReadX(const SpriteInstance& in) { return in.center[0]; }
+
+// 한 프레임 분량을 여러 번 압축해서 스프라이트당 평균 시간 (ns)
+// 반복마다 x를 조금씩 밀어서 입력을 바꾸고, 그 반복의 결과를 volatile에 더해서 반복 하나하나가 실제로 돌게 함
+template <typename Instance, typename PackFunc>
+static double MeasureNs(const std::vector<SpriteSource>& sprites, std::vector<Instance>& out, int repeats, PackFunc pack)
+{
+	using Clock = std::chrono::steady_clock;
+	volatile float sink = 0.0f;
+	out.resize(sprites.size());
+	auto start = Clock::now();
+	for (int r = 0; r < repeats; r++)
+	{
+		float offsetX = r * (1.0f / 1024.0f);
+		for (size_t i = 0; i < sprites.size(); i++) pack(out[i], sprites[i], offsetX);
+		sink = sink + ReadX(out[(size_t)r * 7919 % out.size()]) + ReadX(out.back());
+	}
+	return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ((double)repeats * sprites.size());
+}
+
+int main()
+{
+	std::vector<SpriteSource> sprites = RandomSprites(10000, 7);
+	bool ok = Validate(sprites);
+
+	std::vector<LegacyInstance> legacyOut;
+	std::vector<SpriteInstance> compactOut;
+	const int repeats = 500;
+	double legacyNs = MeasureNs(sprites, legacyOut, repeats, [](LegacyInstance& out, SpriteSource s, float offsetX)
+		{
+			s.x += offsetX;
+			PackLegacy(out, s);
+		});
+	double compactNs = MeasureNs(sprites, compactOut, repeats, [](SpriteInstance& out, const SpriteSource& s, float offsetX)
+		{
+			PackSprite(out, s.x + offsetX, s.y, s.scaleX, s.scaleY, s.flipped, s.uvRect, s.packedTint, s.objectType);
+		});
+
+	const int gameSprites = 438;	// SpriteBatchBench의 실제 게임 한 프레임
+	printf("%-34s %10s %14s %14s %12s\n", "format", "bytes", "game frame", "10k sprites", "ns / sprite");
+	printf("%-34s %10d %14d %14d %12s\n", "per-object constant buffer (256)", 256, 256 * gameSprites, 256 * 10000, "-");
+	printf("%-34s %10d %14d %14d %12.2f\n", "transposed matrix instance", (int)sizeof(LegacyInstance),
+		(int)sizeof(LegacyInstance) * gameSprites, (int)sizeof(LegacyInstance) * 10000, legacyNs);
+	printf("%-34s %10d %14d %14d %12.2f\n", "compact instance", (int)sizeof(SpriteInstance),
+		(int)sizeof(SpriteInstance) * gameSprites, (int)sizeof(SpriteInstance) * 10000, compactNs);
+	printf("\npack throughput (10k) : legacy %.1f M/s, compact %.1f M/s, check %s\n",
+		1000.0 / legacyNs, 1000.0 / compactNs, ok ? "ok" : "FAIL");
+
+	return ok ? 0 : 1;
+}
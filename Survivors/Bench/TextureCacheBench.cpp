@@ -0,0 +1,215 @@
+﻿// 텍스처 캐시 (TextureCache) 콜드 스타트 벤치마크
+// Game::Initialize가 텍스처를 부르는 순서 그대로 실제 PNG 파일을 풀어서
+// 객체마다 따로 읽던 방식과 경로 캐시로 파일마다 한 번만 읽는 방식의 시작 시간과 텍스처 메모리 (GPU 텍스처 + 복사용 버퍼)를 비교
+// 경로 정규화, 참조 카운트, 마지막 Release 때 내려가는지, 내려간 뒤 예전 핸들이 무효가 되는지도 검사
+// 빌드 : g++ -O2 -std=c++14 Bench/TextureCacheBench.cpp -o TextureCacheBench (Survivors 폴더에서 실행하거나 첫 인자로 텍스처 폴더)
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <chrono>
+#include <vector>
+#define STB_IMAGE_IMPLEMENTATION
+#include "../Source/Utils/stb_image.h"
+#include "../Source/Render/TextureCache.h"
+
+struct DecodedImage
+{
+	unsigned char* pixels = nullptr;
+	int width = 0;
+	int height = 0;
+};
+
+struct LoadRequest
+{
+	const char* file;
+	int count;		// 이 파일을 LoadTexture로 부르는 객체 수
+};
+
+// Survivors.cpp Initialize의 LoadTexture 호출 (반복문은 횟수로)
+static const LoadRequest GAME_LOADS[] =
+{
+	{ "map_bg.png", 1 }, { "map_bg.png", 2 },						// 배경, HP 바 2개
+	{ "player_sheet.png", 50 }, { "player_sheet.png", 1 },			// 미사일 50개, 플레이어
+	{ "Enemy1.png", 1 }, { "Enemy2.png", 1 }, { "Enemy3.png", 1 }, { "Enemy4.png", 1 }, { "Enemy5.png", 1 }, { "Enemy6.png", 1 },
+	{ "Boss1.png", 1 }, { "Boss2.png", 1 }, { "Boss3.png", 1 }, { "Boss4.png", 1 },
+	{ "map_bg.png", 2 },											// 경험치 바
+	{ "level_bg.png", 1 }, { "damage_font.png", 2 },				// 레벨 배경, 레벨 숫자
+	{ "gem.png", 1 }, { "damage_font.png", 50 },					// 젬 스킨, 데미지 텍스트
+	{ "GameOver.png", 1 }, { "Clear.png", 1 },
+	{ "Timer_font.png", 4 }, { "map_bg.png", 4 },					// 타이머 숫자, 콜론
+	{ "weapon_card_1.png", 1 }, { "weapon_card_2.png", 1 }, { "weapon_card_3.png", 1 },
+	{ "MELEE.png", 1 }, { "BULLET.png", 1 }, { "AURA.png", 1 },
+	{ "weapon_melee.png", 30 }, { "weapon_bullet_hit.png", 30 }, { "weapon_aura.png", 1 },
+	{ "map_bg.png", 1 }, { "title_text.png", 1 }, { "btn_start.png", 1 }, { "btn_setting.png", 1 }, { "btn_exit.png", 1 },
+	{ "pause_bg.png", 1 }, { "btn_main.png", 1 }, { "btn_setting.png", 1 }, { "btn_exit.png", 1 },
+	{ "btn_retry.png", 1 }, { "btn_main.png", 1 }, { "btn_exit.png", 1 },
+	{ "score_bg.png", 1 }, { "Timer_font.png", 6 },
+	{ "level_up_bg.png", 1 },
+	{ "up_damage.png", 1 }, { "up_cooldown.png", 1 }, { "up_speed.png", 1 }, { "up_hp.png", 1 }, { "up_aura.png", 1 },
+};
+
+// GPU 메모리 추정 : 텍스처 (RGBA8) + 복사용 업로드 버퍼 (줄마다 256바이트 정렬)
+static size_t TextureBytes(const DecodedImage& image) { return (size_t)image.width * image.height * 4; }
+static size_t UploadBytes(const DecodedImage& image) { return (size_t)((image.width * 4 + 255) & ~255) * image.height; }
+
+static bool Decode(const char* path, DecodedImage& out)
+{
+	int channels = 0;
+	out.pixels = stbi_load(path, &out.width, &out.height, &channels, STBI_rgb_alpha);
+	return out.pixels != nullptr;
+}
+
+struct Result
+{
+	double ms = 0.0;
+	int decodes = 0;
+	size_t textureBytes = 0;
+	size_t uploadBytes = 0;
+	int missing = 0;
+};
+
+// 객체마다 LoadTexture가 파일을 새로 읽던 방식
+static Result LoadPerObject(const std::string& root)
+{
+	Result result;
+	auto start = std::chrono::steady_clock::now();
+	for (const LoadRequest& request : GAME_LOADS)
+	{
+		std::string path = root + request.file;
+		for (int i = 0; i < request.count; i++)
+		{
+			DecodedImage image;
+			if (!Decode(path.c_str(), image))
+			{
+				result.missing++;
+				continue;
+			}
+			result.decodes++;
+			result.textureBytes += TextureBytes(image);
+			result.uploadBytes += UploadBytes(image);
+			stbi_image_free(image.pixels);	// 메모리는 합계만 셈 (전부 들고 있으면 GB 단위)
+		}
+	}
+	result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	return result;
+}
+
+// 경로 캐시로 파일마다 한 번만 읽는 방식
+static Result LoadCached(const std::string& root, TextureCache<DecodedImage>& cache, std::vector<TextureHandle>& handles)
+{
+	Result result;
+	auto start = std::chrono::steady_clock::now();
+	for (const LoadRequest& request : GAME_LOADS)
+	{
+		std::string path = root + request.file;
+		for (int i = 0; i < request.count; i++)
+		{
+			TextureHandle handle = cache.Acquire(path.c_str(), [&](const char* file, DecodedImage& out)
+				{
+					if (!Decode(file, out)) return false;
+					result.decodes++;
+					result.textureBytes += TextureBytes(out);
+					result.uploadBytes += UploadBytes(out);
+					return true;
+				});
+			if (handle.IsNull()) result.missing++;
+			else handles.push_back(handle);
+		}
+	}
+	result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	return result;
+}
+
+static bool CheckNormalize()
+{
+	struct Case { const char* in; const char* out; };
+	const Case cases[] =
+	{
+		{ "Assets/Textures/gem.png", "assets/textures/gem.png" },
+		{ "Assets\\Textures\\GEM.png", "assets/textures/gem.png" },
+		{ "./Assets//Textures/../Textures/./gem.png", "assets/textures/gem.png" },
+		{ "../Assets/x/../gem.png", "../assets/gem.png" },
+		{ "/abs/Path.PNG", "/abs/path.png" },
+	};
+	for (const Case& c : cases)
+	{
+		if (NormalizeAssetPath(c.in) != c.out) return false;
+	}
+	return true;
+}
+
+// 가짜 로더로 참조 카운트 / 내리기 / 세대 검사
+static bool CheckRefCounting()
+{
+	TextureCache<int> cache;
+	int loads = 0, unloads = 0;
+	auto load = [&](const char*, int& out) { out = ++loads; return true; };
+	auto fail = [&](const char*, int&) { return false; };
+	auto unload = [&](int&) { unloads++; };
+
+	bool ok = true;
+	TextureHandle a = cache.Acquire("Textures/A.png", load);
+	TextureHandle b = cache.Acquire("textures\\a.png", load);	// 같은 파일
+	TextureHandle c = cache.Acquire("Textures/B.png", load);
+	ok = ok && a == b && a != c && loads == 2 && cache.GetHitCount() == 1;
+	ok = ok && cache.AddRef(a) && cache.GetRefCount(a) == 3;
+
+	ok = ok && cache.Release(a, unload) && cache.Release(b, unload) && unloads == 0;
+	ok = ok && cache.Release(a, unload) && unloads == 1;		// 마지막 참조
+	ok = ok && cache.Get(a) == nullptr && !cache.Release(a, unload) && !cache.AddRef(a);	// 예전 핸들은 무효
+
+	TextureHandle again = cache.Acquire("Textures/A.png", load);	// 다시 부르면 새로 읽음 (내려간 칸 재사용, 세대는 다름)
+	ok = ok && loads == 3 && again.index == a.index && again != a && *cache.Get(again) == 3;
+
+	TextureHandle missing = cache.Acquire("Textures/none.png", fail);
+	ok = ok && missing.IsNull() && cache.GetFailCount() == 1 && cache.GetLoadedCount() == 2;
+	return ok;
+}
+
+int main(int argc, char** argv)
+{
+	// 텍스처 폴더 : 첫 인자, 없으면 이 파일 기준 ../Assets/Textures/
+	std::string root;
+	if (argc > 1)
+	{
+		root = argv[1];
+		if (!root.empty() && root.back() != '/' && root.back() != '\\') root += '/';
+	}
+	else
+	{
+		std::string self = __FILE__;
+		size_t slash = self.find_last_of("/\\");
+		root = (slash == std::string::npos ? std::string(".") : self.substr(0, slash)) + "/../Assets/Textures/";
+	}
+
+	bool normalizeOk = CheckNormalize();
+	bool refOk = CheckRefCounting();
+
+	Result perObject = LoadPerObject(root);
+	TextureCache<DecodedImage> cache;
+	std::vector<TextureHandle> handles;
+	Result cached = LoadCached(root, cache, handles);
+
+	int requests = 0;
+	for (const LoadRequest& request : GAME_LOADS) requests += request.count;
+
+	// 없는 파일 (게임에서도 메시지 박스가 뜨는 파일)은 두 방식 모두 똑같이 건너뛰어야 함
+	bool cacheOk = perObject.missing == cached.missing && cached.decodes == cache.GetLoadedCount() &&
+		(int)handles.size() == requests - cached.missing && cache.GetHitCount() == (int)handles.size() - cached.decodes;
+
+	// 핸들을 전부 반납하면 다 내려가야 함
+	int unloads = 0;
+	for (TextureHandle handle : handles) cache.Release(handle, [&](DecodedImage& image) { stbi_image_free(image.pixels); unloads++; });
+	cacheOk = cacheOk && unloads == cached.decodes && cache.GetLoadedCount() == 0;
+
+	printf("textures from %s (%d LoadTexture calls)\n\n", root.c_str(), requests);
+	printf("%-14s %8s %12s %14s %14s\n", "mode", "decodes", "startup ms", "texture MB", "upload MB");
+	printf("%-14s %8d %12.1f %14.2f %14.2f\n", "per object", perObject.decodes, perObject.ms,
+		perObject.textureBytes / (1024.0 * 1024.0), perObject.uploadBytes / (1024.0 * 1024.0));
+	printf("%-14s %8d %12.1f %14.2f %14.2f\n", "path cache", cached.decodes, cached.ms,
+		cached.textureBytes / (1024.0 * 1024.0), cached.uploadBytes / (1024.0 * 1024.0));
+	printf("\nmissing files %d, normalize %s, refcount %s, cache %s\n", cached.missing, normalizeOk ? "ok" : "FAIL",
+		refOk ? "ok" : "FAIL", cacheOk ? "ok" : "FAIL");
+
+	return normalizeOk && refOk && cacheOk ? 0 : 1;
+}
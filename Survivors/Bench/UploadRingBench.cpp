@@ -0,0 +1,205 @@
+﻿// 프레임 업로드 링 할당기 (UploadRing) 헤드리스 벤치마크
+// GPU 대신 몇 프레임 늦게 따라오는 가짜 펜스로 돌리면서 256바이트 조각 할당 속도 (초당 할당 수)를 재고
+// 정렬, 아직 반납 안 된 조각끼리 안 겹치는지, 끝에서 0번으로 돌아가는지, 꽉 차면 실패했다가 반납 후 다시 되는지 검사
+// 빌드 : g++ -O2 -std=c++14 Bench/UploadRingBench.cpp -o UploadRingBench
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <vector>
+#include <deque>
+#include "../Source/Render/UploadRing.h"
+
+struct Slice
+{
+	uint64_t offset;
+	uint64_t size;
+};
+
+// 살아있는 조각끼리 겹치지 않는지 (프레임마다 조각 목록을 들고 있다가 반납되면 버림)
+static bool NoOverlap(const std::deque<std::vector<Slice>>& liveFrames, const Slice& slice)
+{
+	for (const std::vector<Slice>& frame : liveFrames)
+	{
+		for (const Slice& other : frame)
+		{
+			if (slice.offset < other.offset + other.size && other.offset < slice.offset + slice.size) return false;
+		}
+	}
+	return true;
+}
+
+// GPU가 latency 프레임 늦게 따라오는 상황을 흉내내며 무작위 크기 조각을 떼어주고 전부 검사
+static bool CheckFencedFrames(uint64_t capacity, int latency, int frames, int maxPerFrame, unsigned int seed, int& outWraps, int& outFails)
+{
+	srand(seed);
+	UploadRing ring;
+	ring.Initialize(capacity);
+
+	std::deque<std::vector<Slice>> liveFrames;	// 아직 반납 안 된 프레임들의 조각 (현재 프레임 포함)
+	uint64_t fenceValue = 1;
+	uint64_t lastOffset = 0;
+	outWraps = 0;
+	outFails = 0;
+
+	for (int f = 0; f < frames; f++)
+	{
+		liveFrames.emplace_back();
+		int count = rand() % maxPerFrame;
+		for (int n = 0; n < count; n++)
+		{
+			uint64_t alignment = (rand() % 2) ? UploadRing::DEFAULT_ALIGNMENT : 16;
+			Slice slice;
+			slice.size = 16 + (uint64_t)(rand() % 4096);
+			if (!ring.Allocate(slice.size, slice.offset, alignment))
+			{
+				outFails++;
+				continue;
+			}
+
+			if (slice.offset % alignment != 0) return false;
+			if (slice.offset + slice.size > capacity) return false;
+			if (!NoOverlap(liveFrames, slice)) return false;
+			if (slice.offset < lastOffset) outWraps++;
+			lastOffset = slice.offset;
+
+			liveFrames.back().push_back(slice);
+		}
+
+		ring.FinishFrame(fenceValue);
+		fenceValue++;
+
+		// GPU는 latency 프레임 전 것까지만 끝냄
+		uint64_t completed = fenceValue > (uint64_t)latency ? fenceValue - 1 - latency : 0;
+		ring.Retire(completed);
+		while ((int)liveFrames.size() > ring.GetFramesInFlight()) liveFrames.pop_front();
+	}
+
+	// GPU가 전부 따라오면 빈 링이 되어야 함
+	ring.Retire(fenceValue);
+	return ring.GetUsed() == 0 && ring.GetFramesInFlight() == 0;
+}
+
+// 꽉 찬 상태에서 실패하고, 반납하면 다시 되는지
+static bool CheckFull()
+{
+	UploadRing ring;
+	ring.Initialize(4096);
+
+	uint64_t offset = 0;
+	bool ok = true;
+	for (int i = 0; i < 16; i++) ok = ok && ring.Allocate(256, offset) && offset == (uint64_t)i * 256;
+	ok = ok && !ring.Allocate(1, offset);			// 꽉 참
+	ok = ok && !ring.Allocate(8192, offset);		// 링보다 큼
+	ok = ok && ring.GetFailedCount() == 2;
+
+	ring.FinishFrame(1);
+	ring.Retire(0);
+	ok = ok && !ring.Allocate(256, offset);			// GPU가 아직 안 끝냄
+	ring.Retire(1);
+	ok = ok && ring.Allocate(4096, offset) && offset == 0;	// 반납 후 통째로 다시 씀
+
+	// 끝에 남은 꼬리가 모자라면 처음으로 돌아가되, 아직 GPU가 쓰는 조각과는 안 겹쳐야 함
+	ring.Initialize(4096);
+	ok = ok && ring.Allocate(1024, offset);
+	ring.FinishFrame(1);
+	ok = ok && ring.Allocate(2048, offset) && offset == 1024;
+	ring.FinishFrame(2);
+	ring.Retire(1);										// [0, 1024) 반납, [1024, 3072) 사용 중
+	ok = ok && !ring.Allocate(1536, offset);			// 꼬리 (1024)에도, 앞쪽 (1024)에도 안 들어감
+	ok = ok && ring.Allocate(1024, offset) && offset == 3072;	// 꼬리에 딱 맞음
+	ok = ok && ring.Allocate(1024, offset) && offset == 0;		// 처음으로 돌아감
+	ok = ok && !ring.Allocate(16, offset);				// 다시 꽉 참
+	ring.FinishFrame(3);
+	ring.Retire(3);
+	ok = ok && ring.GetUsed() == 0;
+
+	// 링이 빈 채로 아무것도 안 떼어준 프레임을 마친 뒤 0으로 돌아가서 쓰면,
+	// 그 빈 프레임을 반납할 때 tail이 낡은 head로 돌아가면 안 됨 (EndFrame은 그린 게 없어도 FinishFrame을 부름)
+	ring.Initialize(1000);
+	ok = ok && ring.Allocate(200, offset, 1) && offset == 0;
+	ring.FinishFrame(1);
+	ring.Retire(1);										// 비어 있음, tail = 200
+	ring.FinishFrame(2);								// 떼어준 게 없는 프레임
+	ok = ok && ring.Allocate(500, offset, 1) && offset == 0;	// 비었으니 처음부터
+	ring.FinishFrame(3);
+	ring.Retire(2);										// [0, 500)은 프레임 3이 아직 사용 중
+	ok = ok && ring.Allocate(400, offset, 1) && offset == 500;
+	ok = ok && !ring.Allocate(150, offset, 1);			// 꼬리 (100)에도, 앞쪽 (0)에도 안 들어감
+	ring.Retire(3);
+	ok = ok && ring.Allocate(150, offset, 1) && offset == 0;	// 프레임 3을 반납해야 처음으로 돌아감
+	return ok;
+}
+
+// 한 프레임에 objectCount개씩 256바이트 조각을 떼어주는 속도 (GPU는 2프레임 늦게 따라옴)
+static double MeasureAllocsPerSec(int objectCount, int frames)
+{
+	UploadRing ring;
+	ring.Initialize(8 * 1024 * 1024);
+
+	using Clock = std::chrono::steady_clock;
+	uint64_t checksum = 0;
+	auto start = Clock::now();
+	for (int f = 1; f <= frames; f++)
+	{
+		for (int n = 0; n < objectCount; n++)
+		{
+			uint64_t offset = 0;
+			ring.Allocate(256, offset);
+			checksum += offset;
+		}
+		ring.FinishFrame((uint64_t)f);
+		ring.Retire(f > 2 ? (uint64_t)(f - 2) : 0);
+	}
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	if (checksum == 1) printf(" ");	// 최적화로 통째로 지워지지 않게
+	return (double)objectCount * frames / seconds;
+}
+
+int main()
+{
+	bool allOk = true;
+
+	printf("%-30s %8s %8s %s\n", "scenario", "wraps", "fails", "check");
+	struct Scenario
+	{
+		const char* name;
+		uint64_t capacity;
+		int latency;
+		int maxPerFrame;
+	};
+	Scenario scenarios[] =
+	{
+		{ "64KB, 1 frame behind", 64 * 1024, 1, 12 },
+		{ "64KB, 2 frames behind", 64 * 1024, 2, 12 },
+		{ "64KB, 3 frames behind (tight)", 64 * 1024, 3, 24 },
+		{ "1MB, 2 frames behind", 1024 * 1024, 2, 200 },
+	};
+	for (int s = 0; s < 4; s++)
+	{
+		int wraps = 0, fails = 0;
+		bool ok = CheckFencedFrames(scenarios[s].capacity, scenarios[s].latency, 2000, scenarios[s].maxPerFrame, 100 + s, wraps, fails);
+		ok = ok && wraps > 0;	// 링이 실제로 한 바퀴 이상 돌았어야 검사 의미가 있음
+		allOk = allOk && ok;
+		printf("%-30s %8d %8d %s\n", scenarios[s].name, wraps, fails, ok ? "ok" : "FAIL");
+	}
+
+	bool fullOk = CheckFull();
+	allOk = allOk && fullOk;
+	printf("%-30s %8s %8s %s\n", "full / retire / wrap", "-", "-", fullOk ? "ok" : "FAIL");
+
+	// 실제 게임 규모 (그리기 객체 약 600개)와 1만 개
+	printf("\n%-30s %16s\n", "objects / frame", "allocs / sec");
+	int objectCounts[] = { 600, 10000 };
+	for (int objects : objectCounts)
+	{
+		double rate = MeasureAllocsPerSec(objects, objects < 1000 ? 20000 : 1000);
+		printf("%-30d %16.0f\n", objects, rate);
+	}
+
+	// 객체마다 CreateCommittedResource로 만들던 256바이트 버퍼는 리소스 정렬 때문에 하나에 64KB씩 차지
+	const double committedMB = 600.0 * 64 * 1024 / (1024 * 1024);
+	const double ringMB = 600.0 * 256 * 3 / (1024 * 1024);	// 3프레임이 동시에 살아있어도
+	printf("\nmemory for 600 objects : committed %.1f MB vs ring %.2f MB (3 frames in flight)\n", committedMB, ringMB);
+
+	return allOk ? 0 : 1;
+}
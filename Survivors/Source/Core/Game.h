@@ -0,0 +1,1338 @@
+﻿#pragma once
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include "../Platform/Platform.h"
+#include "../Objects/GameObject.h"
+#include "../Utils/FixedTimestep.h"
+#include "../Sim/SimWorld.h"
+#include "../Render/RenderSnapshot.h"
+#include "../Utils/SnapshotMailbox.h"
+
+// 스프라이트 레이어 (작은 번호부터 그림)
+// 배치는 같은 레이어 안에서 텍스처별로 묶으면서 텍스처가 다른 스프라이트끼리 순서를 바꿀 수 있으므로
+// 겹쳤을 때 위아래가 중요한 것들은 레이어를 따로 둠 (기존 Render 호출 순서 그대로)
+enum SpriteLayer
+{
+	// 타이틀 씬
+	LAYER_TITLE_BG,
+	LAYER_TITLE_LOGO,
+	LAYER_TITLE_BUTTONS,
+
+	// 인게임 세계
+	LAYER_BACKGROUND,
+	LAYER_GEMS,
+	LAYER_AURA,
+	LAYER_ENEMIES,
+	LAYER_PLAYER,
+	LAYER_BULLETS,
+	LAYER_MELEE_EFFECTS,
+	LAYER_HIT_EFFECTS,
+
+	// 공통 인게임 UI
+	LAYER_HP_BAR_BG,
+	LAYER_HP_BAR_FILL,
+	LAYER_DAMAGE_TEXTS,
+	LAYER_EXP_BAR_BG,
+	LAYER_EXP_BAR_FILL,
+	LAYER_LEVEL_BG,
+	LAYER_LEVEL_TEXTS,
+	LAYER_TIMER_TEXTS,
+	LAYER_TIMER_COLON_BG,
+	LAYER_TIMER_COLON,
+
+	// 상태별 오버레이 (무기 선택, 일시정지, 레벨업, 결과 창)
+	LAYER_OVERLAY_BG,
+	LAYER_OVERLAY_PANEL,
+	LAYER_OVERLAY_CONTENT,
+	LAYER_OVERLAY_BUTTONS,
+};
+
+// 게임 한 판 전체 (타이틀 -> 무기 선택 -> 플레이 -> 레벨업 / 일시정지 -> 게임 오버 / 클리어)
+// 창 / 입력 / 시간 / 소리 / 그리기는 Platform의 인터페이스로만 쓰므로 Windows (D3D12)와 헤드리스 (리눅스)에서 같은 코드가 돎
+class Game
+{
+public:
+	// 게임 상태 (Game State) 열거형
+	enum class GameState
+	{
+		TITLE,          // 메인 타이틀 씬
+		WEAPON_SELECT,  // 처음 시작 시 무기 고르는 상태
+		PLAY,           // 정상 플레이 중
+		LEVEL_UP,       // 레벨업 선택 창 상태
+		PAUSE,          // ESC 일시 정지, 설정 창
+		GAME_OVER,      // HP 0 (사망)
+		CLEAR,          // 생존 성공
+	};
+
+	// 게임 매니저용 변수들
+	// 처음 켜지면 무조건 타이틀 씬 부터
+	GameState currentState = GameState::TITLE;
+
+	// 메인 씬 (TITLE) 전용 객체들
+	GameObject titleBg;         // 타이틀 배경
+	GameObject titleText;       // 게임 로고 타이틀
+	Button btnStart;            // 게임 시작 버튼
+	Button btnSetting;          // 설정 버튼 (임시 비활성화)
+	Button btnExit;             // 종료 버튼
+
+	// 일시정지 씬 (PAUSE) 전용 객체들
+	GameObject pauseBg;         // 반투명한 검은색 배경 용도
+	Button btnPauseMain;        // 메인으로 돌아가기 버튼
+	Button btnPauseSetting;     // 설정 버튼
+	Button btnPauseExit;        // 종료 버튼
+
+	// 결과 창 (GAME_OVER / CLEAR) 전용 객체들
+	Button btnRetry;        // 다시 시작 (무기 선택 창으로)
+	Button btnResultMain;   // 메인 타이틀로
+	Button btnResultExit;   // 게임 종료
+
+	GameObject scoreBg;         // score_bg.png
+	GameObject scoreTexts[6];   // 점수 폰트 (최대 6 자리)
+
+	// 레벨업 시스템 관련 객체
+	GameObject levelUpBg;
+	Button upgradeCards[3];     // 화면에 띄울 3개의 선택지 카드
+	int cardUpIds[3];           // 각 카드에 어떤 업그레이드인지 저장 (0:HP, 1:SPD, 2:DMG, 3:CDR, 4:AURA)
+
+	// 중복 로딩 방지를 위한 마스터 카드 스킨들 (플라이웨이트 패턴)
+	GameObject cardSkins[5];
+
+	// 씬 전환 시 게임 데이터를 싹 초기화해주는 함수
+	void ResetGame()
+	{
+		world.Reset();
+	}
+
+	// 젬 그리기용 객체 세팅 (젬 풀의 칸 번호와 1:1로 짝지어지는 MAX_GEMS개 전부 같은 세팅)
+	void SetupGem(GameObject& gem)
+	{
+		gem.ShareTextureFrom(gemSkin);
+		gem.SetScale(0.04f, 0.06f);
+
+		// 텍스처 원본 색상을 그대로 보여주기 위해 틴트 컬러를 흰색(1,1,1)으로 초기화
+		gem.SetTintColor(1.0f, 1.0f, 1.0f);
+
+		// 진짜 텍스처를 그리는 모드(0)로 변경
+		gem.SetObjectType(0);
+	}
+
+	// 무기 선택 UI용 객체
+	Button weaponCards[3];
+	GameObject weaponIcons[3];
+
+	// 이펙트 & 오라 그리기용 객체 (시뮬레이션 풀의 같은 번호 칸을 그림)
+	static const int MAX_EFFECTS = 30;
+	GameObject meleeEffects[MAX_EFFECTS];
+	GameObject hitEffects[MAX_EFFECTS];
+	GameObject auraEffect;  // 오라는 플레이어 몸에 1개만 붙어있으므로 단일 객체
+
+	bool isEscPressed = false;                     // ESC 키 꾹 누름 (중복) 방지용 플래그
+
+	GameObject gameOverUI;
+	GameObject clearUI;
+
+	// 시뮬레이션 스레드가 업데이트마다 만든 그리기 정보 (스프라이트 배치 등)를 렌더 스레드 (메인 스레드)로 넘기는 우편함
+	// 세 칸을 번호만 맞바꿔서 넘기므로 락이 없고, 시뮬레이션은 렌더러의 Present / vsync를 기다리지 않음
+	SnapshotMailbox<RenderSnapshot> snapshots;
+	uint64_t snapshotSequence = 0;
+
+	// 시뮬레이션 스레드
+	static const int MAX_SNAPSHOTS_PER_SECOND = 240;   // 화면보다 훨씬 빨리 만들어도 버려지기만 하므로 이만큼까지만 만들고 남는 시간은 잠
+	std::thread simThread;
+	std::atomic<bool> stopSimulation{ false };
+	std::atomic<bool> quitRequested{ false };           // 종료 버튼 (창은 메인 스레드만 닫을 수 있으므로 메인 루프가 보고 대신 닫음)
+
+	// 위치 / 입력 변수
+	float playerX = 0.0f; // 플레이어의 X 위치
+	float playerY = 0.0f; // 플레이어의 Y 위치
+	float speed = 2.0f;   // 이동 속도
+
+	// 창 / 입력 / 시간 / 소리 / 그리기 (Windows 또는 헤드리스)
+	Platform platform;
+
+	// 고정 간격 시뮬레이션 (프레임 속도와 상관없이 항상 같은 dt로 게임 로직을 돌림)
+	static const int SIM_TICK_RATE = 60;            // 초당 틱 수 (120으로 올리면 더 촘촘하게 시뮬레이션)
+	static const int MAX_SIM_STEPS_PER_FRAME = 5;   // 렉이 걸려도 한 프레임에 이 이상은 따라잡지 않음
+	FixedTimestep simClock;
+
+	// 게임 플레이 시뮬레이션 (플레이어 / 적 / 무기 / 웨이브 상태는 전부 여기에 있고, 아래 객체들은 그리기만 담당)
+	SimWorld world;
+	JobSystem jobs;     // 시뮬레이션의 독립적인 단계 (적 이동, 밀어내기 등)를 나눠서 돌릴 워커 스레드들
+
+	// 플레이어 객체
+	GameObject player;
+
+	// Enemy 객체
+	static const int ENEMY_COUNT = 60;
+	Enemy enemies[ENEMY_COUNT];     // 시뮬레이션 적 풀의 같은 번호 칸을 화면에 그려주는 렌더링용 객체
+
+	// 중복 로딩 방지용 마스터 스킨들
+	GameObject enemySkins[6];
+	GameObject bossSkins[4];
+
+	// 배경 맵 객체 (순수 GameObject 사용)
+	GameObject background;
+
+	// 미사일 그리기용 객체
+	static const int MAX_BULLETS = 50;
+	GameObject bullets[MAX_BULLETS];
+
+	// 플레이어 HP바 (배경 1개, 게이지 1개)
+	GameObject hpBarBg;
+	GameObject hpBarFill;
+
+	// 젬, 데미지 텍스트, EXP 바
+	// 젬 풀은 200칸 고정 (가득 차면 드롭 취소)이므로 그리기용 객체도 칸마다 하나씩 고정 배열
+	static const int MAX_GEMS = 200;
+	GameObject gems[MAX_GEMS];
+	GameObject gemSkin;     // 모든 젬이 같이 쓰는 텍스처 (200칸 전부 여기서 공유)
+
+	static const int MAX_DMG_TEXTS = 50;
+	GameObject dmgTexts[MAX_DMG_TEXTS];
+
+	GameObject expBarBg;
+	GameObject expBarFill;
+
+	// 레벨 UI 배경과 레벨 텍스트 선언
+	GameObject levelBg;
+	GameObject levelTexts[2]; // 10의 자리, 1의 자리
+
+	// 타이머 폰트 배열 (MM:SS 4자리)
+	GameObject timerTexts[4];
+	
+	// 콜론의 검은색 배경 역할을 할 점 2개 선언
+	GameObject timerColonBg[2];
+	// 콜론 (:) 역할을 할 점 2개 선언
+	GameObject timerColon[2];
+
+	// 게임 객체 / 시뮬레이션 / 소리 초기화 (렌더러와 오디오는 미리 초기화되어 있어야 함)
+	// seed : 시뮬레이션 난수 시드, workerCount : 잡 시스템 워커 수 (-1이면 코어 수 - 1)
+	void Initialize(const Platform& newPlatform, uint32_t seed, int workerCount = -1)
+	{
+		platform = newPlatform;
+		g_Audio = platform.audio;
+		g_Renderer = platform.renderer;
+
+		// 맵 초기화 및 텍스처 로드
+		// 맵 이미지 파일 경로를 넣어주고 프레임은 무조건 1
+		background.LoadTexture("Assets/Textures/map_bg.png", 1);
+
+		background.SetScale(10.0f, 10.0f);   // 도화지를 화면보다 훨씬 크게 키움
+		background.SetUVScale(1.0f, 1.0f);
+		background.SetPosition(0.0f, 0.0f);  // 맵 항상 세상의 정중앙에 고정
+		background.SetObjectType(0);
+
+		// HP 바 초기화 (배경 이미지를 불러오되 셰이더에서 사각형으로 덮어씀)
+		hpBarBg.LoadTexture("Assets/Textures/map_bg.png", 1);
+		hpBarBg.SetTintColor(0.2f, 0.2f, 0.2f); // 짙은 회색 배경
+		hpBarBg.SetObjectType(2);               // 사각형 사용
+
+		hpBarFill.LoadTexture("Assets/Textures/map_bg.png", 1);
+		hpBarFill.SetTintColor(0.0f, 1.0f, 0.0f); // 초록색 체력
+		hpBarFill.SetObjectType(2);                 // 사각형 사용
+
+
+		// 미사일 초기화 (플레이어 이미지를 노란색으로 칠해서 구슬처럼 쏨)
+		for (GameObject& bullet : bullets)
+		{
+			bullet.LoadTexture("Assets/Textures/player_sheet.png", 1);
+			bullet.SetScale(0.05f, 0.05f);
+			bullet.SetTintColor(1.0f, 1.0f, 0.0f); // 노란색
+			bullet.SetObjectType(1); // 완벽한 동그라미 사용
+		}
+		
+		// 플레이어 객체 세팅 & 텍스처 로드
+		// png 파일 이름과 애니메이션 프레임 수 전달
+		player.LoadTexture("Assets/Textures/player_sheet.png", 30);
+		player.SetScale(0.45f, 0.45f);
+
+		// 마스터 텍스처 딱 1번씩만 메모리에 올리기
+		enemySkins[0].LoadTexture("Assets/Textures/Enemy1.png", 20);
+		enemySkins[1].LoadTexture("Assets/Textures/Enemy2.png", 20);
+		enemySkins[2].LoadTexture("Assets/Textures/Enemy3.png", 20);
+		enemySkins[3].LoadTexture("Assets/Textures/Enemy4.png", 30);
+		enemySkins[4].LoadTexture("Assets/Textures/Enemy5.png", 30);
+		enemySkins[5].LoadTexture("Assets/Textures/Enemy6.png", 20);
+
+		bossSkins[0].LoadTexture("Assets/Textures/Boss1.png", 20);
+		bossSkins[1].LoadTexture("Assets/Textures/Boss2.png", 20);
+		bossSkins[2].LoadTexture("Assets/Textures/Boss3.png", 30);
+		bossSkins[3].LoadTexture("Assets/Textures/Boss4.png", 20);
+
+		// 시뮬레이션 초기화 (그리기용 객체 수와 같은 용량, 적 칸마다 타입이 정해짐)
+		SimConfig simConfig;
+		simConfig.enemyCapacity = ENEMY_COUNT;
+		simConfig.bulletCapacity = MAX_BULLETS;
+		simConfig.gemCapacity = MAX_GEMS;
+		simConfig.damageTextCapacity = MAX_DMG_TEXTS;
+		simConfig.effectCapacity = MAX_EFFECTS;
+		simConfig.seed = seed;
+		world.Initialize(simConfig);
+
+		jobs.Initialize(workerCount);  // 기본은 코어 수 - 1 만큼 워커 생성
+		world.SetJobSystem(&jobs);
+
+		// 몬스터 초기화, 몬스터들은 로드된 마스터 스킨을 공유만 받음
+
+		for (int i = 0; i < ENEMY_COUNT; i++)
+		{
+			// 일반 몬스터 구역 (0 ~ 55번) - 10마리씩 할당
+			if (i < 10) enemies[i].ShareTextureFrom(enemySkins[0]);
+			else if (i < 20) enemies[i].ShareTextureFrom(enemySkins[1]);
+			else if (i < 30) enemies[i].ShareTextureFrom(enemySkins[2]);
+			else if (i < 40) enemies[i].ShareTextureFrom(enemySkins[3]);
+			else if (i < 50) enemies[i].ShareTextureFrom(enemySkins[4]);
+			else if (i < 56) enemies[i].ShareTextureFrom(enemySkins[5]);
+
+			// 보스 구역 (56 ~ 59번)
+			else if (i == 56) enemies[i].ShareTextureFrom(bossSkins[0]);
+			else if (i == 57) enemies[i].ShareTextureFrom(bossSkins[1]);
+			else if (i == 58) enemies[i].ShareTextureFrom(bossSkins[2]);
+			else if (i == 59) enemies[i].ShareTextureFrom(bossSkins[3]);
+
+			// 타입은 시뮬레이션 적 풀의 같은 칸에 정해진 값을 따름
+			enemies[i].enemyType = world.enemies.type[i];
+			enemies[i].InitLook();
+		}
+
+		// 경험치 바 (EXP Bar) 초기화
+		expBarBg.LoadTexture("Assets/Textures/map_bg.png", 1);
+		expBarBg.SetTintColor(0.0f, 0.0f, 0.2f); // 짙은 파란색 (배경)
+		expBarBg.SetObjectType(2); // 사각형 사용
+
+		expBarFill.LoadTexture("Assets/Textures/map_bg.png", 1);
+		expBarFill.SetTintColor(0.0f, 0.5f, 1.0f); // 밝은 파란색 (채워지는 바)
+		expBarFill.SetObjectType(2); // 사각형 사용
+
+		// 레벨 배경 UI 초기화
+		// 이미지 이름은 실제 저장하신 파일명과 완벽히 똑같이 맞춰주세요!
+		levelBg.LoadTexture("Assets/Textures/level_bg.png", 1);
+		levelBg.SetScale(0.1f, 0.15f);
+		levelBg.SetObjectType(0);
+
+		// 레벨 숫자 텍스트 (데미지 폰트 재활용)
+		for (int i = 0; i < 2; i++)
+		{
+			levelTexts[i].LoadTexture("Assets/Textures/damage_font.png", 10);
+			levelTexts[i].SetScale(0.03f, 0.045f);
+			levelTexts[i].SetTintColor(1.0f, 1.0f, 1.0f);
+			levelTexts[i].SetObjectType(0);
+			levelTexts[i].SetFrameDuration(9999.0f); // 애니메이션 멈춤
+		}
+
+		// 경험치 젬 초기화
+		// "gem.png" 같은 진짜 보석 이미지 파일 경로로 변경 (마스터 스킨에 한 번만 로드)
+		gemSkin.LoadTexture("Assets/Textures/gem.png", 1);
+
+		for (GameObject& gem : gems) SetupGem(gem);
+
+		// 데미지 텍스트 초기화
+		for (GameObject& text : dmgTexts)
+		{
+			// 숫자 0~9 가 일렬로 나열된 스프라이트 시트
+			// 숫자가 10개이므로 프레임 수를 '10'으로 설정하여 이미지를 10등분
+			text.LoadTexture("Assets/Textures/damage_font.png", 10);
+			text.SetScale(0.04f, 0.06f);
+			text.SetTintColor(1.0f, 1.0f, 1.0f);
+			text.SetObjectType(0);
+			// 애니메이션 영원히 정지
+			text.SetFrameDuration(9999.0f);
+		}
+
+		// Game Over 및 Clear UI 초기화
+		gameOverUI.LoadTexture("Assets/Textures/GameOver.png", 50);
+		gameOverUI.SetScale(0.8f, 1.2f);
+		gameOverUI.SetObjectType(0);
+
+		clearUI.LoadTexture("Assets/Textures/Clear.png", 80);
+		clearUI.SetScale(0.8f, 1.2f);
+		clearUI.SetObjectType(0);
+
+		// 타이머 텍스트 초기화
+		for (int i = 0; i < 4; i++)
+		{
+			// 0~9가 10칸으로 나열된 Timer_font.png 사용
+			timerTexts[i].LoadTexture("Assets/Textures/Timer_font.png", 10);
+			timerTexts[i].SetScale(0.04f, 0.06f); // 데미지 폰트보다 살짝 작거나 비슷하게
+			timerTexts[i].SetTintColor(1.0f, 1.0f, 1.0f); // 하얀색
+			timerTexts[i].SetObjectType(0);
+			timerTexts[i].SetFrameDuration(9999.0f); // 애니메이션 멈춤
+		}
+
+		// 콜론(:) 초기화
+		for (int i = 0; i < 2; i++)
+		{
+			// 검은색 배경 점 (테두리 역할)
+			timerColonBg[i].LoadTexture("Assets/Textures/map_bg.png", 1);
+			timerColonBg[i].SetScale(0.015f, 0.02f); // 흰색 점보다 약간 크게
+			timerColonBg[i].SetTintColor(0.0f, 0.0f, 0.0f); // 완벽한 검은색
+			timerColonBg[i].SetObjectType(1); // 동그라미 셰이더 재활용
+
+			// 흰색 점
+			timerColon[i].LoadTexture("Assets/Textures/map_bg.png", 1);
+			timerColon[i].SetScale(0.01f, 0.015f); // 원래 크기
+			timerColon[i].SetTintColor(1.0f, 1.0f, 1.0f); // 하얀색
+			timerColon[i].SetObjectType(1);
+		}
+
+		// 무기 선택 카드 UI 초기화
+		weaponCards[0].LoadTexture("Assets/Textures/weapon_card_1.png", 1);
+		weaponCards[0].InitScale(0.6f, 0.95f);
+		weaponCards[0].SetObjectType(0);
+
+		weaponCards[1].LoadTexture("Assets/Textures/weapon_card_2.png", 1);
+		weaponCards[1].InitScale(0.6f, 0.95f);
+		weaponCards[1].SetObjectType(0);
+
+		weaponCards[2].LoadTexture("Assets/Textures/weapon_card_3.png", 1);
+		weaponCards[2].InitScale(0.6f, 0.95f);
+		weaponCards[2].SetObjectType(0);
+
+		// 카드 위에 올라갈 무기 아이콘 초기화
+		for (int i = 0; i < 3; i++)
+		{
+			weaponIcons[i].SetScale(0.45f, 0.45f); // 카드보다 작게 크기 조절
+			weaponIcons[i].SetObjectType(0);
+		}
+
+		// 각각 지정된 이름의 텍스처 로드
+		weaponIcons[0].LoadTexture("Assets/Textures/MELEE.png", 1);
+		weaponIcons[1].LoadTexture("Assets/Textures/BULLET.png", 1);
+		weaponIcons[2].LoadTexture("Assets/Textures/AURA.png", 1);
+
+		// 이펙트 초기화 (재생 프레임은 시뮬레이션이 진행시키므로 여기선 그림만 세팅)
+		for (GameObject& effect : meleeEffects)
+		{
+			effect.LoadTexture("Assets/Textures/weapon_melee.png", 30);
+			effect.SetScale(0.3f, 0.3f);
+			effect.SetObjectType(0);
+		}
+
+		for (GameObject& effect : hitEffects)
+		{
+			effect.LoadTexture("Assets/Textures/weapon_bullet_hit.png", 30);
+			effect.SetScale(0.2f, 0.2f);
+			effect.SetObjectType(0);
+		}
+
+		// 오라 이펙트
+		auraEffect.LoadTexture("Assets/Textures/weapon_aura.png", 30);
+		auraEffect.SetScale(world.auraRadius * 2.0f, world.auraRadius * 2.0f); // 반지름의 2배 = 지름
+		auraEffect.SetObjectType(0);
+		auraEffect.SetFrameDuration(0.016f);
+
+		// 메인 씬 (TITLE) 초기화
+		titleBg.LoadTexture("Assets/Textures/map_bg.png", 1);
+		titleBg.SetScale(4.0f, 3.0f); // 화면 꽉 차게
+		titleBg.SetObjectType(0);
+
+		titleText.LoadTexture("Assets/Textures/title_text.png", 1);
+		titleText.SetScale(1.0f, 1.0f);
+		titleText.SetObjectType(0);
+
+		btnStart.LoadTexture("Assets/Textures/btn_start.png", 1);
+		btnStart.InitScale(0.4f, 0.2f); // 버튼 기본 크기 세팅
+		btnStart.SetObjectType(0);
+
+		btnSetting.LoadTexture("Assets/Textures/btn_setting.png", 1);
+		btnSetting.InitScale(0.4f, 0.2f);
+		btnSetting.SetObjectType(0);
+
+		btnExit.LoadTexture("Assets/Textures/btn_exit.png", 1);
+		btnExit.InitScale(0.4f, 0.2f);
+		btnExit.SetObjectType(0);
+
+		// 일시정지 (PAUSE) 설정 창 초기화
+		pauseBg.LoadTexture("Assets/Textures/pause_bg.png", 1); // 반투명 팝업 창 느낌
+		pauseBg.SetScale(0.6f, 1.2f);
+		pauseBg.SetObjectType(0);
+
+		btnPauseMain.LoadTexture("Assets/Textures/btn_main.png", 1);
+		btnPauseMain.InitScale(0.5f, 0.25f);
+		btnPauseMain.SetObjectType(0);
+
+		btnPauseSetting.LoadTexture("Assets/Textures/btn_setting.png", 1);
+		btnPauseSetting.InitScale(0.5f, 0.25f);
+		btnPauseSetting.SetObjectType(0);
+
+		btnPauseExit.LoadTexture("Assets/Textures/btn_exit.png", 1);
+		btnPauseExit.InitScale(0.5f, 0.25f);
+		btnPauseExit.SetObjectType(0);
+
+		// 결과 창 (GAME_OVER & CLEAR) 초기화
+		btnRetry.LoadTexture("Assets/Textures/btn_retry.png", 1);
+		btnRetry.InitScale(0.6f, 0.2f);
+		btnRetry.SetObjectType(0);
+
+		btnResultMain.LoadTexture("Assets/Textures/btn_main.png", 1);
+		btnResultMain.InitScale(0.6f, 0.2f);
+		btnResultMain.SetObjectType(0);
+
+		btnResultExit.LoadTexture("Assets/Textures/btn_exit.png", 1);
+		btnResultExit.InitScale(0.6f, 0.2f);
+		btnResultExit.SetObjectType(0);
+
+		scoreBg.LoadTexture("Assets/Textures/score_bg.png", 1);
+		scoreBg.SetScale(0.6f, 0.2f); // 버튼 크기와 동일하게 세팅
+		scoreBg.SetObjectType(0);
+
+		// 점수를 표시할 6자리의 숫자 폰트 세팅 (타이머 폰트 재활용)
+		for (int i = 0; i < 6; i++)
+		{
+			scoreTexts[i].LoadTexture("Assets/Textures/Timer_font.png", 10);
+			scoreTexts[i].SetScale(0.04f, 0.06f);
+			scoreTexts[i].SetTintColor(1.0f, 1.0f, 1.0f);
+			scoreTexts[i].SetObjectType(0);
+			scoreTexts[i].SetFrameDuration(9999.0f);
+		}
+
+		// 레벨업 UI 초기화
+		levelUpBg.LoadTexture("Assets/Textures/level_up_bg.png", 1);
+		levelUpBg.SetScale(1.8f, 1.8f);
+		levelUpBg.SetObjectType(0);
+
+		// 업그레이드 카드 스킨들 미리 로드 (0:HP, 1:SPD, 2:DMG, 3:CDR, 4:AURA)
+		const char* cardPaths[] = {
+			"Assets/Textures/up_hp.png", 
+			"Assets/Textures/up_speed.png",
+			"Assets/Textures/up_damage.png", 
+			"Assets/Textures/up_cooldown.png", 
+			"Assets/Textures/up_aura.png"
+		};
+
+		for (int i = 0; i < 5; i++) 
+		{
+			cardSkins[i].LoadTexture(cardPaths[i], 1);
+		}
+
+		// 실제 화면에 뜰 버튼 카드 3개 설정
+		for (int i = 0; i < 3; i++) 
+		{
+			upgradeCards[i].InitScale(0.45f, 1.0f); // 카드 형태의 버튼
+			upgradeCards[i].SetObjectType(0);
+		}
+
+		// 위에서 LoadTexture로 모은 이미지 파일을 워커들이 동시에 풀고 한 번에 올림 (끝날 때까지 기다림)
+		platform.renderer->FinishTextureLoads(&jobs);
+
+		// 시간 관리자 시작
+		platform.timer->Reset();
+		simClock.SetTickRate(SIM_TICK_RATE);
+		simClock.SetMaxStepsPerFrame(MAX_SIM_STEPS_PER_FRAME);
+
+		// WAV 파일 로드 (사운드 시스템 초기화는 플랫폼이 미리 함)
+		platform.audio->LoadWAV("bgm", "Assets/Sounds/bgm.wav");
+		platform.audio->LoadWAV("hover", "Assets/Sounds/hover.wav");
+		platform.audio->LoadWAV("click", "Assets/Sounds/click.wav");
+		platform.audio->LoadWAV("attack_melee", "Assets/Sounds/attack_melee.wav");
+		platform.audio->LoadWAV("attack_bullet", "Assets/Sounds/attack_bullet.wav");
+		platform.audio->LoadWAV("attack_aura", "Assets/Sounds/attack_aura.wav");
+		platform.audio->LoadWAV("levelup", "Assets/Sounds/levelup.wav");
+
+		// 게임 켜지자마자 배경음악 무한 루프 재생!
+		platform.audio->Play("bgm", true, 0.4f);
+	}
+
+	// 시뮬레이션 스레드에서 매번 호출 : 흐른 시간만큼 고정 간격 틱을 돌리고, 마지막 두 틱 사이를 보간해서 그리기용 객체에 반영
+	void Update()
+	{
+		platform.timer->Update();
+		int steps = simClock.Advance(platform.timer->GetDeltaTime());
+
+		for (int step = 0; step < steps; step++)
+		{
+			Tick(simClock.GetTickDt());
+		}
+
+		// 타이틀 화면에서는 인게임 세계를 그리지 않음
+		if (currentState == GameState::TITLE) return;
+
+		// 시뮬레이션이 멈춘 상태 (일시정지, 레벨업 등)에서는 마지막 틱 위치에 고정
+		bool isPlaying = currentState == GameState::PLAY;
+		SyncWorldView(isPlaying ? simClock.GetAlpha() : 1.0f, isPlaying ? platform.timer->GetDeltaTime() : 0.0f);
+	}
+
+	// 키보드 상태를 시뮬레이션 입력으로 변환 (WASD 또는 방향키)
+	SimInput ReadSimInput()
+	{
+		SimInput input;
+		IInput& keys = *platform.input;
+		input.up = keys.IsKeyDown(KEY_W) || keys.IsKeyDown(KEY_UP);
+		input.down = keys.IsKeyDown(KEY_S) || keys.IsKeyDown(KEY_DOWN);
+		input.left = keys.IsKeyDown(KEY_A) || keys.IsKeyDown(KEY_LEFT);
+		input.right = keys.IsKeyDown(KEY_D) || keys.IsKeyDown(KEY_RIGHT);
+		return input;
+	}
+
+	// 시뮬레이션이 이번 틱에 알려준 일 처리 (효과음, 씬 전환)
+	void HandleSimEvents()
+	{
+		for (const SimEvent& e : world.events)
+		{
+			if (e.type == SimEventType::Sound)
+			{
+				if (e.sound == SimSound::Gem) platform.audio->Play("gem");
+				else if (e.sound == SimSound::AttackMelee) platform.audio->Play("attack_melee");
+				else if (e.sound == SimSound::AttackBullet) platform.audio->Play("attack_bullet");
+				else if (e.sound == SimSound::AttackAura) platform.audio->Play("attack_aura");
+			}
+			else if (e.type == SimEventType::GameOver)
+			{
+				currentState = GameState::GAME_OVER;
+			}
+			else if (e.type == SimEventType::Clear)
+			{
+				currentState = GameState::CLEAR;
+			}
+			else if (e.type == SimEventType::LevelUp)
+			{
+				platform.audio->Play("levelup");
+
+				// 랜덤하게 3가지 업그레이드 아이디 뽑기 (0~4 중 중복 없이)
+				for (int i = 0; i < 3; i++)
+				{
+					bool isUnique = false;
+
+					while (!isUnique)
+					{
+						cardUpIds[i] = rand() % 5;
+						isUnique = true;
+						for (int j = 0; j < i; j++) if (cardUpIds[i] == cardUpIds[j]) isUnique = false;
+					}
+
+					// 텍스처를 카드 버튼에 입힘
+					upgradeCards[i].ShareTextureFrom(cardSkins[cardUpIds[i]]);
+				}
+
+				currentState = GameState::LEVEL_UP; // 레벨업 씬으로 전환
+				platform.timer->Sleep(200); // 아주 짧은 딜레이
+			}
+		}
+	}
+
+	// 시뮬레이션 상태를 그리기용 객체들로 옮겨서 GPU로 전송
+	// 위치는 직전 틱과 현재 틱 사이를 alpha (0 ~ 1) 비율로 섞고, 애니메이션은 실제 프레임 시간 (animDt)만큼 진행
+	void SyncWorldView(float alpha, float animDt)
+	{
+		const SimPlayer& p = world.player;
+		float px = p.prevX + (p.x - p.prevX) * alpha;
+		float py = p.prevY + (p.y - p.prevY) * alpha;
+
+		// 카메라는 보간한 플레이어 위치를 따라가되 파란색 허공을 비추지 않도록 제한
+		Float2 camPos = { px, py };
+		float camLimit = 4.0f;
+
+		if (camPos.x > camLimit)  camPos.x = camLimit;
+		if (camPos.x < -camLimit) camPos.x = -camLimit;
+		if (camPos.y > camLimit)  camPos.y = camLimit;
+		if (camPos.y < -camLimit) camPos.y = -camLimit;
+
+		// 무한 맵 (배경) 스크롤 로직
+		// 배경은 세상의 중심(0,0)에 가만히 있고 카메라만 움직이게
+		background.SetCameraPos(camPos.x, camPos.y);
+		background.Update(animDt);
+
+		// 플레이어 (피격 중이면 빨간색)
+		player.SetPosition(px, py);
+		player.SetFlipped(p.isFlipped);
+		if (p.isHit) player.SetTintColor(1.0f, 0.0f, 0.0f);
+		else player.SetTintColor(1.0f, 1.0f, 1.0f);
+		player.SetCameraPos(camPos.x, camPos.y);
+		player.Update(animDt);
+
+		// 오라 (플레이어 몸에 붙어서 업그레이드된 범위만큼)
+		if (world.selectedWeapon == 2 && world.isAuraActive)
+		{
+			auraEffect.SetPosition(px, py);
+			auraEffect.SetScale(world.auraRadius * 2.0f, world.auraRadius * 2.0f);
+			auraEffect.SetCameraPos(camPos.x, camPos.y);
+			auraEffect.Update(animDt);
+		}
+
+		// 살아있는 적 (죽은 적은 그리지 않으므로 건너뜀)
+		const EnemyPool& pool = world.enemies;
+		for (int i = 0; i < ENEMY_COUNT; i++)
+		{
+			if (!pool.alive[i]) continue;
+
+			enemies[i].SetPosition(pool.prevX[i] + (pool.x[i] - pool.prevX[i]) * alpha, pool.prevY[i] + (pool.y[i] - pool.prevY[i]) * alpha);
+			enemies[i].SetFlipped(p.x < pool.x[i]); // 플레이어가 내 왼쪽에 있으면 왼쪽 보기
+			enemies[i].SetCameraPos(camPos.x, camPos.y);
+			enemies[i].Update(animDt);
+		}
+
+		for (int n = 0; n < world.bullets.GetLiveCount(); n++)
+		{
+			const SimBullet& b = world.bullets.Live(n);
+			GameObject& bullet = bullets[world.bullets.LiveSlot(n)];
+			bullet.SetPosition(b.prevX + (b.x - b.prevX) * alpha, b.prevY + (b.y - b.prevY) * alpha);
+			bullet.SetCameraPos(camPos.x, camPos.y);
+			bullet.Update(0.0f);
+		}
+
+		for (int n = 0; n < world.gems.GetLiveCount(); n++)
+		{
+			const SimGem& g = world.gems.Live(n);
+			GameObject& gem = gems[world.gems.LiveSlot(n)];
+			gem.SetPosition(g.x, g.y);
+			gem.SetCameraPos(camPos.x, camPos.y);
+			gem.Update(animDt);
+		}
+
+		for (int n = 0; n < world.damageTexts.GetLiveCount(); n++)
+		{
+			const SimDamageText& t = world.damageTexts.Live(n);
+			GameObject& text = dmgTexts[world.damageTexts.LiveSlot(n)];
+			text.SetPosition(t.prevX + (t.x - t.prevX) * alpha, t.prevY + (t.y - t.prevY) * alpha);
+			text.SetFrame(t.digit);
+			text.SetCameraPos(camPos.x, camPos.y);
+			text.Update(0.0f);
+		}
+
+		SyncEffects(world.meleeEffects, meleeEffects, camPos);
+		SyncEffects(world.hitEffects, hitEffects, camPos);
+
+		SyncHud(px, py, camPos);
+	}
+
+	void SyncEffects(const Pool<SimEffect>& simEffects, GameObject* sprites, const Float2& camPos)
+	{
+		for (int n = 0; n < simEffects.GetLiveCount(); n++)
+		{
+			const SimEffect& e = simEffects.Live(n);
+			GameObject& effect = sprites[simEffects.LiveSlot(n)];
+			effect.SetPosition(e.x, e.y);
+			effect.SetFlipped(e.isFlipped);
+			effect.SetFrame(e.frame);
+			effect.SetCameraPos(camPos.x, camPos.y);
+			effect.Update(0.0f);
+		}
+	}
+
+	// 체력바, 경험치바, 레벨, 타이머 (체력바는 플레이어를 따라다니고 나머지는 화면에 고정)
+	void SyncHud(float px, float py, const Float2& camPos)
+	{
+		const SimPlayer& p = world.player;
+
+		// HP바 크기와 위치 실시간 계산
+		float barWidth = 0.12f;      // 체력바 전체 가로길이
+		float barHeight = 0.02f;    // 체력바 세로 두께
+		float hpY = py - 0.25f;     // 플레이어 위치보다 살짝 아래
+
+		hpBarBg.SetPosition(px, hpY); // 위치 세팅
+		hpBarBg.SetCameraPos(camPos.x, camPos.y);
+		hpBarBg.SetScale(barWidth, barHeight);
+		hpBarBg.Update(0.0f); // 애니메이션 없으므로 0.0f 전달
+
+		// 체력 게이지(초록 줄) 계산
+		float hpRatio = p.hp / p.maxHp;
+
+		if (hpRatio < 0.0f) hpRatio = 0.0f; // 마이너스 방지
+
+		float currentWidth = barWidth * hpRatio; // 현재 체력만큼 깎인 길이
+		float offset = (barWidth - currentWidth) * 0.5f;
+
+		hpBarFill.SetPosition(px - offset, hpY); // 위치 세팅
+		hpBarFill.SetCameraPos(camPos.x, camPos.y);
+		hpBarFill.SetScale(currentWidth, barHeight);
+
+		// 피가 30% 이하면 빨간색으로 변경
+		if (hpRatio <= 0.3f)
+		{
+			hpBarFill.SetTintColor(1.0f, 0.0f, 0.0f);
+		}
+		else
+		{
+			hpBarFill.SetTintColor(0.0f, 1.0f, 0.0f);
+		}
+
+		hpBarFill.Update(0.0f);
+
+		// EXP 바 (화면 맨 위에 고정)
+		float expBarWidth = 2.0f;
+		float expBarHeight = 0.05f;
+		float expY = camPos.y + 0.95f;
+
+		expBarBg.SetPosition(camPos.x, expY);
+		expBarBg.SetCameraPos(camPos.x, camPos.y);
+		expBarBg.SetScale(expBarWidth, expBarHeight);
+		expBarBg.Update(0.0f);
+
+		float expRatio = p.exp / p.maxExp;
+
+		if (expRatio > 1.0f) expRatio = 1.0f;
+
+		float currentExpWidth = expBarWidth * expRatio;
+		float expOffset = (expBarWidth - currentExpWidth) * 0.5f;
+
+		expBarFill.SetPosition(camPos.x - expOffset, expY);
+		expBarFill.SetCameraPos(camPos.x, camPos.y);
+		expBarFill.SetScale(currentExpWidth, expBarHeight);
+		expBarFill.Update(0.0f);
+
+		// 레벨 UI (우측 상단)
+		float uiY = camPos.y + 0.85f; // EXP 바 살짝 아래
+		float levelX = camPos.x + 0.8f; // 화면 우측으로 이동
+
+		levelBg.SetPosition(levelX, uiY);
+		levelBg.SetCameraPos(camPos.x, camPos.y);
+		levelBg.Update(0.0f);
+
+		int tens = (p.level / 10) % 10;
+		int units = p.level % 10;
+
+		levelTexts[0].SetFrame(tens);
+		levelTexts[1].SetFrame(units);
+
+		// 두 숫자가 살짝 떨어져 있도록 간격 조절
+		float textSpacing = 0.015f;
+		levelTexts[0].SetPosition(levelX - textSpacing, uiY);
+		levelTexts[1].SetPosition(levelX + textSpacing, uiY);
+
+		for (int i = 0; i < 2; i++)
+		{
+			levelTexts[i].SetCameraPos(camPos.x, camPos.y);
+			levelTexts[i].Update(0.0f);
+		}
+
+
+		// 타이머 시스템 (화면 중앙 상단 배치)
+		// 전체 시간을 분(MM)과 초(SS)로 쪼개기
+		int minutes = (int)(world.gameTimer / 60.0f);
+		int seconds = (int)world.gameTimer % 60;
+
+		// 각 자릿수 추출 (예: 12분 34초 -> m1=1, m2=2, s1=3, s2=4)
+		int m1 = (minutes / 10) % 10;
+		int m2 = minutes % 10;
+		int s1 = (seconds / 10) % 10;
+		int s2 = seconds % 10;
+
+		// 폰트에 프레임(숫자) 적용
+		timerTexts[0].SetFrame(m1);
+		timerTexts[1].SetFrame(m2);
+		timerTexts[2].SetFrame(s1);
+		timerTexts[3].SetFrame(s2);
+
+		// 폰트 간격 설정 (가운데를 살짝 띄워서 ':' 역할을 대신함)
+		float spacingTime = 0.04f;
+		float gap = 0.03f; // 콜론(:)이 들어갈 빈 공간
+
+		timerTexts[0].SetPosition(camPos.x - spacingTime - gap, uiY);
+		timerTexts[1].SetPosition(camPos.x - gap, uiY);
+		timerTexts[2].SetPosition(camPos.x + gap, uiY);
+		timerTexts[3].SetPosition(camPos.x + spacingTime + gap, uiY);
+
+		for (int i = 0; i < 4; i++)
+		{
+			timerTexts[i].SetCameraPos(camPos.x, camPos.y);
+			timerTexts[i].Update(0.0f);
+		}
+
+		// 콜론 (:) 위치 잡기
+		// X좌표는 화면 정중앙(camPos.x), Y좌표는 타이머 기준 위/아래로 살짝 벌림
+		// Y좌표 세팅 (위쪽 점, 아래쪽 점)
+		float colonTopY = uiY + 0.015f;
+		float colonBottomY = uiY - 0.015f;
+
+		// 검은색 배경 점 (뒤에 그릴 예정)
+		timerColonBg[0].SetPosition(camPos.x, colonTopY);
+		timerColonBg[1].SetPosition(camPos.x, colonBottomY);
+
+		// 흰색 점 (앞에 그릴 예정)
+		timerColon[0].SetPosition(camPos.x, colonTopY);
+		timerColon[1].SetPosition(camPos.x, colonBottomY);
+
+		// 업데이트 호출 (카메라 좌표 전달)
+		for (int i = 0; i < 2; i++)
+		{
+			timerColonBg[i].SetCameraPos(camPos.x, camPos.y);
+			timerColonBg[i].Update(0.0f);
+
+			timerColon[i].SetCameraPos(camPos.x, camPos.y);
+			timerColon[i].Update(0.0f);
+		}
+	}
+
+	// 시뮬레이션 한 틱 (dt는 항상 1 / SIM_TICK_RATE)
+	void Tick(float dt)
+	{
+		// ESC 키 일시정지 (PAUSE) 토글 로직
+		if (platform.input->IsKeyDown(KEY_ESCAPE))
+		{
+			if (!isEscPressed)  // 키를 누르는 그 순간 딱 한 번만 작동
+			{
+				if (currentState == GameState::PLAY)
+				{
+					currentState = GameState::PAUSE;
+				}
+				else if (currentState == GameState::PAUSE)
+				{
+					currentState = GameState::PLAY;
+				}
+				isEscPressed = true;
+			}
+		}
+		else
+		{
+			isEscPressed = false;   // 키를 떼면 다시 누를 수 있게 리셋
+		}
+
+		// 공용 카메라 위치 계산
+		Float2 camPos = { world.player.x, world.player.y };
+		float camLimit = 4.0f;
+
+		if (camPos.x > camLimit)  camPos.x = camLimit;
+		if (camPos.x < -camLimit) camPos.x = -camLimit;
+		if (camPos.y > camLimit)  camPos.y = camLimit;
+		if (camPos.y < -camLimit) camPos.y = -camLimit;
+
+		// 마우스 클릭 상태 1번만 체크
+		bool isMouseDown = platform.input->IsMouseDown();
+		int pointerX = 0, pointerY = 0;
+		platform.input->GetMousePosition(pointerX, pointerY);
+		float mouseX = (pointerX * 2.0f / platform.window->GetWidth()) - 1.0f;
+		float mouseY = -((pointerY * 2.0f / platform.window->GetHeight()) - 1.0f); // Y축은 위가 +이므로 뒤집기
+
+		// 메인 씬 (TITLE)
+		if (currentState == GameState::TITLE)
+		{
+			// 카메라 위치 대신 (0, 0)을 전달하여 화면 중앙에 고정
+			titleBg.SetCameraPos(0, 0);
+			titleBg.Update(0.0f);
+
+			titleText.SetPosition(0.0f, 0.4f);
+			titleText.SetCameraPos(0, 0);
+			titleText.Update(0.0f);
+
+			// 버튼들도 (0, 0) 카메라 기준으로 배치
+			btnStart.SetPosition(0.0f, -0.1f); btnStart.SetCameraPos(0, 0);
+			btnSetting.SetPosition(0.0f, -0.4f); btnSetting.SetCameraPos(0, 0);
+			btnExit.SetPosition(0.0f, -0.7f); btnExit.SetCameraPos(0, 0);
+
+			if (btnStart.UpdateButton(mouseX, mouseY, isMouseDown))
+			{
+				platform.audio->Play("click");
+				ResetGame();
+				currentState = GameState::WEAPON_SELECT;
+				platform.timer->Sleep(200);
+			}
+			if (btnSetting.UpdateButton(mouseX, mouseY, isMouseDown))
+			{
+				// 나중에 세팅 기능 추가
+			}
+			if (btnExit.UpdateButton(mouseX, mouseY, isMouseDown))
+			{
+				quitRequested = true; // 프로그램 종료
+			}
+
+			// 부드러운 행렬 업데이트를 위해 호출
+			btnStart.Update(0.0f); btnSetting.Update(0.0f); btnExit.Update(0.0f);
+		}
+		else if (currentState == GameState::WEAPON_SELECT)   // 무기 선택 창 (WEAPON_SELECT)
+		{
+			// 카드 3장을 화면 중앙에 나란히 배치 (크기 및 간격 확장)
+			float spacing = 0.7f;
+			float iconOffsetY = 0.05f;
+
+			weaponCards[0].SetScale(0.6f, 0.95f);
+			weaponCards[1].SetScale(0.6f, 0.95f);
+			weaponCards[2].SetScale(0.6f, 0.95f);
+
+			weaponCards[0].SetPosition(camPos.x - spacing, camPos.y);
+			weaponCards[1].SetPosition(camPos.x, camPos.y);
+			weaponCards[2].SetPosition(camPos.x + spacing, camPos.y);
+
+			// 아이콘 위치 세팅 (카드 위치와 동일하게 맞춤)
+			weaponIcons[0].SetPosition(camPos.x - spacing, camPos.y + iconOffsetY);
+			weaponIcons[1].SetPosition(camPos.x, camPos.y + iconOffsetY);
+			weaponIcons[2].SetPosition(camPos.x + spacing, camPos.y + iconOffsetY);
+
+			// 카메라 위치가 반영된 월드 마우스 좌표 계산
+			float worldMouseX = mouseX + camPos.x;
+			float worldMouseY = mouseY + camPos.y;
+
+			for (int i = 0; i < 3; i++)
+			{
+				// 버튼 업데이트 및 클릭 판정 (화면 3등분 대신 버튼 자체 충돌 판정 사용!)
+				if (weaponCards[i].UpdateButton(worldMouseX, worldMouseY, isMouseDown))
+				{
+					world.selectedWeapon = i; // 0, 1, 2번 인덱스 그대로 무기 번호로 사용
+					currentState = GameState::PLAY;
+					platform.timer->Sleep(200); // 연속 클릭 방지
+				}
+
+				weaponCards[i].SetCameraPos(camPos.x, camPos.y);
+				weaponCards[i].Update(0.0f);
+
+				// 아이콘도 카메라와 매트릭스 업데이트
+				weaponIcons[i].SetCameraPos(camPos.x, camPos.y);
+				weaponIcons[i].Update(0.0f);
+			}
+
+			// 마우스 클릭 감지 로직
+			if (isMouseDown)  // 마우스 왼쪽 버튼 클릭 시
+			{
+				// 카드가 3등분 된 영역 중 어디를 클릭했는지 판별
+				if (mouseX < -0.33f) world.selectedWeapon = 0;      // 왼쪽 클릭 -> 근접
+				else if (mouseX < 0.33f) world.selectedWeapon = 1;  // 중앙 클릭 -> 총
+				else world.selectedWeapon = 2;                      // 오른쪽 클릭 -> 오라      
+
+				// 무기 고르면 게임 시작
+				currentState = GameState::PLAY;
+				platform.timer->Sleep(200); // 연속 클릭 방지용 아주 짧은 딜레이
+			}
+		}
+		// 오직 PLAY 상태일 때만 게임 세계의 시간이 흐름
+		else if (currentState == GameState::PLAY)
+		{
+			// 전투, 이동, 웨이브는 전부 시뮬레이션이 처리하고 여기선 결과 이벤트만 받아서 처리
+			world.Tick(ReadSimInput(), dt);
+			HandleSimEvents();
+		}
+		else if (currentState == GameState::LEVEL_UP)   // LEVEL_UP 선택 씬
+		{
+			float worldMouseX = mouseX + camPos.x;
+			float worldMouseY = mouseY + camPos.y;
+
+			pauseBg.SetPosition(camPos.x, camPos.y);
+			pauseBg.SetCameraPos(camPos.x, camPos.y);
+			pauseBg.Update(0.0f);
+
+			levelUpBg.SetPosition(camPos.x, camPos.y);
+			levelUpBg.SetCameraPos(camPos.x, camPos.y);
+			levelUpBg.Update(0.0f);
+
+			float cardSpacing = 0.55f;
+
+			for (int i = 0; i < 3; i++)
+			{
+				upgradeCards[i].SetPosition(camPos.x + (i - 1) * cardSpacing, camPos.y);
+				upgradeCards[i].SetCameraPos(camPos.x, camPos.y);
+
+				if (upgradeCards[i].UpdateButton(worldMouseX, worldMouseY, isMouseDown))
+				{
+					// 선택한 카드에 따른 능력치 적용!
+					world.ApplyUpgrade(cardUpIds[i]);
+
+					currentState = GameState::PLAY; // 다시 게임으로!
+					platform.timer->Sleep(200);
+				}
+				upgradeCards[i].Update(0.0f);
+			}
+		}
+		else if (currentState == GameState::PAUSE)  // 일시 정지 씬
+		{
+			// 배경과 버튼을 카메라 중앙에 띄움
+			pauseBg.SetPosition(camPos.x, camPos.y);
+			pauseBg.SetCameraPos(camPos.x, camPos.y);
+			pauseBg.Update(0.0f);
+
+			btnPauseMain.SetPosition(camPos.x, camPos.y + 0.2f);
+			btnPauseMain.SetCameraPos(camPos.x, camPos.y);
+
+			btnPauseSetting.SetPosition(camPos.x, camPos.y - 0.1f);
+			btnPauseSetting.SetCameraPos(camPos.x, camPos.y);
+
+			btnPauseExit.SetPosition(camPos.x, camPos.y - 0.4f);
+			btnPauseExit.SetCameraPos(camPos.x, camPos.y);
+
+			// 마우스 좌표(화면 기준)를 버튼 좌표(월드 기준)에 맞게 카메라 위치만큼 더함
+			float worldMouseX = mouseX + camPos.x;
+			float worldMouseY = mouseY + camPos.y;
+
+			// 버튼 판정 시 기존의 mouseX, mouseY 대신 worldMouseX, worldMouseY
+			if (btnPauseMain.UpdateButton(worldMouseX, worldMouseY, isMouseDown))
+			{
+				currentState = GameState::TITLE; // 메인으로 돌아감
+				platform.timer->Sleep(200);
+			}
+			if (btnPauseSetting.UpdateButton(worldMouseX, worldMouseY, isMouseDown))
+			{
+				// 세팅 기능
+			}
+			if (btnPauseExit.UpdateButton(worldMouseX, worldMouseY, isMouseDown))
+			{
+				quitRequested = true; // 종료
+			}
+
+			btnPauseMain.Update(0.0f);
+			btnPauseSetting.Update(0.0f);
+			btnPauseExit.Update(0.0f);
+		}    
+		else if (currentState == GameState::GAME_OVER || currentState == GameState::CLEAR) // 게임 오버 / 클리어 UI 및 점수 계산
+		{
+			float worldMouseX = mouseX + camPos.x;
+			float worldMouseY = mouseY + camPos.y;
+
+			if (currentState == GameState::GAME_OVER)
+			{
+				gameOverUI.SetPosition(camPos.x, camPos.y + 0.8f);
+				gameOverUI.SetCameraPos(camPos.x, camPos.y);
+				gameOverUI.Update(dt);
+			}
+			else
+			{
+				clearUI.SetPosition(camPos.x, camPos.y + 0.8f);
+				clearUI.SetCameraPos(camPos.x, camPos.y);
+				clearUI.Update(dt);
+			}
+
+			// 점수 계산 및 배경 띄우기
+			int score = (int)(world.gameTimer * 10.0f) + (world.player.level * 100) + (world.totalKills * 50);
+
+			scoreBg.SetPosition(camPos.x, camPos.y + 0.05f);
+			scoreBg.SetCameraPos(camPos.x, camPos.y);
+			scoreBg.Update(0.0f);
+
+			// 점수 숫자 추출 및 세팅
+			int tempScore = score;
+			float digitStartX = camPos.x + 0.06f;
+			float digitSpacing = 0.035f;
+
+			for (int i = 5; i >= 0; i--) // 1의 자리가 맨 뒤(5번)에 오도록 배열 거꾸로 순회
+			{
+				int digit = tempScore % 10;
+				tempScore /= 10;
+
+				scoreTexts[i].SetFrame(digit);
+				scoreTexts[i].SetPosition(digitStartX + (i * digitSpacing), camPos.y + 0.05f);
+				scoreTexts[i].SetCameraPos(camPos.x, camPos.y);
+				scoreTexts[i].Update(0.0f);
+			}
+
+			// 버튼 3개 위치 세팅 (점수판 아래로 나란히)
+			btnRetry.SetPosition(camPos.x, camPos.y - 0.25f); btnRetry.SetCameraPos(camPos.x, camPos.y);
+			btnResultMain.SetPosition(camPos.x, camPos.y - 0.5f); btnResultMain.SetCameraPos(camPos.x, camPos.y);
+			btnResultExit.SetPosition(camPos.x, camPos.y - 0.75f); btnResultExit.SetCameraPos(camPos.x, camPos.y);
+
+			// 클릭 판정
+			if (btnRetry.UpdateButton(worldMouseX, worldMouseY, isMouseDown))
+			{
+				ResetGame();
+				currentState = GameState::WEAPON_SELECT; // 바로 무기 고르고 재시작
+				platform.timer->Sleep(200);
+			}
+			if (btnResultMain.UpdateButton(worldMouseX, worldMouseY, isMouseDown))
+			{
+				ResetGame();
+				currentState = GameState::TITLE; // 타이틀로
+				platform.timer->Sleep(200);
+			}
+			if (btnResultExit.UpdateButton(worldMouseX, worldMouseY, isMouseDown))
+			{
+				quitRequested = true; // 종료
+			}
+
+			btnRetry.Update(0.0f); btnResultMain.Update(0.0f); btnResultExit.Update(0.0f);
+			}
+	}
+
+	// 명령 스트림 하나를 기록 (스트림마다 워커 스레드에서 동시에 불리므로 게임 객체는 읽기만 함, End는 부른 쪽에서)
+	void RecordStream(int streamId, RenderCommandStream& stream)
+	{
+		stream.Begin();
+
+		if (currentState == GameState::TITLE)
+		{
+			// 타이틀 씬일 때는 오직 타이틀 전용 객체들만 렌더링
+			if (streamId != RENDER_STREAM_UI) return;
+			titleBg.Render(stream, LAYER_TITLE_BG);
+			titleText.Render(stream, LAYER_TITLE_LOGO);
+			btnStart.Render(stream, LAYER_TITLE_BUTTONS);
+			btnSetting.Render(stream, LAYER_TITLE_BUTTONS);
+			btnExit.Render(stream, LAYER_TITLE_BUTTONS);
+			return;
+		}
+
+		// 타이틀 화면이 아닐 때만 (무기 선택, 플레이, 일시정지 등) 인게임 세계를 렌더링
+		switch (streamId)
+		{
+		case RENDER_STREAM_WORLD:
+			// 배경 맵 (가장 밑바닥)
+			background.Render(stream, LAYER_BACKGROUND);
+
+			// 경험치 젬 (겹칠 때 앞뒤가 프레임마다 바뀌지 않게 살아있는 목록 순서 대신 칸 번호 순서로 그림)
+			for (int slot = 0; slot < world.gems.GetCapacity(); slot++)
+			{
+				if (world.gems.IsLiveSlot(slot)) gems[slot].Render(stream, LAYER_GEMS);
+			}
+
+			// 전기 오라 이펙트 (플레이 상태이고 오라가 활성화된 경우만)
+			if (currentState == GameState::PLAY && world.selectedWeapon == 2 && world.isAuraActive)
+			{
+				auraEffect.Render(stream, LAYER_AURA);
+			}
+			break;
+
+		case RENDER_STREAM_ENEMIES:
+			// 살아있는 적군들
+			for (int i = 0; i < ENEMY_COUNT; i++)
+			{
+				if (world.enemies.alive[i])
+				{
+					enemies[i].Render(stream, LAYER_ENEMIES);
+				}
+			}
+			break;
+
+		case RENDER_STREAM_COMBAT:
+			// 플레이어
+			player.Render(stream, LAYER_PLAYER);
+
+			// 날아다니는 미사일
+			for (int n = 0; n < world.bullets.GetLiveCount(); n++)
+			{
+				bullets[world.bullets.LiveSlot(n)].Render(stream, LAYER_BULLETS);
+			}
+
+			// 타격 이펙트
+			for (int n = 0; n < world.meleeEffects.GetLiveCount(); n++)
+			{
+				meleeEffects[world.meleeEffects.LiveSlot(n)].Render(stream, LAYER_MELEE_EFFECTS);
+			}
+			for (int n = 0; n < world.hitEffects.GetLiveCount(); n++)
+			{
+				hitEffects[world.hitEffects.LiveSlot(n)].Render(stream, LAYER_HIT_EFFECTS);
+			}
+			break;
+
+		case RENDER_STREAM_UI:
+			// 공통 인게임 UI (체력바, 경험치바, 레벨, 타이머)
+			hpBarBg.Render(stream, LAYER_HP_BAR_BG);
+			hpBarFill.Render(stream, LAYER_HP_BAR_FILL);
+
+			for (int n = 0; n < world.damageTexts.GetLiveCount(); n++)
+			{
+				dmgTexts[world.damageTexts.LiveSlot(n)].Render(stream, LAYER_DAMAGE_TEXTS);
+			}
+
+			expBarBg.Render(stream, LAYER_EXP_BAR_BG);
+			expBarFill.Render(stream, LAYER_EXP_BAR_FILL);
+
+			levelBg.Render(stream, LAYER_LEVEL_BG);
+
+			for (int i = 0; i < 2; i++)
+			{
+				levelTexts[i].Render(stream, LAYER_LEVEL_TEXTS);
+			}
+			for (int i = 0; i < 4; i++) 
+			{
+				timerTexts[i].Render(stream, LAYER_TIMER_TEXTS);
+			}
+			for (int i = 0; i < 2; i++) 
+			{
+				timerColonBg[i].Render(stream, LAYER_TIMER_COLON_BG);
+				timerColon[i].Render(stream, LAYER_TIMER_COLON);
+			}
+
+			// 상태별 오버레이 (무기 선택 카드 또는 일시정지 팝업)
+			if (currentState == GameState::WEAPON_SELECT)
+			{
+				for (int i = 0; i < 3; i++) 
+				{
+					weaponCards[i].Render(stream, LAYER_OVERLAY_PANEL);
+					weaponIcons[i].Render(stream, LAYER_OVERLAY_CONTENT);
+				}
+			}  
+			else if (currentState == GameState::PAUSE)
+			{
+				pauseBg.Render(stream, LAYER_OVERLAY_BG);
+				btnPauseMain.Render(stream, LAYER_OVERLAY_BUTTONS);
+				btnPauseSetting.Render(stream, LAYER_OVERLAY_BUTTONS);
+				btnPauseExit.Render(stream, LAYER_OVERLAY_BUTTONS);
+			}
+			else if (currentState == GameState::LEVEL_UP)
+			{
+				levelUpBg.Render(stream, LAYER_OVERLAY_BG);
+				for (int i = 0; i < 3; i++)
+				{
+					upgradeCards[i].Render(stream, LAYER_OVERLAY_BUTTONS);
+				}
+			}
+			else if (currentState == GameState::GAME_OVER || currentState == GameState::CLEAR)
+			{
+				if (currentState == GameState::GAME_OVER) gameOverUI.Render(stream, LAYER_OVERLAY_BG);
+				else clearUI.Render(stream, LAYER_OVERLAY_BG);
+
+				// 점수와 숫자 출력
+				scoreBg.Render(stream, LAYER_OVERLAY_PANEL);
+				for (int i = 0; i < 6; i++)
+				{
+					scoreTexts[i].Render(stream, LAYER_OVERLAY_CONTENT);
+				}
+
+				// 버튼들 출력
+				btnRetry.Render(stream, LAYER_OVERLAY_BUTTONS);
+				btnResultMain.Render(stream, LAYER_OVERLAY_BUTTONS);
+				btnResultExit.Render(stream, LAYER_OVERLAY_BUTTONS);
+			}
+			break;
+		}
+	}
+
+	// 지금 게임 객체들로 렌더 스냅샷을 채움 (시뮬레이션 스레드, Update 바로 뒤)
+	void BuildSnapshot(RenderSnapshot& out)
+	{
+		// 레이어 묶음 (배경, 적, 이펙트, UI)마다 따로 스트림을 기록한 뒤 레이어 순서로 합침
+		jobs.ParallelFor(0, RENDER_STREAM_COUNT, 1, [&](int begin, int end)
+			{
+				for (int s = begin; s < end; s++)
+				{
+					RecordStream(s, out.streams[s]);
+					out.streams[s].End();
+				}
+			});
+		out.merged.Merge(out.streams, RENDER_STREAM_COUNT);
+
+		out.gameState = (int)currentState;
+		out.simTick = simClock.GetTickCount();
+		out.sequence = ++snapshotSequence;
+	}
+
+	// 지금 게임 객체들로 스냅샷 하나를 만들어서 우편함에 넣음
+	void PublishSnapshot()
+	{
+		BuildSnapshot(snapshots.BeginWrite());
+		snapshots.Publish();
+	}
+
+	// 업데이트 한 번 + 스냅샷 하나 (헤드리스처럼 한 스레드에서 돌릴 때는 이것과 AcquireSnapshot을 번갈아 부름)
+	void SimulateFrame()
+	{
+		Update();
+		PublishSnapshot();
+	}
+
+	// 시뮬레이션 스레드 시작 (첫 스냅샷은 여기서 만들어서 Render가 처음부터 그릴 것이 있게 함)
+	void StartSimulation()
+	{
+		SimulateFrame();
+		stopSimulation = false;
+		simThread = std::thread([this]()
+			{
+				const auto minInterval = std::chrono::microseconds(1000000 / MAX_SNAPSHOTS_PER_SECOND);
+				while (!stopSimulation.load(std::memory_order_relaxed))
+				{
+					auto next = std::chrono::steady_clock::now() + minInterval;
+					SimulateFrame();
+					std::this_thread::sleep_until(next);
+				}
+			});
+	}
+
+	void StopSimulation()
+	{
+		stopSimulation = true;
+		if (simThread.joinable()) simThread.join();
+	}
+
+	bool IsQuitRequested() const { return quitRequested.load(std::memory_order_relaxed); }
+
+	// 시뮬레이션이 가장 최근에 다 만든 스냅샷 (렌더 스레드, 새 것이 없으면 지난 것)
+	const RenderSnapshot& AcquireSnapshot()
+	{
+		snapshots.Acquire();
+		return snapshots.Read();
+	}
+};
@@ -4,14 +4,16 @@
 #include <d3dcompiler.h>               // 셰이더 컴파일용 헤더
 #include <wrl.h>                      // Comptr (스마트 포인터) 사용을 위함
 #include "../Utils/d3dx12.h"         // 헬퍼 헤더
-#include <DirectXMath.h>
-#include "../Utils/Utils.h"
-#include "../Objects/GameObject.h"
+#include "Game.h"
+#include "../Platform/Win32Platform.h"
+#include "../Utils/SoundManager.h"
+#include "../Render/FrameContext.h"
+#include "../Render/SpriteRenderer.h"
+#include "../Render/GpuTextureCache.h"
 #define STB_IMAGE_IMPLEMENTATION
 #include "../Utils/stb_image.h"
 
 using namespace Microsoft::WRL;
-using namespace DirectX;
 
 // Vertex 구조체
 // 점 하나가 가지는 정보 : 위치 (x, y, z)와 색상 (r, g, b, a)
@@ -21,98 +23,10 @@ struct Vertex
     float uv[2];
 };
 
-class D3D12Manager
+// DX12 렌더러 (게임은 IRenderer로만 부르므로 D3D12 / DXGI 호출은 전부 여기에 있음)
+class D3D12Renderer : public IRenderer
 {
 public:
-    // 게임 상태 (Game State) 열거형
-    enum class GameState
-    {
-        TITLE,          // 메인 타이틀 씬
-        WEAPON_SELECT,  // 처음 시작 시 무기 고르는 상태
-        PLAY,           // 정상 플레이 중
-        LEVEL_UP,       // 레벨업 선택 창 상태
-        PAUSE,          // ESC 일시 정지, 설정 창
-        GAME_OVER,      // HP 0 (사망)
-        CLEAR,          // 생존 성공
-    };
-
-    // 게임 매니저용 변수들
-    // 처음 켜지면 무조건 타이틀 씬 부터
-    GameState currentState = GameState::TITLE;
-
-    // 메인 씬 (TITLE) 전용 객체들
-    GameObject titleBg;         // 타이틀 배경
-    GameObject titleText;       // 게임 로고 타이틀
-    Button btnStart;            // 게임 시작 버튼
-    Button btnSetting;          // 설정 버튼 (임시 비활성화)
-    Button btnExit;             // 종료 버튼
-
-    // 일시정지 씬 (PAUSE) 전용 객체들
-    GameObject pauseBg;         // 반투명한 검은색 배경 용도
-    Button btnPauseMain;        // 메인으로 돌아가기 버튼
-    Button btnPauseSetting;     // 설정 버튼
-    Button btnPauseExit;        // 종료 버튼
-
-    // 결과 창 (GAME_OVER / CLEAR) 전용 객체들
-    Button btnRetry;        // 다시 시작 (무기 선택 창으로)
-    Button btnResultMain;   // 메인 타이틀로
-    Button btnResultExit;   // 게임 종료
-
-    GameObject scoreBg;         // score_bg.png
-    GameObject scoreTexts[6];   // 점수 폰트 (최대 6 자리)
-
-    int totalKills = 0;         // 몬스터 누적 처치 수
-
-    // 레벨업 시스템 관련 객체
-    GameObject levelUpBg;
-    Button upgradeCards[3];     // 화면에 띄울 3개의 선택지 카드
-    int cardUpIds[3];           // 각 카드에 어떤 업그레이드인지 저장 (0:HP, 1:SPD, 2:DMG, 3:CDR, 4:AURA)
-
-    // 중복 로딩 방지를 위한 마스터 카드 스킨들 (플라이웨이트 패턴)
-    GameObject cardSkins[5];
-
-    // 씬 전환 시 게임 데이터를 싹 초기화해주는 함수
-    void ResetGame()
-    {
-        player.hp = player.maxHp;
-        player.exp = 0.0f;
-        player.level = 1;
-        player.SetPosition(0.0f, 0.0f);
-        gameTimer = 0.0f;
-        selectedWeapon = -1;
-        totalKills = 0; // 킬 수 리셋
-
-        for (int i = 0; i < ENEMY_COUNT; i++) enemies[i].isDead = true;
-        for (int i = 0; i < MAX_BULLETS; i++) bullets[i].isDead = true;
-        for (int i = 0; i < MAX_GEMS; i++) gems[i].isDead = true;
-        for (int i = 0; i < 4; i++) isBossSpawned[i] = false;
-    }
-
-    // 무기 시스템 변수들
-    int selectedWeapon = -1;        // 0 : 근접, 1 : 유도 총, 2 : 오라 (주변)
-    float attackTimer = 0.0f;
-    float attackCooldown = 1.0f;    // 기본 1초마다 공격
-
-    // 오라 전용 변수
-    bool isAuraActive = false;
-    float auraRadius = 0.5f;
-
-    // 무기 선택 UI용 객체
-    Button weaponCards[3];
-    GameObject weaponIcons[3];
-
-    // 이펙트 & 오라 객체 풀링
-    static const int MAX_EFFECTS = 30;
-    Effect meleeEffects[MAX_EFFECTS];
-    Effect hitEffects[MAX_EFFECTS];
-    GameObject auraEffect;  // 오라는 플레이어 몸에 1개만 붙어있으므로 단일 객체
-
-    float gameTimer = 0.0f;                        // 현재 흘러간 시간
-    bool isEscPressed = false;                     // ESC 키 꾹 누름 (중복) 방지용 플래그
-
-    GameObject gameOverUI;
-    GameObject clearUI;
-
     // ComPtr은 DX12 객체들의 메모리 누수를 막아주는 자동 관리 포인터
     ComPtr<IDXGIFactory4>       dxgiFactory;
     ComPtr<ID3D12Device>        d3dDevice;
@@ -121,7 +35,8 @@ public:
     // 더블 버퍼링
     static const int frameCount = 2;
 
-    ComPtr<ID3D12CommandAllocator>      commandAllocator;
+    // 프레임 칸 링 (칸마다 명령 할당자 + 펜스 번호, CPU가 GPU를 한 바퀴 따라잡았을 때만 기다림)
+    FrameContextRing                    frameContexts;
     ComPtr<ID3D12GraphicsCommandList>   commandList;
     ComPtr<IDXGISwapChain3>             swapChain;
     ComPtr<ID3D12DescriptorHeap>        rtvHeap;
@@ -132,11 +47,6 @@ public:
     // 현재 몇 번째 버퍼를 쓰고 있는지
     UINT frameIndex = 0;
 
-    // Fence 관련 변수
-    ComPtr<ID3D12Fence> fence;
-    UINT64              fenceValue = 0;
-    HANDLE              fenceEvent = nullptr;
-
     // Vertex Buffer 관련 변수
     ComPtr<ID3D12Resource>      vertexBuffer;
     D3D12_VERTEX_BUFFER_VIEW    vertexBufferView;
@@ -145,67 +55,17 @@ public:
     ComPtr<ID3D12RootSignature> rootSignature;
     ComPtr <ID3D12PipelineState> pipelineState;
 
-    // 상수 버퍼와 위치 / 입력 변수
-    ComPtr<ID3D12Resource> constantBuffer;
-    UINT8* cbvDataBegin = nullptr;         // CPU가 쓸 데이터 주소
-
-    float playerX = 0.0f; // 플레이어의 X 위치
-    float playerY = 0.0f; // 플레이어의 Y 위치
-    float speed = 2.0f;   // 이동 속도
-
-    TimeManager timeMgr;
-    InputManager inputMgr;
-
-    // 플레이어 객체
-    Player player;
-
-    // Enemy 객체
-    static const int ENEMY_COUNT = 60;
-    Enemy enemies[ENEMY_COUNT];
-    float spawnTimer = 0.0f;
-    bool isBossSpawned[4] = { false, false, false, false }; // 5, 10, 15, 20분 보스 등장 여부
-
-    // 중복 로딩 방지용 마스터 스킨들
-    GameObject enemySkins[6];
-    GameObject bossSkins[4];
+    // 프레임마다 쓰고 버리는 업로드 데이터 (인스턴스 스트림 등)를 잘라 쓰는 버퍼 하나
+    UploadHeap uploadHeap;
+    static const UINT64 UPLOAD_HEAP_SIZE = 8 * 1024 * 1024;
 
-    // 배경 맵 객체 (순수 GameObject 사용)
-    GameObject background;
+    GlobalDescriptorHeap descriptors;   // 로드한 텍스처마다 힙 칸 번호 발급 (셰이더도 이 번호로 텍스처를 읽음)
+    GpuTextureCache textureCache;       // 경로마다 텍스처 하나 (객체들은 핸들만 나눠 가짐)
+    SpriteRenderer spriteRenderer;
 
-    // 미사일 배열 및 발사 타이머
-    static const int MAX_BULLETS = 50;
-    Bullet bullets[MAX_BULLETS];
-    float shootTimer = 0.0f;
-    float shootInterval = 0.5f; // 0.5초마다 1발씩 자동 발사
-
-    // 플레이어 HP바 (배경 1개, 게이지 1개)
-    GameObject hpBarBg;
-    GameObject hpBarFill;
-
-    // 젬, 데미지 텍스트, EXP 바
-    static const int MAX_GEMS = 200;
-    Gem gems[MAX_GEMS];
-
-    static const int MAX_DMG_TEXTS = 50;
-    DamageText dmgTexts[MAX_DMG_TEXTS];
-
-    GameObject expBarBg;
-    GameObject expBarFill;
-
-    // 레벨 UI 배경과 레벨 텍스트 선언
-    GameObject levelBg;
-    GameObject levelTexts[2]; // 10의 자리, 1의 자리
-
-    // 타이머 폰트 배열 (MM:SS 4자리)
-    GameObject timerTexts[4];
-    
-    // 콜론의 검은색 배경 역할을 할 점 2개 선언
-    GameObject timerColonBg[2];
-    // 콜론 (:) 역할을 할 점 2개 선언
-    GameObject timerColon[2];
-
-    // DX12 초기화를 진행하는 함수
-    void Initialize(HWND hWnd, int width, int height)
+    // DX12 초기화를 진행하는 함수 (텍스처는 이후 게임 객체들이 AcquireTexture로 모으고 FinishTextureLoads 때 한 번에 올림)
+    // pack : 열려있는 에셋 팩 (없으면 nullptr, 렌더러보다 오래 살아있어야 함)
+    void Initialize(HWND hWnd, int width, int height, const AssetPack* pack)
     {
         // 디버그 레이어 활성화
 #if defined(_DEBUG)
@@ -234,13 +94,12 @@ public:
 
         d3dDevice->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&commandQueue));
 
-        // 커맨드 할당자 (Command Allocator) 생성
-        // 명령서를 작성하기 위한 실제 메모리 공간을 할당
-        d3dDevice->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&commandAllocator));
+        // 프레임 칸 (칸마다 커맨드 할당자) 과 Fence (동기화 객체) 생성
+        frameContexts.Initialize(d3dDevice.Get(), commandQueue.Get());
 
         // 커맨드 리스트 (Command List) 생성
-        // 할당받은 메모리 공간에 명령을 적는 펜 역할
-        d3dDevice->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, commandAllocator.Get(), nullptr, IID_PPV_ARGS(&commandList));
+        // 할당받은 메모리 공간에 명령을 적는 펜 역할 (시작할 때 텍스처 업로드는 첫 칸의 할당자에 적음)
+        d3dDevice->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, frameContexts.GetInitialAllocator(), nullptr, IID_PPV_ARGS(&commandList));
 
         // 스왑 체인 (Swap Chain) 생성
         // 화면 깜빡임을 막기 위해 버퍼를 여러 장 교체하는 시스템
@@ -291,28 +150,18 @@ public:
             rtvHandle.ptr += rtvDescriptorSize;
         }
 
-        // Fence (동기화 객체) 생성
-        d3dDevice->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence));
-        fenceValue = 1;
-
-        // Event 운영체제로 부터 발급 받기
-        fenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
-        if (fenceEvent == nullptr)
-        {
-            // 에러 처리
-        }
-
         // 파이프라인(PSO) 구축 단계
         // Root Signature 생성 (매개변수가 몇 개 들어가는지 알려줌)
         CD3DX12_DESCRIPTOR_RANGE ranges[1];
-        ranges[0].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 0); // 텍스처 1개 (t0)
+        // 전역 서술자 힙 전체가 텍스처 배열 (t0 ~), 셰이더가 인스턴스의 텍스처 번호로 골라 읽음
+        ranges[0].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, GlobalDescriptorHeap::DEFAULT_CAPACITY, 0);
 
-        CD3DX12_ROOT_PARAMETER rootParameters[2];
-        rootParameters[0].InitAsConstantBufferView(0); // 위치 정보 (b0)
-        rootParameters[1].InitAsDescriptorTable(1, &ranges[0], D3D12_SHADER_VISIBILITY_PIXEL); // 텍스처 정보 (t0)
+        // 위치 / UV / 색상은 인스턴스 스트림으로 들어오므로 루트 파라미터는 텍스처 하나뿐
+        CD3DX12_ROOT_PARAMETER rootParameters[1];
+        rootParameters[0].InitAsDescriptorTable(1, &ranges[0], D3D12_SHADER_VISIBILITY_PIXEL); // 텍스처 배열 (t0 ~)
 
         D3D12_STATIC_SAMPLER_DESC sampler = {}; // 스포이트 설정
-        sampler.Filter = D3D12_FILTER_MIN_MAG_MIP_POINT; // 도트 픽셀 유지
+        sampler.Filter = D3D12_FILTER_MIN_MAG_MIP_POINT; // 도트 픽셀 유지 (밉이 있는 텍스처는 화면 크기에 가장 가까운 단계 하나를 고름)
         // WRAP (무한 반복) -> 무한 맵
         sampler.AddressU = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
         sampler.AddressV = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
@@ -345,10 +194,10 @@ public:
 #endif
         ComPtr<ID3DBlob> vertexShader;
         ComPtr<ID3DBlob> pixelShader;
-        // shaders.hlsl 파일에서 VSMain 함수를 '정점 셰이더(vs_5_0)' 버전으로 컴파일
-        D3DCompileFromFile(L"Assets/Shaders/shaders.hlsl", nullptr, nullptr, "VSMain", "vs_5_0", compileFlags, 0, &vertexShader, nullptr);
-        // shaders.hlsl 파일에서 PSMain 함수를 '픽셀 셰이더(ps_5_0)' 버전으로 컴파일
-        D3DCompileFromFile(L"Assets/Shaders/shaders.hlsl", nullptr, nullptr, "PSMain", "ps_5_0", compileFlags, 0, &pixelShader, nullptr);
+        // shaders.hlsl 파일에서 VSMain 함수를 '정점 셰이더(vs_5_1)' 버전으로 컴파일 (텍스처 배열을 번호로 읽으려면 5.1 이상)
+        D3DCompileFromFile(L"Assets/Shaders/shaders.hlsl", nullptr, nullptr, "VSMain", "vs_5_1", compileFlags, 0, &vertexShader, nullptr);
+        // shaders.hlsl 파일에서 PSMain 함수를 '픽셀 셰이더(ps_5_1)' 버전으로 컴파일
+        D3DCompileFromFile(L"Assets/Shaders/shaders.hlsl", nullptr, nullptr, "PSMain", "ps_5_1", compileFlags, 0, &pixelShader, nullptr);
 
         // Input Layout 정의
         // Vertex 구조체 (C++ 데이터)가 셰이더의 파라미터 (POSITION, COLOR)와 어떻게 매칭되는지 설명해주는 표
@@ -356,7 +205,15 @@ public:
         {
             { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
             // 좌표 데이터 x,y,z 가 12바이트를 차지함
-            { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
+            { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+
+            // 입력 슬롯 1 : 스프라이트마다 한 번씩 넘어가는 인스턴스 데이터 (SpriteInstance)
+            { "CENTER", 0, DXGI_FORMAT_R32G32_FLOAT, 1, offsetof(SpriteInstance, center), D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
+            { "HALFSIZE", 0, DXGI_FORMAT_R32G32_FLOAT, 1, offsetof(SpriteInstance, halfSize), D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
+            { "UVRECT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, offsetof(SpriteInstance, uvRect), D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
+            // RGBA8을 셰이더가 0 ~ 1 float4로 받음
+            { "TINT", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 1, offsetof(SpriteInstance, tint), D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
+            { "TYPEFLAGS", 0, DXGI_FORMAT_R32_UINT, 1, offsetof(SpriteInstance, typeFlags), D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
         };
 
         // 파이프라인 상태 객체 (PSO) 생성
@@ -381,347 +238,32 @@ public:
         // Vertex Buffer 생성 함수
         CreateVertexBuffer();
 
-        // 맵 초기화 및 텍스처 로드
-        background.Initialize(d3dDevice.Get());
-        // 맵 이미지 파일 경로를 넣어주고 프레임은 무조건 1
-        background.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/map_bg.png", 1);
-
-        background.SetScale(10.0f, 10.0f);   // 도화지를 화면보다 훨씬 크게 키움
-        background.SetUVScale(1.0f, 1.0f);
-        background.SetPosition(0.0f, 0.0f);  // 맵 항상 세상의 정중앙에 고정
-        background.SetObjectType(0);
-
-        // HP 바 초기화 (배경 이미지를 불러오되 셰이더에서 사각형으로 덮어씀)
-        hpBarBg.Initialize(d3dDevice.Get());
-        hpBarBg.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/map_bg.png", 1);
-        hpBarBg.SetTintColor(0.2f, 0.2f, 0.2f); // 짙은 회색 배경
-        hpBarBg.SetObjectType(2);               // 사각형 사용
-
-        hpBarFill.Initialize(d3dDevice.Get());
-        hpBarFill.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/map_bg.png", 1);
-        hpBarFill.SetTintColor(0.0f, 1.0f, 0.0f); // 초록색 체력
-        hpBarFill.SetObjectType(2);                 // 사각형 사용
-
-
-        // 미사일 초기화 (플레이어 이미지를 노란색으로 칠해서 구슬처럼 쏨)
-        for (int i = 0; i < MAX_BULLETS; i++)
-        {
-            bullets[i].Initialize(d3dDevice.Get());
-            bullets[i].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/player_sheet.png", 1);
-            bullets[i].SetScale(0.05f, 0.05f);
-            bullets[i].SetTintColor(1.0f, 1.0f, 0.0f); // 노란색
-            bullets[i].SetObjectType(1); // 완벽한 동그라미 사용
-            bullets[i].isDead = true; // 처음엔 다 숨겨둠
-        }
-        
-        // 플레이어 객체에서 자신의 메모리를 알아서 세팅하도록 명령
-        // 플레이어 객체 세팅 & 텍스처 로드 (commandList 전달!)
-        player.Initialize(d3dDevice.Get());
-        // png 파일 이름과 애니메이션 프레임 수 전달
-        player.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/player_sheet.png", 30);
-        player.SetScale(0.45f, 0.45f);
-
-        // 마스터 텍스처 딱 1번씩만 메모리에 올리기
-        enemySkins[0].Initialize(d3dDevice.Get()); enemySkins[0].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/Enemy1.png", 20);
-        enemySkins[1].Initialize(d3dDevice.Get()); enemySkins[1].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/Enemy2.png", 20);
-        enemySkins[2].Initialize(d3dDevice.Get()); enemySkins[2].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/Enemy3.png", 20);
-        enemySkins[3].Initialize(d3dDevice.Get()); enemySkins[3].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/Enemy4.png", 30);
-        enemySkins[4].Initialize(d3dDevice.Get()); enemySkins[4].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/Enemy5.png", 30);
-        enemySkins[5].Initialize(d3dDevice.Get()); enemySkins[5].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/Enemy6.png", 20);
-
-        bossSkins[0].Initialize(d3dDevice.Get()); bossSkins[0].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/Boss1.png", 20);
-        bossSkins[1].Initialize(d3dDevice.Get()); bossSkins[1].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/Boss2.png", 20);
-        bossSkins[2].Initialize(d3dDevice.Get()); bossSkins[2].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/Boss3.png", 30);
-        bossSkins[3].Initialize(d3dDevice.Get()); bossSkins[3].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/Boss4.png", 20);
-
-        // 몬스터 초기화 및 스폰 위치 설정, 100마리의 몬스터는 로드된 마스터 스킨을 공유만 받음
-        for (int i = 0; i < ENEMY_COUNT; i++)
-        {
-            // 각 몬스터가 자기 위치를 기억할 빈 공간(상수 버퍼)은 각자 만들어야 함
-            enemies[i].Initialize(d3dDevice.Get());
-
-            // 일반 몬스터 구역 (0 ~ 55번) - 10마리씩 할당
-            if (i < 10) { enemies[i].ShareTextureFrom(enemySkins[0]); enemies[i].enemyType = 0; }
-            else if (i < 20) { enemies[i].ShareTextureFrom(enemySkins[1]); enemies[i].enemyType = 0; }
-            else if (i < 30) { enemies[i].ShareTextureFrom(enemySkins[2]); enemies[i].enemyType = 1; }
-            else if (i < 40) { enemies[i].ShareTextureFrom(enemySkins[3]); enemies[i].enemyType = 1; }
-            else if (i < 50) { enemies[i].ShareTextureFrom(enemySkins[4]); enemies[i].enemyType = 2; }
-            else if (i < 56) { enemies[i].ShareTextureFrom(enemySkins[5]); enemies[i].enemyType = 2; }
-
-            // 보스 구역 (56 ~ 59번)
-            else if (i == 56) { enemies[i].ShareTextureFrom(bossSkins[0]); enemies[i].enemyType = 3; }
-            else if (i == 57) { enemies[i].ShareTextureFrom(bossSkins[1]); enemies[i].enemyType = 4; }
-            else if (i == 58) { enemies[i].ShareTextureFrom(bossSkins[2]); enemies[i].enemyType = 5; }
-            else if (i == 59) { enemies[i].ShareTextureFrom(bossSkins[3]); enemies[i].enemyType = 6; }
-
-            enemies[i].isDead = true; // 태어날 땐 무조건 죽은 상태로 창고 대기
-        }
-
-        // 경험치 바 (EXP Bar) 초기화
-        expBarBg.Initialize(d3dDevice.Get());
-        expBarBg.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/map_bg.png", 1);
-        expBarBg.SetTintColor(0.0f, 0.0f, 0.2f); // 짙은 파란색 (배경)
-        expBarBg.SetObjectType(2); // 사각형 사용
-
-        expBarFill.Initialize(d3dDevice.Get());
-        expBarFill.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/map_bg.png", 1);
-        expBarFill.SetTintColor(0.0f, 0.5f, 1.0f); // 밝은 파란색 (채워지는 바)
-        expBarFill.SetObjectType(2); // 사각형 사용
-
-        // 레벨 배경 UI 초기화
-        levelBg.Initialize(d3dDevice.Get());
-        // 이미지 이름은 실제 저장하신 파일명과 완벽히 똑같이 맞춰주세요!
-        levelBg.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/level_bg.png", 1);
-        levelBg.SetScale(0.1f, 0.15f);
-        levelBg.SetObjectType(0);
-
-        // 레벨 숫자 텍스트 (데미지 폰트 재활용)
-        for (int i = 0; i < 2; i++)
-        {
-            levelTexts[i].Initialize(d3dDevice.Get());
-            levelTexts[i].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/damage_font.png", 10);
-            levelTexts[i].SetScale(0.03f, 0.045f);
-            levelTexts[i].SetTintColor(1.0f, 1.0f, 1.0f);
-            levelTexts[i].SetObjectType(0);
-            levelTexts[i].SetFrameDuration(9999.0f); // 애니메이션 멈춤
-        }
-
-        // 경험치 젬 초기화
-        for (int i = 0; i < MAX_GEMS; i++)
-        {
-            gems[i].Initialize(d3dDevice.Get());
-
-            // "gem.png" 같은 진짜 보석 이미지 파일 경로로 변경
-            gems[i].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/gem.png", 1);
-            gems[i].SetScale(0.04f, 0.06f);
-
-            // 텍스처 원본 색상을 그대로 보여주기 위해 틴트 컬러를 흰색(1,1,1)으로 초기화
-            gems[i].SetTintColor(1.0f, 1.0f, 1.0f);
-
-            // 진짜 텍스처를 그리는 모드(0)로 변경
-            gems[i].SetObjectType(0);
-
-            gems[i].isDead = true;
-        }
-
-        // 데미지 텍스트 초기화
-        for (int i = 0; i < MAX_DMG_TEXTS; i++)
-        {
-            dmgTexts[i].Initialize(d3dDevice.Get());
-            // 숫자 0~9 가 일렬로 나열된 스프라이트 시트
-            // 숫자가 10개이므로 프레임 수를 '10'으로 설정하여 이미지를 10등분
-            dmgTexts[i].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/damage_font.png", 10);
-            dmgTexts[i].SetScale(0.04f, 0.06f);
-            dmgTexts[i].SetTintColor(1.0f, 1.0f, 1.0f);
-            dmgTexts[i].SetObjectType(0);
-            // 애니메이션 영원히 정지
-            dmgTexts[i].SetFrameDuration(9999.0f);
-
-            dmgTexts[i].isDead = true;
-        }
-
-        // Game Over 및 Clear UI 초기화
-        gameOverUI.Initialize(d3dDevice.Get());
-        gameOverUI.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/GameOver.png", 50);
-        gameOverUI.SetScale(0.8f, 1.2f);
-        gameOverUI.SetObjectType(0);
-
-        clearUI.Initialize(d3dDevice.Get());
-        clearUI.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/Clear.png", 80);
-        clearUI.SetScale(0.8f, 1.2f);
-        clearUI.SetObjectType(0);
-
-        // 타이머 텍스트 초기화
-        for (int i = 0; i < 4; i++)
-        {
-            timerTexts[i].Initialize(d3dDevice.Get());
-            // 0~9가 10칸으로 나열된 Timer_font.png 사용
-            timerTexts[i].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/Timer_font.png", 10);
-            timerTexts[i].SetScale(0.04f, 0.06f); // 데미지 폰트보다 살짝 작거나 비슷하게
-            timerTexts[i].SetTintColor(1.0f, 1.0f, 1.0f); // 하얀색
-            timerTexts[i].SetObjectType(0);
-            timerTexts[i].SetFrameDuration(9999.0f); // 애니메이션 멈춤
-        }
-
-        // 콜론(:) 초기화
-        for (int i = 0; i < 2; i++)
-        {
-            // 검은색 배경 점 (테두리 역할)
-            timerColonBg[i].Initialize(d3dDevice.Get());
-            timerColonBg[i].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/map_bg.png", 1);
-            timerColonBg[i].SetScale(0.015f, 0.02f); // 흰색 점보다 약간 크게
-            timerColonBg[i].SetTintColor(0.0f, 0.0f, 0.0f); // 완벽한 검은색
-            timerColonBg[i].SetObjectType(1); // 동그라미 셰이더 재활용
-
-            // 흰색 점
-            timerColon[i].Initialize(d3dDevice.Get());
-            timerColon[i].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/map_bg.png", 1);
-            timerColon[i].SetScale(0.01f, 0.015f); // 원래 크기
-            timerColon[i].SetTintColor(1.0f, 1.0f, 1.0f); // 하얀색
-            timerColon[i].SetObjectType(1);
-        }
-
-        // 무기 선택 카드 UI 초기화
-        weaponCards[0].Initialize(d3dDevice.Get());
-        weaponCards[0].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/weapon_card_1.png", 1);
-        weaponCards[0].InitScale(0.6f, 0.95f);
-        weaponCards[0].SetObjectType(0);
-
-        weaponCards[1].Initialize(d3dDevice.Get());
-        weaponCards[1].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/weapon_card_2.png", 1);
-        weaponCards[1].InitScale(0.6f, 0.95f);
-        weaponCards[1].SetObjectType(0);
-
-        weaponCards[2].Initialize(d3dDevice.Get());
-        weaponCards[2].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/weapon_card_3.png", 1);
-        weaponCards[2].InitScale(0.6f, 0.95f);
-        weaponCards[2].SetObjectType(0);
-
-        // 카드 위에 올라갈 무기 아이콘 초기화
-        for (int i = 0; i < 3; i++)
-        {
-            weaponIcons[i].Initialize(d3dDevice.Get());
-            weaponIcons[i].SetScale(0.45f, 0.45f); // 카드보다 작게 크기 조절
-            weaponIcons[i].SetObjectType(0);
-        }
+        // 업로드 버퍼 (8MB = 스프라이트 약 7만 개 분량, 프레임이 끝나면 GPU 펜스를 보고 통째로 반납)
+        uploadHeap.Initialize(d3dDevice.Get(), UPLOAD_HEAP_SIZE);
 
-        // 각각 지정된 이름의 텍스처 로드
-        weaponIcons[0].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/MELEE.png", 1);
-        weaponIcons[1].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/BULLET.png", 1);
-        weaponIcons[2].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/AURA.png", 1);
-
-        // 이펙트 초기화
-        for (int i = 0; i < MAX_EFFECTS; i++)
-        {
-            meleeEffects[i].Initialize(d3dDevice.Get());
-            meleeEffects[i].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/weapon_melee.png", 30);
-            meleeEffects[i].SetScale(0.3f, 0.3f);
-            meleeEffects[i].SetObjectType(0);
-            meleeEffects[i].SetFrameDuration(0.016f); // 이펙트는 빠르게 재생
-            meleeEffects[i].isDead = true;
-
-            hitEffects[i].Initialize(d3dDevice.Get());
-            hitEffects[i].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/weapon_bullet_hit.png", 30);
-            hitEffects[i].SetScale(0.2f, 0.2f);
-            hitEffects[i].SetObjectType(0);
-            hitEffects[i].SetFrameDuration(0.016f);
-            hitEffects[i].isDead = true;
-        }
-
-        // 오라 이펙트
-        auraEffect.Initialize(d3dDevice.Get());
-        auraEffect.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/weapon_aura.png", 30);
-        auraEffect.SetScale(auraRadius * 2.0f, auraRadius * 2.0f); // 반지름의 2배 = 지름
-        auraEffect.SetObjectType(0);
-        auraEffect.SetFrameDuration(0.016f);
-
-        // 메인 씬 (TITLE) 초기화
-        titleBg.Initialize(d3dDevice.Get());
-        titleBg.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/map_bg.png", 1);
-        titleBg.SetScale(4.0f, 3.0f); // 화면 꽉 차게
-        titleBg.SetObjectType(0);
-
-        titleText.Initialize(d3dDevice.Get());
-        titleText.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/title_text.png", 1);
-        titleText.SetScale(1.0f, 1.0f);
-        titleText.SetObjectType(0);
-
-        btnStart.Initialize(d3dDevice.Get());
-        btnStart.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/btn_start.png", 1);
-        btnStart.InitScale(0.4f, 0.2f); // 버튼 기본 크기 세팅
-        btnStart.SetObjectType(0);
-
-        btnSetting.Initialize(d3dDevice.Get());
-        btnSetting.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/btn_setting.png", 1);
-        btnSetting.InitScale(0.4f, 0.2f);
-        btnSetting.SetObjectType(0);
-
-        btnExit.Initialize(d3dDevice.Get());
-        btnExit.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/btn_exit.png", 1);
-        btnExit.InitScale(0.4f, 0.2f);
-        btnExit.SetObjectType(0);
-
-        // 일시정지 (PAUSE) 설정 창 초기화
-        pauseBg.Initialize(d3dDevice.Get());
-        pauseBg.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/pause_bg.png", 1); // 반투명 팝업 창 느낌
-        pauseBg.SetScale(0.6f, 1.2f);
-        pauseBg.SetObjectType(0);
-
-        btnPauseMain.Initialize(d3dDevice.Get());
-        btnPauseMain.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/btn_main.png", 1);
-        btnPauseMain.InitScale(0.5f, 0.25f);
-        btnPauseMain.SetObjectType(0);
-
-        btnPauseSetting.Initialize(d3dDevice.Get());
-        btnPauseSetting.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/btn_setting.png", 1);
-        btnPauseSetting.InitScale(0.5f, 0.25f);
-        btnPauseSetting.SetObjectType(0);
-
-        btnPauseExit.Initialize(d3dDevice.Get());
-        btnPauseExit.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/btn_exit.png", 1);
-        btnPauseExit.InitScale(0.5f, 0.25f);
-        btnPauseExit.SetObjectType(0);
-
-        // 결과 창 (GAME_OVER & CLEAR) 초기화
-        btnRetry.Initialize(d3dDevice.Get());
-        btnRetry.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/btn_retry.png", 1);
-        btnRetry.InitScale(0.6f, 0.2f);
-        btnRetry.SetObjectType(0);
-
-        btnResultMain.Initialize(d3dDevice.Get());
-        btnResultMain.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/btn_main.png", 1);
-        btnResultMain.InitScale(0.6f, 0.2f);
-        btnResultMain.SetObjectType(0);
-
-        btnResultExit.Initialize(d3dDevice.Get());
-        btnResultExit.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/btn_exit.png", 1);
-        btnResultExit.InitScale(0.6f, 0.2f);
-        btnResultExit.SetObjectType(0);
-
-        scoreBg.Initialize(d3dDevice.Get());
-        scoreBg.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/score_bg.png", 1);
-        scoreBg.SetScale(0.6f, 0.2f); // 버튼 크기와 동일하게 세팅
-        scoreBg.SetObjectType(0);
-
-        // 점수를 표시할 6자리의 숫자 폰트 세팅 (타이머 폰트 재활용)
-        for (int i = 0; i < 6; i++)
-        {
-            scoreTexts[i].Initialize(d3dDevice.Get());
-            scoreTexts[i].LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/Timer_font.png", 10);
-            scoreTexts[i].SetScale(0.04f, 0.06f);
-            scoreTexts[i].SetTintColor(1.0f, 1.0f, 1.0f);
-            scoreTexts[i].SetObjectType(0);
-            scoreTexts[i].SetFrameDuration(9999.0f);
-        }
+        // 텍스처 서술자 힙 (모든 텍스처가 이 힙 하나에 칸을 받음, 텍스처 로드 전에 만들어야 함)
+        descriptors.Initialize(d3dDevice.Get());
+        textureCache.Initialize(d3dDevice.Get(), &descriptors, pack);
+    }
 
-        // 레벨업 UI 초기화
-        levelUpBg.Initialize(d3dDevice.Get());
-        levelUpBg.LoadTexture(d3dDevice.Get(), commandList.Get(), "Assets/Textures/level_up_bg.png", 1);
-        levelUpBg.SetScale(1.8f, 1.8f);
-        levelUpBg.SetObjectType(0);
-
-        // 업그레이드 카드 스킨들 미리 로드 (0:HP, 1:SPD, 2:DMG, 3:CDR, 4:AURA)
-        const char* cardPaths[] = {
-            "Assets/Textures/up_hp.png", 
-            "Assets/Textures/up_speed.png",
-            "Assets/Textures/up_damage.png", 
-            "Assets/Textures/up_cooldown.png", 
-            "Assets/Textures/up_aura.png"
-        };
+    TextureHandle AcquireTexture(const char* path) override { return textureCache.Acquire(path); }
+    bool AddRefTexture(TextureHandle handle) override { return textureCache.AddRef(handle); }
+    void ReleaseTexture(TextureHandle handle) override { textureCache.Release(handle); }
 
-        for (int i = 0; i < 5; i++) 
-        {
-            cardSkins[i].Initialize(d3dDevice.Get());
-            cardSkins[i].LoadTexture(d3dDevice.Get(), commandList.Get(), cardPaths[i], 1);
-        }
+    TextureInfo GetTextureInfo(TextureHandle handle) const override
+    {
+        TextureInfo info;
+        info.descriptor = textureCache.GetDescriptor(handle);
+        textureCache.GetUvScale(handle, info.uvScale[0], info.uvScale[1]);
+        info.frames = textureCache.GetFrames(handle, info.frameCount);
+        info.paletteRow = textureCache.GetPaletteRow(handle);
+        return info;
+    }
 
-        // 실제 화면에 뜰 버튼 카드 3개 설정
-        for (int i = 0; i < 3; i++) 
-        {
-            upgradeCards[i].Initialize(d3dDevice.Get());
-            upgradeCards[i].InitScale(0.45f, 1.0f); // 카드 형태의 버튼
-            upgradeCards[i].SetObjectType(0);
-        }
+    // 지금까지 AcquireTexture로 모은 이미지 파일을 워커들이 동시에 풀고, 업로드 명령은 여기서 한 번에 기록
+    void FinishTextureLoads(JobSystem* jobs) override
+    {
+        textureCache.FinishLoads(commandList.Get(), jobs);
 
         // 모든 텍스처 복사 명령 기록이 끝났으니 Close() 하고 한 방에 실행
         commandList->Close();
@@ -729,1066 +271,23 @@ public:
         commandQueue->ExecuteCommandLists(1, ppCommandLists);
 
         // 이미지 복사가 끝날 때까지 CPU 잠깐 대기
-        WaitForGPU();
-
-        // 시간 관리자 시작
-        timeMgr.Initialize();
+        WaitForIdle();
 
-        // 사운드 시스템 초기화 및 WAV 파일 로드
-        g_SoundMgr.Initialize();
-
-        g_SoundMgr.LoadWAV("bgm", "Assets/Sounds/bgm.wav");
-        g_SoundMgr.LoadWAV("hover", "Assets/Sounds/hover.wav");
-        g_SoundMgr.LoadWAV("click", "Assets/Sounds/click.wav");
-        g_SoundMgr.LoadWAV("attack_melee", "Assets/Sounds/attack_melee.wav");
-        g_SoundMgr.LoadWAV("attack_bullet", "Assets/Sounds/attack_bullet.wav");
-        g_SoundMgr.LoadWAV("attack_aura", "Assets/Sounds/attack_aura.wav");
-        g_SoundMgr.LoadWAV("levelup", "Assets/Sounds/levelup.wav");
-
-        // 게임 켜지자마자 배경음악 무한 루프 재생!
-        g_SoundMgr.Play("bgm", true, 0.4f);
+        // 복사가 끝났으니 텍스처마다 만들었던 복사용 버퍼는 버림
+        textureCache.ReleaseUploadBuffers();
     }
 
-    // 매 프레임 위치를 계산하고 GPU로 데이터를 쏴주는 함수
-    void Update()
+    // 매 프레임 화면을 그리는 함수 (메인 스레드)
+    // 게임 객체는 보지 않고 시뮬레이션 스레드가 가장 최근에 다 만든 스냅샷만 그림 (새 것이 없으면 지난 것을 다시 그림)
+    void Render(const RenderSnapshot& snapshot) override
     {
-        timeMgr.Update();
-        float dt = timeMgr.GetDeltaTime();
-
-        // ESC 키 일시정지 (PAUSE) 토글 로직
-        if (inputMgr.IsKeyPressed(VK_ESCAPE))
-        {
-            if (!isEscPressed)  // 키를 누르는 그 순간 딱 한 번만 작동
-            {
-                if (currentState == GameState::PLAY)
-                {
-                    currentState = GameState::PAUSE;
-                }
-                else if (currentState == GameState::PAUSE)
-                {
-                    currentState = GameState::PLAY;
-                }
-                isEscPressed = true;
-            }
-        }
-        else
-        {
-            isEscPressed = false;   // 키를 떼면 다시 누를 수 있게 리셋
-        }
-
-        // 공용 카메라 위치 계산
-        XMFLOAT2 camPos = { player.GetPosition().x, player.GetPosition().y };
-        float camLimit = 4.0f;
-
-        if (camPos.x > camLimit)  camPos.x = camLimit;
-        if (camPos.x < -camLimit) camPos.x = -camLimit;
-        if (camPos.y > camLimit)  camPos.y = camLimit;
-        if (camPos.y < -camLimit) camPos.y = -camLimit;
-
-        // 마우스 클릭 상태 1번만 체크
-        bool isMouseDown = (GetAsyncKeyState(VK_LBUTTON) & 0x8000) != 0;
-        POINT pt; GetCursorPos(&pt); ScreenToClient(FindWindowW(L"DX12PortfolioClass", nullptr), &pt);
-        float mouseX = (pt.x * 2.0f / 1280.0f) - 1.0f;
-        float mouseY = -((pt.y * 2.0f / 720.0f) - 1.0f); // Y축은 위가 +이므로 뒤집기
-
-        // 메인 씬 (TITLE)
-        if (currentState == GameState::TITLE)
-        {
-            // 카메라 위치 대신 (0, 0)을 전달하여 화면 중앙에 고정
-            titleBg.SetCameraPos(0, 0);
-            titleBg.Update(0.0f);
-
-            titleText.SetPosition(0.0f, 0.4f);
-            titleText.SetCameraPos(0, 0);
-            titleText.Update(0.0f);
-
-            // 버튼들도 (0, 0) 카메라 기준으로 배치
-            btnStart.SetPosition(0.0f, -0.1f); btnStart.SetCameraPos(0, 0);
-            btnSetting.SetPosition(0.0f, -0.4f); btnSetting.SetCameraPos(0, 0);
-            btnExit.SetPosition(0.0f, -0.7f); btnExit.SetCameraPos(0, 0);
-
-            if (btnStart.UpdateButton(mouseX, mouseY, isMouseDown))
-            {
-                g_SoundMgr.Play("click");
-                ResetGame();
-                currentState = GameState::WEAPON_SELECT;
-                Sleep(200);
-            }
-            if (btnSetting.UpdateButton(mouseX, mouseY, isMouseDown))
-            {
-                // 나중에 세팅 기능 추가
-            }
-            if (btnExit.UpdateButton(mouseX, mouseY, isMouseDown))
-            {
-                PostQuitMessage(0); // 프로그램 종료
-            }
-
-            // 부드러운 행렬 업데이트를 위해 호출
-            btnStart.Update(0.0f); btnSetting.Update(0.0f); btnExit.Update(0.0f);
-        }
-        else if (currentState == GameState::WEAPON_SELECT)   // 무기 선택 창 (WEAPON_SELECT)
-        {
-            // 배경과 플레이어가 정지된 상태로 화면에 그려지도록 위치 업데이트 유지
-            player.SetCameraPos(camPos.x, camPos.y);
-            player.GameObject::Update(0.0f);
-
-            background.SetCameraPos(camPos.x, camPos.y);
-            background.Update(0.0f);
-
-            // 카드 3장을 화면 중앙에 나란히 배치 (크기 및 간격 확장)
-            float spacing = 0.7f;
-            float iconOffsetY = 0.05f;
-
-            weaponCards[0].SetScale(0.6f, 0.95f);
-            weaponCards[1].SetScale(0.6f, 0.95f);
-            weaponCards[2].SetScale(0.6f, 0.95f);
-
-            weaponCards[0].SetPosition(camPos.x - spacing, camPos.y);
-            weaponCards[1].SetPosition(camPos.x, camPos.y);
-            weaponCards[2].SetPosition(camPos.x + spacing, camPos.y);
-
-            // 아이콘 위치 세팅 (카드 위치와 동일하게 맞춤)
-            weaponIcons[0].SetPosition(camPos.x - spacing, camPos.y + iconOffsetY);
-            weaponIcons[1].SetPosition(camPos.x, camPos.y + iconOffsetY);
-            weaponIcons[2].SetPosition(camPos.x + spacing, camPos.y + iconOffsetY);
-
-            // 카메라 위치가 반영된 월드 마우스 좌표 계산
-            float worldMouseX = mouseX + camPos.x;
-            float worldMouseY = mouseY + camPos.y;
-
-            for (int i = 0; i < 3; i++)
-            {
-                // 버튼 업데이트 및 클릭 판정 (화면 3등분 대신 버튼 자체 충돌 판정 사용!)
-                if (weaponCards[i].UpdateButton(worldMouseX, worldMouseY, isMouseDown))
-                {
-                    selectedWeapon = i; // 0, 1, 2번 인덱스 그대로 무기 번호로 사용
-                    currentState = GameState::PLAY;
-                    Sleep(200); // 연속 클릭 방지
-                }
-
-                weaponCards[i].SetCameraPos(camPos.x, camPos.y);
-                weaponCards[i].Update(0.0f);
-
-                // 아이콘도 카메라와 매트릭스 업데이트
-                weaponIcons[i].SetCameraPos(camPos.x, camPos.y);
-                weaponIcons[i].Update(0.0f);
-            }
-
-            // 마우스 클릭 감지 로직 (Windows API)
-            if (GetAsyncKeyState(VK_LBUTTON) & 0x8000)  // 마우스 왼쪽 버튼 클릭 시
-            {
-                POINT pt;
-                GetCursorPos(&pt);
-                ScreenToClient(FindWindowW(L"DX12PortfolioClass", nullptr), &pt);
-
-                // 마우스 좌표(픽셀)를 화면 좌표계 (-1.0 ~ 1.0)로 변환
-                float mouseX = (pt.x * 2.0f / 1280.0f) - 1.0f;
-
-                // 카드가 3등분 된 영역 중 어디를 클릭했는지 판별
-                if (mouseX < -0.33f) selectedWeapon = 0;      // 왼쪽 클릭 -> 근접
-                else if (mouseX < 0.33f) selectedWeapon = 1;  // 중앙 클릭 -> 총
-                else selectedWeapon = 2;                      // 오른쪽 클릭 -> 오라      
-
-                // 무기 고르면 게임 시작
-                currentState = GameState::PLAY;
-                Sleep(200); // 연속 클릭 방지용 아주 짧은 딜레이
-            }
-        }
-        // 오직 PLAY 상태일 때만 게임 세계의 시간이 흐름
-        else if (currentState == GameState::PLAY)
-        {
-            // 타이머 증가 및 클리어 체크
-            gameTimer += dt;
-
-            // 사망 체크
-            if (player.hp <= 0.0f)
-            {
-                currentState = GameState::GAME_OVER;
-            }
-
-            // 충돌 범위 반지름 세팅
-            float playerRadius = 0.08f;
-            float enemyRadius = 0.08f;
-
-            // Player vs Enemy 충돌 검사 (속도 저하 로직)
-            // 매 프레임 플레이어의 속도를 원래 속도로 원상복구 시킴
-            player.currentSpeed = player.basespeed;
-            XMFLOAT3 playerPos = player.GetPosition();
-            bool isPlayerHit = false;
-
-            for (int i = 0; i < ENEMY_COUNT; i++)
-            {
-                if (enemies[i].isDead) continue; // 죽은 적과는 부딪히지 않음
-
-                XMFLOAT3 enemyPos = enemies[i].GetPosition();
-                // 피타고라스의 정리
-                float dx = playerPos.x - enemyPos.x;
-                float dy = playerPos.y - enemyPos.y;
-                float dist = sqrt((dx * dx) + (dy * dy));
-
-                // 내 반지름 + 적 반지름 보다 거리가 짧으면 충돌 (겹침) 발생
-                if (dist < playerRadius + enemyRadius)
-                {
-                    isPlayerHit = true;
-                    break;  // 하나라도 부딪히면 느려지므로 더 검사할 필요 없음
-                }
-            }
-
-            // 부딪혔다면 속도를 40%로 확 줄임
-            if (isPlayerHit)
-            {
-                player.currentSpeed = player.basespeed * 0.6f;
-                // 피격 시 빨간색으로 변경
-                player.SetTintColor(1.0f, 0.0f, 0.0f);
-
-                // 피격 시 dt(시간)을 곱해서 초당 데미지(DPS)를 줌
-                player.hp -= 5.0f * dt;
-
-                // 체력이 음수로 안 내려가게 방지
-                if (player.hp < 0.0f) player.hp = 0.0f;
-            }
-            else
-            {
-                // 피격 받지 않을 시 원래 색상으로 변경
-                player.SetTintColor(1.0f, 1.0f, 1.0f);
-            }
-
-            // 플레이어 객체 스스로 업데이트하도록 호출 (키보드 이동 반영)
-            player.Update(dt, inputMgr);
-
-            // 플레이어 투명 벽 (경계선) 로직
-            XMFLOAT3 pPos = player.GetPosition();
-
-            // 카메라 마지노선(camLimit)보다 조금 크게 설정하여, 카메라가 멈춘 상태에서 플레이어가 가장자리로 이동하도록 연출
-            float mapLimit = 4.5f;
-
-            if (pPos.x > mapLimit)  pPos.x = mapLimit;   // 오른쪽 벽
-            if (pPos.x < -mapLimit) pPos.x = -mapLimit;  // 왼쪽 벽
-            if (pPos.y > mapLimit)  pPos.y = mapLimit;   // 위쪽 벽
-            if (pPos.y < -mapLimit) pPos.y = -mapLimit;  // 아래쪽 벽
-
-            // 벽에 막힌 최종 위치를 플레이어에게 다시 덮어씌움
-            player.SetPosition(pPos.x, pPos.y);
-
-            // 카메라 좌표 설정 (카메라는 항상 최신 플레이어 위치를 따라가되 가두기 적용)
-            camPos = { player.GetPosition().x, player.GetPosition().y };
-
-            // 카메라가 파란색 허공을 비추지 않도록 제한하는 마지노선
-            if (camPos.x > camLimit)  camPos.x = camLimit;   // 오른쪽 카메라 정지
-            if (camPos.x < -camLimit) camPos.x = -camLimit;  // 왼쪽 카메라 정지
-            if (camPos.y > camLimit)  camPos.y = camLimit;   // 위쪽 카메라 정지
-            if (camPos.y < -camLimit) camPos.y = -camLimit;  // 아래쪽 카메라 정지
-
-            // 모든 객체에 제한이 걸린 카메라 좌표 전달 (플레이어 본인 포함)
-            player.SetCameraPos(camPos.x, camPos.y);
-
-            // 새 카메라 위치로 행렬을 다시 계산하기 위한 강제 업데이트
-            player.GameObject::Update(0.0f);
-
-            // 무한 맵 (배경) 스크롤 로직
-            // 배경은 세상의 중심(0,0)에 가만히 있고 카메라만 움직이게
-            background.SetCameraPos(camPos.x, camPos.y);
-            background.Update(dt);
-
-            // 무기 공격 쿨타임 로직
-            attackTimer += dt;
-
-            if (attackTimer >= attackCooldown)
-            {
-                attackTimer = 0.0f; // 쿨타임 리셋
-
-                // 근접 공격
-                if (selectedWeapon == 0)
-                {
-                    g_SoundMgr.Play("attack_melee");
-
-                    // 플레이어가 보는 방향 (isFlipped)에 따라 이펙트 위치 결정
-                    float dir = player.GetIsFlipped() ? -1.0f : 1.0f;
-                    float attackX = pPos.x + (0.2f * dir);
-
-                    // 이펙트 생성
-                    for (int i = 0; i < MAX_EFFECTS; i++)
-                    {
-                        if (meleeEffects[i].isDead)
-                        {
-                            meleeEffects[i].isDead = false;
-                            meleeEffects[i].SetPosition(attackX, pPos.y);
-                            meleeEffects[i].SetFlipped(player.GetIsFlipped());
-                            break;
-                        }
-                    }
-
-                    // 데미지 판정 (앞쪽 네모 박스 안의 적 타격 - 범위 축소 적용)
-                    for (int i = 0; i < ENEMY_COUNT; i++)
-                    {
-                        if (enemies[i].isDead) continue;
-
-                        float ex = enemies[i].GetPosition().x;
-                        float ey = enemies[i].GetPosition().y;
-
-                        // 방향이 맞고 거리가 가까우면 hit
-                        if (((dir > 0 && ex > pPos.x) || (dir < 0 && ex < pPos.x)) && abs(ex - pPos.x) < 0.5f && abs(ey - pPos.y) < 0.3f)
-                        {
-                            // 기본 15 데미지에 -1 ~ +1 랜덤 오차 적용 (즉 14, 15, 16 중 하나가 뜸)
-                            int baseDmg = (int)(15.0f * player.damageMultiplier);
-                            int randomDmg = baseDmg + (rand() % 3 - 1);
-                            enemies[i].hp -= (float)randomDmg;
-
-                            // 데미지 텍스트 팝업 띄우기
-                            for (int k = 0; k < MAX_DMG_TEXTS; k++)
-                            {
-                                if (dmgTexts[k].isDead)
-                                {
-                                    dmgTexts[k].isDead = false;
-                                    dmgTexts[k].lifeTime = 0.0f;
-                                    dmgTexts[k].SetPosition(ex, ey + 0.1f);
-
-                                    // 고정 숫자 대신 방금 뽑은 랜덤 데미지를 출력
-                                    dmgTexts[k].SetFrame(randomDmg % 10);
-                                    break;
-                                }
-                            }
-
-                            // 적이 죽었다면 사망 처리 및 경험치 젬 드롭
-                            if (enemies[i].hp <= 0.0f)
-                            {
-                                enemies[i].isDead = true;
-
-                                if (enemies[i].enemyType == 6)
-                                {
-                                    currentState = GameState::CLEAR;
-                                }
-
-                                for (int g = 0; g < MAX_GEMS; g++)
-                                {
-                                    if (gems[g].isDead)
-                                    {
-                                        gems[g].isDead = false;
-                                        gems[g].SetPosition(enemies[i].GetPosition().x, enemies[i].GetPosition().y);
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-                else if (selectedWeapon == 1)   // 총 (유도탄)
-                {
-                    g_SoundMgr.Play("attack_bullet");
-
-                    // 배열에서 isDead된 미사일을 하나 찾아서 발사
-                    for (int i = 0; i < MAX_BULLETS; i++)
-                    {
-                        if (bullets[i].isDead)
-                        {
-                            bullets[i].isDead = false;
-                            bullets[i].lifeTime = 0.0f; // 쏠 때마다 수명을 0으로 새롭게 세팅
-                            bullets[i].SetPosition(pPos.x, pPos.y); // 플레이어 위치에서 스폰
-                            break;
-                        }
-                    }
-                }
-                else if (selectedWeapon == 2)   // 오라 (주변 공격)
-                {
-                    g_SoundMgr.Play("attack_aura");
-
-                    // 쿨타임이 돌 때마다 오라가 잠깐 켜졌다가 꺼짐 (지속 데미지)
-                    isAuraActive = true;
-                }
-            }
-
-            // 오라가 켜져 있을 때 (플레이어 따라다니며 닿는 적 피격)
-            if (selectedWeapon == 2 && isAuraActive)
-            {
-                auraEffect.SetPosition(pPos.x, pPos.y);
-                auraEffect.SetCameraPos(camPos.x, camPos.y);
-                auraEffect.Update(dt); // 빙글빙글 돌릴 수 있음
-
-                // 텍스트 폭주를 막기 위한 틱 타이머
-                static float auraTextTimer = 0.0f;
-                auraTextTimer += dt;
-                bool shouldPopText = false;
-
-                if (auraTextTimer >= 0.2f)
-                {
-                    shouldPopText = true;
-                    auraTextTimer = 0.0f;
-                }
-
-                for (int i = 0; i < ENEMY_COUNT; i++)
-                {
-                    if (enemies[i].isDead) continue;
-
-                    float dx = enemies[i].GetPosition().x - pPos.x;
-                    float dy = enemies[i].GetPosition().y - pPos.y;
-
-                    if (sqrt(dx * dx + dy * dy) < auraRadius)
-                    {
-                        // 데미지는 매 프레임 부드럽게 들어감
-                        enemies[i].hp -= 15.0f * dt;
-
-                        // 틱 타이머가 허락할 때만 텍스트 팝업
-                        if (shouldPopText)
-                        {
-                            for (int k = 0; k < MAX_DMG_TEXTS; k++)
-                            {
-                                if (dmgTexts[k].isDead)
-                                {
-                                    dmgTexts[k].isDead = false;
-                                    dmgTexts[k].lifeTime = 0.0f;
-                                    dmgTexts[k].SetPosition(enemies[i].GetPosition().x, enemies[i].GetPosition().y + 0.1f);
-
-                                    // 3 ~ 4 중 하나가 랜덤으로 뜨도록 설정 (기본 데미지가 15로 올랐으므로 숫자를 조금 더 크게 표시)
-                                    int baseAuraDmg = (int)(3.0f * player.damageMultiplier);
-                                    int randomAuraDmg = baseAuraDmg + (rand() % 2);
-                                    dmgTexts[k].SetFrame(randomAuraDmg);
-                                    break;
-                                }
-                            }
-                        }
-
-                        // 체력이 0 이하가 되면 죽음 처리 및 젬 드롭
-                        if (enemies[i].hp <= 0.0f)
-                        {
-                            enemies[i].isDead = true;
-                            totalKills++;   // 몬스터 잡을 때마다 킬 수 1 증가
-
-                            if (enemies[i].enemyType == 6)
-                            {
-                                currentState = GameState::CLEAR;
-                            }
-
-                            for (int g = 0; g < MAX_GEMS; g++)
-                            {
-                                if (gems[g].isDead)
-                                {
-                                    gems[g].isDead = false;
-                                    gems[g].SetPosition(enemies[i].GetPosition().x, enemies[i].GetPosition().y);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                }
-
-                // 0.5초 켜져있다가 꺼짐 (나중에 업그레이드로 무한 지속 가능)
-                if (attackTimer > 0.5f)
-                {
-                    isAuraActive = false;
-                }
-            }
-
-            // 살아있는 이펙트들 업데이트
-            for (int i = 0; i < MAX_EFFECTS; i++)
-            {
-                meleeEffects[i].SetCameraPos(camPos.x, camPos.y);
-                meleeEffects[i].Update(dt);
-
-                hitEffects[i].SetCameraPos(camPos.x, camPos.y);
-                hitEffects[i].Update(dt);
-            }
-
-            // 살아 있는 미사일들 업데이트, 젬과 데미지 생성
-            for (int i = 0; i < MAX_BULLETS; i++)
-            {
-                if (bullets[i].isDead) continue;
-                bullets[i].SetCameraPos(camPos.x, camPos.y); // 미사일에게도 카메라 위치 전달
-
-                // 미사일 로직을 밖으로 빼서 메인루프에서 적의 죽음을 캐치
-                float minDist = 9999.0f;
-                int targetIdx = -1;
-
-                // 타겟 찾기
-                for (int j = 0; j < ENEMY_COUNT; j++)
-                {
-                    if (enemies[j].isDead) continue;
-
-                    float dx = enemies[j].GetPosition().x - bullets[i].GetPosition().x;
-                    float dy = enemies[j].GetPosition().y - bullets[i].GetPosition().y;
-                    float dist = sqrt((dx * dx) + (dy * dy));
-
-                    if (dist < minDist)
-                    {
-                        minDist = dist;
-                        targetIdx = j;
-                    }
-                }
-
-                // 날아가기 및 명중 처리
-                if (targetIdx != -1)
-                {
-                    float dx = enemies[targetIdx].GetPosition().x - bullets[i].GetPosition().x;
-                    float dy = enemies[targetIdx].GetPosition().y - bullets[i].GetPosition().y;
-                    float dist = sqrt((dx * dx) + (dy * dy));
-
-                    if (dist > 0.0f)
-                    {
-                        bullets[i].SetPosition(bullets[i].GetPosition().x + (dx / dist) * bullets[i].speed * dt,
-                        bullets[i].GetPosition().y + (dy / dist) * bullets[i].speed * dt);
-                    }
-
-                    // 적중
-                    float hitRadius = 0.08f;
-
-                    if (dist < hitRadius)
-                    {
-                        // 총알 기본 데미지에 -1 ~ +1 랜덤 오차 적용 (예: 데미지가 5라면 4, 5, 6 중 하나가 적용됨)
-                        int baseDmg = (int)(bullets[i].damage * player.damageMultiplier);
-                        int randomDmg = baseDmg + (rand() % 3 - 1);
-                        enemies[targetIdx].hp -= (float)randomDmg;
-                        bullets[i].isDead = true;
-
-                        // 총알 피격 이펙트 띄우기
-                        for (int k = 0; k < MAX_EFFECTS; k++)
-                        {
-                            if (hitEffects[k].isDead)
-                            {
-                                hitEffects[k].isDead = false;
-                                hitEffects[k].SetPosition(enemies[targetIdx].GetPosition().x, enemies[targetIdx].GetPosition().y);
-                                break;
-                            }
-                        }
-
-                        // 데미지 텍스트 팝업 띄우기
-                        for (int k = 0; k < MAX_DMG_TEXTS; k++)
-                        {
-                            if (dmgTexts[k].isDead)
-                            {
-                                dmgTexts[k].isDead = false;
-                                dmgTexts[k].lifeTime = 0.0f;
-                                dmgTexts[k].SetPosition(enemies[targetIdx].GetPosition().x, enemies[targetIdx].GetPosition().y + 0.1f);
-
-                                // 무조건 5가 아니라, 방금 계산된 랜덤 데미지 숫자를 띄움
-                                dmgTexts[k].SetFrame(randomDmg % 10);
-                                break;
-                            }
-                        }
-
-                        // 타입 6 (최종 보스) 적이 죽었다면
-                        if (enemies[targetIdx].enemyType == 6)
-                        {
-                            currentState = GameState::CLEAR;
-                        }
-
-                        // 적이 죽었다면 경험치 젬 드롭
-                        if (enemies[targetIdx].hp <= 0.0f)
-                        {
-                            enemies[targetIdx].isDead = true;
-
-                            for (int g = 0; g < MAX_GEMS; g++)
-                            {
-                                if (gems[g].isDead)
-                                {
-                                    gems[g].isDead = false;
-                                    gems[g].SetPosition(enemies[targetIdx].GetPosition().x, enemies[targetIdx].GetPosition().y);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                }
-                else
-                {
-                    bullets[i].SetPosition(bullets[i].GetPosition().x, bullets[i].GetPosition().y + bullets[i].speed * dt);
-                }
-
-                bullets[i].Update(dt);
-            }
-
-            // 5분 (300초) 웨이브 & 보스 매니저
-            spawnTimer += dt;
-            int currentMinute = (int)(gameTimer / 60.0f);
-            float spawnInterval = max(0.15f, 2.0f - (currentMinute * 0.4f));
-
-            auto SpawnEnemy = [&](int targetType, float x, float y)
-                {
-                    int startIndex = rand() % ENEMY_COUNT;
-
-                    for (int i = 0; i < ENEMY_COUNT; i++)
-                    {
-                        int idx = (startIndex + i) % ENEMY_COUNT;
-
-                        if (enemies[idx].isDead && enemies[idx].enemyType == targetType)
-                        {
-                            enemies[idx].InitStats();
-
-                            // 시간에 따른 체력 뻥튀기 로직 (1초마다 체력 0.4씩 증가)
-                            // (5분이 되면 기본몹 체력이 30 + 120 = 150으로 상승)
-                            float hpBonus = gameTimer * 0.1f;
-                            enemies[idx].maxHp += hpBonus;
-                            enemies[idx].hp = enemies[idx].maxHp;
-
-                            enemies[idx].SetPosition(x, y);
-                            break;
-                        }
-                    }
-                };
-
-            // 보스 스폰 로직 (1분, 2분, 3분에 중간 보스 / 4분 30초에 최종 보스)
-            if (currentMinute == 1 && !isBossSpawned[0])
-            {
-                SpawnEnemy(3, pPos.x + 2.5f, pPos.y); isBossSpawned[0] = true;
-            }
-            else if (currentMinute == 2 && !isBossSpawned[1])
-            {
-                SpawnEnemy(4, pPos.x - 2.5f, pPos.y); isBossSpawned[1] = true;
-            }
-            else if (currentMinute == 3 && !isBossSpawned[2])
-            {
-                SpawnEnemy(5, pPos.x, pPos.y + 2.5f); isBossSpawned[2] = true;
-            }
-            else if (gameTimer >= 270.0f && !isBossSpawned[3]) // 270초 = 4분 30초
-            {
-                SpawnEnemy(6, pPos.x, pPos.y - 2.5f); isBossSpawned[3] = true;
-            }
-
-            // 일반 웨이브 스폰 로직 (분 단위로 패턴 변경)
-            if (spawnTimer >= spawnInterval)
-            {
-                spawnTimer = 0.0f;
-
-                if (currentMinute < 1) // 0 ~ 1분: 몸풀기 원형 포위
-                {
-                    for (int k = 0; k < 6; k++) 
-                    {
-                        float angle = k * (XM_2PI / 6.0f);
-                        SpawnEnemy(0, pPos.x + cos(angle) * 1.5f, pPos.y + sin(angle) * 1.5f);
-                    }
-                }
-                else if (currentMinute < 2) // 1 ~ 2분: 위아래 양각
-                {
-                    for (int k = 0; k < 6; k++) 
-                    {
-                        float offsetX = (pPos.x - 2.0f) + (k * 0.8f);
-                        SpawnEnemy(1, offsetX, pPos.y + 1.5f);
-                        SpawnEnemy(1, offsetX, pPos.y - 1.5f);
-                    }
-                }
-                else if (currentMinute < 3) // 2 ~ 3분: 혼합 난전
-                {
-                    SpawnEnemy(2, pPos.x + 1.5f, pPos.y);
-                    SpawnEnemy(2, pPos.x - 1.5f, pPos.y);
-
-                    for (int k = 0; k < 5; k++) 
-                    {
-                        float angle = k * (XM_2PI / 5.0f) + 0.5f;
-                        SpawnEnemy(1, pPos.x + cos(angle) * 1.5f, pPos.y + sin(angle) * 1.5f);
-                    }
-                }
-                else // 3분 이후: 대규모 물량 공세
-                {
-                    for (int k = 0; k < 12; k++) 
-                    {
-                        float angle = k * (XM_2PI / 12.0f);
-                        SpawnEnemy(k % 3, pPos.x + cos(angle) * 1.5f, pPos.y + sin(angle) * 1.5f);
-                    }
-                }
-            }
-
-            // 모든 Enemy가 플레이어의 위치를 향해 돌격
-            for (int i = 0; i < ENEMY_COUNT; i++)
-            {
-                // 죽은 적은 움직이지 않음
-                if (enemies[i].isDead) continue;
-
-                enemies[i].SetCameraPos(camPos.x, camPos.y); // 적에게도 카메라 위치 전달
-                enemies[i].Update(dt, pPos);
-            }
-
-            // 적들 끼리 겹치지 않게 서로 밀어내기 (군집 형성의 핵심)
-            for (int i = 0; i < ENEMY_COUNT; i++)
-            {
-                // 죽은 적은 밀어내기 제외
-                if (enemies[i].isDead) continue;
-
-                for (int j = i + 1; j < ENEMY_COUNT; j++)
-                {
-                    if (enemies[j].isDead) continue; // j도 죽었는지 체크
-
-                    XMFLOAT3 pos1 = enemies[i].GetPosition();
-                    XMFLOAT3 pos2 = enemies[j].GetPosition();
-
-                    float dx = pos2.x - pos1.x;
-                    float dy = pos2.y - pos1.y;
-                    float dist = sqrt((dx * dx) + (dy * dy));
-
-                    // 두 적이 유지해야하는 최소 거리 (반지름 2배)
-                    float minDistance = 0.2f;
-
-                    // 0.0001f 체크는 둘이 완벽하게 겹쳐서 거리가 0이 될 때 생기는 나눗셈 오류 방지
-                    if (dist < minDistance && dist > 0.0001f)
-                    {
-                        // 얼마나 겹쳤는지 계산
-                        float overlap = minDistance - dist;
-
-                        // 밀어낼 방향 (단위 벡터) 구하기
-                        float nx = dx / dist;
-                        float ny = dy / dist;
-
-                        // dt를 곱해서 프레임 속도에 맞춰 0.5배 속도로 아주 부드럽게 밀어냄
-                        float pushStrength = 0.5f * dt;
-                        float pushX = nx * (overlap * pushStrength);
-                        float pushY = ny * (overlap * pushStrength);
-
-                        enemies[i].SetPosition(pos1.x - pushX, pos1.y - pushY);
-                        enemies[j].SetPosition(pos2.x + pushX, pos2.y + pushY);
-                    }
-                }
-            }
-
-            // 젬 (플레이어에게 다가가서 먹히기)
-            for (int i = 0; i < MAX_GEMS; i++)
-            {
-                if (gems[i].isDead) continue;
-
-                gems[i].SetCameraPos(camPos.x, camPos.y);
-                gems[i].Update(dt, player);
-            }
-
-            // 데미지 텍스트
-            for (int i = 0; i < MAX_DMG_TEXTS; i++)
-            {
-                if (dmgTexts[i].isDead) continue;
-
-                dmgTexts[i].SetCameraPos(camPos.x, camPos.y);
-                dmgTexts[i].Update(dt);
-            }
-
-            // HP바 크기와 위치 실시간 계산
-            float barWidth = 0.12f;      // 체력바 전체 가로길이
-            float barHeight = 0.02f;    // 체력바 세로 두께
-            float hpY = pPos.y - 0.25f; // 플레이어 위치보다 살짝 아래
-
-            hpBarBg.SetPosition(pPos.x, hpY); // 위치 세팅
-            hpBarBg.SetCameraPos(camPos.x, camPos.y);
-            hpBarBg.SetScale(barWidth, barHeight);
-            hpBarBg.Update(0.0f); // 애니메이션 없으므로 0.0f 전달
-
-            // 체력 게이지(초록 줄) 계산
-            float hpRatio = player.hp / player.maxHp;
-
-            if (hpRatio < 0.0f) hpRatio = 0.0f; // 마이너스 방지
-
-            float currentWidth = barWidth * hpRatio; // 현재 체력만큼 깎인 길이
-            float offset = (barWidth - currentWidth) * 0.5f;
-
-            hpBarFill.SetPosition(pPos.x - offset, hpY); // 위치 세팅
-            hpBarFill.SetCameraPos(camPos.x, camPos.y);
-            hpBarFill.SetScale(currentWidth, barHeight);
-
-            // 피가 30% 이하면 빨간색으로 변경
-            if (hpRatio <= 0.3f)
-            {
-                hpBarFill.SetTintColor(1.0f, 0.0f, 0.0f);
-            }
-            else
-            {
-                hpBarFill.SetTintColor(0.0f, 1.0f, 0.0f);
-            }
-
-            hpBarFill.Update(0.0f);
-
-            // EXP 바 (화면 맨 위에 고정)
-            float expBarWidth = 2.0f;
-            float expBarHeight = 0.05f;
-            float expY = camPos.y + 0.95f;
-
-            expBarBg.SetPosition(camPos.x, expY);
-            expBarBg.SetCameraPos(camPos.x, camPos.y);
-            expBarBg.SetScale(expBarWidth, expBarHeight);
-            expBarBg.Update(0.0f);
-
-            float expRatio = player.exp / player.maxExp;
-
-            if (expRatio > 1.0f) expRatio = 1.0f;
-
-            float currentExpWidth = expBarWidth * expRatio;
-            float expOffset = (expBarWidth - currentExpWidth) * 0.5f;
-
-            expBarFill.SetPosition(camPos.x - expOffset, expY);
-            expBarFill.SetCameraPos(camPos.x, camPos.y);
-            expBarFill.SetScale(currentExpWidth, expBarHeight);
-            expBarFill.Update(0.0f);
-
-            // 레벨 업
-            if (player.exp >= player.maxExp)
-            {
-                g_SoundMgr.Play("levelup");
-                player.exp -= player.maxExp; // 남은 경험치 이월
-                player.maxExp *= 1.2f;       // 다음 레벨은 더 어렵게
-                player.level++;
-
-                // 랜덤하게 3가지 업그레이드 아이디 뽑기 (0~4 중 중복 없이)
-                for (int i = 0; i < 3; i++) 
-                {
-                    bool isUnique = false;
-
-                    while (!isUnique) 
-                    {
-                        cardUpIds[i] = rand() % 5;
-                        isUnique = true;
-                        for (int j = 0; j < i; j++) if (cardUpIds[i] == cardUpIds[j]) isUnique = false;
-                    }
-
-                    // 텍스처를 카드 버튼에 입힘
-                    upgradeCards[i].ShareTextureFrom(cardSkins[cardUpIds[i]]);
-                }
-
-                currentState = GameState::LEVEL_UP; // 레벨업 씬으로 전환
-                Sleep(200); // 아주 짧은 딜레이
-
-                return;
-            }
-
-
-            // 레벨 UI (우측 상단)
-            float uiY = camPos.y + 0.85f; // EXP 바 살짝 아래
-            float levelX = camPos.x + 0.8f; // 화면 우측으로 이동
-
-            levelBg.SetPosition(levelX, uiY);
-            levelBg.SetCameraPos(camPos.x, camPos.y);
-            levelBg.Update(0.0f);
-
-            int tens = (player.level / 10) % 10;
-            int units = player.level % 10;
-
-            levelTexts[0].SetFrame(tens);
-            levelTexts[1].SetFrame(units);
-
-            // 두 숫자가 살짝 떨어져 있도록 간격 조절
-            float textSpacing = 0.015f;
-            levelTexts[0].SetPosition(levelX - textSpacing, uiY);
-            levelTexts[1].SetPosition(levelX + textSpacing, uiY);
-
-            for (int i = 0; i < 2; i++)
-            {
-                levelTexts[i].SetCameraPos(camPos.x, camPos.y);
-                levelTexts[i].Update(0.0f);
-            }
-
-
-            // 타이머 시스템 (화면 중앙 상단 배치)
-            // 전체 시간을 분(MM)과 초(SS)로 쪼개기
-            int minutes = (int)(gameTimer / 60.0f);
-            int seconds = (int)gameTimer % 60;
-
-            // 각 자릿수 추출 (예: 12분 34초 -> m1=1, m2=2, s1=3, s2=4)
-            int m1 = (minutes / 10) % 10;
-            int m2 = minutes % 10;
-            int s1 = (seconds / 10) % 10;
-            int s2 = seconds % 10;
-
-            // 폰트에 프레임(숫자) 적용
-            timerTexts[0].SetFrame(m1);
-            timerTexts[1].SetFrame(m2);
-            timerTexts[2].SetFrame(s1);
-            timerTexts[3].SetFrame(s2);
-
-            // 폰트 간격 설정 (가운데를 살짝 띄워서 ':' 역할을 대신함)
-            float spacingTime = 0.04f;
-            float gap = 0.03f; // 콜론(:)이 들어갈 빈 공간
-
-            timerTexts[0].SetPosition(camPos.x - spacingTime - gap, uiY);
-            timerTexts[1].SetPosition(camPos.x - gap, uiY);
-            timerTexts[2].SetPosition(camPos.x + gap, uiY);
-            timerTexts[3].SetPosition(camPos.x + spacingTime + gap, uiY);
-
-            for (int i = 0; i < 4; i++)
-            {
-                timerTexts[i].SetCameraPos(camPos.x, camPos.y);
-                timerTexts[i].Update(0.0f);
-            }
-
-            // 콜론 (:) 위치 잡기
-            // X좌표는 화면 정중앙(camPos.x), Y좌표는 타이머 기준 위/아래로 살짝 벌림
-            // Y좌표 세팅 (위쪽 점, 아래쪽 점)
-            float colonTopY = uiY + 0.015f;
-            float colonBottomY = uiY - 0.015f;
-
-            // 검은색 배경 점 (뒤에 그릴 예정)
-            timerColonBg[0].SetPosition(camPos.x, colonTopY);
-            timerColonBg[1].SetPosition(camPos.x, colonBottomY);
-
-            // 흰색 점 (앞에 그릴 예정)
-            timerColon[0].SetPosition(camPos.x, colonTopY);
-            timerColon[1].SetPosition(camPos.x, colonBottomY);
-
-            // 업데이트 호출 (카메라 좌표 전달)
-            for (int i = 0; i < 2; i++)
-            {
-                timerColonBg[i].SetCameraPos(camPos.x, camPos.y);
-                timerColonBg[i].Update(0.0f);
-
-                timerColon[i].SetCameraPos(camPos.x, camPos.y);
-                timerColon[i].Update(0.0f);
-            }
-        }
-        else if (currentState == GameState::LEVEL_UP)   // LEVEL_UP 선택 씬
-        {
-            float worldMouseX = mouseX + camPos.x;
-            float worldMouseY = mouseY + camPos.y;
-
-            pauseBg.SetPosition(camPos.x, camPos.y);
-            pauseBg.SetCameraPos(camPos.x, camPos.y);
-            pauseBg.Update(0.0f);
-
-            levelUpBg.SetPosition(camPos.x, camPos.y);
-            levelUpBg.SetCameraPos(camPos.x, camPos.y);
-            levelUpBg.Update(0.0f);
-
-            float cardSpacing = 0.55f;
-
-            for (int i = 0; i < 3; i++)
-            {
-                upgradeCards[i].SetPosition(camPos.x + (i - 1) * cardSpacing, camPos.y);
-                upgradeCards[i].SetCameraPos(camPos.x, camPos.y);
-
-                if (upgradeCards[i].UpdateButton(worldMouseX, worldMouseY, isMouseDown))
-                {
-                    // 선택한 카드에 따른 능력치 적용!
-                    int pickedId = cardUpIds[i];
-
-                    if (pickedId == 0) 
-                    {
-                        player.maxHp += 20.0f; player.hp = player.maxHp; // HP증가 & 풀피
-                    }
-                    else if (pickedId == 1) 
-                    { 
-                        player.basespeed *= 1.1f;  // 이속 10% 증가
-                    }                  
-                    else if (pickedId == 2)
-                    {
-                        // 모든 무기 데미지 증가 (근접, 유도탄 등 변수에 직접 접근하거나 수식화)
-                        player.damageMultiplier += 0.2f;
-                    }
-                    else if (pickedId == 3) 
-                    { 
-                        attackCooldown *= 0.9f; // 쿨다운 10% 감소
-                    }                    
-                    else if (pickedId == 4) 
-                    { 
-                        auraRadius *= 1.2f; auraEffect.SetScale(auraRadius * 2, auraRadius * 2); // 오라 범위 증가
-                    } 
-
-                    currentState = GameState::PLAY; // 다시 게임으로!
-                    Sleep(200);
-                }
-                upgradeCards[i].Update(0.0f);
-            }
-        }
-        else if (currentState == GameState::PAUSE)  // 일시 정지 씬
-        {
-            // 배경과 버튼을 카메라 중앙에 띄움
-            pauseBg.SetPosition(camPos.x, camPos.y);
-            pauseBg.SetCameraPos(camPos.x, camPos.y);
-            pauseBg.Update(0.0f);
-
-            btnPauseMain.SetPosition(camPos.x, camPos.y + 0.2f);
-            btnPauseMain.SetCameraPos(camPos.x, camPos.y);
-
-            btnPauseSetting.SetPosition(camPos.x, camPos.y - 0.1f);
-            btnPauseSetting.SetCameraPos(camPos.x, camPos.y);
-
-            btnPauseExit.SetPosition(camPos.x, camPos.y - 0.4f);
-            btnPauseExit.SetCameraPos(camPos.x, camPos.y);
-
-            // 마우스 좌표(화면 기준)를 버튼 좌표(월드 기준)에 맞게 카메라 위치만큼 더함
-            float worldMouseX = mouseX + camPos.x;
-            float worldMouseY = mouseY + camPos.y;
-
-            // 버튼 판정 시 기존의 mouseX, mouseY 대신 worldMouseX, worldMouseY
-            if (btnPauseMain.UpdateButton(worldMouseX, worldMouseY, isMouseDown))
-            {
-                currentState = GameState::TITLE; // 메인으로 돌아감
-                Sleep(200);
-            }
-            if (btnPauseSetting.UpdateButton(worldMouseX, worldMouseY, isMouseDown))
-            {
-                // 세팅 기능
-            }
-            if (btnPauseExit.UpdateButton(worldMouseX, worldMouseY, isMouseDown))
-            {
-                PostQuitMessage(0); // 종료
-            }
-
-            btnPauseMain.Update(0.0f);
-            btnPauseSetting.Update(0.0f);
-            btnPauseExit.Update(0.0f);
-        }    
-        else if (currentState == GameState::GAME_OVER || currentState == GameState::CLEAR) // 게임 오버 / 클리어 UI 및 점수 계산
-        {
-            float worldMouseX = mouseX + camPos.x;
-            float worldMouseY = mouseY + camPos.y;
-
-            if (currentState == GameState::GAME_OVER)
-            {
-                gameOverUI.SetPosition(camPos.x, camPos.y + 0.8f);
-                gameOverUI.SetCameraPos(camPos.x, camPos.y);
-                gameOverUI.Update(dt);
-            }
-            else
-            {
-                clearUI.SetPosition(camPos.x, camPos.y + 0.8f);
-                clearUI.SetCameraPos(camPos.x, camPos.y);
-                clearUI.Update(dt);
-            }
-
-            // 점수 계산 및 배경 띄우기
-            int score = (int)(gameTimer * 10.0f) + (player.level * 100) + (totalKills * 50);
-
-            scoreBg.SetPosition(camPos.x, camPos.y + 0.05f);
-            scoreBg.SetCameraPos(camPos.x, camPos.y);
-            scoreBg.Update(0.0f);
-
-            // 점수 숫자 추출 및 세팅
-            int tempScore = score;
-            float digitStartX = camPos.x + 0.06f;
-            float digitSpacing = 0.035f;
-
-            for (int i = 5; i >= 0; i--) // 1의 자리가 맨 뒤(5번)에 오도록 배열 거꾸로 순회
-            {
-                int digit = tempScore % 10;
-                tempScore /= 10;
-
-                scoreTexts[i].SetFrame(digit);
-                scoreTexts[i].SetPosition(digitStartX + (i * digitSpacing), camPos.y + 0.05f);
-                scoreTexts[i].SetCameraPos(camPos.x, camPos.y);
-                scoreTexts[i].Update(0.0f);
-            }
-
-            // 버튼 3개 위치 세팅 (점수판 아래로 나란히)
-            btnRetry.SetPosition(camPos.x, camPos.y - 0.25f); btnRetry.SetCameraPos(camPos.x, camPos.y);
-            btnResultMain.SetPosition(camPos.x, camPos.y - 0.5f); btnResultMain.SetCameraPos(camPos.x, camPos.y);
-            btnResultExit.SetPosition(camPos.x, camPos.y - 0.75f); btnResultExit.SetCameraPos(camPos.x, camPos.y);
-
-            // 클릭 판정
-            if (btnRetry.UpdateButton(worldMouseX, worldMouseY, isMouseDown))
-            {
-                ResetGame();
-                currentState = GameState::WEAPON_SELECT; // 바로 무기 고르고 재시작
-                Sleep(200);
-            }
-            if (btnResultMain.UpdateButton(worldMouseX, worldMouseY, isMouseDown))
-            {
-                ResetGame();
-                currentState = GameState::TITLE; // 타이틀로
-                Sleep(200);
-            }
-            if (btnResultExit.UpdateButton(worldMouseX, worldMouseY, isMouseDown))
-            {
-                PostQuitMessage(0); // 종료
-            }
-
-            btnRetry.Update(0.0f); btnResultMain.Update(0.0f); btnResultExit.Update(0.0f);
-            }
-    }
+        // 다음 프레임 칸으로 넘어감 (그 칸의 예전 프레임을 GPU가 아직 그리고 있을 때만 기다림)
+        // 메모리 초기화 : CPU가 새로운 명령을 적기 위해 그 칸의 Allocator와 List를 싹 지움
+        FrameContext& frame = frameContexts.BeginFrame(uploadHeap);
+        commandList->Reset(frame.commandAllocator.Get(), nullptr);
 
-    // 매 프레임 화면을 그리는 함수
-    void Render()
-    {
-        // 메모리 초기화 : CPU가 새로운 명령을 적기 위해 Allocator와 List를 싹 지움
-        commandAllocator->Reset();
-        commandList->Reset(commandAllocator.Get(), nullptr);
+        // 이번에 그릴 도화지 번호 (스왑 체인이 돌려주는 순서대로)
+        frameIndex = swapChain->GetCurrentBackBufferIndex();
 
         // Resource Barrier (상태 변화: 출력용 -> 그리기용)
         D3D12_RESOURCE_BARRIER barrier = {};
@@ -1802,8 +301,7 @@ public:
         // 화면 칠하기 (파란색)
         D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = rtvHeap->GetCPUDescriptorHandleForHeapStart();
         rtvHandle.ptr += frameIndex * rtvDescriptorSize;
-        const float clearColor[] = { 0.1f, 0.1f, 0.3f, 1.0f };
-        commandList->ClearRenderTargetView(rtvHandle, clearColor, 0, nullptr);
+        commandList->ClearRenderTargetView(rtvHandle, snapshot.clearColor, 0, nullptr);
 
         // Output Merger 및 파이프라인 세팅
         commandList->OMSetRenderTargets(1, &rtvHandle, FALSE, nullptr);
@@ -1816,144 +314,8 @@ public:
         commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
         commandList->IASetVertexBuffers(0, 1, &vertexBufferView);
 
-        if (currentState == GameState::TITLE)
-        {
-            // 타이틀 씬일 때는 오직 타이틀 전용 객체들만 렌더링
-            titleBg.Render(commandList.Get());
-            titleText.Render(commandList.Get());
-            btnStart.Render(commandList.Get());
-            btnSetting.Render(commandList.Get());
-            btnExit.Render(commandList.Get());
-        }
-        else
-        {
-            // 타이틀 화면이 아닐 때만 (무기 선택, 플레이, 일시정지 등) 인게임 세계를 렌더링
-
-            // [Layer 1] 배경 맵 (가장 밑바닥)
-            background.Render(commandList.Get());
-
-            // [Layer 2] 경험치 젬
-            for (int i = 0; i < MAX_GEMS; i++)
-            {
-                if (!gems[i].isDead) 
-                {
-                    gems[i].Render(commandList.Get());
-                }
-            }
-
-            // [Layer 3] 전기 오라 이펙트 (플레이 상태이고 오라가 활성화된 경우만)
-            if (currentState == GameState::PLAY && selectedWeapon == 2 && isAuraActive)
-            {
-                auraEffect.Render(commandList.Get());
-            }
-
-            // [Layer 4] 살아있는 적군들
-            for (int i = 0; i < ENEMY_COUNT; i++)
-            {
-                if (!enemies[i].isDead) 
-                {
-                    enemies[i].Render(commandList.Get());
-                }
-            }
-
-            // [Layer 5] 플레이어
-            player.Render(commandList.Get());
-
-            // [Layer 6] 날아다니는 미사일
-            for (int i = 0; i < MAX_BULLETS; i++)
-            {
-                if (!bullets[i].isDead) 
-                {
-                    bullets[i].Render(commandList.Get());
-                }
-            }
-
-            // [Layer 7] 타격 이펙트
-            for (int i = 0; i < MAX_EFFECTS; i++)
-            {
-                if (!meleeEffects[i].isDead) 
-                {
-                    meleeEffects[i].Render(commandList.Get());
-                }
-                if (!hitEffects[i].isDead) 
-                {
-                    hitEffects[i].Render(commandList.Get());
-                }
-            }
-
-            // [Layer 8] 공통 인게임 UI (체력바, 경험치바, 레벨, 타이머)
-            hpBarBg.Render(commandList.Get());
-            hpBarFill.Render(commandList.Get());
-
-            for (int i = 0; i < MAX_DMG_TEXTS; i++)
-            {
-                if (!dmgTexts[i].isDead) 
-                {
-                    dmgTexts[i].Render(commandList.Get());
-                }
-            }
-
-            expBarBg.Render(commandList.Get());
-            expBarFill.Render(commandList.Get());
-
-            levelBg.Render(commandList.Get());
-
-            for (int i = 0; i < 2; i++)
-            {
-                levelTexts[i].Render(commandList.Get());
-            }
-            for (int i = 0; i < 4; i++) 
-            {
-                timerTexts[i].Render(commandList.Get());
-            }
-            for (int i = 0; i < 2; i++) 
-            {
-                timerColonBg[i].Render(commandList.Get());
-                timerColon[i].Render(commandList.Get());
-            }
-
-            // [Layer 9] 상태별 오버레이 (무기 선택 카드 또는 일시정지 팝업)
-            if (currentState == GameState::WEAPON_SELECT)
-            {
-                for (int i = 0; i < 3; i++) 
-                {
-                    weaponCards[i].Render(commandList.Get());
-                    weaponIcons[i].Render(commandList.Get());
-                }
-            }  
-            else if (currentState == GameState::PAUSE)
-            {
-                pauseBg.Render(commandList.Get());
-                btnPauseMain.Render(commandList.Get());
-                btnPauseSetting.Render(commandList.Get());
-                btnPauseExit.Render(commandList.Get());
-            }
-            else if (currentState == GameState::LEVEL_UP)
-            {
-                levelUpBg.Render(commandList.Get());
-                for (int i = 0; i < 3; i++)
-                {
-                    upgradeCards[i].Render(commandList.Get());
-                }
-            }
-            else if (currentState == GameState::GAME_OVER || currentState == GameState::CLEAR)
-            {
-                if (currentState == GameState::GAME_OVER) gameOverUI.Render(commandList.Get());
-                else clearUI.Render(commandList.Get());
-
-                // 점수와 숫자 출력
-                scoreBg.Render(commandList.Get());
-                for (int i = 0; i < 6; i++)
-                {
-                    scoreTexts[i].Render(commandList.Get());
-                }
-
-                // 버튼들 출력
-                btnRetry.Render(commandList.Get());
-                btnResultMain.Render(commandList.Get());
-                btnResultExit.Render(commandList.Get());
-            }
-        }
+        // 스냅샷의 명령은 레이어 순서로 합쳐져 있으므로 업로드 버퍼에 이어 붙여서 한 번에 그림
+        spriteRenderer.Flush(commandList.Get(), uploadHeap, snapshot.merged, descriptors);
 
         // Resource Barrier 복구 (그리기용 -> 출력용)
         barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
@@ -1965,29 +327,19 @@ public:
         ID3D12CommandList* ppCommandLists[] = { commandList.Get() };
         commandQueue->ExecuteCommandLists(_countof(ppCommandLists), ppCommandLists);
 
-        // 스왑 체인 교체 & 동기화
+        // 스왑 체인 교체
         swapChain->Present(1, 0);
-        WaitForGPU();
+
+        // GPU가 다 그릴 때까지 기다리지 않고 펜스 번호만 남김 (이번 프레임 업로드 조각도 그 번호가 끝나면 반납)
+        frameContexts.EndFrame(uploadHeap);
     }
 
     // CPU가 GPU의 작업 완료를 기다리는 함수
-    void WaitForGPU()
+    // (시작할 때 텍스처 업로드 뒤, 종료 전에만 씀, 매 프레임은 frameContexts가 필요할 때만 기다림)
+    void WaitForIdle() override
     {
-        // 큐의 마지막에 fenceValue를 Fence에 적도록 하는 명령을 삽입
-        const UINT64 currentFenceValue = fenceValue;
-        commandQueue->Signal(fence.Get(), currentFenceValue);
-        fenceValue++;
-
-        // 만약 GPU가 아직 그 번호를 Fence에 안 적었다면? (아직 작업 중이라면?)
-        if (fence->GetCompletedValue() < currentFenceValue)
-        {
-            // Event를 설정하고 GPU가 번호를 적을 때까지 CPU를 Wait 시킴
-            fence->SetEventOnCompletion(currentFenceValue, fenceEvent);
-            WaitForSingleObject(fenceEvent, INFINITE);
-        }
-
-        // GPU가 다 그렸으니 이제 다음 프레임에 쓸 도화지 번호 (0 또는 1)를 가져옴
-        frameIndex = swapChain->GetCurrentBackBufferIndex();
+        // 큐의 마지막에 펜스 번호를 적도록 하는 명령을 넣고 GPU가 그 번호를 적을 때까지 CPU를 Wait 시킴
+        frameContexts.WaitForIdle();
     }
 
     void CreateVertexBuffer()
@@ -2054,79 +406,52 @@ public:
 // 프로그램 시작점인 메인 함수
 int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR pCmdLine, int nCmdShow)
 {
-	// 윈도우 클래스 설정 및 등록
-	// 창의 기본적인 속성 (아이콘, 커서, 이름 등)을 정의하는 구조체
-	WNDCLASSEXW wcex = { 0 };
-	wcex.cbSize = sizeof(WNDCLASSEXW);
-	wcex.style = CS_HREDRAW | CS_VREDRAW;
-
-	// 윈도우 메시지 (클릭, 종료 등)를 처리하는 콜백 함수
-	// 외부 함수를 만들지 않고 메인 함수 내부에서 람다(Lambda)로 처리
-    wcex.lpfnWndProc = [](HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam) -> LRESULT WINAPI
-    {
-        // 창 닫기 버튼을 눌렀을 때의 처리
-        if (message == WM_DESTROY)
-        {
-            PostQuitMessage(0);
-            return 0;
-        }
-        // 그 외의 메시지는 윈도우 기본 처리에 맡김
-        return DefWindowProcW(hWnd, message, wParam, lParam);
-    };
-
-    wcex.hInstance = hInstance;
-    wcex.hCursor = LoadCursor(nullptr, IDC_ARROW);
-    wcex.lpszClassName = L"DX12PortfolioClass"; // 이 창의 고유한 클래스 이름
-
-    // 설정한 정보를 운영체제에 등록
-    RegisterClassExW(&wcex);
-
-    // 윈도우 창 생성
-    // 등록한 클래스 이름을 바탕으로 실제 화면에 띄울 창 객체를 만듦
-    HWND hWnd = CreateWindowExW(
-        0,
-        L"DX12PortfolioClass",          // 등록했던 클래스 이름
-        L"Survivors",                   // 창 상단에 뜰 제목
-        WS_OVERLAPPEDWINDOW,            // 일반적인 창 스타일 (최소화, 최대화, 닫기 버튼 포함)
-        CW_USEDEFAULT, CW_USEDEFAULT,   // 창의 X, Y 시작 위치
-        1280, 720,                      // 창의 가로, 세로 크기
-        nullptr, nullptr, hInstance, nullptr
-    );
-
-    // 창 생성에 실패하면 프로그램 종료
-    if (!hWnd)
+    // 윈도우 창 생성 (실패하면 프로그램 종료)
+    Win32Window window;
+    if (!window.Create(hInstance, nCmdShow, L"Survivors", 1280, 720))
     {
         return 0;
     }
 
-    // 윈도우 창을 화면에 표시
-    ShowWindow(hWnd, nCmdShow);
-    UpdateWindow(hWnd);
+    Win32Input input;
+    input.Initialize(window.GetHandle());
+    Win32Timer timer;
+
+    // Tools/AssetPacker로 만든 에셋 팩이 있으면 PNG / WAV를 푸는 대신 팩을 메모리 맵으로 열어서 씀 (없으면 원래대로 파일을 읽음)
+    g_AssetPack.Open("Assets/assets.pack");
+
+    // 사운드 시스템 / DX12 초기화 (게임 객체 전체가 크므로 스택 대신 static)
+    static SoundManager audio;
+    audio.Initialize(&g_AssetPack);
+    static D3D12Renderer renderer;
+    renderer.Initialize(window.GetHandle(), 1280, 720, &g_AssetPack);
 
-    // 게임 루프 시작 전에 초기화를 한 번만 실행!
-    D3D12Manager d3dManager;
-    d3dManager.Initialize(hWnd, 1280, 720);
+    Platform platform;
+    platform.window = &window;
+    platform.input = &input;
+    platform.timer = &timer;
+    platform.audio = &audio;
+    platform.renderer = &renderer;
+
+    // 게임 루프 시작 전에 초기화를 한 번만 실행! (시드는 켤 때마다 다르게)
+    static Game game;
+    game.Initialize(platform, GetTickCount());
+
+    // 시뮬레이션 (Update)은 따로 스레드에서 돌고 메인 스레드는 메시지와 그리기만 함
+    game.StartSimulation();
 
     // 메시지 루프 (게임 루프)
-    // 프로그램이 종료될 때까지 계속해서 도는 무한 루프
-    MSG msg = { 0 };
-    while (msg.message != WM_QUIT)
+    // 쌓인 메시지를 처리하고 나면 시뮬레이션 스레드가 가장 최근에 만든 스냅샷을 그리기
+    while (window.PumpMessages())
     {
-        // PeekMessage는 메시지가 없어도 프로그램이 멈추지 않고 바로 다음 코드로 넘어가게 해줌
-        // 메시지가 없을 때 (else 문) 게임의 랜더링을 계속 수행 가능
-        if (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
-        {
-            TranslateMessage(&msg);
-            DispatchMessage(&msg);
-        }
-        else
-        {
-            // Update로 위치 계산하고 Render로 그리기
-            d3dManager.Update();
-            d3dManager.Render();
-        }
+        renderer.Render(game.AcquireSnapshot());
+        if (game.IsQuitRequested()) window.RequestClose();
     }
 
+    // 시뮬레이션 스레드를 먼저 세우고, GPU가 아직 그리고 있는 프레임이 있을 수 있으므로 다 끝낸 뒤에 자원을 내림
+    game.StopSimulation();
+    renderer.WaitForIdle();
+
     // 프로그램 정상 종료
-    return (int)msg.wParam;
-}
\ No newline at end of file
+    return window.GetExitCode();
+}
@@ -0,0 +1,187 @@
+﻿#pragma once
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include "SeekKernel.h"
+#include "../Utils/Handle.h"
+
+// 적 타입별 기본 능력치와 외형 (0 : 노멀, 1 : 스피드, 2 : 탱커, 3 ~ 5 : 중간 보스, 6 : 최종 보스)
+struct EnemyTypeInfo
+{
+	float maxHp;
+	float speed;
+	float scaleX, scaleY;
+	float tintR, tintG, tintB;
+};
+
+inline const EnemyTypeInfo& GetEnemyTypeInfo(int type)
+{
+	static const EnemyTypeInfo types[] =
+	{
+		{ 15.0f, 0.25f, 0.45f, 0.6f, 1.0f, 1.0f, 1.0f },	// 기본 적
+		{  5.0f, 0.35f, 0.45f, 0.6f, 1.0f, 1.0f, 1.0f },	// 스피드 형 적
+		{ 20.0f, 0.1f,  0.45f, 0.6f, 1.0f, 1.0f, 1.0f },	// 탱커 형 괴물
+		{ 25.0f, 0.2f,  0.9f,  1.2f, 1.0f, 0.8f, 0.2f },	// 1분 보스 (Boss1.png), 황금색
+		{ 30.0f, 0.22f, 0.9f,  1.2f, 1.0f, 0.8f, 0.2f },	// 2분 보스 (Boss2.png)
+		{ 40.0f, 0.25f, 0.9f,  1.2f, 1.0f, 0.8f, 0.2f },	// 3분 보스 (Boss3.png)
+		{ 50.0f, 0.3f,  1.5f,  1.8f, 1.0f, 0.2f, 0.2f },	// 4분 30초 최종 보스 (Boss4.png), 붉은색 필터
+	};
+
+	return types[type];
+}
+
+// 적 데이터를 구조체 배열 (SoA)로 보관하는 풀
+// 이동 / 데미지 / 밀어내기처럼 매 틱 모든 적을 훑는 루프는 위치, 체력, 속도, 생존 여부만 읽기 때문에
+// 이 값들만 연속된 배열에 모아두면 캐시 라인 하나에 적 16마리 분량이 들어감
+// (렌더링용 ComPtr, 애니메이션, UV 같은 값은 Enemy 오브젝트 쪽에 그대로 남음)
+class EnemyPool
+{
+public:
+	// SIMD 한 번에 처리할 수 있도록 배열 길이를 이 값의 배수로 맞춤 (남는 칸은 항상 죽은 상태)
+	static const int LANE_PADDING = 8;
+
+	// Hot 데이터 : 매 틱 읽고 쓰는 값 (각 배열은 64바이트 경계에 정렬)
+	float* x = nullptr;
+	float* y = nullptr;
+	float* hp = nullptr;
+	float* speed = nullptr;
+	uint8_t* alive = nullptr;		// 1 : 살아있음, 0 : 창고 대기
+
+	// Cold 데이터 : 스폰 / 사망 처리 때만 읽는 값
+	float* maxHp = nullptr;
+	int* type = nullptr;
+	uint32_t* generation = nullptr;	// 스폰할 때마다 증가 (죽었다 다시 살아난 적을 예전 핸들이 가리키지 않도록)
+
+	// 직전 틱의 위치 (렌더링 보간 전용, 시뮬레이션은 읽지 않음)
+	float* prevX = nullptr;
+	float* prevY = nullptr;
+
+private:
+	void* block = nullptr;		// 위 배열 전부를 담는 메모리 한 덩어리
+	int capacity = 0;
+	int paddedCapacity = 0;
+
+	static size_t AlignUp(size_t v) { return (v + 63) & ~(size_t)63; }
+
+public:
+	EnemyPool() = default;
+	EnemyPool(const EnemyPool&) = delete;
+	EnemyPool& operator=(const EnemyPool&) = delete;
+	~EnemyPool() { free(block); }
+
+	// count 마리 분량의 배열을 한 번에 할당하고 전부 죽은 상태로 초기화
+	void Initialize(int count)
+	{
+		free(block);
+
+		capacity = count;
+		paddedCapacity = (count + LANE_PADDING - 1) / LANE_PADDING * LANE_PADDING;
+
+		size_t floatBytes = AlignUp(sizeof(float) * paddedCapacity);
+		size_t intBytes = AlignUp(sizeof(int) * paddedCapacity);
+		size_t byteBytes = AlignUp(sizeof(uint8_t) * paddedCapacity);
+		size_t total = floatBytes * 7 + intBytes * 2 + byteBytes;
+
+		// 정렬 여유분 64바이트를 더 받아서 시작 주소를 직접 맞춤
+		block = malloc(total + 64);
+		memset(block, 0, total + 64);
+		uint8_t* cursor = (uint8_t*)(((uintptr_t)block + 63) & ~(uintptr_t)63);
+
+		x = (float*)cursor;       cursor += floatBytes;
+		y = (float*)cursor;       cursor += floatBytes;
+		hp = (float*)cursor;      cursor += floatBytes;
+		speed = (float*)cursor;   cursor += floatBytes;
+		maxHp = (float*)cursor;   cursor += floatBytes;
+		prevX = (float*)cursor;   cursor += floatBytes;
+		prevY = (float*)cursor;   cursor += floatBytes;
+		type = (int*)cursor;      cursor += intBytes;
+		generation = (uint32_t*)cursor; cursor += intBytes;
+		alive = (uint8_t*)cursor;
+	}
+
+	int GetCapacity() const { return capacity; }
+	int GetPaddedCapacity() const { return paddedCapacity; }
+
+	// 창고에서 꺼내서 타입에 맞는 능력치로 부활 (시간이 지날수록 hpBonus 만큼 체력 증가)
+	void Spawn(int i, float spawnX, float spawnY, float hpBonus)
+	{
+		const EnemyTypeInfo& info = GetEnemyTypeInfo(type[i]);
+
+		x[i] = spawnX;
+		y[i] = spawnY;
+		prevX[i] = spawnX;	// 스폰 자리에서 보간을 시작 (예전 자리에서 끌려오지 않게)
+		prevY[i] = spawnY;
+		speed[i] = info.speed;
+		maxHp[i] = info.maxHp + hpBonus;
+		hp[i] = maxHp[i];
+		alive[i] = 1;
+		generation[i]++;
+	}
+
+	// 살아있는 i번 적의 핸들
+	EntityHandle GetHandle(int i) const
+	{
+		EntityHandle handle;
+		handle.index = i;
+		handle.generation = generation[i];
+		return handle;
+	}
+
+	// 핸들이 가리키던 적이 아직 살아있으면 칸 번호, 죽었거나 다시 스폰됐으면 -1
+	int Resolve(EntityHandle handle) const
+	{
+		if (handle.index < 0 || handle.index >= capacity) return -1;
+		if (!alive[handle.index] || generation[handle.index] != handle.generation) return -1;
+		return handle.index;
+	}
+
+	void Kill(int i) { alive[i] = 0; }
+
+	void KillAll() { memset(alive, 0, paddedCapacity); }
+
+	// 데미지를 주고 이번 공격으로 죽었으면 true 반환 (이미 죽은 적은 무시)
+	bool ApplyDamage(int i, float damage)
+	{
+		if (!alive[i]) return false;
+
+		hp[i] -= damage;
+		if (hp[i] <= 0.0f)
+		{
+			alive[i] = 0;
+			return true;
+		}
+		return false;
+	}
+
+	// startIndex부터 한 바퀴 돌면서 targetType의 죽은 칸을 찾음 (없으면 -1)
+	int FindDead(int targetType, int startIndex) const
+	{
+		for (int n = 0; n < capacity; n++)
+		{
+			int i = (startIndex + n) % capacity;
+			if (!alive[i] && type[i] == targetType) return i;
+		}
+		return -1;
+	}
+
+	// 틱을 시작하기 전에 현재 위치를 직전 위치로 저장
+	void StorePrevPositions()
+	{
+		memcpy(prevX, x, sizeof(float) * paddedCapacity);
+		memcpy(prevY, y, sizeof(float) * paddedCapacity);
+	}
+
+	// 모든 적이 목표 위치를 향해 돌격 (CPU에 맞는 SIMD 배치 커널로 한 번에 처리)
+	void MoveTowards(float targetX, float targetY, float dt)
+	{
+		SeekBatch(x, y, speed, alive, paddedCapacity, targetX, targetY, dt);
+	}
+
+	// [begin, end) 칸만 이동 (여러 스레드가 범위를 나눠 처리할 때 사용)
+	// SIMD 정렬을 위해 begin은 LANE_PADDING의 배수, end는 LANE_PADDING의 배수이거나 GetPaddedCapacity()여야 함
+	void MoveTowardsRange(int begin, int end, float targetX, float targetY, float dt)
+	{
+		SeekBatch(x + begin, y + begin, speed + begin, alive + begin, end - begin, targetX, targetY, dt);
+	}
+};
@@ -1,43 +1,31 @@
 #pragma once
-#include <d3d12.h>
-#include <wrl.h>
-#include <DirectXMath.h>
-#include "../Utils/d3dx12.h"
-#include "../Utils/Utils.h"			// Input Manager 
-#include "../Utils/stb_image.h"		// ̹ ε
-#include "../Utils/SoundManager.h"	//  Ŵ
+#include "../Utils/MathTypes.h"
+#include "../Platform/Platform.h"		// ؽó /  ÷ ̽
+#include "EnemyPool.h"				//  ɷġ ̺
+#include "../Render/RenderCommandStream.h"	// Ʈ νϽ /  Ʈ
 
-SoundManager g_SoundMgr;
-
-using namespace Microsoft::WRL;
-using namespace DirectX;
-
-// C++ HLSL   ԰ ߱  ü
-struct CBData
-{
-	XMMATRIX worldMatrix;
-	XMFLOAT4 uvOffsetScale;	// x: Offset X, y: Offset Y, z: Scale X, w: Scale Y	
-	XMFLOAT4 tintColor;		// R, G, B, A  
-	float objectType;		// objectType Bullet, ü¹  
-	float padding[3];
-};
+AssetPack g_AssetPack;			// ̸ Ǯ ؽó /  ( PNG / WAV   ,  /    ߿ )
+IAudio* g_Audio = nullptr;		// ȿ (Game::Initialize ÷  ä)
+IRenderer* g_Renderer = nullptr;	// θ ؽó ϳ (ü ڵ鸸  )
 
 // Object ֻ θ Ŭ
 class GameObject
 {
 	// ڽ Ŭ (Player, Monster )   ֵ protected 
 protected:
-	XMFLOAT3 position = { 0.0f, 0.0f, 0.0f };
-	XMFLOAT3 scale = { 0.1f, 0.1f, 0.1f };
-
-	// ü  ڽŸ   (޸) 
-	ComPtr<ID3D12Resource> constantBuffer;
-	UINT8* cbvDataBegin = nullptr;
+	Float3 position = { 0.0f, 0.0f, 0.0f };
+	Float3 scale = { 0.1f, 0.1f, 0.1f };
 
 	// ؽó  
-	ComPtr<ID3D12Resource> texture;
-	ComPtr<ID3D12Resource> textureUploadHeap;
-	ComPtr<ID3D12DescriptorHeap> srvHeap;		//  ؽó 
+	TextureHandle textureHandle;				// g_Renderer ؽó ڵ (ü  ϳ)
+	int textureId = 0;							// ̴ д ؽó ȣ (0 : ؽó )
+	Float2 textureUvScale = { 1.0f, 1.0f };	// ؽó ȿ ׸ ϴ  (   Ʈ 1 )
+	const AssetPackFrame* textureFrames = nullptr;	//  Ʋ Ʈ Ӹ uv / ߶ 簢
+	int textureFrameCount = 0;
+	int texturePaletteRow = -1;					//  8Ʈ ȷƮ ؽó ȷƮ ؽó  ȣ
+
+	//   ׸  (Render  ġ )
+	SpriteInstance instance = {};
 
 	// ִϸ̼   ߰
 	int currentFrame = 0;
@@ -48,14 +36,14 @@ protected:
 	//   ϴ boolean
 	bool isFlipped = false;
 
-	// ⺻ Ͼ (  )
-	XMFLOAT4 tintColor = { 1.0f, 1.0f, 1.0f, 1.0f };
+	// ⺻ Ͼ (  ), ٲ    RGBA8 ص
+	uint32_t tintColor = 0xFFFFFFFF;
 	int objectType = 0; // ⺻  ؽó  (0)
 
 	// ī޶ UV ũ 
-	XMFLOAT2 cameraPos = { 0.0f, 0.0f };	// ī޶ ġ
-	XMFLOAT2 uvScroll = { 0.0f, 0.0f }; // ׸ӽó ؽó  ġ
-	XMFLOAT2 uvScale = { 1.0f, 1.0f };	// ؽó Ÿϸ(ݺ) 
+	Float2 cameraPos = { 0.0f, 0.0f };	// ī޶ ġ
+	Float2 uvScroll = { 0.0f, 0.0f }; // ׸ӽó ؽó  ġ
+	Float2 uvScale = { 1.0f, 1.0f };	// ؽó Ÿϸ(ݺ) 
 
 public:
 	// ۿ Ÿ   ִ Լ ߰
@@ -73,92 +61,26 @@ public:
 	// ܺο  ü  Ȯ  ְ ִ Լ
 	bool GetIsFlipped() const { return isFlipped; }
 
-	// ü   GPU ڽŸ ޸ ( ) Ҵ
-	virtual void Initialize(ID3D12Device* device)
+	//  ؽó ٲ ( ڵ  ϳ  · ް,  ڵ ݳ)
+	void SetTexture(TextureHandle handle)
 	{
-		//   (Constant Buffer) 
-		// DX12 Ģ :   ũ  256   / CBData ũ ŭ 256 ؼ Ҵ
-		UINT cbSize = (sizeof(XMMATRIX) + 255) & ~255;
-		CD3DX12_HEAP_PROPERTIES cbHeapProps(D3D12_HEAP_TYPE_UPLOAD);	// CPU   ġ  ϹǷ Upload Heap
-		CD3DX12_RESOURCE_DESC cbDesc = CD3DX12_RESOURCE_DESC::Buffer(cbSize);
-
-		device->CreateCommittedResource(
-			&cbHeapProps, D3D12_HEAP_FLAG_NONE, &cbDesc,
-			D3D12_RESOURCE_STATE_GENERIC_READ, nullptr,
-			IID_PPV_ARGS(&constantBuffer));
-
-		// CPU ͸   ֵ Map ص (     )
-		constantBuffer->Map(0, nullptr, reinterpret_cast<void**>(&cbvDataBegin));
+		if (!textureHandle.IsNull()) g_Renderer->ReleaseTexture(textureHandle);
+		textureHandle = handle;
+
+		TextureInfo info = g_Renderer->GetTextureInfo(handle);
+		textureId = info.descriptor;
+		textureUvScale = { info.uvScale[0], info.uvScale[1] };
+		textureFrames = info.frames;
+		textureFrameCount = info.frameCount;
+		texturePaletteRow = info.paletteRow;
 	}
 
-	// ̹  о GPU ѱ DX12  ڵ
-	void LoadTexture(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList, const char* filename, int frames)
+	// ̹  ؽó  (  ̹  ҷ ٽ  ʰ ĳÿ  ؽó )
+	//  g_Renderer->FinishTextureLoads  ٸ ϵ  ,  ȣ  
+	void LoadTexture(const char* filename, int frames)
 	{
 		maxFrames = frames;
-
-		// stb_image PC ̹  б
-		int texWidth, texHeight, texChannels;
-		unsigned char* image = stbi_load(filename, &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
-
-		if (image == nullptr)
-		{
-			MessageBoxA(nullptr, filename, "Texture Load Failed! Check File Path/Name", MB_OK);
-			return;
-		}
-
-		// ̹ DX12 Ѱġ(16384) Ѵ ˻
-		if (texWidth > 16384 || texHeight > 16384)
-		{
-			MessageBoxA(nullptr, "2. ̹ ʹ Ůϴ! (μ 16384 ȼ  ʰ)", "DX12 ϵ Ѱ ʰ", MB_OK);
-			stbi_image_free(image);
-			return;
-		}
-
-		// GPU ޸𸮿 Texture 
-		CD3DX12_RESOURCE_DESC texDesc = CD3DX12_RESOURCE_DESC::Tex2D(DXGI_FORMAT_R8G8B8A8_UNORM, texWidth, texHeight);
-		CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_DEFAULT);
-
-		// GPU ȭ ¥   (HRESULT) ˻!
-		HRESULT hr = device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &texDesc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&texture));
-		if (FAILED(hr) || texture == nullptr)
-		{
-			MessageBoxA(nullptr, "3. GPU ޸𸮿 ؽó  !", "GPU ", MB_OK);
-			stbi_image_free(image);
-			return;
-		}
-
-		//  Upload Heap 
-		const UINT64 uploadBufferSize = GetRequiredIntermediateSize(texture.Get(), 0, 1);
-		CD3DX12_HEAP_PROPERTIES uploadHeapProps(D3D12_HEAP_TYPE_UPLOAD);
-		CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(uploadBufferSize);
-		device->CreateCommittedResource(&uploadHeapProps, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&textureUploadHeap));
-
-		// Upload Heap  ư GPU ȭ   
-		D3D12_SUBRESOURCE_DATA texData = {};
-		texData.pData = image;
-		texData.RowPitch = texWidth * 4;
-		texData.SlicePitch = texData.RowPitch * texHeight;
-		UpdateSubresources(cmdList, texture.Get(), textureUploadHeap.Get(), 0, 0, 1, &texData);
-
-		// 簡  ȭ б  (SRV)  ȯ
-		CD3DX12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(texture.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-		cmdList->ResourceBarrier(1, &barrier);
-
-		stbi_image_free(image);	// ޸ û
-
-		// ؽó   ִ SRV  
-		D3D12_DESCRIPTOR_HEAP_DESC srvHeapDesc = {};
-		srvHeapDesc.NumDescriptors = 1;
-		srvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-		srvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-		device->CreateDescriptorHeap(&srvHeapDesc, IID_PPV_ARGS(&srvHeap));
-
-		D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-		srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-		srvDesc.Format = texDesc.Format;
-		srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-		srvDesc.Texture2D.MipLevels = 1;
-		device->CreateShaderResourceView(texture.Get(), &srvDesc, srvHeap->GetCPUDescriptorHandleForHeapStart());
+		SetTexture(g_Renderer->AcquireTexture(filename));
 	}
 
 	// ۿ Flip   ִ Լ
@@ -167,19 +89,19 @@ public:
 	// ۿ   ٲ  ִ Լ
 	void SetTintColor(float r, float g, float b, float a = 1.0f)
 	{
-		tintColor = { r, g, b, a };
+		tintColor = PackTint(r, g, b, a);
 	}
 
 	// ޸   ؽó  Լ
 	void ShareTextureFrom(const GameObject& other)
 	{
-		// ̰ LoadTexture ٽ  ʰ ̹ ε ؽó (srvHeap) ּҸ Ȱ Ŵ
-		this->texture = other.texture;
-		this->srvHeap = other.srvHeap;
+		// ̰ LoadTexture ٽ  ʰ ̹ ε ؽó ڵ鸸 ϳ  
+		g_Renderer->AddRefTexture(other.textureHandle);
+		SetTexture(other.textureHandle);
 		this->maxFrames = other.maxFrames;
 	}
 
-	//   ڽ ġ ķ ȯ GPU 
+	//   ִϸ̼ ѱ ׸ ͸ 
 	virtual void Update(float dt)
 	{
 		// Ÿ̸Ӹ   ѱ (ִϸ̼ ȱ )
@@ -190,322 +112,70 @@ public:
 			frameTime = 0.0f;
 		}
 
-		// isFlipped true  ũ⸦ (-) 
-		float realScaleX = isFlipped ? -scale.x : scale.x;
-
-		//   (ũ İ ̵ )  ؼ    ϼ ( ũ > ȸ > ̵  ؾ )
-		// ¥  ġ ī޶ ġ   
-		XMMATRIX worldMatrix = XMMatrixScaling(realScaleX, scale.y, scale.z) * XMMatrixTranslation(position.x - cameraPos.x, position.y - cameraPos.y, position.z);
+		WriteConstants(position, cameraPos);
+	}
 
-		// HLSL(̴)    (Column)  ϱ    (Transpose) Ѱܾ 
-		CBData cbData;
-		cbData.worldMatrix = XMMatrixTranspose(worldMatrix);
+	// ־ ġ ī޶  ġ, ũ, UV νϽ  (  ʰ  ̴ 簢 ħ)
+	void WriteConstants(const Float3& drawPos, const Float2& drawCam)
+	{
+		// Ʋ Ʈ :  ǥ uv , 簢 ߶ ׸ ũ ٿ    ڸ ű
+		// (簢 ߽ ġ̹Ƿ ׸  ӿ ִ ڸŭ ߽ о ߹ / ǹ ״ )
+		if (textureFrames != nullptr && textureFrameCount == maxFrames && currentFrame < textureFrameCount)
+		{
+			const AssetPackFrame& frame = textureFrames[currentFrame];
+			float uvRect[4] = { frame.uvRect[0] + uvScroll.x, frame.uvRect[1] + uvScroll.y, frame.uvRect[2] * uvScale.x, frame.uvRect[3] * uvScale.y };
+			float offsetX = (frame.quadRect[0] + frame.quadRect[2] * 0.5f - 0.5f) * scale.x;
+			float offsetY = (frame.quadRect[1] + frame.quadRect[3] * 0.5f - 0.5f) * scale.y;	// ؽó v Ʒ, ȭ y 
+			if (isFlipped) offsetX = -offsetX;
+
+			PackSprite(instance, drawPos.x - drawCam.x + offsetX, drawPos.y - drawCam.y - offsetY, scale.x * frame.quadRect[2], scale.y * frame.quadRect[3],
+				isFlipped, uvRect, tintColor, objectType);
+			instance.typeFlags |= PackPaletteRow(texturePaletteRow);
+			return;
+		}
 
 		// ü ̹    ڸ UV 
 		float frameWidth = 1.0f / maxFrames;							//    
-		cbData.uvOffsetScale.z = frameWidth * uvScale.x;
-		cbData.uvOffsetScale.w = 1.0f * uvScale.y;
 
 		// ⺻ ִϸ̼ ̵ +  ؽó ũ (uvScroll) ġ
-		cbData.uvOffsetScale.x = (currentFrame * frameWidth) + uvScroll.x;
-		cbData.uvOffsetScale.y = uvScroll.y;
+		float uvRect[4] = { (currentFrame * frameWidth) + uvScroll.x, uvScroll.y, frameWidth * uvScale.x * textureUvScale.x, 1.0f * uvScale.y * textureUvScale.y };
 
-		//    GPU  ѱ
-		cbData.tintColor = tintColor;
-		// objectType Ÿ  
-		cbData.objectType = (float)objectType;
-
-		// MAP ص GPU ޸𸮿 ϼ  ͸  (  ̴ Ͱ Ѿ)
-		memcpy(cbvDataBegin, &cbData, sizeof(CBData));
+		// ¥  ġ ī޶ ġ    (isFlipped ̴ θ )
+		// ϼ ʹ Render  ġ ְ, ġ   GPU ø
+		PackSprite(instance, drawPos.x - drawCam.x, drawPos.y - drawCam.y, scale.x, scale.y, isFlipped, uvRect, tintColor, objectType);
+		instance.typeFlags |= PackPaletteRow(texturePaletteRow);
 	}
 
-	// θ ȭ鿡 ׸ 
-	virtual void Render(ID3D12GraphicsCommandList* commandList)
+	// θ  Ʈ  ( ο  Ʈ ̾  ģ   )
+	virtual void Render(RenderCommandStream& stream, int layer)
 	{
-		// ڽ   (ġ / UV ) ο 
-		commandList->SetGraphicsRootConstantBufferView(0, constantBuffer->GetGPUVirtualAddress());
-
-		// ؽó  (SRV ) 
-		// srvHeap õ (ؽó ε) ü ؽó  
-		// ̹  ҷͼ srvHeap   ؽó 
-		if (srvHeap != nullptr)
-		{
-			ID3D12DescriptorHeap* descriptorHeaps[] = { srvHeap.Get() };
-			commandList->SetDescriptorHeaps(_countof(descriptorHeaps), descriptorHeaps);
-			commandList->SetGraphicsRootDescriptorTable(1, srvHeap->GetGPUDescriptorHandleForHeapStart());
-		}
-
-		// ü ׸
-		commandList->DrawInstanced(6, 1, 0, 0);
+		stream.Draw(layer, textureId, instance);
 	}
 
 	void SetPosition(float x, float y) { position.x = x; position.y = y; }
 
 	// ܺο  ġ   ְ ִ Լ
-	XMFLOAT3 GetPosition() const { return position; }
+	Float3 GetPosition() const { return position; }
 
 	// ũ⸦ ٲ  ִ Setter Լ ߰
 	void SetScale(float x, float y) { scale.x = x; scale.y = y; }
 };
 
-// GameObject ӹ  ÷̾ Ŭ
-class Player : public GameObject
-{
-public:
-	float basespeed = 0.5f;		//  ӵ
-	float currentSpeed = 0.5f;	//    ӵ
-
-	// ü 
-	float maxHp = 100.0f;
-	float hp = 100.0f;
-
-	//  ý 
-	int level = 1;
-	float exp = 0.0f;
-	float maxExp = 100.0f;	//  ġ   
-	float damageMultiplier = 1.0f; // ⺻ ݷ 100%
-
-	// ÷̾  Ʈ  (Ű Է)
-	void Update(float dt, InputManager& inputMgr)
-	{
-		if (inputMgr.IsKeyPressed('W') || inputMgr.IsKeyPressed(VK_UP))
-		{
-			position.y += currentSpeed * dt;
-		}
-
-		if (inputMgr.IsKeyPressed('S') || inputMgr.IsKeyPressed(VK_DOWN))
-		{
-			position.y -= currentSpeed * dt;
-		}
-		if (inputMgr.IsKeyPressed('A') || inputMgr.IsKeyPressed(VK_LEFT)) 
-		{
-			position.x -= currentSpeed * dt;
-			isFlipped = true;	//    
-		}
-		if (inputMgr.IsKeyPressed('D') || inputMgr.IsKeyPressed(VK_RIGHT)) 
-		{
-			position.x += currentSpeed * dt;
-			isFlipped = false;	//     
-		}
-
-		// θ Update ȣؼ  ġ GPU !
-		GameObject::Update(dt);
-	}
-};
-
 // ÷̾ Ѿư  Ŭ
+// ġ, ü, ӵó  ƽ ŵǴ  EnemyPool 迭  ְ
+//  ü Ǯ  ġ ޾ ׸⸸ 
 class Enemy : public GameObject
 {
 public:
-	// ÷̾(2.0f)  ¦  
-	float speed = 0.25f;
-
-	// ü    ߰
-	float maxHp = 30.0f;
-	float hp = 30.0f;
-	bool isDead = false;	// HP 0 Ǹ true ٲ
-
 	//  ؽó  ϴ Ÿ  (0 : , 1 : ǵ, 2 : Ŀ, 3 ~ 5 : ߰ , 6 :  )
 	int enemyType = 0;
 
-	// ܺο Ÿ  Թ޵ ʰ  ŸԿ °  
-	void InitStats()
+	//  ŸԿ ´ ũ    (ɷġ EnemyPool::Spawn )
+	void InitLook()
 	{
-		// â  Ȱ
-		isDead = false;
-
-		if (enemyType == 0)	// ⺻ 
-		{
-			maxHp = 15.0f; hp = 15.0f; speed = 0.25f;
-			SetScale(0.45f, 0.6f);
-			SetTintColor(1.0f, 1.0f, 1.0f);
-		}
-		else if (enemyType == 1) // ǵ  
-		{
-			maxHp = 5.0f; hp = 5.0f; speed = 0.35f;
-			SetScale(0.45f, 0.6f);
-			SetTintColor(1.0f, 1.0f, 1.0f);
-		}
-		else if (enemyType == 2) // Ŀ  
-		{
-			maxHp = 20.0f; hp = 20.0f; speed = 0.1f;
-			SetScale(0.45f, 0.6f);
-			SetTintColor(1.0f, 1.0f, 1.0f);
-		}
-		else if (enemyType == 3) // 5  (Boss1.png)
-		{
-			maxHp = 25.0f; hp = 25.0f; speed = 0.2f;
-			SetScale(0.9f, 1.2f);
-			SetTintColor(1.0f, 0.8f, 0.2f); // Ȳݻ
-		}
-		else if (enemyType == 4) // 10  (Boss2.png)
-		{
-			maxHp = 30.0f; hp = 30.0f; speed = 0.22f;
-			SetScale(0.9f, 1.2f);
-			SetTintColor(1.0f, 0.8f, 0.2f);
-		}
-		else if (enemyType == 5) // 15  (Boss3.png)
-		{
-			maxHp = 40.0f; hp = 40.0f; speed = 0.25f;
-			SetScale(0.9f, 1.2f);
-			SetTintColor(1.0f, 0.8f, 0.2f);
-		}
-		else if (enemyType == 6) //  19   (Boss4.png)
-		{
-			maxHp = 50.0f; hp = 50.0f; speed = 0.3f;
-			SetScale(1.5f, 1.8f);
-			SetTintColor(1.0f, 0.2f, 0.2f); //   
-		}
-	}
-
-	// Enemy Ʈ :   ÷̾ ġ (targetPos) ޾Ƽ  ̵
-	void Update(float dt, XMFLOAT3 targetPos)
-	{
-		//   ϱ (ǥ ġ -  ġ)
-		float dirX = targetPos.x - position.x;
-		float dirY = targetPos.y - position.y;
-
-		// Ÿ  ǥ   Ÿ ϱ (밢 )
-		float distance = sqrt((dirX * dirX) + (dirY * dirY));
-
-		// ȭ (Normalize)  ̵
-		// Ÿ 0 Ŭ   (0   )
-		if (distance > 0.0f)
-		{
-			//  Ÿ  ũⰡ  '1'   ȭǥ ( )
-			dirX /= distance;
-			dirY /= distance;
-
-			//   * ӵ * ð = Ȯ  ̵
-			position.x += dirX * speed * dt;
-			position.y += dirY * speed * dt;
-		}
-
-		// ʹ ÷̾ ġ  ġ ؼ 
-		if (targetPos.x < position.x)
-		{
-			isFlipped = true;  // ÷̾  ʿ   
-		}
-		else 
-		{
-			isFlipped = false; // ÷̾  ʿ   
-		}
-
-		// ̵ ġ GPU( ) 
-		GameObject::Update(dt);
-	}
-};
-
-// Bullet Ŭ
-class Bullet : public GameObject
-{
-public:
-	float speed = 1.5f;		// ̻ ӵ
-	float damage = 15.0f;	// ̻ 
-	bool isDead = true;		// ó Ȱȭ (߻ ) 
-
-	float lifeTime = 0.0f;  // Ѿ ִ ð
-
-	// ̻  Update    ֹǷ   ĸ 
-	void Update(float dt)
-	{
-		//  ̻  
-		if (isDead) return;
-
-		// 3 ̻ ư ȭ    ϰ ı (Ǯ ȯ)
-		lifeTime += dt;
-		if (lifeTime > 3.0f)
-		{
-			isDead = true;
-		}
-
-		// θ(GameObject)  Ÿ ȣ
-		GameObject::Update(dt);
-	}
-};
-
-// ġ  (Gem) Ŭ 
-class Gem : public GameObject
-{
-public:
-	bool isDead = true;
-	float expValue = 20.0f; //  ϳ  ġ
-	
-	void Update(float dt, Player& player)
-	{
-		if (isDead) return;
-
-		// ÷̾ Ÿ 
-		float dx = player.GetPosition().x - position.x;
-		float dy = player.GetPosition().y - position.y;
-		float dist = sqrt((dx * dx) + (dy * dy));
-
-		// ȹ  (÷̾   ġ ȹ)
-		float pickupRadius = 0.15f;
-		if (dist < pickupRadius)
-		{
-			g_SoundMgr.Play("gem");
-			player.exp += expValue;
-			isDead = true; // ȹ  ı
-		}
-
-		GameObject::Update(dt);
-	}
-};
-
-// ǰ  ؽƮ (DamageText) Ŭ ߰
-class DamageText : public GameObject
-{
-public:
-	bool isDead = true;
-	float lifeTime = 0.0f;
-	float maxLife = 0.5f;	// 0.5 ȸ ȭ鿡  
-
-	void Update(float dt)
-	{
-		if (isDead) return;
-
-		lifeTime += dt;
-
-		//    
-		position.y += 0.5f * dt;
-
-		//  ϸ 
-		if (lifeTime >= maxLife)
-		{
-			isDead = true;
-		}
-
-		GameObject::Update(dt);
-	}
-};
-
-//   ǰ  Ÿ Ʈ Ŭ
-class Effect : public GameObject
-{
-public:
-	bool isDead = true;
-
-	void Update(float dt)
-	{
-		if (isDead) return;
-
-		// ִϸ̼  ѱ
-		frameTime += dt;
-		if (frameTime >= frameDuration)
-		{
-			currentFrame++;
-			frameTime = 0.0f;
-
-			//  ӿ ϸ Ʈ ı
-			if (currentFrame >= maxFrames)
-			{
-				isDead = true;
-				currentFrame = 0; //   ʱȭ
-			}
-		}
-
-		GameObject::Update(dt);
+		const EnemyTypeInfo& info = GetEnemyTypeInfo(enemyType);
+		SetScale(info.scaleX, info.scaleY);
+		SetTintColor(info.tintR, info.tintG, info.tintB);
 	}
 };
 
@@ -539,7 +209,7 @@ public:
 			// 콺 ó     ȣ  
 			if (!wasHovered) 
 			{
-				g_SoundMgr.Play("hover");
+				g_Audio->Play("hover");
 				wasHovered = true;
 			}
 			if (isMouseDown)
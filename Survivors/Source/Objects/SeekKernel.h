@@ -0,0 +1,206 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <cfloat>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SURVIVORS_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// 살아있는 적 전부를 목표 위치 쪽으로 한 번에 이동시키는 배치 커널
+// x[i] += normalize(target - p[i]) * speed[i] * dt
+//
+// SSE (4마리) / AVX2 (8마리) 버전은 sqrt + 나눗셈 대신 rsqrt 근사값에 뉴턴 반복 1회를 적용
+// 허용 오차 : 스칼라 버전과 비교해 한 번 이동할 때 축마다
+//             |차이| <= SEEK_KERNEL_TOLERANCE * speed * dt + 2 ulp(위치)   (rsqrt + 뉴턴 1회의 상대 오차 ~ 5e-7)
+// 거리 제곱이 FLT_MIN 이하인 적 (플레이어와 완전히 겹친 적)은 SIMD 버전에서 움직이지 않음
+//
+// 배열 길이 count는 EnemyPool::LANE_PADDING(8)의 배수여야 하고 남는 칸의 alive는 0이어야 함
+
+static const float SEEK_KERNEL_TOLERANCE = 2e-6f;
+
+enum class SimdLevel
+{
+	Scalar,
+	SSE,
+	AVX2,
+};
+
+// 스칼라 기준 구현 (다른 CPU 이거나 SIMD를 끌 때 사용)
+inline void SeekBatchScalar(float* x, float* y, const float* speed, const uint8_t* alive, int count,
+	float targetX, float targetY, float dt)
+{
+	for (int i = 0; i < count; i++)
+	{
+		if (!alive[i]) continue;
+
+		float dirX = targetX - x[i];
+		float dirY = targetY - y[i];
+		float distance = std::sqrt((dirX * dirX) + (dirY * dirY));
+
+		// 거리가 0보다 클 때만 움직임 (0 나누기 에러 방지)
+		if (distance > 0.0f)
+		{
+			x[i] += (dirX / distance) * speed[i] * dt;
+			y[i] += (dirY / distance) * speed[i] * dt;
+		}
+	}
+}
+
+#if defined(SURVIVORS_SIMD_X86)
+
+// GCC / Clang은 함수 단위로 AVX2 코드 생성을 허락받아야 함 (MSVC는 그냥 사용 가능)
+#if defined(__GNUC__) || defined(__clang__)
+#define SURVIVORS_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SURVIVORS_TARGET_AVX2
+#endif
+
+inline void SeekBatchSSE(float* x, float* y, const float* speed, const uint8_t* alive, int count,
+	float targetX, float targetY, float dt)
+{
+	const __m128 vTargetX = _mm_set1_ps(targetX);
+	const __m128 vTargetY = _mm_set1_ps(targetY);
+	const __m128 vDt = _mm_set1_ps(dt);
+	const __m128 vHalf = _mm_set1_ps(0.5f);
+	const __m128 vThreeHalves = _mm_set1_ps(1.5f);
+	const __m128 vMinDistSq = _mm_set1_ps(FLT_MIN);
+	const __m128i vZero = _mm_setzero_si128();
+
+	for (int i = 0; i < count; i += 4)
+	{
+		// 생존 바이트 4개를 32비트 레인 마스크로 확장
+		int aliveBits;
+		memcpy(&aliveBits, alive + i, sizeof(aliveBits));
+		if (aliveBits == 0) continue;	// 4마리 모두 죽어있으면 통째로 건너뜀
+
+		__m128i alive32 = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(aliveBits), vZero), vZero);
+		__m128 aliveMask = _mm_castsi128_ps(_mm_cmpgt_epi32(alive32, vZero));
+
+		__m128 px = _mm_load_ps(x + i);
+		__m128 py = _mm_load_ps(y + i);
+		__m128 dx = _mm_sub_ps(vTargetX, px);
+		__m128 dy = _mm_sub_ps(vTargetY, py);
+		__m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+
+		// 1 / 거리 근사 후 뉴턴 반복 1회 : r = r * (1.5 - 0.5 * d² * r²)
+		__m128 r = _mm_rsqrt_ps(distSq);
+		r = _mm_mul_ps(r, _mm_sub_ps(vThreeHalves, _mm_mul_ps(_mm_mul_ps(vHalf, distSq), _mm_mul_ps(r, r))));
+
+		__m128 moveMask = _mm_and_ps(aliveMask, _mm_cmpgt_ps(distSq, vMinDistSq));
+		__m128 step = _mm_and_ps(moveMask, _mm_mul_ps(_mm_mul_ps(_mm_load_ps(speed + i), vDt), r));
+
+		_mm_store_ps(x + i, _mm_add_ps(px, _mm_mul_ps(dx, step)));
+		_mm_store_ps(y + i, _mm_add_ps(py, _mm_mul_ps(dy, step)));
+	}
+}
+
+SURVIVORS_TARGET_AVX2
+inline void SeekBatchAVX2(float* x, float* y, const float* speed, const uint8_t* alive, int count,
+	float targetX, float targetY, float dt)
+{
+	const __m256 vTargetX = _mm256_set1_ps(targetX);
+	const __m256 vTargetY = _mm256_set1_ps(targetY);
+	const __m256 vDt = _mm256_set1_ps(dt);
+	const __m256 vHalf = _mm256_set1_ps(0.5f);
+	const __m256 vThreeHalves = _mm256_set1_ps(1.5f);
+	const __m256 vMinDistSq = _mm256_set1_ps(FLT_MIN);
+	const __m256i vZero = _mm256_setzero_si256();
+
+	for (int i = 0; i < count; i += 8)
+	{
+		// 생존 바이트 8개를 32비트 레인 마스크로 확장
+		long long aliveBits;
+		memcpy(&aliveBits, alive + i, sizeof(aliveBits));
+		if (aliveBits == 0) continue;	// 8마리 모두 죽어있으면 통째로 건너뜀
+
+		__m256i alive32 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(alive + i)));
+		__m256 aliveMask = _mm256_castsi256_ps(_mm256_cmpgt_epi32(alive32, vZero));
+
+		__m256 px = _mm256_load_ps(x + i);
+		__m256 py = _mm256_load_ps(y + i);
+		__m256 dx = _mm256_sub_ps(vTargetX, px);
+		__m256 dy = _mm256_sub_ps(vTargetY, py);
+		__m256 distSq = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+
+		__m256 r = _mm256_rsqrt_ps(distSq);
+		r = _mm256_mul_ps(r, _mm256_sub_ps(vThreeHalves, _mm256_mul_ps(_mm256_mul_ps(vHalf, distSq), _mm256_mul_ps(r, r))));
+
+		__m256 moveMask = _mm256_and_ps(aliveMask, _mm256_cmp_ps(distSq, vMinDistSq, _CMP_GT_OQ));
+		__m256 step = _mm256_and_ps(moveMask, _mm256_mul_ps(_mm256_mul_ps(_mm256_load_ps(speed + i), vDt), r));
+
+		_mm256_store_ps(x + i, _mm256_add_ps(px, _mm256_mul_ps(dx, step)));
+		_mm256_store_ps(y + i, _mm256_add_ps(py, _mm256_mul_ps(dy, step)));
+	}
+}
+
+// CPU가 AVX2 명령어와 OS의 YMM 레지스터 저장을 둘 다 지원하는지 확인
+inline bool CpuSupportsAVX2()
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7) return false;
+
+	__cpuid(info, 1);
+	bool osxsave = (info[2] & (1 << 27)) != 0;
+	bool avx = (info[2] & (1 << 28)) != 0;
+	if (!osxsave || !avx) return false;
+	if ((_xgetbv(0) & 0x6) != 0x6) return false;
+
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+#endif // SURVIVORS_SIMD_X86
+
+// 이 CPU에서 쓸 수 있는 가장 넓은 커널 (처음 한 번만 검사)
+inline SimdLevel DetectSimdLevel()
+{
+#if defined(SURVIVORS_SIMD_X86)
+	return CpuSupportsAVX2() ? SimdLevel::AVX2 : SimdLevel::SSE;
+#else
+	return SimdLevel::Scalar;
+#endif
+}
+
+// 현재 사용 중인 커널 단계 (벤치마크나 비교 검증에서 강제로 낮출 수 있음)
+inline SimdLevel& SeekKernelLevel()
+{
+	static SimdLevel level = DetectSimdLevel();
+	return level;
+}
+
+inline const char* GetSimdLevelName(SimdLevel level)
+{
+	switch (level)
+	{
+	case SimdLevel::AVX2: return "AVX2";
+	case SimdLevel::SSE: return "SSE";
+	default: return "Scalar";
+	}
+}
+
+// 런타임에 고른 커널로 배치 이동 실행
+inline void SeekBatch(float* x, float* y, const float* speed, const uint8_t* alive, int count,
+	float targetX, float targetY, float dt)
+{
+#if defined(SURVIVORS_SIMD_X86)
+	switch (SeekKernelLevel())
+	{
+	case SimdLevel::AVX2: SeekBatchAVX2(x, y, speed, alive, count, targetX, targetY, dt); return;
+	case SimdLevel::SSE: SeekBatchSSE(x, y, speed, alive, count, targetX, targetY, dt); return;
+	default: break;
+	}
+#endif
+	SeekBatchScalar(x, y, speed, alive, count, targetX, targetY, dt);
+}
@@ -0,0 +1,457 @@
+﻿#pragma once
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include "Platform.h"
+#include "../Render/DescriptorAllocator.h"
+#include "../Render/NullRenderBackend.h"
+
+// 헤드리스 플랫폼 (창 / GPU / 사운드 장치 없이 게임 전체를 돌림, 리눅스 빌드 서버 / 벤치마크용)
+// 시계는 실제 시간과 상관없이 Update마다 고정 간격만큼 흐르므로 몇 프레임을 얼마나 빨리 돌리든 게임 안의 시간은 같음
+// 입력은 그 시계를 기준으로 스크립트가 누르고 떼므로, 시드와 스크립트가 같으면 메뉴 / 레벨업까지 매번 같은 게임이 나옴
+// 게임 루프 (PumpMessages / Update / Render)를 한 스레드에서 차례로 부르는 것을 전제로 함 (HeadlessGame)
+
+class NullWindow : public IWindow
+{
+private:
+	int width;
+	int height;
+	bool closed = false;
+
+public:
+	NullWindow(int newWidth = 1280, int newHeight = 720) : width(newWidth), height(newHeight) {}
+
+	bool PumpMessages() override { return !closed; }
+	void RequestClose() override { closed = true; }
+	int GetWidth() const override { return width; }
+	int GetHeight() const override { return height; }
+};
+
+// Update 한 번 = frameDt초, Sleep은 재우지 않고 시계만 넘김 (다음 Update의 dt에 더해짐)
+class ManualTimer : public ITimer
+{
+private:
+	double frameDt;
+	double now = 0.0;
+	double prevTime = 0.0;
+	float deltaTime = 0.0f;
+
+public:
+	ManualTimer(double newFrameDt = 1.0 / 60.0) : frameDt(newFrameDt) {}
+
+	void SetFrameDt(double newFrameDt) { frameDt = newFrameDt; }
+
+	void Reset() override
+	{
+		now = 0.0;
+		prevTime = 0.0;
+		deltaTime = 0.0f;
+	}
+
+	void Update() override
+	{
+		now += frameDt;
+		deltaTime = (float)(now - prevTime);
+		prevTime = now;
+	}
+
+	float GetDeltaTime() const override { return deltaTime; }
+	double GetTime() const override { return now; }
+	void Sleep(int milliseconds) override { now += milliseconds / 1000.0; }
+};
+
+// 스크립트로 누르는 키보드 / 마우스
+// 한 줄에 "<초> [every <간격>] <명령> [인자]", #으로 시작하는 줄은 주석
+//   keys <WASD 조합 또는 -> : 이동 키를 이 조합으로 (나머지 이동 키는 뗌)
+//   press <키> / release <키> : 키 이름은 W A S D UP DOWN LEFT RIGHT ESC
+//   click <x> <y> : 창 픽셀 좌표로 마우스를 옮기고 CLICK_HOLD초 동안 누름
+//   move <x> <y> / down / up : 마우스만 옮기기 / 누르기 / 떼기
+//   quit : IsQuitRequested가 true (게임 루프가 창을 닫음)
+// every가 붙으면 그 시각부터 간격마다 반복
+class ScriptedInput : public IInput
+{
+private:
+	enum Command
+	{
+		CMD_KEYS,
+		CMD_PRESS,
+		CMD_RELEASE,
+		CMD_CLICK,
+		CMD_MOVE,
+		CMD_DOWN,
+		CMD_UP,
+		CMD_QUIT,
+	};
+
+	struct Event
+	{
+		double nextTime = 0.0;
+		double period = 0.0;	// 0이면 한 번만
+		bool done = false;
+		Command command = CMD_QUIT;
+		int key = 0;
+		std::string keys;
+		int x = 0;
+		int y = 0;
+	};
+
+	const ITimer* timer = nullptr;
+	std::vector<Event> events;
+	std::mutex mutex;
+
+	bool keyDown[256] = {};
+	bool mouseDown = false;
+	double mouseUpTime = -1.0;	// 클릭으로 누른 버튼을 뗄 시각 (음수면 없음)
+	int mouseX = 0;
+	int mouseY = 0;
+	bool quitRequested = false;
+
+	static int ParseKey(const char* name)
+	{
+		struct KeyName { const char* name; int key; };
+		static const KeyName names[] =
+		{
+			{ "W", KEY_W }, { "A", KEY_A }, { "S", KEY_S }, { "D", KEY_D },
+			{ "UP", KEY_UP }, { "DOWN", KEY_DOWN }, { "LEFT", KEY_LEFT }, { "RIGHT", KEY_RIGHT },
+			{ "ESC", KEY_ESCAPE },
+		};
+		for (const KeyName& entry : names)
+		{
+			if (strcmp(entry.name, name) == 0) return entry.key;
+		}
+		return -1;
+	}
+
+	void Apply(const Event& event)
+	{
+		switch (event.command)
+		{
+		case CMD_KEYS:
+			keyDown[KEY_W] = keyDown[KEY_A] = keyDown[KEY_S] = keyDown[KEY_D] = false;
+			for (char c : event.keys)
+			{
+				int key = toupper((unsigned char)c);
+				if (key == KEY_W || key == KEY_A || key == KEY_S || key == KEY_D) keyDown[key] = true;
+			}
+			break;
+		case CMD_PRESS: keyDown[event.key] = true; break;
+		case CMD_RELEASE: keyDown[event.key] = false; break;
+		case CMD_CLICK:
+			mouseX = event.x;
+			mouseY = event.y;
+			mouseDown = true;
+			mouseUpTime = event.nextTime + CLICK_HOLD;
+			break;
+		case CMD_MOVE:
+			mouseX = event.x;
+			mouseY = event.y;
+			break;
+		case CMD_DOWN: mouseDown = true; mouseUpTime = -1.0; break;
+		case CMD_UP: mouseDown = false; mouseUpTime = -1.0; break;
+		case CMD_QUIT: quitRequested = true; break;
+		}
+	}
+
+	// 지금 시각까지 할 일을 시각 순서대로 처리 (물어볼 때마다 따라잡음)
+	void Advance()
+	{
+		double now = timer->GetTime();
+		for (;;)
+		{
+			Event* due = nullptr;
+			for (Event& event : events)
+			{
+				if (!event.done && event.nextTime <= now && (due == nullptr || event.nextTime < due->nextTime)) due = &event;
+			}
+			if (mouseUpTime >= 0.0 && mouseUpTime <= now && (due == nullptr || mouseUpTime <= due->nextTime))
+			{
+				mouseDown = false;
+				mouseUpTime = -1.0;
+				continue;
+			}
+			if (due == nullptr) break;
+
+			Apply(*due);
+			if (due->period > 0.0) due->nextTime += due->period;
+			else due->done = true;
+		}
+	}
+
+public:
+	static constexpr double CLICK_HOLD = 0.05;	// 3틱 (버튼은 누른 동안 눌린 것으로 판정)
+
+	void Initialize(const ITimer* newTimer) { timer = newTimer; }
+
+	// 스크립트 한 줄을 읽어서 추가 (빈 줄 / 주석은 true, 형식이 틀리면 false)
+	bool AddLine(const char* line)
+	{
+		while (*line == ' ' || *line == '\t') line++;
+		if (*line == '\0' || *line == '\n' || *line == '\r' || *line == '#') return true;
+
+		Event event;
+		char word[32] = "";
+		int read = 0;
+		if (sscanf(line, "%lf %31s%n", &event.nextTime, word, &read) < 2) return false;
+		line += read;
+		if (strcmp(word, "every") == 0)
+		{
+			if (sscanf(line, "%lf %31s%n", &event.period, word, &read) < 2 || event.period <= 0.0) return false;
+			line += read;
+		}
+
+		char arg[32] = "";
+		if (strcmp(word, "keys") == 0)
+		{
+			if (sscanf(line, "%31s", arg) < 1) return false;
+			event.command = CMD_KEYS;
+			event.keys = strcmp(arg, "-") == 0 ? "" : arg;
+		}
+		else if (strcmp(word, "press") == 0 || strcmp(word, "release") == 0)
+		{
+			if (sscanf(line, "%31s", arg) < 1 || (event.key = ParseKey(arg)) < 0) return false;
+			event.command = word[0] == 'p' ? CMD_PRESS : CMD_RELEASE;
+		}
+		else if (strcmp(word, "click") == 0 || strcmp(word, "move") == 0)
+		{
+			if (sscanf(line, "%d %d", &event.x, &event.y) < 2) return false;
+			event.command = word[0] == 'c' ? CMD_CLICK : CMD_MOVE;
+		}
+		else if (strcmp(word, "down") == 0) event.command = CMD_DOWN;
+		else if (strcmp(word, "up") == 0) event.command = CMD_UP;
+		else if (strcmp(word, "quit") == 0) event.command = CMD_QUIT;
+		else return false;
+
+		std::lock_guard<std::mutex> lock(mutex);
+		events.push_back(event);
+		return true;
+	}
+
+	// 여러 줄짜리 스크립트 (틀린 줄은 번호를 찍고 건너뜀)
+	int AddScript(const char* text)
+	{
+		int errors = 0;
+		int lineNumber = 0;
+		while (*text != '\0')
+		{
+			const char* end = strchr(text, '\n');
+			std::string line = end != nullptr ? std::string(text, end) : std::string(text);
+			lineNumber++;
+			if (!AddLine(line.c_str()))
+			{
+				fprintf(stderr, "script line %d ignored : %s\n", lineNumber, line.c_str());
+				errors++;
+			}
+			if (end == nullptr) break;
+			text = end + 1;
+		}
+		return errors;
+	}
+
+	bool LoadScript(const char* path)
+	{
+		FILE* file = fopen(path, "rb");
+		if (file == nullptr) return false;
+
+		std::string text;
+		char buffer[4096];
+		size_t read;
+		while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) text.append(buffer, read);
+		fclose(file);
+
+		AddScript(text.c_str());
+		return true;
+	}
+
+	bool IsKeyDown(int key) override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		Advance();
+		return key >= 0 && key < 256 && keyDown[key];
+	}
+
+	bool IsMouseDown() override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		Advance();
+		return mouseDown;
+	}
+
+	void GetMousePosition(int& x, int& y) override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		Advance();
+		x = mouseX;
+		y = mouseY;
+	}
+
+	bool IsQuitRequested()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		Advance();
+		return quitRequested;
+	}
+};
+
+// 소리는 내지 않고 이름마다 몇 번 재생됐는지만 셈
+class NullAudio : public IAudio
+{
+private:
+	std::map<std::string, int> playCounts;
+	std::mutex mutex;
+
+public:
+	bool LoadWAV(const std::string& name, const char*) override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		playCounts[name];
+		return true;
+	}
+
+	void Play(const std::string& name, bool, float) override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		playCounts[name]++;
+	}
+
+	std::map<std::string, int> GetPlayCounts()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		return playCounts;
+	}
+};
+
+// 헤드리스 렌더러가 기억하는 텍스처 (GpuTexture에서 게임 객체에 돌려줄 정보만)
+struct HeadlessTexture
+{
+	int descriptor = 0;
+	float uvScale[2] = { 1.0f, 1.0f };
+	const AssetPackFrame* frames = nullptr;
+	int frameCount = 0;
+	int paletteRow = -1;
+};
+
+// 그리지 않는 렌더러
+// 텍스처 번호 / 팩 메타데이터 (uv 배율, 아틀라스 프레임, 팔레트 줄)는 GpuTextureCache와 같은 규칙으로 나눠주고
+// Render는 NullRenderBackend로 인스턴스를 CPU 배열에 복사만 함 (스냅샷 합치기 / 인스턴스 쓰기 비용까지는 GPU 렌더러와 같음)
+class NullRenderer : public IRenderer
+{
+protected:
+	struct PendingLoad
+	{
+		TextureHandle handle;
+		std::string path;
+	};
+
+	const AssetPack* pack = nullptr;
+	JobSystem* renderJobs = nullptr;
+	TextureCache<HeadlessTexture> cache;
+	DescriptorAllocator descriptors;
+	std::vector<PendingLoad> pending;	// FinishTextureLoads가 읽을 파일 (Acquire 순서)
+	int paletteRows = 0;
+
+	NullRenderBackend backend;
+	int frameCount = 0;
+	int lastSpriteCount = 0;
+	int lastRunCount = 0;
+	uint64_t totalSprites = 0;
+
+	void CountFrame(const RenderSnapshot& snapshot)
+	{
+		frameCount++;
+		lastSpriteCount = snapshot.merged.GetSpriteCount();
+		lastRunCount = (int)snapshot.merged.GetRuns().size();
+		totalSprites += lastSpriteCount;
+	}
+
+	// 팔레트 줄 하나 (팔레트 텍스처가 있는 렌더러는 여기서 실제로 줄을 붙임)
+	virtual int AddPaletteRow(const uint32_t*)
+	{
+		return paletteRows < MAX_SPRITE_PALETTES ? paletteRows++ : -1;
+	}
+
+	// 마지막 핸들이 반납된 텍스처를 내림
+	virtual void UnloadTexture(HeadlessTexture&) {}
+
+public:
+	static const int DESCRIPTOR_CAPACITY = 1024;	// GlobalDescriptorHeap::DEFAULT_CAPACITY와 같음
+	static const int RESERVED_DESCRIPTORS = 2;		// 0 : 텍스처 없음, 1 : 팔레트 텍스처
+
+	// newPack : 열려있는 에셋 팩 (없으면 nullptr), jobs : 인스턴스 쓰기를 나눌 잡 시스템 (없으면 부른 스레드에서)
+	void Initialize(const AssetPack* newPack = nullptr, JobSystem* jobs = nullptr)
+	{
+		pack = newPack != nullptr && newPack->IsOpen() ? newPack : nullptr;
+		renderJobs = jobs;
+		descriptors.Initialize(DESCRIPTOR_CAPACITY, RESERVED_DESCRIPTORS);
+	}
+
+	TextureHandle AcquireTexture(const char* filename) override
+	{
+		bool added = false;
+		TextureHandle handle = cache.Acquire(filename, [&](const char*, HeadlessTexture& out)
+			{
+				out.descriptor = descriptors.Allocate();
+				if (out.descriptor < 0) return false;
+				added = true;
+
+				const AssetPackEntry* entry = pack != nullptr ? pack->Find(filename) : nullptr;
+				if (entry != nullptr && entry->type == ASSET_TEXTURE)
+				{
+					out.uvScale[0] = entry->uvScale[0];
+					out.uvScale[1] = entry->uvScale[1];
+					out.frames = pack->GetFrames(*entry);
+					out.frameCount = out.frames != nullptr ? (int)entry->frameCount : 0;
+					if (entry->format == ASSET_FORMAT_PALETTE8) out.paletteRow = AddPaletteRow(pack->GetPalette(*entry));
+				}
+				return true;
+			});
+		if (added && !handle.IsNull()) pending.push_back({ handle, filename });
+		return handle;
+	}
+
+	bool AddRefTexture(TextureHandle handle) override { return cache.AddRef(handle); }
+
+	void ReleaseTexture(TextureHandle handle) override
+	{
+		cache.Release(handle, [&](HeadlessTexture& texture)
+			{
+				UnloadTexture(texture);
+				descriptors.Free(texture.descriptor);
+			});
+	}
+
+	TextureInfo GetTextureInfo(TextureHandle handle) const override
+	{
+		TextureInfo info;
+		const HeadlessTexture* texture = cache.Get(handle);
+		if (texture == nullptr) return info;
+
+		info.descriptor = texture->descriptor;
+		info.uvScale[0] = texture->uvScale[0];
+		info.uvScale[1] = texture->uvScale[1];
+		info.frames = texture->frames;
+		info.frameCount = texture->frameCount;
+		info.paletteRow = texture->paletteRow;
+		return info;
+	}
+
+	void FinishTextureLoads(JobSystem*) override { pending.clear(); }
+
+	void Render(const RenderSnapshot& snapshot) override
+	{
+		backend.Flush(snapshot.merged, renderJobs);
+		CountFrame(snapshot);
+	}
+
+	void WaitForIdle() override {}
+
+	int GetFrameCount() const { return frameCount; }
+	int GetLastSpriteCount() const { return lastSpriteCount; }
+	int GetLastRunCount() const { return lastRunCount; }
+	uint64_t GetTotalSprites() const { return totalSprites; }
+	int GetTextureCount() const { return cache.GetLoadedCount(); }
+};
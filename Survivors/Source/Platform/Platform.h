@@ -0,0 +1,114 @@
+﻿#pragma once
+#include <cstdint>
+#include <string>
+#include "../Render/TextureCache.h"
+#include "../Render/RenderSnapshot.h"
+#include "../Utils/AssetPack.h"
+
+// 게임 (Game)이 운영체제 / 그래픽 API / 오디오 API를 직접 부르지 않고 쓰는 얇은 인터페이스들
+// Windows : Win32Platform.h (창 / 입력 / 시간) + SoundManager (XAudio2) + D3D12Renderer (Survivors.cpp)
+// 헤드리스 : NullPlatform.h (입력은 스크립트, 시간은 고정 간격으로 흐르는 가짜 시계) + SoftwareRenderer.h (선택)
+
+// 키 번호 (Windows 가상 키 코드와 같은 값이라 Win32 입력은 그대로 GetAsyncKeyState에 넘김)
+enum PlatformKey
+{
+	KEY_ESCAPE = 0x1B,
+	KEY_LEFT = 0x25,
+	KEY_UP = 0x26,
+	KEY_RIGHT = 0x27,
+	KEY_DOWN = 0x28,
+	KEY_A = 'A',
+	KEY_D = 'D',
+	KEY_S = 'S',
+	KEY_W = 'W',
+};
+
+class IWindow
+{
+public:
+	virtual ~IWindow() {}
+
+	// 쌓인 창 메시지를 전부 처리 (창이 닫혔으면 false)
+	virtual bool PumpMessages() = 0;
+	// 창을 닫음 (메인 스레드에서만, 다음 PumpMessages가 false)
+	virtual void RequestClose() = 0;
+	virtual int GetWidth() const = 0;
+	virtual int GetHeight() const = 0;
+};
+
+// 시뮬레이션 스레드가 틱마다 읽음 (여러 스레드에서 읽어도 되게 구현)
+class IInput
+{
+public:
+	virtual ~IInput() {}
+
+	virtual bool IsKeyDown(int key) = 0;
+	virtual bool IsMouseDown() = 0;		// 왼쪽 버튼
+	// 창 안의 마우스 위치 (픽셀, 왼쪽 위가 0, 0)
+	virtual void GetMousePosition(int& x, int& y) = 0;
+};
+
+class ITimer
+{
+public:
+	virtual ~ITimer() {}
+
+	// 지금부터 시간을 잼
+	virtual void Reset() = 0;
+	// 지난 Update (또는 Reset)부터 흐른 시간을 GetDeltaTime으로 넘김
+	virtual void Update() = 0;
+	virtual float GetDeltaTime() const = 0;
+	// Reset부터 흐른 초
+	virtual double GetTime() const = 0;
+	// 부른 스레드를 재움 (가짜 시계는 재우지 않고 시계만 그만큼 넘김)
+	virtual void Sleep(int milliseconds) = 0;
+};
+
+class IAudio
+{
+public:
+	virtual ~IAudio() {}
+
+	// WAV 파일 (에셋 팩에 있으면 팩)을 name으로 올림
+	virtual bool LoadWAV(const std::string& name, const char* filename) = 0;
+	virtual void Play(const std::string& name, bool loop = false, float volume = 1.0f) = 0;
+};
+
+// 게임 객체가 그리기에 쓰는 텍스처 정보 (GpuTexture에서 셰이더 / uv 계산에 필요한 것만)
+struct TextureInfo
+{
+	int descriptor = 0;				// 셰이더가 읽는 텍스처 번호 (0 : 텍스처 없음)
+	float uvScale[2] = { 1.0f, 1.0f };
+	const AssetPackFrame* frames = nullptr;
+	int frameCount = 0;
+	int paletteRow = -1;
+};
+
+class IRenderer
+{
+public:
+	virtual ~IRenderer() {}
+
+	// 경로마다 텍스처 하나 (GpuTextureCache와 같은 규칙 : 번호는 바로 정해지고 그림은 FinishTextureLoads가 채움)
+	virtual TextureHandle AcquireTexture(const char* filename) = 0;
+	virtual bool AddRefTexture(TextureHandle handle) = 0;
+	virtual void ReleaseTexture(TextureHandle handle) = 0;
+	virtual TextureInfo GetTextureInfo(TextureHandle handle) const = 0;
+	// 시작할 때 한 번 : 지금까지 Acquire한 텍스처를 전부 읽어서 올리고 끝날 때까지 기다림
+	virtual void FinishTextureLoads(JobSystem* jobs) = 0;
+
+	// 스냅샷 하나를 그리고 화면에 냄 (메인 스레드)
+	virtual void Render(const RenderSnapshot& snapshot) = 0;
+	// 그리던 프레임이 전부 끝날 때까지 기다림 (종료 전)
+	virtual void WaitForIdle() = 0;
+};
+
+// 게임이 쓰는 플랫폼 기능 묶음 (게임보다 오래 살아있어야 함)
+struct Platform
+{
+	IWindow* window = nullptr;
+	IInput* input = nullptr;
+	ITimer* timer = nullptr;
+	IAudio* audio = nullptr;
+	IRenderer* renderer = nullptr;
+};
@@ -0,0 +1,69 @@
+﻿#pragma once
+#include <cstring>
+#include "NullPlatform.h"
+#include "../Render/SoftwareRasterizer.h"
+#include "../Render/ImageDecoder.h"
+
+// CPU로 실제 화면을 그리는 헤드리스 렌더러 (SoftwareRenderBackend)
+// 텍스처 번호는 NullRenderer와 같은 규칙으로 나눠주고, 그 번호의 칸에 텍스처 표를 채워서 래스터라이저가 서술자 힙처럼 찾게 함
+// 팩에 든 텍스처는 팩 본문을 풀고 (블록 압축 -> RGBA8, 팔레트는 번호 그대로), 나머지는 PNG를 jobs로 한꺼번에 풂
+// 다 그린 화면은 GetRasterizer().SavePng로 저장
+class SoftwareRenderer : public NullRenderer
+{
+private:
+	SoftwareTextureTable textures;
+	SoftwareRenderBackend softwareBackend;
+
+protected:
+	int AddPaletteRow(const uint32_t* palette) override { return textures.AddPaletteRow(palette); }
+	void UnloadTexture(HeadlessTexture& texture) override { textures.ClearTexture(texture.descriptor); }
+
+public:
+	void Initialize(int width, int height, const AssetPack* newPack = nullptr, JobSystem* jobs = nullptr)
+	{
+		NullRenderer::Initialize(newPack, jobs);
+		softwareBackend.Initialize(width, height);
+	}
+
+	void FinishTextureLoads(JobSystem* jobs) override
+	{
+		std::vector<std::string> paths;
+		std::vector<int> decodeSlots;
+		for (const PendingLoad& load : pending)
+		{
+			const HeadlessTexture* texture = cache.Get(load.handle);
+			if (texture == nullptr) continue;	// 읽기 전에 이미 Release됨
+
+			const AssetPackEntry* entry = pack != nullptr ? pack->Find(load.path.c_str()) : nullptr;
+			if (entry != nullptr && entry->type == ASSET_TEXTURE)
+			{
+				textures.SetPackTexture(texture->descriptor, *pack, *entry);
+				continue;
+			}
+			paths.push_back(load.path);
+			decodeSlots.push_back(texture->descriptor);
+		}
+
+		std::vector<DecodedImage> images;
+		DecodeImages(paths, images, jobs);
+
+		for (size_t i = 0; i < images.size(); i++)
+		{
+			const DecodedImage& image = images[i];
+			if (!image.IsValid()) continue;	// 못 읽은 파일은 빈 칸으로 남음 (GPU의 null SRV처럼 안 보임)
+			SoftwareTexture& texture = textures.SetTexture(decodeSlots[i], image.width, image.height, 1, false);
+			memcpy(texture.GetLevelPixels(0), image.pixels, (size_t)image.width * image.height * 4);
+		}
+
+		FreeDecodedImages(images);
+		pending.clear();
+	}
+
+	void Render(const RenderSnapshot& snapshot) override
+	{
+		softwareBackend.Flush(snapshot.merged, snapshot.clearColor, textures, renderJobs);
+		CountFrame(snapshot);
+	}
+
+	const SoftwareRasterizer& GetRasterizer() const { return softwareBackend.GetRasterizer(); }
+};
@@ -0,0 +1,152 @@
+﻿#pragma once
+#include <windows.h>
+#include "Platform.h"
+
+// Windows 창 (WS_OVERLAPPEDWINDOW, 클라이언트 영역이 아니라 창 크기가 width x height)
+class Win32Window : public IWindow
+{
+private:
+	HWND hWnd = nullptr;
+	int width = 0;
+	int height = 0;
+	int exitCode = 0;
+
+public:
+	static constexpr const wchar_t* CLASS_NAME = L"DX12PortfolioClass";	// 이 창의 고유한 클래스 이름
+
+	// 창을 만들고 화면에 띄움 (실패하면 false)
+	bool Create(HINSTANCE hInstance, int nCmdShow, const wchar_t* title, int newWidth, int newHeight)
+	{
+		width = newWidth;
+		height = newHeight;
+
+		// 윈도우 클래스 설정 및 등록
+		// 창의 기본적인 속성 (아이콘, 커서, 이름 등)을 정의하는 구조체
+		WNDCLASSEXW wcex = { 0 };
+		wcex.cbSize = sizeof(WNDCLASSEXW);
+		wcex.style = CS_HREDRAW | CS_VREDRAW;
+
+		// 윈도우 메시지 (클릭, 종료 등)를 처리하는 콜백 함수
+		wcex.lpfnWndProc = [](HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam) -> LRESULT WINAPI
+		{
+			// 창 닫기 버튼을 눌렀을 때의 처리
+			if (message == WM_DESTROY)
+			{
+				PostQuitMessage(0);
+				return 0;
+			}
+			// 그 외의 메시지는 윈도우 기본 처리에 맡김
+			return DefWindowProcW(hWnd, message, wParam, lParam);
+		};
+
+		wcex.hInstance = hInstance;
+		wcex.hCursor = LoadCursor(nullptr, IDC_ARROW);
+		wcex.lpszClassName = CLASS_NAME;
+		RegisterClassExW(&wcex);
+
+		hWnd = CreateWindowExW(
+			0,
+			CLASS_NAME,						// 등록했던 클래스 이름
+			title,							// 창 상단에 뜰 제목
+			WS_OVERLAPPEDWINDOW,			// 일반적인 창 스타일 (최소화, 최대화, 닫기 버튼 포함)
+			CW_USEDEFAULT, CW_USEDEFAULT,	// 창의 X, Y 시작 위치
+			width, height,					// 창의 가로, 세로 크기
+			nullptr, nullptr, hInstance, nullptr
+		);
+		if (!hWnd) return false;
+
+		ShowWindow(hWnd, nCmdShow);
+		UpdateWindow(hWnd);
+		return true;
+	}
+
+	// PeekMessage는 메시지가 없어도 멈추지 않으므로 쌓인 것만 처리하고 바로 게임 루프로 돌아감
+	bool PumpMessages() override
+	{
+		MSG msg = { 0 };
+		while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
+		{
+			if (msg.message == WM_QUIT)
+			{
+				exitCode = (int)msg.wParam;
+				return false;
+			}
+			TranslateMessage(&msg);
+			DispatchMessage(&msg);
+		}
+		return true;
+	}
+
+	// PostQuitMessage는 부른 스레드의 큐로 가므로 메인 스레드에서만 부름
+	void RequestClose() override { PostQuitMessage(0); }
+
+	int GetWidth() const override { return width; }
+	int GetHeight() const override { return height; }
+	HWND GetHandle() const { return hWnd; }
+	int GetExitCode() const { return exitCode; }
+};
+
+// 키보드 / 마우스 입력 (GetAsyncKeyState는 어느 스레드에서 불러도 됨)
+class Win32Input : public IInput
+{
+private:
+	HWND hWnd = nullptr;
+
+public:
+	void Initialize(HWND newWindow) { hWnd = newWindow; }
+
+	// 특정 키가 지금 눌려있는지 확인 (W, A, S, D)
+	bool IsKeyDown(int key) override
+	{
+		return (GetAsyncKeyState(key) & 0x8000) != 0;
+	}
+
+	bool IsMouseDown() override
+	{
+		return (GetAsyncKeyState(VK_LBUTTON) & 0x8000) != 0;
+	}
+
+	void GetMousePosition(int& x, int& y) override
+	{
+		POINT pt;
+		GetCursorPos(&pt);
+		ScreenToClient(hWnd, &pt);
+		x = pt.x;
+		y = pt.y;
+	}
+};
+
+// 시간 관리를 담당하는 클래스 Tick 역할 (QueryPerformanceCounter)
+class Win32Timer : public ITimer
+{
+private:
+	LARGE_INTEGER startTime, prevTime, currentTime, frequency;
+	float deltaTime = 0.0f;
+
+public:
+	void Reset() override
+	{
+		QueryPerformanceFrequency(&frequency);
+		QueryPerformanceCounter(&startTime);
+		prevTime = startTime;
+	}
+
+	void Update() override
+	{
+		QueryPerformanceCounter(&currentTime);
+		// 이전 프레임부터 지금 프레임까지 걸린 시간(초)을 계산
+		deltaTime = static_cast<float>(currentTime.QuadPart - prevTime.QuadPart) / frequency.QuadPart;
+		prevTime = currentTime;
+	}
+
+	float GetDeltaTime() const override { return deltaTime; }
+
+	double GetTime() const override
+	{
+		LARGE_INTEGER now;
+		QueryPerformanceCounter(&now);
+		return (double)(now.QuadPart - startTime.QuadPart) / frequency.QuadPart;
+	}
+
+	void Sleep(int milliseconds) override { ::Sleep(milliseconds); }
+};
@@ -0,0 +1,737 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+#include <utility>
+#include "../Utils/JobSystem.h"
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BLOCK_COMPRESS_SSE2 1
+#endif
+
+// CPU 블록 압축기 (BC7 / BC3, 그래픽 API와 무관)
+// 4x4 픽셀 블록마다 16바이트라 RGBA8 (픽셀당 4바이트)보다 VRAM을 4분의 1만 씀
+// BC7 : 블록마다 모드 6 (RGBA 끝점 7비트 + p비트, 인덱스 4비트)과 모드 5 (색 / 알파 인덱스 따로)를 둘 다 해보고 오차가 작은 쪽
+//       (분할 모드는 안 써서 전용 인코더보다 화질은 조금 낮지만 빠름)
+// BC3 : BC1 색 블록 (565 끝점 2개 + 2비트 인덱스) + BC4 알파 블록 (8비트 끝점 2개 + 3비트 인덱스), BC7을 못 쓸 때의 대안
+// 인덱스를 고르는 "16픽셀 x 팔레트" 거리 계산이 시간의 대부분이라 그 부분만 SSE2로 4픽셀씩 처리하고, 결과는 스칼라와 비트 단위로 같음
+// 디코더는 이 인코더가 만드는 모드만 풂 (PSNR 검사용)
+enum BlockFormat
+{
+	BLOCK_BC3 = 0,
+	BLOCK_BC7 = 1,
+};
+
+static const int BLOCK_BYTES = 16;
+
+// 블록 하나의 16픽셀을 채널별로 (SoA) 모아둔 것, SIMD가 픽셀 4개를 한 번에 읽음
+struct BlockTexels
+{
+	float channel[4][16];
+};
+
+inline void LoadBlock(const uint8_t* rgba, int pitch, BlockTexels& out)
+{
+	for (int y = 0; y < 4; y++)
+	{
+		const uint8_t* row = rgba + (size_t)y * pitch;
+		for (int x = 0; x < 4; x++)
+		{
+			for (int c = 0; c < 4; c++) out.channel[c][y * 4 + x] = (float)row[x * 4 + c];
+		}
+	}
+}
+
+// 픽셀마다 palette[count]에서 가중 거리가 가장 가까운 항목을 골라 indices에 쓰고 오차 합을 돌려줌 (같으면 앞 번호)
+inline float FindClosestScalar(const BlockTexels& texels, const float (*palette)[4], int count, const float weights[4], uint8_t indices[16])
+{
+	float total = 0.0f;
+	for (int i = 0; i < 16; i++)
+	{
+		float best = FLT_MAX;
+		int bestIndex = 0;
+		for (int j = 0; j < count; j++)
+		{
+			float dr = texels.channel[0][i] - palette[j][0];
+			float dg = texels.channel[1][i] - palette[j][1];
+			float db = texels.channel[2][i] - palette[j][2];
+			float da = texels.channel[3][i] - palette[j][3];
+			float d = dr * dr * weights[0];
+			d += dg * dg * weights[1];
+			d += db * db * weights[2];
+			d += da * da * weights[3];
+			if (d < best)
+			{
+				best = d;
+				bestIndex = j;
+			}
+		}
+		indices[i] = (uint8_t)bestIndex;
+		total += best;
+	}
+	return total;
+}
+
+#ifdef BLOCK_COMPRESS_SSE2
+inline float FindClosestSse2(const BlockTexels& texels, const float (*palette)[4], int count, const float weights[4], uint8_t indices[16])
+{
+	const __m128 w0 = _mm_set1_ps(weights[0]);
+	const __m128 w1 = _mm_set1_ps(weights[1]);
+	const __m128 w2 = _mm_set1_ps(weights[2]);
+	const __m128 w3 = _mm_set1_ps(weights[3]);
+
+	alignas(16) float bestDistance[16];
+	alignas(16) int32_t bestIndex[16];
+	for (int group = 0; group < 16; group += 4)
+	{
+		__m128 r = _mm_loadu_ps(&texels.channel[0][group]);
+		__m128 g = _mm_loadu_ps(&texels.channel[1][group]);
+		__m128 b = _mm_loadu_ps(&texels.channel[2][group]);
+		__m128 a = _mm_loadu_ps(&texels.channel[3][group]);
+
+		__m128 best = _mm_set1_ps(FLT_MAX);
+		__m128i bestJ = _mm_setzero_si128();
+		for (int j = 0; j < count; j++)
+		{
+			__m128 dr = _mm_sub_ps(r, _mm_set1_ps(palette[j][0]));
+			__m128 dg = _mm_sub_ps(g, _mm_set1_ps(palette[j][1]));
+			__m128 db = _mm_sub_ps(b, _mm_set1_ps(palette[j][2]));
+			__m128 da = _mm_sub_ps(a, _mm_set1_ps(palette[j][3]));
+			__m128 d = _mm_mul_ps(_mm_mul_ps(dr, dr), w0);
+			d = _mm_add_ps(d, _mm_mul_ps(_mm_mul_ps(dg, dg), w1));
+			d = _mm_add_ps(d, _mm_mul_ps(_mm_mul_ps(db, db), w2));
+			d = _mm_add_ps(d, _mm_mul_ps(_mm_mul_ps(da, da), w3));
+
+			// 스칼라의 d < best와 같은 규칙 (같으면 앞 번호 유지)
+			__m128 closer = _mm_cmplt_ps(d, best);
+			__m128i closerMask = _mm_castps_si128(closer);
+			best = _mm_or_ps(_mm_and_ps(closer, d), _mm_andnot_ps(closer, best));
+			bestJ = _mm_or_si128(_mm_and_si128(closerMask, _mm_set1_epi32(j)), _mm_andnot_si128(closerMask, bestJ));
+		}
+		_mm_store_ps(&bestDistance[group], best);
+		_mm_store_si128((__m128i*)&bestIndex[group], bestJ);
+	}
+
+	// 오차 합은 스칼라와 같은 순서로 더해야 결과가 비트 단위로 같음
+	float total = 0.0f;
+	for (int i = 0; i < 16; i++)
+	{
+		indices[i] = (uint8_t)bestIndex[i];
+		total += bestDistance[i];
+	}
+	return total;
+}
+#endif
+
+inline float FindClosest(const BlockTexels& texels, const float (*palette)[4], int count, const float weights[4], uint8_t indices[16], bool simd)
+{
+#ifdef BLOCK_COMPRESS_SSE2
+	if (simd) return FindClosestSse2(texels, palette, count, weights, indices);
+#else
+	(void)simd;
+#endif
+	return FindClosestScalar(texels, palette, count, weights, indices);
+}
+
+// 픽셀들이 가장 넓게 퍼진 방향 (공분산 행렬의 주축, 거듭제곱법)으로 min / max 끝점을 잡음
+// channels개 채널만 봄 (BC7은 RGBA 4개, BC1 색은 RGB 3개)
+inline void PrincipalEndpoints(const BlockTexels& texels, int channels, float outLow[4], float outHigh[4])
+{
+	float mean[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	float low[4], high[4];
+	for (int c = 0; c < channels; c++)
+	{
+		low[c] = FLT_MAX;
+		high[c] = -FLT_MAX;
+		for (int i = 0; i < 16; i++)
+		{
+			float v = texels.channel[c][i];
+			mean[c] += v;
+			if (v < low[c]) low[c] = v;
+			if (v > high[c]) high[c] = v;
+		}
+		mean[c] /= 16.0f;
+	}
+
+	float covariance[4][4] = {};
+	for (int i = 0; i < 16; i++)
+	{
+		for (int c = 0; c < channels; c++)
+		{
+			float dc = texels.channel[c][i] - mean[c];
+			for (int k = c; k < channels; k++) covariance[c][k] += dc * (texels.channel[k][i] - mean[k]);
+		}
+	}
+	for (int c = 0; c < channels; c++)
+	{
+		for (int k = 0; k < c; k++) covariance[c][k] = covariance[k][c];
+	}
+
+	float axis[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	for (int c = 0; c < channels; c++) axis[c] = high[c] - low[c];
+	for (int iteration = 0; iteration < 8; iteration++)
+	{
+		float next[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		float length = 0.0f;
+		for (int c = 0; c < channels; c++)
+		{
+			for (int k = 0; k < channels; k++) next[c] += covariance[c][k] * axis[k];
+			length = (std::max)(length, std::fabs(next[c]));
+		}
+		if (length < 1e-6f) break;
+		for (int c = 0; c < channels; c++) axis[c] = next[c] / length;
+	}
+
+	float axisLength = 0.0f;
+	for (int c = 0; c < channels; c++) axisLength += axis[c] * axis[c];
+	if (axisLength < 1e-12f)
+	{
+		// 블록이 한 색이면 평균 하나
+		for (int c = 0; c < channels; c++) outLow[c] = outHigh[c] = mean[c];
+		return;
+	}
+
+	float tMin = FLT_MAX, tMax = -FLT_MAX;
+	for (int i = 0; i < 16; i++)
+	{
+		float t = 0.0f;
+		for (int c = 0; c < channels; c++) t += (texels.channel[c][i] - mean[c]) * axis[c];
+		tMin = (std::min)(tMin, t);
+		tMax = (std::max)(tMax, t);
+	}
+	for (int c = 0; c < channels; c++)
+	{
+		outLow[c] = (std::min)(255.0f, (std::max)(0.0f, mean[c] + axis[c] * tMin / axisLength));
+		outHigh[c] = (std::min)(255.0f, (std::max)(0.0f, mean[c] + axis[c] * tMax / axisLength));
+	}
+}
+
+// 인덱스가 정해진 뒤 끝점을 최소 제곱으로 다시 맞춤 (weights[index] : 0이면 끝점 0, 1이면 끝점 1), 풀 수 없으면 false
+inline bool RefineEndpoints(const BlockTexels& texels, int channels, const uint8_t indices[16], const float* weights, float outLow[4], float outHigh[4])
+{
+	float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+	float ax[4] = { 0.0f, 0.0f, 0.0f, 0.0f }, bx[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	for (int i = 0; i < 16; i++)
+	{
+		float w = weights[indices[i]];
+		float v = 1.0f - w;
+		aa += v * v;
+		ab += v * w;
+		bb += w * w;
+		for (int c = 0; c < channels; c++)
+		{
+			ax[c] += v * texels.channel[c][i];
+			bx[c] += w * texels.channel[c][i];
+		}
+	}
+
+	float det = aa * bb - ab * ab;
+	if (std::fabs(det) < 1e-6f) return false;
+	for (int c = 0; c < channels; c++)
+	{
+		outLow[c] = (std::min)(255.0f, (std::max)(0.0f, (ax[c] * bb - bx[c] * ab) / det));
+		outHigh[c] = (std::min)(255.0f, (std::max)(0.0f, (bx[c] * aa - ax[c] * ab) / det));
+	}
+	return true;
+}
+
+// 128비트 블록에 낮은 비트부터 채워 쓰기 / 읽기
+struct BlockBits
+{
+	uint8_t* bytes;
+	int position;
+
+	void Write(uint32_t value, int count)
+	{
+		for (int i = 0; i < count; i++, position++)
+		{
+			if (value & (1u << i)) bytes[position >> 3] |= (uint8_t)(1u << (position & 7));
+		}
+	}
+};
+
+struct BlockBitReader
+{
+	const uint8_t* bytes;
+	int position;
+
+	uint32_t Read(int count)
+	{
+		uint32_t value = 0;
+		for (int i = 0; i < count; i++, position++) value |= (uint32_t)((bytes[position >> 3] >> (position & 7)) & 1) << i;
+		return value;
+	}
+};
+
+// ---------------- BC7 (모드 6) ----------------
+
+static const int BC7_WEIGHTS4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+// 7비트 끝점 + p비트 -> 8비트
+inline int Bc7Unquantize(int quantized, int pBit) { return (quantized << 1) | pBit; }
+
+inline void Bc7Palette(const int low[4], const int high[4], float palette[16][4])
+{
+	for (int j = 0; j < 16; j++)
+	{
+		for (int c = 0; c < 4; c++) palette[j][c] = (float)(((64 - BC7_WEIGHTS4[j]) * low[c] + BC7_WEIGHTS4[j] * high[c] + 32) >> 6);
+	}
+}
+
+struct Bc7Candidate
+{
+	int quantized[2][4];	// 끝점 7비트
+	int pBit[2];
+	uint8_t indices[16];
+	float error = FLT_MAX;
+};
+
+// 실수 끝점을 p비트 4조합으로 양자화해보고 오차가 가장 작은 것
+inline void Bc7TryEndpoints(const BlockTexels& texels, const float low[4], const float high[4], bool simd, Bc7Candidate& best)
+{
+	static const float weights[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	for (int p0 = 0; p0 < 2; p0++)
+	{
+		for (int p1 = 0; p1 < 2; p1++)
+		{
+			Bc7Candidate candidate;
+			candidate.pBit[0] = p0;
+			candidate.pBit[1] = p1;
+			int endpoints[2][4];
+			for (int c = 0; c < 4; c++)
+			{
+				int q0 = (int)std::floor((low[c] - p0) * 0.5f + 0.5f);
+				int q1 = (int)std::floor((high[c] - p1) * 0.5f + 0.5f);
+				candidate.quantized[0][c] = (std::min)(127, (std::max)(0, q0));
+				candidate.quantized[1][c] = (std::min)(127, (std::max)(0, q1));
+				endpoints[0][c] = Bc7Unquantize(candidate.quantized[0][c], p0);
+				endpoints[1][c] = Bc7Unquantize(candidate.quantized[1][c], p1);
+			}
+
+			float palette[16][4];
+			Bc7Palette(endpoints[0], endpoints[1], palette);
+			candidate.error = FindClosest(texels, palette, 16, weights, candidate.indices, simd);
+			if (candidate.error < best.error) best = candidate;
+		}
+	}
+}
+
+// 모드 5 : RGB 끝점 7비트 + 알파 끝점 8비트, 색과 알파가 인덱스 (2비트)를 따로 가짐
+// 투명한 가장자리와 불투명한 색이 섞인 블록은 RGBA를 한 직선에 놓는 모드 6보다 훨씬 잘 맞음
+static const int BC7_WEIGHTS2[4] = { 0, 21, 43, 64 };
+
+inline int Bc7UnquantizeColor7(int quantized) { return (quantized << 1) | (quantized >> 6); }
+
+struct Bc7Mode5Candidate
+{
+	int color[2][3];	// 끝점 7비트
+	int alpha[2];		// 끝점 8비트
+	uint8_t colorIndices[16];
+	uint8_t alphaIndices[16];
+	float error = FLT_MAX;
+};
+
+inline float Bc7Mode5Color(const BlockTexels& texels, const float low[3], const float high[3], bool simd, Bc7Mode5Candidate& out)
+{
+	static const float weights[4] = { 1.0f, 1.0f, 1.0f, 0.0f };
+	int endpoints[2][3];
+	for (int c = 0; c < 3; c++)
+	{
+		out.color[0][c] = (std::min)(127, (std::max)(0, (int)std::floor(low[c] * 127.0f / 255.0f + 0.5f)));
+		out.color[1][c] = (std::min)(127, (std::max)(0, (int)std::floor(high[c] * 127.0f / 255.0f + 0.5f)));
+		endpoints[0][c] = Bc7UnquantizeColor7(out.color[0][c]);
+		endpoints[1][c] = Bc7UnquantizeColor7(out.color[1][c]);
+	}
+
+	float palette[4][4] = {};
+	for (int j = 0; j < 4; j++)
+	{
+		for (int c = 0; c < 3; c++) palette[j][c] = (float)(((64 - BC7_WEIGHTS2[j]) * endpoints[0][c] + BC7_WEIGHTS2[j] * endpoints[1][c] + 32) >> 6);
+	}
+	return FindClosest(texels, palette, 4, weights, out.colorIndices, simd);
+}
+
+inline void EncodeBc7Mode5(const BlockTexels& texels, bool simd, Bc7Mode5Candidate& best)
+{
+	// 색 : 주축 끝점 -> 인덱스 -> 최소 제곱으로 한 번 더
+	float low[4], high[4];
+	PrincipalEndpoints(texels, 3, low, high);
+	Bc7Mode5Candidate color;
+	float colorError = Bc7Mode5Color(texels, low, high, simd, color);
+
+	float weights[4];
+	for (int j = 0; j < 4; j++) weights[j] = BC7_WEIGHTS2[j] / 64.0f;
+	if (colorError > 0.0f && RefineEndpoints(texels, 3, color.colorIndices, weights, low, high))
+	{
+		Bc7Mode5Candidate refined;
+		float refinedError = Bc7Mode5Color(texels, low, high, simd, refined);
+		if (refinedError < colorError)
+		{
+			color = refined;
+			colorError = refinedError;
+		}
+	}
+
+	// 알파 : 최소 / 최대
+	static const float alphaWeights[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+	float alphaLow = FLT_MAX, alphaHigh = -FLT_MAX;
+	for (int i = 0; i < 16; i++)
+	{
+		alphaLow = (std::min)(alphaLow, texels.channel[3][i]);
+		alphaHigh = (std::max)(alphaHigh, texels.channel[3][i]);
+	}
+	color.alpha[0] = (int)alphaLow;
+	color.alpha[1] = (int)alphaHigh;
+	float alphaPalette[4][4] = {};
+	for (int j = 0; j < 4; j++) alphaPalette[j][3] = (float)(((64 - BC7_WEIGHTS2[j]) * color.alpha[0] + BC7_WEIGHTS2[j] * color.alpha[1] + 32) >> 6);
+	float alphaError = FindClosest(texels, alphaPalette, 4, alphaWeights, color.alphaIndices, simd);
+
+	color.error = colorError + alphaError;
+	best = color;
+}
+
+inline void WriteBc7Mode5(Bc7Mode5Candidate block, uint8_t out[16])
+{
+	// 0번 픽셀 인덱스의 최상위 비트는 생략되므로 0이어야 함 (색 / 알파 각각 끝점을 바꾸고 인덱스를 뒤집음)
+	if (block.colorIndices[0] & 2)
+	{
+		for (int c = 0; c < 3; c++) std::swap(block.color[0][c], block.color[1][c]);
+		for (int i = 0; i < 16; i++) block.colorIndices[i] = (uint8_t)(3 - block.colorIndices[i]);
+	}
+	if (block.alphaIndices[0] & 2)
+	{
+		std::swap(block.alpha[0], block.alpha[1]);
+		for (int i = 0; i < 16; i++) block.alphaIndices[i] = (uint8_t)(3 - block.alphaIndices[i]);
+	}
+
+	memset(out, 0, 16);
+	BlockBits bits = { out, 0 };
+	bits.Write(1u << 5, 6);		// 모드 5
+	bits.Write(0, 2);			// 채널 회전 없음
+	for (int c = 0; c < 3; c++)
+	{
+		bits.Write((uint32_t)block.color[0][c], 7);
+		bits.Write((uint32_t)block.color[1][c], 7);
+	}
+	bits.Write((uint32_t)block.alpha[0], 8);
+	bits.Write((uint32_t)block.alpha[1], 8);
+	bits.Write(block.colorIndices[0], 1);
+	for (int i = 1; i < 16; i++) bits.Write(block.colorIndices[i], 2);
+	bits.Write(block.alphaIndices[0], 1);
+	for (int i = 1; i < 16; i++) bits.Write(block.alphaIndices[i], 2);
+}
+
+inline void WriteBc7Mode6(Bc7Candidate block, uint8_t out[16])
+{
+	// 0번 픽셀 인덱스의 최상위 비트는 생략되므로 0이어야 함 (아니면 끝점을 바꾸고 인덱스를 뒤집음)
+	if (block.indices[0] & 8)
+	{
+		for (int c = 0; c < 4; c++) std::swap(block.quantized[0][c], block.quantized[1][c]);
+		std::swap(block.pBit[0], block.pBit[1]);
+		for (int i = 0; i < 16; i++) block.indices[i] = (uint8_t)(15 - block.indices[i]);
+	}
+
+	memset(out, 0, 16);
+	BlockBits bits = { out, 0 };
+	bits.Write(1u << 6, 7);		// 모드 6
+	for (int c = 0; c < 4; c++)
+	{
+		bits.Write((uint32_t)block.quantized[0][c], 7);
+		bits.Write((uint32_t)block.quantized[1][c], 7);
+	}
+	bits.Write((uint32_t)block.pBit[0], 1);
+	bits.Write((uint32_t)block.pBit[1], 1);
+	bits.Write(block.indices[0], 3);
+	for (int i = 1; i < 16; i++) bits.Write(block.indices[i], 4);
+}
+
+// 모드 6과 모드 5를 둘 다 해보고 오차가 작은 쪽을 씀
+inline void EncodeBc7Block(const BlockTexels& texels, uint8_t out[16], bool simd)
+{
+	float low[4], high[4];
+	PrincipalEndpoints(texels, 4, low, high);
+
+	Bc7Candidate mode6;
+	Bc7TryEndpoints(texels, low, high, simd, mode6);
+
+	// 고른 인덱스로 끝점을 다시 맞춰서 한 번 더
+	float weights[16];
+	for (int j = 0; j < 16; j++) weights[j] = BC7_WEIGHTS4[j] / 64.0f;
+	if (mode6.error > 0.0f && RefineEndpoints(texels, 4, mode6.indices, weights, low, high)) Bc7TryEndpoints(texels, low, high, simd, mode6);
+
+	if (mode6.error > 0.0f)
+	{
+		Bc7Mode5Candidate mode5;
+		EncodeBc7Mode5(texels, simd, mode5);
+		if (mode5.error < mode6.error)
+		{
+			WriteBc7Mode5(mode5, out);
+			return;
+		}
+	}
+	WriteBc7Mode6(mode6, out);
+}
+
+// 모드 5 / 6 블록만 풂 (다른 모드면 false, 픽셀은 검은 투명)
+inline bool DecodeBc7Block(const uint8_t in[16], uint8_t rgba[64])
+{
+	memset(rgba, 0, 64);
+	BlockBitReader bits = { in, 0 };
+
+	if ((in[0] & 0x3F) == 0x20)
+	{
+		bits.Read(6);
+		if (bits.Read(2) != 0) return false;	// 채널 회전은 안 씀
+
+		int color[2][3], alpha[2];
+		for (int c = 0; c < 3; c++)
+		{
+			color[0][c] = Bc7UnquantizeColor7((int)bits.Read(7));
+			color[1][c] = Bc7UnquantizeColor7((int)bits.Read(7));
+		}
+		alpha[0] = (int)bits.Read(8);
+		alpha[1] = (int)bits.Read(8);
+		for (int i = 0; i < 16; i++)
+		{
+			int w = BC7_WEIGHTS2[bits.Read(i == 0 ? 1 : 2)];
+			for (int c = 0; c < 3; c++) rgba[i * 4 + c] = (uint8_t)(((64 - w) * color[0][c] + w * color[1][c] + 32) >> 6);
+		}
+		for (int i = 0; i < 16; i++)
+		{
+			int w = BC7_WEIGHTS2[bits.Read(i == 0 ? 1 : 2)];
+			rgba[i * 4 + 3] = (uint8_t)(((64 - w) * alpha[0] + w * alpha[1] + 32) >> 6);
+		}
+		return true;
+	}
+
+	if (bits.Read(7) != (1u << 6)) return false;
+
+	int quantized[2][4];
+	for (int c = 0; c < 4; c++)
+	{
+		quantized[0][c] = (int)bits.Read(7);
+		quantized[1][c] = (int)bits.Read(7);
+	}
+	int p0 = (int)bits.Read(1);
+	int p1 = (int)bits.Read(1);
+
+	int low[4], high[4];
+	for (int c = 0; c < 4; c++)
+	{
+		low[c] = Bc7Unquantize(quantized[0][c], p0);
+		high[c] = Bc7Unquantize(quantized[1][c], p1);
+	}
+	float palette[16][4];
+	Bc7Palette(low, high, palette);
+
+	for (int i = 0; i < 16; i++)
+	{
+		int index = (int)bits.Read(i == 0 ? 3 : 4);
+		for (int c = 0; c < 4; c++) rgba[i * 4 + c] = (uint8_t)palette[index][c];
+	}
+	return true;
+}
+
+// ---------------- BC3 (BC1 색 + BC4 알파) ----------------
+
+inline uint16_t PackRgb565(const float color[3])
+{
+	int r = (int)std::floor(color[0] * 31.0f / 255.0f + 0.5f);
+	int g = (int)std::floor(color[1] * 63.0f / 255.0f + 0.5f);
+	int b = (int)std::floor(color[2] * 31.0f / 255.0f + 0.5f);
+	return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+inline void UnpackRgb565(uint16_t packed, int out[3])
+{
+	int r = (packed >> 11) & 31, g = (packed >> 5) & 63, b = packed & 31;
+	out[0] = (r << 3) | (r >> 2);
+	out[1] = (g << 2) | (g >> 4);
+	out[2] = (b << 3) | (b >> 2);
+}
+
+// BC3의 색 블록은 끝점 순서와 상관없이 항상 4색 (0 : c0, 1 : c1, 2 : 2/3 c0 + 1/3 c1, 3 : 1/3 c0 + 2/3 c1)
+inline void Bc1Palette(uint16_t c0, uint16_t c1, float palette[4][4])
+{
+	int a[3], b[3];
+	UnpackRgb565(c0, a);
+	UnpackRgb565(c1, b);
+	for (int c = 0; c < 3; c++)
+	{
+		palette[0][c] = (float)a[c];
+		palette[1][c] = (float)b[c];
+		palette[2][c] = (float)((2 * a[c] + b[c]) / 3);
+		palette[3][c] = (float)((a[c] + 2 * b[c]) / 3);
+	}
+	for (int j = 0; j < 4; j++) palette[j][3] = 0.0f;
+}
+
+inline float Bc1TryEndpoints(const BlockTexels& texels, const float low[3], const float high[3], bool simd, uint16_t& outC0, uint16_t& outC1, uint8_t indices[16])
+{
+	static const float weights[4] = { 1.0f, 1.0f, 1.0f, 0.0f };
+	// 밝은 쪽을 c0으로 (BC1 단독으로 읽혀도 4색 모드가 되게 c0 > c1)
+	uint16_t c0 = PackRgb565(high), c1 = PackRgb565(low);
+	if (c0 < c1)
+	{
+		uint16_t swap = c0;
+		c0 = c1;
+		c1 = swap;
+	}
+
+	float palette[4][4];
+	Bc1Palette(c0, c1, palette);
+	float error = FindClosest(texels, palette, c0 == c1 ? 1 : 4, weights, indices, simd);
+	outC0 = c0;
+	outC1 = c1;
+	return error;
+}
+
+inline void EncodeBc3Block(const BlockTexels& texels, uint8_t out[16], bool simd)
+{
+	memset(out, 0, 16);
+
+	// 알파 (BC4, a0 > a1이면 8단계) : 최소 / 최대를 끝점으로
+	float alphaLow = FLT_MAX, alphaHigh = -FLT_MAX;
+	for (int i = 0; i < 16; i++)
+	{
+		alphaLow = (std::min)(alphaLow, texels.channel[3][i]);
+		alphaHigh = (std::max)(alphaHigh, texels.channel[3][i]);
+	}
+	int a0 = (int)alphaHigh, a1 = (int)alphaLow;
+	out[0] = (uint8_t)a0;
+	out[1] = (uint8_t)a1;
+	if (a0 > a1)
+	{
+		static const float weights[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+		float palette[8][4] = {};
+		palette[0][3] = (float)a0;
+		palette[1][3] = (float)a1;
+		for (int j = 1; j < 7; j++) palette[j + 1][3] = (float)(((7 - j) * a0 + j * a1) / 7);
+
+		uint8_t alphaIndices[16];
+		FindClosest(texels, palette, 8, weights, alphaIndices, simd);
+		BlockBits bits = { out + 2, 0 };
+		for (int i = 0; i < 16; i++) bits.Write(alphaIndices[i], 3);
+	}
+
+	// 색 (BC1)
+	float low[4], high[4];
+	PrincipalEndpoints(texels, 3, low, high);
+	uint16_t c0, c1;
+	uint8_t indices[16];
+	float error = Bc1TryEndpoints(texels, low, high, simd, c0, c1, indices);
+
+	if (error > 0.0f && c0 != c1)
+	{
+		static const float weights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };	// 팔레트 번호 -> c1 쪽 비율
+		uint16_t refinedC0, refinedC1;
+		uint8_t refinedIndices[16];
+		if (RefineEndpoints(texels, 3, indices, weights, high, low))	// 0번 끝점이 c0 (밝은 쪽)
+		{
+			float refinedError = Bc1TryEndpoints(texels, low, high, simd, refinedC0, refinedC1, refinedIndices);
+			if (refinedError < error)
+			{
+				c0 = refinedC0;
+				c1 = refinedC1;
+				memcpy(indices, refinedIndices, 16);
+			}
+		}
+	}
+
+	out[8] = (uint8_t)(c0 & 0xFF);
+	out[9] = (uint8_t)(c0 >> 8);
+	out[10] = (uint8_t)(c1 & 0xFF);
+	out[11] = (uint8_t)(c1 >> 8);
+	BlockBits bits = { out + 12, 0 };
+	for (int i = 0; i < 16; i++) bits.Write(indices[i], 2);
+}
+
+inline void DecodeBc3Block(const uint8_t in[16], uint8_t rgba[64])
+{
+	int a0 = in[0], a1 = in[1];
+	int alphas[8] = { a0, a1 };
+	if (a0 > a1)
+	{
+		for (int j = 1; j < 7; j++) alphas[j + 1] = ((7 - j) * a0 + j * a1) / 7;
+	}
+	else
+	{
+		for (int j = 1; j < 5; j++) alphas[j + 1] = ((5 - j) * a0 + j * a1) / 5;
+		alphas[6] = 0;
+		alphas[7] = 255;
+	}
+
+	float palette[4][4];
+	Bc1Palette((uint16_t)(in[8] | in[9] << 8), (uint16_t)(in[10] | in[11] << 8), palette);
+
+	BlockBitReader alphaBits = { in + 2, 0 };
+	BlockBitReader colorBits = { in + 12, 0 };
+	for (int i = 0; i < 16; i++)
+	{
+		int color = (int)colorBits.Read(2);
+		for (int c = 0; c < 3; c++) rgba[i * 4 + c] = (uint8_t)palette[color][c];
+		rgba[i * 4 + 3] = (uint8_t)alphas[alphaBits.Read(3)];
+	}
+}
+
+// ---------------- 이미지 단위 ----------------
+
+// width / height는 4의 배수여야 함, out은 블록 줄마다 outRowPitch 바이트 (블록 줄 하나 = width / 4 * 16바이트 이상)
+// jobs가 있으면 블록 줄 단위로 나눠서 병렬로 (블록끼리 독립이라 결과는 스레드 수와 상관없이 같음)
+inline void CompressImage(const uint8_t* rgba, int width, int height, int pitch, BlockFormat format, uint8_t* out, size_t outRowPitch,
+	bool simd = true, JobSystem* jobs = nullptr)
+{
+	auto compressRows = [&](int begin, int end)
+	{
+		BlockTexels texels;
+		for (int by = begin; by < end; by++)
+		{
+			uint8_t* dst = out + (size_t)by * outRowPitch;
+			for (int bx = 0; bx < width / 4; bx++)
+			{
+				LoadBlock(rgba + (size_t)by * 4 * pitch + bx * 16, pitch, texels);
+				if (format == BLOCK_BC7) EncodeBc7Block(texels, dst + bx * BLOCK_BYTES, simd);
+				else EncodeBc3Block(texels, dst + bx * BLOCK_BYTES, simd);
+			}
+		}
+	};
+
+	if (jobs != nullptr) jobs->ParallelFor(0, height / 4, 4, compressRows);
+	else compressRows(0, height / 4);
+}
+
+inline void DecompressImage(const uint8_t* blocks, size_t blockRowPitch, int width, int height, BlockFormat format, uint8_t* rgba, int pitch)
+{
+	uint8_t texels[64];
+	for (int by = 0; by < height / 4; by++)
+	{
+		for (int bx = 0; bx < width / 4; bx++)
+		{
+			const uint8_t* block = blocks + (size_t)by * blockRowPitch + bx * BLOCK_BYTES;
+			if (format == BLOCK_BC7) DecodeBc7Block(block, texels);
+			else DecodeBc3Block(block, texels);
+			for (int y = 0; y < 4; y++) memcpy(rgba + (size_t)(by * 4 + y) * pitch + bx * 16, texels + y * 16, 16);
+		}
+	}
+}
+
+// RGBA 채널 전체의 PSNR (dB, 같으면 무한대 대신 99)
+inline double ComputePsnr(const uint8_t* a, const uint8_t* b, int width, int height, int pitch)
+{
+	double squared = 0.0;
+	for (int y = 0; y < height; y++)
+	{
+		const uint8_t* rowA = a + (size_t)y * pitch;
+		const uint8_t* rowB = b + (size_t)y * pitch;
+		for (int x = 0; x < width * 4; x++)
+		{
+			double d = (double)rowA[x] - rowB[x];
+			squared += d * d;
+		}
+	}
+	if (squared == 0.0) return 99.0;
+	double mse = squared / ((double)width * height * 4);
+	return 10.0 * std::log10(255.0 * 255.0 / mse);
+}
@@ -0,0 +1,71 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+
+// 서술자 힙 한 칸 번호 할당기 (번호 관리만, 그래픽 API와 무관)
+// 한 번 받은 번호는 Free 전까지 바뀌지 않으므로 셰이더가 그 번호로 바로 텍스처를 찾을 수 있음
+// 반납된 번호는 free list에 쌓아뒀다가 가장 최근 것부터 다시 줌 (아직 안 쓴 칸보다 먼저)
+class DescriptorAllocator
+{
+private:
+	int capacity = 0;
+	int reserved = 0;				// 0 ~ reserved-1번은 고정 용도라 나눠주지 않음
+	int nextUnused = 0;				// 한 번도 안 나간 첫 번호
+	std::vector<int> freeList;
+	std::vector<uint8_t> inUse;
+	int usedCount = 0;
+	int peakCount = 0;
+
+public:
+	void Initialize(int newCapacity, int reservedCount = 0)
+	{
+		capacity = newCapacity;
+		reserved = reservedCount;
+		nextUnused = reservedCount;
+		freeList.clear();
+		inUse.assign(newCapacity, 0);
+		usedCount = 0;
+		peakCount = 0;
+	}
+
+	// 빈 번호 하나 (꽉 차면 -1)
+	int Allocate()
+	{
+		int index = -1;
+		if (!freeList.empty())
+		{
+			index = freeList.back();
+			freeList.pop_back();
+		}
+		else if (nextUnused < capacity)
+		{
+			index = nextUnused++;
+		}
+		else
+		{
+			return -1;
+		}
+
+		inUse[index] = 1;
+		usedCount++;
+		if (usedCount > peakCount) peakCount = usedCount;
+		return index;
+	}
+
+	// 번호 반납 (고정 번호, 범위 밖, 이미 반납된 번호는 무시하고 false)
+	bool Free(int index)
+	{
+		if (index < reserved || index >= capacity || !inUse[index]) return false;
+
+		inUse[index] = 0;
+		usedCount--;
+		freeList.push_back(index);
+		return true;
+	}
+
+	bool IsAllocated(int index) const { return index >= 0 && index < capacity && inUse[index] != 0; }
+	int GetCapacity() const { return capacity; }
+	int GetReservedCount() const { return reserved; }
+	int GetUsedCount() const { return usedCount; }
+	int GetPeakCount() const { return peakCount; }
+};
@@ -0,0 +1,111 @@
+﻿#pragma once
+#include <d3d12.h>
+#include <wrl.h>
+#include "FrameRing.h"
+#include "UploadHeap.h"
+
+// ID3D12Fence를 FrameRing이 쓰는 펜스로 (Signal은 커맨드 큐 끝에 넣고, Wait는 이벤트로 CPU를 재움)
+class D3D12FrameFence : public IFrameFence
+{
+private:
+	ID3D12CommandQueue* queue = nullptr;
+	Microsoft::WRL::ComPtr<ID3D12Fence> fence;
+	HANDLE fenceEvent = nullptr;
+
+public:
+	~D3D12FrameFence()
+	{
+		if (fenceEvent != nullptr) CloseHandle(fenceEvent);
+	}
+
+	bool Initialize(ID3D12Device* device, ID3D12CommandQueue* newQueue)
+	{
+		queue = newQueue;
+		device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence));
+
+		// Event 운영체제로 부터 발급 받기
+		fenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+		return fence != nullptr && fenceEvent != nullptr;
+	}
+
+	void Signal(uint64_t value) override { queue->Signal(fence.Get(), value); }
+	uint64_t GetCompletedValue() override { return fence->GetCompletedValue(); }
+
+	void Wait(uint64_t value) override
+	{
+		// 만약 GPU가 아직 그 번호를 Fence에 안 적었다면? (아직 작업 중이라면?)
+		if (fence->GetCompletedValue() < value)
+		{
+			// Event를 설정하고 GPU가 번호를 적을 때까지 CPU를 Wait 시킴
+			fence->SetEventOnCompletion(value, fenceEvent);
+			WaitForSingleObject(fenceEvent, INFINITE);
+		}
+	}
+};
+
+// 프레임 칸 하나가 따로 가지는 것 (GPU가 그 칸의 예전 프레임을 다 읽기 전에는 건드리면 안 되는 것들)
+struct FrameContext
+{
+	Microsoft::WRL::ComPtr<ID3D12CommandAllocator> commandAllocator;	// 명령서 메모리 (칸의 예전 프레임이 끝나야 Reset 가능)
+	uint64_t fenceValue = 0;	// 이 칸의 마지막 프레임이 Signal한 번호
+	uint64_t uploadBytes = 0;	// 이 칸의 마지막 프레임이 업로드 버퍼에서 떼어간 바이트 (정렬 포함)
+};
+
+// 프레임 칸 2 ~ 3개를 돌려 쓰면서 CPU가 다음 프레임 명령을 적는 동안 GPU가 앞 프레임을 그리게 함
+// 칸마다 명령 할당자를 따로 두고, 업로드 버퍼 (UploadHeap)는 프레임마다 떼어간 조각을 그 프레임의 펜스 번호로 표시했다가 GPU가 지나가면 반납
+class FrameContextRing
+{
+public:
+	static const int DEFAULT_FRAMES_IN_FLIGHT = 2;
+
+private:
+	D3D12FrameFence fence;
+	FrameRing ring;
+	FrameContext frames[MAX_FRAMES_IN_FLIGHT];
+	uint64_t uploadUsedAtBegin = 0;
+
+public:
+	bool Initialize(ID3D12Device* device, ID3D12CommandQueue* queue, int framesInFlight = DEFAULT_FRAMES_IN_FLIGHT)
+	{
+		if (!fence.Initialize(device, queue)) return false;
+		ring.Initialize(&fence, framesInFlight);
+
+		// 커맨드 할당자 (Command Allocator) 생성
+		// 명령서를 작성하기 위한 실제 메모리 공간을 할당 (프레임 칸마다 하나)
+		for (int i = 0; i < ring.GetFrameCount(); i++)
+		{
+			if (FAILED(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&frames[i].commandAllocator)))) return false;
+		}
+		return true;
+	}
+
+	// 다음 칸으로 넘어감 (CPU가 GPU를 한 바퀴 따라잡았을 때만 기다림)
+	// GPU가 끝낸 프레임의 업로드 조각을 반납하고, 이 칸의 할당자를 비워서 돌려줌 (명령 리스트는 이 할당자로 Reset)
+	FrameContext& BeginFrame(UploadHeap& uploads)
+	{
+		FrameContext& frame = frames[ring.BeginFrame()];
+		uploads.Retire(ring.GetCompletedValue());
+		uploadUsedAtBegin = uploads.GetRing().GetUsed();
+
+		frame.commandAllocator->Reset();
+		return frame;
+	}
+
+	// 이번 프레임 명령을 큐에 넣은 뒤 부름 (펜스 번호를 Signal하고 이번 프레임 업로드 조각을 그 번호로 표시)
+	uint64_t EndFrame(UploadHeap& uploads)
+	{
+		FrameContext& frame = frames[ring.GetCurrentFrame()];
+		frame.fenceValue = ring.EndFrame();
+		frame.uploadBytes = uploads.GetRing().GetUsed() - uploadUsedAtBegin;
+		uploads.FinishFrame(frame.fenceValue);
+		return frame.fenceValue;
+	}
+
+	// GPU가 큐의 일을 전부 끝낼 때까지 기다림 (시작할 때 텍스처 업로드 뒤, 종료 전)
+	void WaitForIdle() { ring.WaitForIdle(); }
+
+	// 시작할 때 명령 리스트를 만들 할당자 (첫 칸, 첫 BeginFrame 전에 WaitForIdle해야 함)
+	ID3D12CommandAllocator* GetInitialAllocator() const { return frames[0].commandAllocator.Get(); }
+
+	const FrameRing& GetRing() const { return ring; }
+};
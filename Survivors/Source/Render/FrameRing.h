@@ -0,0 +1,158 @@
+﻿#pragma once
+#include <cstdint>
+#include <deque>
+#include <algorithm>
+
+// 동시에 GPU에 올라가 있는 프레임 수를 정하는 링 (펜스 번호 계산만, 그래픽 API와 무관)
+// 프레임마다 GPU가 다 그릴 때까지 기다리면 CPU와 GPU가 번갈아 놀게 되므로, 프레임 칸을 2 ~ 3개 두고 칸마다 명령 할당자 / 업로드 조각을 따로 씀
+// 칸을 다시 쓰려는데 그 칸의 예전 프레임이 아직 GPU에 있을 때만 (CPU가 GPU를 한 바퀴 따라잡았을 때만) 기다림
+// 펜스는 IFrameFence 뒤에 숨겨서 게임은 ID3D12Fence (FrameContext.h)로, 벤치마크는 SimulatedFence로 같은 링을 돌림
+
+static const int MAX_FRAMES_IN_FLIGHT = 3;
+
+// 펜스 : CPU가 큐 끝에 번호를 Signal해두면 GPU가 그 앞의 일을 다 끝냈을 때 완료 번호가 그 번호가 됨 (번호는 늘기만 함)
+class IFrameFence
+{
+public:
+	virtual ~IFrameFence() {}
+	virtual void Signal(uint64_t value) = 0;	// 지금까지 제출한 일 뒤에 value를 적는 명령을 넣음
+	virtual uint64_t GetCompletedValue() = 0;	// GPU가 끝낸 가장 큰 번호
+	virtual void Wait(uint64_t value) = 0;		// value가 끝날 때까지 CPU를 재움
+};
+
+class FrameRing
+{
+private:
+	IFrameFence* fence = nullptr;
+	int frameCount = 0;
+	int current = -1;								// 지금 기록 중인 칸 (BeginFrame ~ EndFrame 사이)
+	uint64_t slotFences[MAX_FRAMES_IN_FLIGHT] = {};	// 칸마다 마지막으로 그 칸을 쓴 프레임의 펜스 번호 (0이면 아직 안 씀)
+	uint64_t nextFenceValue = 1;
+
+	uint64_t frames = 0;
+	uint64_t waits = 0;		// 칸을 다시 쓰려고 기다린 횟수
+
+public:
+	// newFrameCount : 동시에 GPU에 올라갈 수 있는 프레임 수 (1이면 예전처럼 매 프레임 기다림)
+	void Initialize(IFrameFence* newFence, int newFrameCount)
+	{
+		fence = newFence;
+		frameCount = (std::max)(1, (std::min)(newFrameCount, MAX_FRAMES_IN_FLIGHT));
+		current = -1;
+		for (uint64_t& value : slotFences) value = 0;
+		nextFenceValue = 1;
+		frames = waits = 0;
+	}
+
+	// 다음 칸으로 넘어가서 번호를 돌려줌 (그 칸을 쓴 프레임이 아직 GPU에 있으면 끝날 때까지 기다림)
+	// 돌아온 뒤에는 그 칸의 명령 할당자 / 업로드 조각을 다시 써도 됨
+	int BeginFrame()
+	{
+		current = (current + 1) % frameCount;
+		uint64_t previous = slotFences[current];
+		if (previous != 0 && fence->GetCompletedValue() < previous)
+		{
+			waits++;
+			fence->Wait(previous);
+		}
+		return current;
+	}
+
+	// 이번 프레임의 명령을 모두 제출한 뒤 부름 : 펜스 번호를 Signal해서 칸에 적고 그 번호를 돌려줌 (업로드 조각 반납 표시용)
+	uint64_t EndFrame()
+	{
+		uint64_t value = nextFenceValue++;
+		fence->Signal(value);
+		slotFences[current] = value;
+		frames++;
+		return value;
+	}
+
+	// 제출한 일을 GPU가 전부 끝낼 때까지 기다림 (시작할 때 텍스처 업로드, 끝낼 때 자원 해제 전)
+	void WaitForIdle()
+	{
+		uint64_t value = nextFenceValue++;
+		fence->Signal(value);
+		fence->Wait(value);
+	}
+
+	uint64_t GetCompletedValue() { return fence->GetCompletedValue(); }
+	uint64_t GetLastSignaledValue() const { return nextFenceValue - 1; }
+	int GetFrameCount() const { return frameCount; }
+	int GetCurrentFrame() const { return current; }
+	uint64_t GetFrames() const { return frames; }
+	uint64_t GetWaits() const { return waits; }
+};
+
+// GPU 없이 링을 돌리는 가짜 펜스 (시간은 CPU 쪽에서 흘려보내는 가상 시간, 단위는 쓰는 쪽 마음대로)
+// GPU는 Signal 사이에 제출된 일 (SubmitWork로 쌓은 시간)을 순서대로 처리하고, 앞의 일이 끝나기 전에는 다음 일을 시작하지 않음
+class SimulatedFence : public IFrameFence
+{
+private:
+	struct Pending
+	{
+		uint64_t value;
+		double finishTime;
+	};
+
+	std::deque<Pending> queue;	// 아직 안 끝난 Signal (번호 순서)
+	double now = 0.0;			// CPU 시각
+	double gpuFreeTime = 0.0;	// GPU가 지금 받은 일을 다 끝내는 시각
+	double submittedWork = 0.0;	// 마지막 Signal 뒤로 제출된 일의 GPU 시간
+	double waitedTime = 0.0;	// Wait로 CPU가 논 시간 합계
+	uint64_t completed = 0;
+
+	void Update()
+	{
+		while (!queue.empty() && queue.front().finishTime <= now)
+		{
+			completed = queue.front().value;
+			queue.pop_front();
+		}
+	}
+
+public:
+	// 명령 목록 하나를 제출한 것처럼 GPU 일을 쌓음 (다음 Signal이 이 일이 끝난 뒤에 완료됨)
+	void SubmitWork(double gpuTime) { submittedWork += gpuTime; }
+
+	// CPU가 일한 만큼 시간을 흘려보냄 (그 사이 GPU가 끝낸 번호가 완료로 바뀜)
+	void Advance(double cpuTime)
+	{
+		now += cpuTime;
+		Update();
+	}
+
+	void Signal(uint64_t value) override
+	{
+		gpuFreeTime = (std::max)(now, gpuFreeTime) + submittedWork;
+		submittedWork = 0.0;
+		queue.push_back({ value, gpuFreeTime });
+	}
+
+	uint64_t GetCompletedValue() override
+	{
+		Update();
+		return completed;
+	}
+
+	void Wait(uint64_t value) override
+	{
+		Update();
+		if (completed >= value) return;
+		for (const Pending& pending : queue)
+		{
+			if (pending.value < value) continue;
+			if (pending.finishTime > now)
+			{
+				waitedTime += pending.finishTime - now;
+				now = pending.finishTime;
+			}
+			break;
+		}
+		Update();
+	}
+
+	double GetTime() const { return now; }
+	double GetWaitedTime() const { return waitedTime; }
+	int GetPendingCount() const { return (int)queue.size(); }	// 아직 GPU에 남아있는 Signal 수
+};
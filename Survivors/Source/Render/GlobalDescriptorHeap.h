@@ -0,0 +1,88 @@
+﻿#pragma once
+#include <d3d12.h>
+#include <wrl.h>
+#include "../Utils/d3dx12.h"
+#include "DescriptorAllocator.h"
+
+// 게임 전체가 같이 쓰는 셰이더용 CBV / SRV / UAV 서술자 힙 하나 (바인드리스)
+// 텍스처마다 힙을 따로 만들면 그릴 때마다 SetDescriptorHeaps로 힙을 바꿔야 하는데, 하드웨어는 힙 교체를 비싸게 처리함
+// 대신 큰 힙 하나에 텍스처마다 고정 번호를 주고, 셰이더는 인스턴스가 넘겨준 번호로 textures[번호]를 읽음
+// 0번은 "텍스처 없음" (null SRV, 읽으면 0)이고 빈 칸도 전부 null SRV로 채워둠
+// 1번은 팔레트 텍스처 자리 (8비트 팔레트 텍스처가 색을 찾는 표, GpuTextureCache가 채우고 셰이더는 고정 번호로 읽음)
+// 테이블 크기가 128칸을 넘으므로 Resource Binding Tier 2 이상 필요
+class GlobalDescriptorHeap
+{
+public:
+	static const int DEFAULT_CAPACITY = 1024;
+	static const int NULL_DESCRIPTOR = 0;
+	static const int PALETTE_DESCRIPTOR = 1;
+
+private:
+	Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> heap;
+	UINT descriptorSize = 0;
+	DescriptorAllocator allocator;
+
+	void WriteNullTexture(ID3D12Device* device, int index)
+	{
+		D3D12_SHADER_RESOURCE_VIEW_DESC nullDesc = {};
+		nullDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+		nullDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		nullDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+		nullDesc.Texture2D.MipLevels = 1;
+		device->CreateShaderResourceView(nullptr, &nullDesc, GetCPUHandle(index));
+	}
+
+public:
+	void Initialize(ID3D12Device* device, int capacity = DEFAULT_CAPACITY)
+	{
+		D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
+		heapDesc.NumDescriptors = capacity;
+		heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+		heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+		device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&heap));
+		descriptorSize = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+		allocator.Initialize(capacity, PALETTE_DESCRIPTOR + 1);
+		for (int i = 0; i < capacity; i++) WriteNullTexture(device, i);
+	}
+
+	// 빈 칸 번호를 하나 받음 (SRV를 만들기 전까지는 null SRV라 읽으면 0, 힙이 꽉 차면 NULL_DESCRIPTOR)
+	int Allocate()
+	{
+		int index = allocator.Allocate();
+		return index < 0 ? NULL_DESCRIPTOR : index;
+	}
+
+	// 받아둔 칸에 텍스처 SRV를 만듦
+	void WriteTextureView(ID3D12Device* device, int index, ID3D12Resource* resource, const D3D12_SHADER_RESOURCE_VIEW_DESC& srvDesc)
+	{
+		if (index == NULL_DESCRIPTOR) return;
+		device->CreateShaderResourceView(resource, &srvDesc, GetCPUHandle(index));
+	}
+
+	// 텍스처 SRV를 빈 칸에 만들고 그 번호를 돌려줌 (힙이 꽉 차면 NULL_DESCRIPTOR)
+	int CreateTextureView(ID3D12Device* device, ID3D12Resource* resource, const D3D12_SHADER_RESOURCE_VIEW_DESC& srvDesc)
+	{
+		int index = Allocate();
+		WriteTextureView(device, index, resource, srvDesc);
+		return index;
+	}
+
+	// 번호 반납 (칸은 null SRV로 되돌림, GPU가 아직 그 번호를 읽는 프레임이 없을 때 불러야 함)
+	void Free(ID3D12Device* device, int index)
+	{
+		if (allocator.Free(index)) WriteNullTexture(device, index);
+	}
+
+	D3D12_CPU_DESCRIPTOR_HANDLE GetCPUHandle(int index) const
+	{
+		return CD3DX12_CPU_DESCRIPTOR_HANDLE(heap->GetCPUDescriptorHandleForHeapStart(), index, descriptorSize);
+	}
+	D3D12_GPU_DESCRIPTOR_HANDLE GetGPUHandle(int index) const
+	{
+		return CD3DX12_GPU_DESCRIPTOR_HANDLE(heap->GetGPUDescriptorHandleForHeapStart(), index, descriptorSize);
+	}
+
+	ID3D12DescriptorHeap* GetHeap() const { return heap.Get(); }
+	const DescriptorAllocator& GetAllocator() const { return allocator; }
+};
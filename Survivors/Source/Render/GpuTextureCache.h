@@ -0,0 +1,343 @@
+﻿#pragma once
+#include <d3d12.h>
+#include <wrl.h>
+#include "../Utils/d3dx12.h"
+#include "GlobalDescriptorHeap.h"
+#include "ImageDecoder.h"
+#include "../Utils/AssetPack.h"
+#include "TextureCache.h"
+#include "PaletteTexture.h"
+#include "SpriteBatch.h"
+
+// GPU에 올라간 텍스처 하나
+struct GpuTexture
+{
+	Microsoft::WRL::ComPtr<ID3D12Resource> resource;
+	Microsoft::WRL::ComPtr<ID3D12Resource> uploadBuffer;	// 복사 명령이 끝나면 ReleaseUploadBuffers로 버림
+	int descriptor = GlobalDescriptorHeap::NULL_DESCRIPTOR;	// 전역 서술자 힙 칸 (셰이더가 읽는 텍스처 번호)
+	int width = 0;
+	int height = 0;
+	DXGI_FORMAT format = DXGI_FORMAT_R8G8B8A8_UNORM;
+	float uvScale[2] = { 1.0f, 1.0f };	// 팩에서 프레임 칸으로 다시 배치된 텍스처면 1보다 작음 (프레임 uv 크기에 곱함)
+	const AssetPackFrame* frames = nullptr;	// 팩의 아틀라스 텍스처면 프레임 표 (메모리 맵 안을 가리킴)
+	int frameCount = 0;
+	int paletteRow = -1;	// 팩의 8비트 팔레트 텍스처면 팔레트 텍스처의 줄 번호 (아니면 -1)
+	int mipLevels = 1;
+};
+
+// 파일 경로 하나당 텍스처를 한 번만 읽고 올리는 캐시
+// 젬, 미사일, 폰트처럼 같은 그림을 쓰는 객체가 수십 개여도 PNG 해제 / GPU 업로드 / 서술자는 파일마다 하나
+// 시작할 때는 Acquire로 필요한 파일을 모두 모은 뒤 FinishLoads 한 번으로 병렬로 풀고 올림
+// 에셋 팩이 있으면 팩에 든 파일은 풀지 않고 메모리 맵의 픽셀 (큰 시트는 BC7 / BC3 블록)을 밉 단계까지 그대로 업로드 버퍼로 복사
+// 8비트 팔레트 텍스처는 번호만 R8로 올리고, 팔레트는 전부 한 장의 팔레트 텍스처 (256 x MAX_SPRITE_PALETTES, 줄마다 팔레트 하나)에 모음
+class GpuTextureCache
+{
+private:
+	ID3D12Device* device = nullptr;
+	GlobalDescriptorHeap* descriptors = nullptr;
+	const AssetPack* pack = nullptr;
+	TextureCache<GpuTexture> cache;
+
+	// Acquire는 서술자 칸만 잡고 파일 읽기는 FinishLoads로 미룸 (파일마다 하나씩)
+	struct PendingLoad
+	{
+		TextureHandle handle;
+		std::string path;
+	};
+	std::vector<PendingLoad> pending;
+
+	// 팔레트 텍스처 (줄은 한 번 잡으면 돌려주지 않음, 같은 팔레트는 같은 줄을 같이 씀)
+	std::vector<uint32_t> paletteRows;	// CPU 사본 (PALETTE_SIZE x 줄 수)
+	bool paletteDirty = false;
+	Microsoft::WRL::ComPtr<ID3D12Resource> paletteTexture;
+	std::vector<Microsoft::WRL::ComPtr<ID3D12Resource>> paletteUploads;	// ReleaseUploadBuffers까지 들고 있음
+
+	// 팔레트의 줄 번호 (처음 보는 팔레트면 줄을 새로 잡음, 다 차면 -1)
+	int AcquirePaletteRow(const uint32_t* palette)
+	{
+		int rows = (int)(paletteRows.size() / PALETTE_SIZE);
+		for (int row = 0; row < rows; row++)
+		{
+			if (memcmp(&paletteRows[(size_t)row * PALETTE_SIZE], palette, sizeof(uint32_t) * PALETTE_SIZE) == 0) return row;
+		}
+		if (rows >= MAX_SPRITE_PALETTES) return -1;
+		paletteRows.insert(paletteRows.end(), palette, palette + PALETTE_SIZE);
+		paletteDirty = true;
+		return rows;
+	}
+
+	// 바뀐 팔레트 표를 팔레트 텍스처로 올림 (처음이면 텍스처와 PALETTE_DESCRIPTOR 칸의 SRV를 만듦)
+	void UploadPalettes(ID3D12GraphicsCommandList* cmdList)
+	{
+		if (!paletteDirty) return;
+		paletteDirty = false;
+
+		bool created = false;
+		if (paletteTexture == nullptr)
+		{
+			CD3DX12_RESOURCE_DESC texDesc = CD3DX12_RESOURCE_DESC::Tex2D(DXGI_FORMAT_R8G8B8A8_UNORM, PALETTE_SIZE, MAX_SPRITE_PALETTES, 1, 1);
+			CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_DEFAULT);
+			HRESULT hr = device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &texDesc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&paletteTexture));
+			if (FAILED(hr) || paletteTexture == nullptr)
+			{
+				MessageBoxA(nullptr, "팔레트 텍스처 생성 실패!", "GPU 에러", MB_OK);
+				return;
+			}
+			created = true;
+		}
+		else
+		{
+			// 이미 읽고 있던 텍스처면 복사 대상으로 바꿨다가 되돌림 (앞 프레임이 읽는 줄은 내용이 그대로라 같이 덮어써도 됨)
+			CD3DX12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(paletteTexture.Get(), D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_COPY_DEST);
+			cmdList->ResourceBarrier(1, &barrier);
+		}
+
+		std::vector<uint32_t> table((size_t)PALETTE_SIZE * MAX_SPRITE_PALETTES, 0);
+		std::copy(paletteRows.begin(), paletteRows.end(), table.begin());
+
+		Microsoft::WRL::ComPtr<ID3D12Resource> upload;
+		CD3DX12_HEAP_PROPERTIES uploadHeapProps(D3D12_HEAP_TYPE_UPLOAD);
+		CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(GetRequiredIntermediateSize(paletteTexture.Get(), 0, 1));
+		device->CreateCommittedResource(&uploadHeapProps, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&upload));
+
+		D3D12_SUBRESOURCE_DATA data = {};
+		data.pData = table.data();
+		data.RowPitch = PALETTE_SIZE * 4;
+		data.SlicePitch = (LONG_PTR)PALETTE_SIZE * 4 * MAX_SPRITE_PALETTES;
+		UpdateSubresources(cmdList, paletteTexture.Get(), upload.Get(), 0, 0, 1, &data);
+		paletteUploads.push_back(upload);
+
+		CD3DX12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(paletteTexture.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+		cmdList->ResourceBarrier(1, &barrier);
+
+		if (created)
+		{
+			D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+			srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+			srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+			srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+			srvDesc.Texture2D.MipLevels = 1;
+			descriptors->WriteTextureView(device, GlobalDescriptorHeap::PALETTE_DESCRIPTOR, paletteTexture.Get(), srvDesc);
+		}
+	}
+
+	// 팩 텍스처 형식에 맞는 DXGI 형식
+	static DXGI_FORMAT ToDxgiFormat(uint32_t format)
+	{
+		switch (format)
+		{
+		case ASSET_FORMAT_BC3: return DXGI_FORMAT_BC3_UNORM;
+		case ASSET_FORMAT_BC7: return DXGI_FORMAT_BC7_UNORM;
+		case ASSET_FORMAT_PALETTE8: return DXGI_FORMAT_R8_UNORM;
+		default: return DXGI_FORMAT_R8G8B8A8_UNORM;
+		}
+	}
+
+	// 픽셀 (RGBA8 / R8) 또는 4x4 블록 (BC3 / BC7, 줄 하나가 블록 한 줄)을 GPU로 넘기는 DX12 마법의 코드
+	// levels : 밉 단계마다 데이터 (RowPitch : 줄 간격, SlicePitch : 줄 간격 x 줄 수), mipLevels개
+	bool Upload(ID3D12GraphicsCommandList* cmdList, const char* filename, DXGI_FORMAT format, int width, int height, int mipLevels,
+		const D3D12_SUBRESOURCE_DATA* levels, GpuTexture& out)
+	{
+		if (levels == nullptr || levels[0].pData == nullptr)
+		{
+			MessageBoxA(nullptr, filename, "Texture Load Failed! Check File Path/Name", MB_OK);
+			return false;
+		}
+
+		// 이미지가 DX12 한계치(16384)를 넘는지 검사
+		if (width > 16384 || height > 16384)
+		{
+			MessageBoxA(nullptr, "2. 이미지가 너무 큽니다! (가로세로 16384 픽셀 제한 초과)", "DX12 하드웨어 한계 초과", MB_OK);
+			return false;
+		}
+
+		// GPU 메모리에 Texture 만들기
+		CD3DX12_RESOURCE_DESC texDesc = CD3DX12_RESOURCE_DESC::Tex2D(format, width, height, 1, (UINT16)mipLevels);
+		CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_DEFAULT);
+
+		// GPU가 도화지를 진짜 잘 만들었는지 결과(HRESULT)를 검사!
+		HRESULT hr = device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &texDesc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&out.resource));
+		if (FAILED(hr) || out.resource == nullptr)
+		{
+			MessageBoxA(nullptr, "3. GPU 메모리에 텍스처 생성 실패!", "GPU 에러", MB_OK);
+			return false;
+		}
+
+		// 복사용 Upload Heap 만들기
+		const UINT64 uploadBufferSize = GetRequiredIntermediateSize(out.resource.Get(), 0, mipLevels);
+		CD3DX12_HEAP_PROPERTIES uploadHeapProps(D3D12_HEAP_TYPE_UPLOAD);
+		CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(uploadBufferSize);
+		device->CreateCommittedResource(&uploadHeapProps, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&out.uploadBuffer));
+
+		// Upload Heap에 데이터 싣고 GPU 도화지로 복사 명령 내리기
+		UpdateSubresources(cmdList, out.resource.Get(), out.uploadBuffer.Get(), 0, 0, mipLevels, levels);
+
+		// 복사가 끝난 도화지를 읽기 전용 (SRV) 모드로 변환
+		CD3DX12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(out.resource.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+		cmdList->ResourceBarrier(1, &barrier);
+
+		// Acquire 때 받아둔 서술자 칸에 텍스처를 쓸 수 있는 SRV 생성
+		D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+		srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+		srvDesc.Format = texDesc.Format;
+		srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+		srvDesc.Texture2D.MipLevels = mipLevels;
+		descriptors->WriteTextureView(device, out.descriptor, out.resource.Get(), srvDesc);
+
+		out.width = width;
+		out.height = height;
+		out.format = format;
+		out.mipLevels = mipLevels;
+		return true;
+	}
+
+	// 팩 텍스처 하나를 밉 단계까지 올림
+	// 팔레트 줄을 못 받은 팔레트 텍스처 (팔레트가 MAX_SPRITE_PALETTES개를 넘음)는 여기서 RGBA8로 풀어서 올림
+	void UploadPackTexture(ID3D12GraphicsCommandList* cmdList, const char* filename, const AssetPackEntry& entry, GpuTexture& texture)
+	{
+		bool expand = entry.format == ASSET_FORMAT_PALETTE8 && texture.paletteRow < 0;
+		const uint8_t* base = pack->GetData(entry);
+		D3D12_SUBRESOURCE_DATA levels[ASSET_PACK_MAX_MIP_LEVELS] = {};
+		std::vector<std::vector<uint8_t>> expanded(expand ? entry.mipLevels : 0);
+		for (uint32_t i = 0; i < entry.mipLevels; i++)
+		{
+			AssetTextureLevel level = GetTextureLevel(entry, i);
+			levels[i].pData = base + level.offset;
+			levels[i].RowPitch = level.rowPitch;
+			if (expand)
+			{
+				expanded[i].resize((size_t)level.width * level.height * 4);
+				DecodePaletteImage(base + level.offset, level.rowPitch, (int)level.width, (int)level.height, pack->GetPalette(entry), expanded[i].data(), (size_t)level.width * 4);
+				levels[i].pData = expanded[i].data();
+				levels[i].RowPitch = (LONG_PTR)level.width * 4;
+			}
+			levels[i].SlicePitch = levels[i].RowPitch * level.rows;
+		}
+		Upload(cmdList, filename, expand ? DXGI_FORMAT_R8G8B8A8_UNORM : ToDxgiFormat(entry.format), (int)entry.width, (int)entry.height, (int)entry.mipLevels, levels, texture);
+	}
+
+public:
+	// newPack : 열려있는 에셋 팩 (없으면 nullptr, 캐시보다 오래 살아있어야 함)
+	void Initialize(ID3D12Device* newDevice, GlobalDescriptorHeap* newDescriptors, const AssetPack* newPack = nullptr)
+	{
+		device = newDevice;
+		descriptors = newDescriptors;
+		pack = newPack != nullptr && newPack->IsOpen() ? newPack : nullptr;
+	}
+
+	// 텍스처 핸들을 받음 (처음 보는 파일이면 서술자 칸만 잡아두고 읽기 목록에 올림, 서술자 힙이 꽉 차면 빈 핸들)
+	// 서술자 번호는 바로 정해지므로 객체는 지금 받은 번호를 그대로 쓰면 되고, 그림은 FinishLoads가 채움 (그 전까지는 null SRV라 안 보임)
+	TextureHandle Acquire(const char* filename)
+	{
+		bool added = false;
+		TextureHandle handle = cache.Acquire(filename, [&](const char*, GpuTexture& out)
+			{
+				out.descriptor = descriptors->Allocate();
+				added = true;
+
+				// 칸 배치 비율과 아틀라스 프레임 표는 그림보다 먼저 알아야 객체가 uv를 맞게 계산함
+				const AssetPackEntry* entry = pack != nullptr ? pack->Find(filename) : nullptr;
+				if (entry != nullptr && entry->type == ASSET_TEXTURE)
+				{
+					out.uvScale[0] = entry->uvScale[0];
+					out.uvScale[1] = entry->uvScale[1];
+					out.frames = pack->GetFrames(*entry);
+					out.frameCount = out.frames != nullptr ? (int)entry->frameCount : 0;
+					if (entry->format == ASSET_FORMAT_PALETTE8) out.paletteRow = AcquirePaletteRow(pack->GetPalette(*entry));
+				}
+				return out.descriptor != GlobalDescriptorHeap::NULL_DESCRIPTOR;
+			});
+		if (added && !handle.IsNull()) pending.push_back({ handle, filename });
+		return handle;
+	}
+
+	// 읽기 목록의 파일을 cmdList에 업로드 명령으로 한 번에 기록 (D3D 호출은 부른 스레드에서만 함)
+	// 에셋 팩에 든 파일은 팩 본문을 바로 올리고, 나머지는 jobs로 한꺼번에 풀어서 (스레드마다 파일 하나씩) 올림
+	void FinishLoads(ID3D12GraphicsCommandList* cmdList, JobSystem* jobs)
+	{
+		if (pending.empty()) return;
+
+		std::vector<std::string> paths;
+		std::vector<const PendingLoad*> decodeLoads;
+		for (const PendingLoad& load : pending)
+		{
+			const AssetPackEntry* entry = pack != nullptr ? pack->Find(load.path.c_str()) : nullptr;
+			if (entry == nullptr || entry->type != ASSET_TEXTURE)
+			{
+				paths.push_back(load.path);
+				decodeLoads.push_back(&load);
+				continue;
+			}
+
+			GpuTexture* texture = cache.Get(load.handle);
+			if (texture == nullptr) continue;	// 읽기 전에 이미 Release됨
+			UploadPackTexture(cmdList, load.path.c_str(), *entry, *texture);
+		}
+		UploadPalettes(cmdList);
+
+		std::vector<DecodedImage> images;
+		DecodeImages(paths, images, jobs);
+
+		for (size_t i = 0; i < decodeLoads.size(); i++)
+		{
+			GpuTexture* texture = cache.Get(decodeLoads[i]->handle);
+			if (texture == nullptr) continue;
+			const DecodedImage& image = images[i];
+			D3D12_SUBRESOURCE_DATA data = {};
+			data.pData = image.pixels;
+			data.RowPitch = (LONG_PTR)image.width * 4;
+			data.SlicePitch = data.RowPitch * image.height;
+			Upload(cmdList, paths[i].c_str(), DXGI_FORMAT_R8G8B8A8_UNORM, image.width, image.height, 1, &data, *texture);	// 실패하면 칸은 null SRV로 남음
+		}
+
+		FreeDecodedImages(images);	// UpdateSubresources가 업로드 버퍼로 복사했으므로 바로 버려도 됨
+		pending.clear();
+	}
+
+	bool AddRef(TextureHandle handle) { return cache.AddRef(handle); }
+
+	// 핸들 반납 (마지막 핸들이면 텍스처와 서술자 칸을 바로 내리므로, GPU가 아직 그 텍스처를 그리는 중이면 안 됨)
+	void Release(TextureHandle handle)
+	{
+		cache.Release(handle, [&](GpuTexture& texture) { descriptors->Free(device, texture.descriptor); });
+	}
+
+	// 핸들의 서술자 힙 칸 번호 (무효한 핸들이면 텍스처 없음)
+	int GetDescriptor(TextureHandle handle) const
+	{
+		const GpuTexture* texture = cache.Get(handle);
+		return texture != nullptr ? texture->descriptor : GlobalDescriptorHeap::NULL_DESCRIPTOR;
+	}
+
+	// 핸들 텍스처의 uv 배율 (팩에서 블록 압축하려고 프레임 칸을 4픽셀 배수로 늘린 만큼 줄여야 원래 그림만 보임)
+	void GetUvScale(TextureHandle handle, float& u, float& v) const
+	{
+		const GpuTexture* texture = cache.Get(handle);
+		u = texture != nullptr ? texture->uvScale[0] : 1.0f;
+		v = texture != nullptr ? texture->uvScale[1] : 1.0f;
+	}
+
+	// 핸들 텍스처가 팩의 아틀라스면 프레임 표 (아니면 nullptr, count는 0)
+	const AssetPackFrame* GetFrames(TextureHandle handle, int& count) const
+	{
+		const GpuTexture* texture = cache.Get(handle);
+		count = texture != nullptr ? texture->frameCount : 0;
+		return texture != nullptr ? texture->frames : nullptr;
+	}
+
+	// 핸들 텍스처의 팔레트 줄 (8비트 팔레트 텍스처가 아니면 -1, PackPaletteRow로 인스턴스에 붙임)
+	int GetPaletteRow(TextureHandle handle) const
+	{
+		const GpuTexture* texture = cache.Get(handle);
+		return texture != nullptr ? texture->paletteRow : -1;
+	}
+
+	// 업로드 명령이 GPU에서 끝난 뒤 불러서 복사용 버퍼를 버림
+	void ReleaseUploadBuffers()
+	{
+		cache.ForEachLoaded([](GpuTexture& texture) { texture.uploadBuffer.Reset(); });
+		paletteUploads.clear();
+	}
+
+	const TextureCache<GpuTexture>& GetCache() const { return cache; }
+};
@@ -0,0 +1,46 @@
+﻿#pragma once
+#include <string>
+#include <vector>
+#include "../Utils/stb_image.h"
+#include "../Utils/JobSystem.h"
+
+// PNG 등 이미지 파일을 RGBA8로 푼 결과 (그래픽 API와 무관)
+struct DecodedImage
+{
+	unsigned char* pixels = nullptr;	// stbi_load가 준 메모리, FreeDecodedImages로 반납
+	int width = 0;
+	int height = 0;
+
+	bool IsValid() const { return pixels != nullptr; }
+};
+
+// 파일 목록을 한꺼번에 풂 (out[i]가 paths[i]의 결과, 못 읽은 파일은 pixels가 nullptr)
+// 파일마다 독립이라 jobs가 있으면 파일 하나를 조각 하나로 워커들이 나눠서 풀고, 없으면 부른 스레드에서 차례로 풂
+// stb_image의 로드 함수는 전역 설정 (세로 뒤집기 등)만 안 바꾸면 여러 스레드에서 동시에 불러도 됨 (실패 이유는 스레드마다 따로)
+inline void DecodeImages(const std::vector<std::string>& paths, std::vector<DecodedImage>& out, JobSystem* jobs)
+{
+	out.assign(paths.size(), DecodedImage());
+
+	auto decode = [&](int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+		{
+			int channels = 0;
+			DecodedImage& image = out[i];
+			image.pixels = stbi_load(paths[i].c_str(), &image.width, &image.height, &channels, STBI_rgb_alpha);
+			if (image.pixels == nullptr) image.width = image.height = 0;
+		}
+	};
+
+	if (jobs != nullptr) jobs->ParallelFor(0, (int)paths.size(), 1, decode);
+	else decode(0, (int)paths.size());
+}
+
+inline void FreeDecodedImages(std::vector<DecodedImage>& images)
+{
+	for (DecodedImage& image : images)
+	{
+		if (image.pixels != nullptr) stbi_image_free(image.pixels);
+	}
+	images.clear();
+}
@@ -0,0 +1,34 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+#include "RenderCommandStream.h"
+
+// GPU 없이 합친 명령을 받는 백엔드 (헤드리스 실행 / 벤치마크용)
+// SpriteRenderer (DX12)와 같은 순서로 일하지만 업로드 버퍼 대신 CPU 배열에 인스턴스를 복사하고 드로우 콜은 세기만 함
+class NullRenderBackend
+{
+private:
+	std::vector<SpriteInstance> instanceBuffer;	// 업로드 버퍼 대신
+	int lastDrawCount = 0;
+	int lastRunCount = 0;
+	uint64_t uploadedBytes = 0;		// 지금까지 "올린" 인스턴스 바이트
+
+public:
+	void Flush(const RenderCommandMerger& merged, JobSystem* jobs = nullptr)
+	{
+		lastDrawCount = 0;
+		lastRunCount = (int)merged.GetRuns().size();
+		int count = merged.GetSpriteCount();
+		instanceBuffer.resize(count);
+		if (count == 0) return;
+
+		merged.WriteInstances(instanceBuffer.data(), jobs);
+		uploadedBytes += sizeof(SpriteInstance) * (uint64_t)count;
+		lastDrawCount++;
+	}
+
+	const std::vector<SpriteInstance>& GetInstances() const { return instanceBuffer; }
+	int GetLastDrawCount() const { return lastDrawCount; }
+	int GetLastRunCount() const { return lastRunCount; }
+	uint64_t GetUploadedBytes() const { return uploadedBytes; }
+};
@@ -0,0 +1,101 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+
+// 8비트 팔레트 텍스처 (그래픽 API와 무관, Tools/AssetPacker가 변환하고 벤치마크가 CPU 디코더로 검사)
+// 색이 256개 이하인 도트 그림 (오라, 버튼, 숫자 글꼴 등)은 픽셀마다 색 번호 1바이트만 두고 색은 팔레트 (RGBA8 x 256)에서 찾음
+// RGBA8보다 VRAM이 4분의 1이고 블록 압축과 달리 손실이 없음
+// GPU에서는 번호 텍스처 (R8_UNORM)를 점 샘플링한 뒤 팔레트 텍스처의 그 칸을 읽음 (shaders.hlsl, 선형 필터는 번호를 섞으므로 안 됨)
+// 완전히 투명한 픽셀 (알파 0)은 색을 버리고 전부 (0, 0, 0, 0) 하나로 봄 (안 보이는 색이 팔레트 칸을 먹지 않게)
+
+static const int PALETTE_SIZE = 256;
+
+inline uint32_t LoadPaletteColor(const uint8_t* p)
+{
+	uint32_t color;
+	memcpy(&color, p, 4);
+	return p[3] == 0 ? 0u : color;
+}
+
+// 그림의 색을 모아서 팔레트를 만듦 (256개를 넘으면 false, 팔레트는 색 값 순서라 같은 그림이면 항상 같음)
+// palette는 PALETTE_SIZE칸 (RGBA8, R이 가장 낮은 바이트), 안 쓴 칸은 0
+inline bool BuildPalette(const uint8_t* rgba, int width, int height, size_t pitch, uint32_t palette[PALETTE_SIZE], int& colorCount)
+{
+	std::vector<uint32_t> colors;
+	std::unordered_map<uint32_t, int> seen;
+	for (int y = 0; y < height; y++)
+	{
+		const uint8_t* row = rgba + (size_t)y * pitch;
+		for (int x = 0; x < width; x++)
+		{
+			uint32_t color = LoadPaletteColor(row + (size_t)x * 4);
+			if (seen.emplace(color, 0).second)
+			{
+				colors.push_back(color);
+				if ((int)colors.size() > PALETTE_SIZE) return false;
+			}
+		}
+	}
+
+	std::sort(colors.begin(), colors.end());
+	memset(palette, 0, sizeof(uint32_t) * PALETTE_SIZE);
+	for (size_t i = 0; i < colors.size(); i++) palette[i] = colors[i];
+	colorCount = (int)colors.size();
+	return true;
+}
+
+// 픽셀마다 팔레트 번호 (팔레트에 똑같은 색이 없으면 RGBA 거리가 가장 가까운 칸, 밉 단계처럼 평균으로 새 색이 생긴 경우)
+inline void IndexPaletteImage(const uint8_t* rgba, int width, int height, size_t pitch, const uint32_t palette[PALETTE_SIZE], int colorCount,
+	uint8_t* indices, size_t indexPitch)
+{
+	std::unordered_map<uint32_t, uint8_t> lookup;
+	for (int i = 0; i < colorCount; i++) lookup[palette[i]] = (uint8_t)i;
+
+	for (int y = 0; y < height; y++)
+	{
+		const uint8_t* row = rgba + (size_t)y * pitch;
+		uint8_t* out = indices + (size_t)y * indexPitch;
+		for (int x = 0; x < width; x++)
+		{
+			uint32_t color = LoadPaletteColor(row + (size_t)x * 4);
+			auto found = lookup.find(color);
+			if (found != lookup.end())
+			{
+				out[x] = found->second;
+				continue;
+			}
+
+			int best = 0, bestDistance = INT32_MAX;
+			for (int i = 0; i < colorCount; i++)
+			{
+				int distance = 0;
+				for (int c = 0; c < 4; c++)
+				{
+					int d = (int)((color >> (c * 8)) & 0xFF) - (int)((palette[i] >> (c * 8)) & 0xFF);
+					distance += d * d;
+				}
+				if (distance < bestDistance)
+				{
+					bestDistance = distance;
+					best = i;
+				}
+			}
+			out[x] = (uint8_t)best;
+			lookup[color] = (uint8_t)best;
+		}
+	}
+}
+
+// CPU 기준 디코더 (픽셀 셰이더와 같은 계산 : 번호 -> 팔레트 색)
+inline void DecodePaletteImage(const uint8_t* indices, size_t indexPitch, int width, int height, const uint32_t palette[PALETTE_SIZE], uint8_t* rgba, size_t pitch)
+{
+	for (int y = 0; y < height; y++)
+	{
+		const uint8_t* row = indices + (size_t)y * indexPitch;
+		uint8_t* out = rgba + (size_t)y * pitch;
+		for (int x = 0; x < width; x++) memcpy(out + (size_t)x * 4, &palette[row[x]], 4);
+	}
+}
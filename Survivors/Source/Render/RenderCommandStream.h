@@ -0,0 +1,190 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <type_traits>
+#include "SpriteBatch.h"
+#include "../Utils/JobSystem.h"
+
+// 그래픽 API와 무관한 그리기 명령 하나 (12바이트 POD)
+// 스프라이트는 전부 같은 PSO / 루트 시그니처로 그리므로 명령은 "(레이어, 텍스처)가 같은 인스턴스 몇 개" 하나뿐
+struct RenderCommand
+{
+	uint32_t key;				// (레이어 << 16) | 텍스처 (SpriteBatch와 같은 키)
+	uint32_t firstInstance;		// 스트림의 인스턴스 배열 안의 시작 위치
+	uint32_t instanceCount;
+};
+static_assert(sizeof(RenderCommand) == 12 && std::is_trivially_copyable<RenderCommand>::value, "RenderCommand는 그대로 복사하는 12바이트 POD");
+
+// 스레드 하나가 채우는 명령 스트림 (레이어 묶음 하나 : 배경, 적, 이펙트, UI 등)
+// Draw는 뒤에 붙이기만 하고, End에서 스트림 안의 스프라이트를 (레이어, 텍스처)로 안정 정렬한 뒤 키가 같은 덩어리마다 명령 하나로 줄임
+// 정렬을 기록한 스레드가 하므로 스프라이트 정렬이 스트림 수만큼 나뉘고, 합칠 때는 명령 (스트림마다 키 종류 수)만 정렬
+// 스트림끼리는 아무것도 같이 쓰지 않으므로 스트림마다 다른 스레드에서 동시에 채워도 됨
+class RenderCommandStream
+{
+private:
+	std::vector<uint32_t> keys;				// (레이어 << 16) | 텍스처, Draw 순서 그대로
+	std::vector<SpriteInstance> pending;	// Draw 순서 그대로
+	std::vector<int> order;
+	std::vector<int> scratch;
+
+	std::vector<RenderCommand> commands;
+	std::vector<SpriteInstance> instances;	// 키 순서로 정렬된 인스턴스 (명령이 가리킴)
+
+public:
+	// 지난 프레임 내용을 비움 (메모리는 재사용)
+	void Begin()
+	{
+		keys.clear();
+		pending.clear();
+		commands.clear();
+		instances.clear();
+	}
+
+	// SpriteBatch::Draw와 같은 규칙 (layer : 작은 값부터, texture : 0이면 텍스처 없음, 인스턴스에 텍스처 번호를 새김)
+	void Draw(int layer, int texture, const SpriteInstance& instance)
+	{
+		keys.push_back(((uint32_t)layer << 16) | (uint32_t)texture);
+		pending.push_back(instance);
+
+		SpriteInstance& added = pending.back();
+		added.typeFlags = (added.typeFlags & ((1u << SPRITE_TEXTURE_SHIFT) - 1)) | ((uint32_t)texture << SPRITE_TEXTURE_SHIFT);
+	}
+
+	// 기록 끝 : 정렬하고 명령을 만듦 (이미 키 순서로 Draw했으면 정렬을 건너뜀)
+	void End()
+	{
+		int count = (int)keys.size();
+		bool sorted = true;
+		for (int i = 1; i < count && sorted; i++) sorted = keys[i - 1] <= keys[i];
+
+		if (sorted)
+		{
+			instances.swap(pending);
+		}
+		else
+		{
+			SortKeysStable(keys.data(), count, order, scratch);
+			instances.resize(count);
+			for (int n = 0; n < count; n++) memcpy(&instances[n], &pending[order[n]], sizeof(SpriteInstance));
+		}
+
+		for (int n = 0; n < count; n++)
+		{
+			uint32_t key = keys[sorted ? n : order[n]];
+			if (commands.empty() || commands.back().key != key)
+			{
+				RenderCommand command;
+				command.key = key;
+				command.firstInstance = (uint32_t)n;
+				command.instanceCount = 0;
+				commands.push_back(command);
+			}
+			commands.back().instanceCount++;
+		}
+	}
+
+	const std::vector<RenderCommand>& GetCommands() const { return commands; }
+	const std::vector<SpriteInstance>& GetInstances() const { return instances; }
+	int GetSpriteCount() const { return (int)instances.size(); }
+};
+
+// 여러 스트림의 명령을 레이어 순서로 합침
+// 명령을 키로 안정 정렬하므로 결과는 스트림 0, 1, 2 ... 순서로 이어서 SpriteBatch 하나에 Draw한 것과 똑같음
+// (같은 레이어를 여러 스트림이 나눠 채웠다면 번호가 작은 스트림이 먼저 그려짐)
+// 인스턴스는 합친 자리를 정해두기만 했다가 백엔드가 업로드 버퍼에 바로 복사 (WriteInstances)
+class RenderCommandMerger
+{
+public:
+	// 합친 순서의 명령 하나 (어느 스트림의 몇 번째 인스턴스부터 몇 개를 합친 배열 어디에)
+	struct Entry
+	{
+		uint32_t key;
+		uint32_t stream;
+		uint32_t sourceFirst;
+		uint32_t destFirst;
+		uint32_t count;
+	};
+
+private:
+	const RenderCommandStream* streams = nullptr;
+	std::vector<Entry> entries;
+	std::vector<Entry> unsorted;
+	std::vector<uint32_t> keys;
+	std::vector<int> order;
+	std::vector<int> scratch;
+	std::vector<SpriteRun> runs;
+	int spriteCount = 0;
+
+public:
+	// 스트림들을 합침 (스트림은 WriteInstances가 끝날 때까지 그대로 있어야 함)
+	void Merge(const RenderCommandStream* newStreams, int streamCount)
+	{
+		streams = newStreams;
+		unsorted.clear();
+		keys.clear();
+		runs.clear();
+		spriteCount = 0;
+
+		for (int s = 0; s < streamCount; s++)
+		{
+			for (const RenderCommand& command : streams[s].GetCommands())
+			{
+				Entry entry;
+				entry.key = command.key;
+				entry.stream = (uint32_t)s;
+				entry.sourceFirst = command.firstInstance;
+				entry.destFirst = 0;
+				entry.count = command.instanceCount;
+				unsorted.push_back(entry);
+				keys.push_back(command.key);
+			}
+		}
+
+		int count = (int)unsorted.size();
+		SortKeysStable(keys.data(), count, order, scratch);
+		entries.resize(count);
+		for (int n = 0; n < count; n++) entries[n] = unsorted[order[n]];
+
+		// 합친 배열 안의 자리를 정하고, 텍스처가 바뀔 때마다 묶음을 끊음 (SpriteBatch::End와 같은 규칙)
+		for (Entry& entry : entries)
+		{
+			entry.destFirst = (uint32_t)spriteCount;
+			int texture = (int)(entry.key & 0xFFFF);
+			if (runs.empty() || runs.back().texture != texture)
+			{
+				SpriteRun run;
+				run.texture = texture;
+				run.layer = (int)(entry.key >> 16);
+				run.firstInstance = spriteCount;
+				run.instanceCount = 0;
+				runs.push_back(run);
+			}
+			runs.back().instanceCount += (int)entry.count;
+			spriteCount += (int)entry.count;
+		}
+	}
+
+	// 합친 순서의 [firstEntry, endEntry) 명령의 인스턴스를 dest (GetSpriteCount개 크기)의 제자리에 복사
+	// 명령마다 쓰는 자리가 겹치지 않으므로 명령 범위를 나눠서 여러 스레드가 동시에 불러도 됨
+	void WriteInstances(SpriteInstance* dest, int firstEntry, int endEntry) const
+	{
+		for (int e = firstEntry; e < endEntry; e++)
+		{
+			const Entry& entry = entries[e];
+			memcpy(dest + entry.destFirst, streams[entry.stream].GetInstances().data() + entry.sourceFirst, sizeof(SpriteInstance) * entry.count);
+		}
+	}
+
+	// 전부 복사 (jobs가 있으면 명령 범위를 나눠서 병렬)
+	void WriteInstances(SpriteInstance* dest, JobSystem* jobs = nullptr) const
+	{
+		int count = (int)entries.size();
+		if (jobs == nullptr) WriteInstances(dest, 0, count);
+		else jobs->ParallelFor(0, count, 8, [&](int begin, int end) { WriteInstances(dest, begin, end); });
+	}
+
+	const std::vector<Entry>& GetEntries() const { return entries; }
+	const std::vector<SpriteRun>& GetRuns() const { return runs; }
+	int GetSpriteCount() const { return spriteCount; }
+};
@@ -0,0 +1,25 @@
+﻿#pragma once
+#include <cstdint>
+#include "RenderCommandStream.h"
+
+// 스냅샷을 채울 때 동시에 기록하는 명령 스트림 (레이어 묶음 하나씩, 합칠 때는 레이어 순서라 여기 순서와 무관)
+enum RenderStreamId
+{
+	RENDER_STREAM_WORLD,		// 배경, 경험치 젬, 오라
+	RENDER_STREAM_ENEMIES,		// 적 (가장 많음)
+	RENDER_STREAM_COMBAT,		// 플레이어, 미사일, 타격 이펙트
+	RENDER_STREAM_UI,			// 타이틀, HUD, 데미지 숫자, 팝업
+	RENDER_STREAM_COUNT
+};
+
+// 시뮬레이션 스레드가 한 번 업데이트할 때마다 만들어서 렌더 스레드에 넘기는 그리기 정보 (넘긴 뒤에는 읽기만 함)
+// 렌더 스레드는 게임 객체를 보지 않고 이것만 보고 명령을 기록하므로 시뮬레이션이 다음 것을 만드는 동안 같이 돌 수 있음
+struct RenderSnapshot
+{
+	RenderCommandStream streams[RENDER_STREAM_COUNT];	// 이번 화면의 그리기 명령 (스트림마다 다른 스레드가 기록)
+	RenderCommandMerger merged;		// streams를 레이어 순서로 합친 것 (이 스냅샷의 streams를 가리킴)
+	float clearColor[4] = { 0.1f, 0.1f, 0.3f, 1.0f };
+	int gameState = 0;				// 만들 때의 게임 상태 (Game::GameState, 디버깅용)
+	long long simTick = 0;			// 만들 때까지 돌린 시뮬레이션 틱 수
+	uint64_t sequence = 0;			// 몇 번째 스냅샷인지 (1부터)
+};
@@ -0,0 +1,544 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "RenderCommandStream.h"
+#include "BlockCompress.h"
+#include "../Utils/AssetPack.h"
+#include "../Utils/JobSystem.h"
+#include "../Utils/PngWriter.h"
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SOFTWARE_RASTER_SSE2 1
+#endif
+
+// CPU 스프라이트 래스터라이저 (GPU 없는 머신에서 화면을 실제로 그려보는 백엔드)
+// shaders.hlsl과 같은 규칙으로 그림
+//   VSMain : 크기 1 사각형을 (중심 + 모서리 * 절반 크기)로 펼침 (화면 좌표 -1 ~ 1), SPRITE_FLIP_X면 가로 모서리를 뒤집음
+//   PSMain : 0 (그 외) 텍스처 * 틴트, 알파 0.1 미만은 버림 / 1 원형 (uv 중심에서 0.5 밖은 버림) / 2 단색 사각형
+//            팔레트 텍스처는 읽은 번호로 팔레트 텍스처 (서술자 1번)의 그 줄에서 색을 꺼냄
+//   샘플러 : 점 샘플링 + WRAP, 밉은 화면 크기에 가장 가까운 단계 하나 / 블렌딩 없음 (나중 스프라이트가 덮어씀)
+// 스프라이트는 돌리지 않으므로 항상 화면에 나란한 사각형이고, uv는 가로로는 u만 세로로는 v만 바뀜 (삼각형 두 개 대신 사각형 하나로 그림)
+// 픽셀 중심이 [왼쪽, 오른쪽) x [위, 아래)에 들어오면 칠함 (D3D의 top-left 규칙을 사각형에 적용한 것)
+//
+// 화면을 64x64 타일로 나눠서 스프라이트를 그리는 순서대로 타일마다 모아두고 (Binning), 타일마다 다른 스레드가 그림
+// 타일 안에서는 순서대로 그리므로 덮어쓰는 순서가 GPU와 같고, 타일끼리는 겹치지 않으므로 스레드 수와 상관없이 결과가 같음
+// 가로 한 줄은 SSE2로 4픽셀씩 (텍셀 읽기만 하나씩, uv 계산 / 알파 검사 / 틴트 곱은 4개 동시에), 스칼라 버전과 결과가 비트 단위로 같음
+// GPU와 다를 수 있는 곳 : 정점 좌표를 1/256 픽셀로 맞추는 것과 uv 보간의 마지막 자리 반올림 (점 샘플링 경계에서 텍셀 하나 차이)
+
+static const int SOFTWARE_PALETTE_TEXTURE = 1;	// GlobalDescriptorHeap::PALETTE_DESCRIPTOR와 같은 번호
+
+struct SoftwareTextureLevel
+{
+	int width = 0;
+	int height = 0;
+	size_t offset = 0;	// pixels 안의 시작 위치 (줄 간격은 width * 텍셀 크기)
+};
+
+// 텍스처 하나 (RGBA8, 또는 텍셀마다 팔레트 번호 1바이트)
+struct SoftwareTexture
+{
+	int mipLevels = 0;		// 0이면 빈 칸 (GPU의 null 서술자처럼 0을 읽으므로 전부 버려짐)
+	bool paletted = false;
+	SoftwareTextureLevel levels[ASSET_PACK_MAX_MIP_LEVELS];
+	std::vector<uint8_t> pixels;
+
+	int GetTexelSize() const { return paletted ? 1 : 4; }
+	uint8_t* GetLevelPixels(int level) { return pixels.data() + levels[level].offset; }
+	const uint8_t* GetLevelPixels(int level) const { return pixels.data() + levels[level].offset; }
+};
+
+// 서술자 힙처럼 번호로 찾는 텍스처 표 (0번은 텍스처 없음, 1번은 팔레트 텍스처 : 가로 256 x 팔레트 줄 수)
+class SoftwareTextureTable
+{
+private:
+	std::vector<SoftwareTexture> textures;
+
+	void Reserve(int index)
+	{
+		if ((int)textures.size() <= index) textures.resize(index + 1);
+	}
+
+public:
+	SoftwareTextureTable() { Reserve(SOFTWARE_PALETTE_TEXTURE); }
+
+	// index번 칸을 width x height (밉 mipLevels단계)로 만들고 돌려줌 (텍셀은 GetLevelPixels로 채움)
+	SoftwareTexture& SetTexture(int index, int width, int height, int mipLevels, bool paletted)
+	{
+		Reserve(index);
+		SoftwareTexture& texture = textures[index];
+		texture.mipLevels = (std::min)((std::max)(mipLevels, 1), (int)ASSET_PACK_MAX_MIP_LEVELS);
+		texture.paletted = paletted;
+
+		size_t offset = 0;
+		for (int level = 0; level < texture.mipLevels; level++)
+		{
+			SoftwareTextureLevel& info = texture.levels[level];
+			info.width = (std::max)(1, width >> level);
+			info.height = (std::max)(1, height >> level);
+			info.offset = offset;
+			offset += (size_t)info.width * info.height * texture.GetTexelSize();
+		}
+		texture.pixels.assign(offset, 0);
+		return texture;
+	}
+
+	// 비어있는 다음 번호에 만듦 (2번부터)
+	int AddTexture(int width, int height, int mipLevels, bool paletted)
+	{
+		int index = (std::max)((int)textures.size(), SOFTWARE_PALETTE_TEXTURE + 1);
+		SetTexture(index, width, height, mipLevels, paletted);
+		return index;
+	}
+
+	// 팔레트 텍스처에 줄 하나를 붙이고 줄 번호를 돌려줌 (인스턴스에는 PackPaletteRow(줄 번호)로 새김)
+	int AddPaletteRow(const uint32_t colors[ASSET_PACK_PALETTE_SIZE])
+	{
+		SoftwareTexture& palette = textures[SOFTWARE_PALETTE_TEXTURE];
+		int row = palette.mipLevels > 0 ? palette.levels[0].height : 0;
+		if (row >= MAX_SPRITE_PALETTES) return -1;
+
+		palette.mipLevels = 1;
+		palette.paletted = false;
+		palette.levels[0].width = ASSET_PACK_PALETTE_SIZE;
+		palette.levels[0].height = row + 1;
+		palette.levels[0].offset = 0;
+		palette.pixels.insert(palette.pixels.end(), (const uint8_t*)colors, (const uint8_t*)(colors + ASSET_PACK_PALETTE_SIZE));
+		return row;
+	}
+
+	// 에셋 팩 텍스처를 풀어서 index번 칸에 넣음 (블록 압축은 RGBA8로 풀고, 팔레트 텍스처는 번호만 넣으므로 팔레트 줄은 AddPaletteRow로 따로)
+	void SetPackTexture(int index, const AssetPack& pack, const AssetPackEntry& entry)
+	{
+		bool paletted = entry.format == ASSET_FORMAT_PALETTE8;
+		bool blocks = entry.format == ASSET_FORMAT_BC3 || entry.format == ASSET_FORMAT_BC7;
+		SoftwareTexture& texture = SetTexture(index, (int)entry.width, (int)entry.height, (int)entry.mipLevels, paletted);
+		const uint8_t* data = pack.GetData(entry);
+
+		std::vector<uint8_t> decoded;
+		for (int level = 0; level < texture.mipLevels; level++)
+		{
+			AssetTextureLevel source = GetTextureLevel(entry, (uint32_t)level);
+			const SoftwareTextureLevel& info = texture.levels[level];
+			size_t rowBytes = (size_t)info.width * texture.GetTexelSize();
+			uint8_t* dst = texture.GetLevelPixels(level);
+
+			if (blocks)
+			{
+				// 4의 배수가 아닌 작은 단계도 블록 단위로 풀고 필요한 만큼만 복사
+				int paddedWidth = (info.width + 3) / 4 * 4;
+				int paddedHeight = (info.height + 3) / 4 * 4;
+				decoded.resize((size_t)paddedWidth * paddedHeight * 4);
+				DecompressImage(data + source.offset, source.rowPitch, paddedWidth, paddedHeight,
+					entry.format == ASSET_FORMAT_BC7 ? BLOCK_BC7 : BLOCK_BC3, decoded.data(), paddedWidth * 4);
+				for (int y = 0; y < info.height; y++) memcpy(dst + y * rowBytes, decoded.data() + (size_t)y * paddedWidth * 4, rowBytes);
+			}
+			else
+			{
+				for (int y = 0; y < info.height; y++) memcpy(dst + y * rowBytes, data + source.offset + (size_t)y * source.rowPitch, rowBytes);
+			}
+		}
+	}
+
+	// 에셋 팩 텍스처를 다음 번호에 넣음 (팔레트 텍스처는 팔레트 줄도 붙임, 줄이 없으면 -1)
+	int AddPackTexture(const AssetPack& pack, const AssetPackEntry& entry, int& outPaletteRow)
+	{
+		int index = (std::max)((int)textures.size(), SOFTWARE_PALETTE_TEXTURE + 1);
+		SetPackTexture(index, pack, entry);
+		outPaletteRow = entry.format == ASSET_FORMAT_PALETTE8 ? AddPaletteRow(pack.GetPalette(entry)) : -1;
+		return index;
+	}
+
+	// index번 칸을 비움 (텍스처를 내린 서술자 칸처럼 다시 0을 읽음)
+	void ClearTexture(int index)
+	{
+		if (index <= SOFTWARE_PALETTE_TEXTURE || index >= (int)textures.size()) return;
+		textures[index] = SoftwareTexture();
+	}
+
+	// 없거나 빈 칸이면 nullptr
+	const SoftwareTexture* Get(int index) const
+	{
+		if (index < 0 || index >= (int)textures.size() || textures[index].mipLevels == 0) return nullptr;
+		return &textures[index];
+	}
+
+	int GetCount() const { return (int)textures.size(); }
+};
+
+class SoftwareRasterizer
+{
+public:
+	static const int TILE_SIZE = 64;
+
+private:
+	// 스프라이트 하나의 화면 사각형과 uv 식 (그릴 준비)
+	struct RasterSprite
+	{
+		int x0, y0, x1, y1;		// 칠할 픽셀 [x0, x1) x [y0, y1), 화면 밖은 잘라냄 (x0 == x1이면 안 그림)
+		float u0, du;			// 픽셀 x열 중심의 u = u0 + du * x
+		float v0, dv;			// 픽셀 y줄 중심의 v = v0 + dv * y
+		uint32_t tint;
+		int type;				// 0 텍스처, 1 원형, 2 단색
+		const uint8_t* texels;	// 고른 밉 단계
+		int texWidth;
+		int texHeight;
+		bool paletted;
+		const uint32_t* palette;	// 팔레트 텍스처의 그 줄 (256색)
+	};
+
+	int width = 0;
+	int height = 0;
+	int tilesX = 0;
+	int tilesY = 0;
+	bool useSimd = true;
+	std::vector<uint32_t> frame;		// RGBA8 (R이 가장 낮은 바이트, 스왑 체인 R8G8B8A8_UNORM과 같은 배치)
+
+	std::vector<RasterSprite> sprites;
+	std::vector<int> tileStarts;		// 타일마다 tileSprites 안의 시작 위치 (타일 수 + 1개)
+	std::vector<int> tileSprites;		// 타일별로 모은 스프라이트 번호 (그리는 순서 그대로)
+	std::vector<int> tileCursor;
+
+	// 점 샘플링 + WRAP : 0 ~ 1로 접은 좌표의 텍셀 번호
+	static int WrapTexel(float coord, int size)
+	{
+		float folded = coord - std::floor(coord);
+		int texel = (int)(folded * (float)size);
+		return texel < size ? texel : size - 1;
+	}
+
+	// 0 ~ 1 색을 8비트로 (GPU의 UNORM 변환처럼 가장 가까운 값)
+	static uint32_t PackUnorm(const float color[4])
+	{
+		return PackTint(color[0], color[1], color[2], color[3]);
+	}
+
+	// 채널마다 round(a * b / 255), 텍스처 색 * 틴트와 같음
+	static uint32_t MultiplyColor(uint32_t a, uint32_t b)
+	{
+		uint32_t result = 0;
+		for (int shift = 0; shift < 32; shift += 8)
+		{
+			uint32_t t = ((a >> shift) & 0xFF) * ((b >> shift) & 0xFF) + 128;
+			result |= ((t + (t >> 8)) >> 8) << shift;
+		}
+		return result;
+	}
+
+	void SetupSprite(const SpriteInstance& instance, const SoftwareTextureTable& textures, RasterSprite& out) const
+	{
+		out.x0 = out.x1 = out.y0 = out.y1 = 0;
+		float hx = instance.halfSize[0];
+		float hy = instance.halfSize[1];
+		if (hx == 0.0f || hy == 0.0f) return;
+
+		out.type = (int)(instance.typeFlags & SPRITE_TYPE_MASK);
+		if (out.type != 1 && out.type != 2) out.type = 0;
+		out.tint = instance.tint;
+		out.texels = nullptr;
+		out.palette = nullptr;
+		out.paletted = false;
+		out.texWidth = out.texHeight = 0;
+
+		// 텍스처 모드 : 텍스처가 없으면 (null 서술자) 모든 픽셀의 알파가 0이라 전부 버려짐
+		const SoftwareTexture* texture = nullptr;
+		if (out.type == 0)
+		{
+			texture = textures.Get((int)(instance.typeFlags >> SPRITE_TEXTURE_SHIFT));
+			if (texture == nullptr) return;
+
+			int paletteRow = (int)((instance.typeFlags >> SPRITE_PALETTE_SHIFT) & SPRITE_PALETTE_MASK);
+			if (paletteRow != 0)
+			{
+				const SoftwareTexture* palette = textures.Get(SOFTWARE_PALETTE_TEXTURE);
+				if (palette == nullptr || paletteRow > palette->levels[0].height) return;	// 팔레트 밖은 0을 읽으므로 전부 버려짐
+				out.palette = (const uint32_t*)palette->GetLevelPixels(0) + (size_t)(paletteRow - 1) * palette->levels[0].width;
+			}
+		}
+
+		// 정점 셰이더와 같은 네 모서리 (화면 좌표 -1 ~ 1) -> 픽셀 좌표
+		float left = (std::min)(instance.center[0] - hx, instance.center[0] + hx);
+		float right = (std::max)(instance.center[0] - hx, instance.center[0] + hx);
+		float top = (std::max)(instance.center[1] - hy, instance.center[1] + hy);
+		float bottom = (std::min)(instance.center[1] - hy, instance.center[1] + hy);
+		float pixelLeft = (std::min)((std::max)((left + 1.0f) * 0.5f * width, -1.0f), width + 1.0f);
+		float pixelRight = (std::min)((std::max)((right + 1.0f) * 0.5f * width, -1.0f), width + 1.0f);
+		float pixelTop = (std::min)((std::max)((1.0f - top) * 0.5f * height, -1.0f), height + 1.0f);
+		float pixelBottom = (std::min)((std::max)((1.0f - bottom) * 0.5f * height, -1.0f), height + 1.0f);
+
+		// 픽셀 중심 (p + 0.5)이 [시작, 끝)에 들어오는 p
+		out.x0 = (std::max)(0, (int)std::ceil(pixelLeft - 0.5f));
+		out.x1 = (std::min)(width, (int)std::ceil(pixelRight - 0.5f));
+		out.y0 = (std::max)(0, (int)std::ceil(pixelTop - 0.5f));
+		out.y1 = (std::min)(height, (int)std::ceil(pixelBottom - 0.5f));
+		if (out.x0 >= out.x1 || out.y0 >= out.y1)
+		{
+			out.x0 = out.x1 = out.y0 = out.y1 = 0;
+			return;
+		}
+
+		// 사각형 uv (좌상단 0,0)를 픽셀 번호의 1차식으로 : u = 0.5 + 방향 * (x - 중심) / (2 * 절반 크기), 뒤집으면 방향 -1
+		float flip = (instance.typeFlags & SPRITE_FLIP_X) ? -1.0f : 1.0f;
+		float firstX = 1.0f / width - 1.0f;			// 0번 열 중심의 화면 좌표
+		float firstY = 1.0f - 1.0f / height;		// 0번 줄 중심의 화면 좌표
+		const float* uvRect = instance.uvRect;
+		out.du = uvRect[2] * flip / (hx * width);
+		out.u0 = uvRect[0] + uvRect[2] * (0.5f + flip * 0.5f * (firstX - instance.center[0]) / hx);
+		out.dv = uvRect[3] / (hy * height);
+		out.v0 = uvRect[1] + uvRect[3] * (0.5f - 0.5f * (firstY - instance.center[1]) / hy);
+
+		if (texture != nullptr)
+		{
+			// 화면 픽셀 하나에 들어가는 텍셀 수로 밉 단계를 고름 (가장 가까운 단계)
+			float rho = (std::max)(std::fabs(out.du) * texture->levels[0].width, std::fabs(out.dv) * texture->levels[0].height);
+			int level = 0;
+			if (rho > 1.0f) level = (std::min)((int)std::floor(std::log2(rho) + 0.5f), texture->mipLevels - 1);
+			out.texels = texture->GetLevelPixels(level);
+			out.texWidth = texture->levels[level].width;
+			out.texHeight = texture->levels[level].height;
+			out.paletted = texture->paletted;
+		}
+	}
+
+	static const uint8_t* GetTexelRow(const RasterSprite& sprite, int texelY)
+	{
+		return sprite.texels + (size_t)texelY * sprite.texWidth * (sprite.paletted ? 1 : 4);
+	}
+
+	// 텍셀 하나 (R8 팔레트 텍스처는 셰이더처럼 (번호, 0, 0, 1)), 팔레트 줄이 있으면 R을 번호로 그 줄의 색
+	static uint32_t FetchTexel(const RasterSprite& sprite, const uint8_t* texelRow, int texelX)
+	{
+		uint32_t color;
+		if (sprite.paletted) color = texelRow[texelX] | 0xFF000000u;
+		else memcpy(&color, texelRow + texelX * 4, 4);
+		return sprite.palette != nullptr ? sprite.palette[color & 0xFF] : color;
+	}
+
+	// 가로 한 줄 [x0, x1)
+	void DrawSpanScalar(const RasterSprite& sprite, int y, int x0, int x1, uint32_t* row) const
+	{
+		if (sprite.type == 2)
+		{
+			for (int x = x0; x < x1; x++) row[x] = sprite.tint;
+			return;
+		}
+
+		float v = sprite.v0 + sprite.dv * (float)y;
+		if (sprite.type == 1)
+		{
+			float dy = v - 0.5f;
+			for (int x = x0; x < x1; x++)
+			{
+				float dx = sprite.u0 + sprite.du * (float)x - 0.5f;
+				float dist = std::sqrt(dx * dx + dy * dy);
+				if (dist <= 0.5f) row[x] = sprite.tint;
+			}
+			return;
+		}
+
+		const uint8_t* texelRow = GetTexelRow(sprite, WrapTexel(v, sprite.texHeight));
+		for (int x = x0; x < x1; x++)
+		{
+			int texelX = WrapTexel(sprite.u0 + sprite.du * (float)x, sprite.texWidth);
+			uint32_t color = FetchTexel(sprite, texelRow, texelX);
+			if ((color >> 24) <= 25) continue;	// 알파 0.1 미만 (25 / 255 < 0.1 < 26 / 255)
+			row[x] = MultiplyColor(color, sprite.tint);
+		}
+	}
+
+#ifdef SOFTWARE_RASTER_SSE2
+	static __m128 FloorSse(__m128 value)
+	{
+		__m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(value));
+		return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, value), _mm_set1_ps(1.0f)));
+	}
+
+	// 4픽셀씩, 남는 1 ~ 3픽셀은 스칼라 (계산 순서가 같아서 결과도 같음)
+	void DrawSpanSse(const RasterSprite& sprite, int y, int x0, int x1, uint32_t* row) const
+	{
+		int x = x0;
+		const __m128i tint = _mm_set1_epi32((int)sprite.tint);
+		const __m128 lanes = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+		const __m128 u0 = _mm_set1_ps(sprite.u0);
+		const __m128 du = _mm_set1_ps(sprite.du);
+
+		if (sprite.type == 2)
+		{
+			for (; x + 4 <= x1; x += 4) _mm_storeu_si128((__m128i*)(row + x), tint);
+		}
+		else if (sprite.type == 1)
+		{
+			float v = sprite.v0 + sprite.dv * (float)y;
+			const __m128 dy = _mm_set1_ps(v - 0.5f);
+			const __m128 dySquared = _mm_mul_ps(dy, dy);
+			for (; x + 4 <= x1; x += 4)
+			{
+				__m128 u = _mm_add_ps(u0, _mm_mul_ps(du, _mm_add_ps(_mm_set1_ps((float)x), lanes)));
+				__m128 dx = _mm_sub_ps(u, _mm_set1_ps(0.5f));
+				__m128 dist = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), dySquared));
+				__m128i keep = _mm_castps_si128(_mm_cmple_ps(dist, _mm_set1_ps(0.5f)));
+				__m128i old = _mm_loadu_si128((const __m128i*)(row + x));
+				_mm_storeu_si128((__m128i*)(row + x), _mm_or_si128(_mm_and_si128(keep, tint), _mm_andnot_si128(keep, old)));
+			}
+		}
+		else
+		{
+			float v = sprite.v0 + sprite.dv * (float)y;
+			const uint8_t* texelRow = GetTexelRow(sprite, WrapTexel(v, sprite.texHeight));
+			const __m128 size = _mm_set1_ps((float)sprite.texWidth);
+			const __m128i lastTexel = _mm_set1_epi32(sprite.texWidth - 1);
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i round = _mm_set1_epi16(128);
+			const __m128i tintLow = _mm_unpacklo_epi8(tint, zero);
+			const __m128i alphaLimit = _mm_set1_epi32(25);
+			alignas(16) int texelX[4];
+			alignas(16) uint32_t colors[4];
+
+			for (; x + 4 <= x1; x += 4)
+			{
+				// 텍셀 번호 : (u - floor(u)) * 크기, 크기와 같아지면 마지막 텍셀
+				__m128 u = _mm_add_ps(u0, _mm_mul_ps(du, _mm_add_ps(_mm_set1_ps((float)x), lanes)));
+				__m128i texel = _mm_cvttps_epi32(_mm_mul_ps(_mm_sub_ps(u, FloorSse(u)), size));
+				__m128i over = _mm_cmpgt_epi32(texel, lastTexel);
+				texel = _mm_or_si128(_mm_andnot_si128(over, texel), _mm_and_si128(over, lastTexel));
+				_mm_store_si128((__m128i*)texelX, texel);
+
+				for (int i = 0; i < 4; i++) colors[i] = FetchTexel(sprite, texelRow, texelX[i]);
+				__m128i color = _mm_load_si128((const __m128i*)colors);
+				__m128i keep = _mm_cmpgt_epi32(_mm_srli_epi32(color, 24), alphaLimit);
+
+				// 채널마다 round(c * t / 255) = (c * t + 128 + ((c * t + 128) >> 8)) >> 8
+				__m128i low = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(color, zero), tintLow), round);
+				__m128i high = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(color, zero), tintLow), round);
+				low = _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 8)), 8);
+				high = _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 8)), 8);
+				__m128i shaded = _mm_packus_epi16(low, high);
+
+				__m128i old = _mm_loadu_si128((const __m128i*)(row + x));
+				_mm_storeu_si128((__m128i*)(row + x), _mm_or_si128(_mm_and_si128(keep, shaded), _mm_andnot_si128(keep, old)));
+			}
+		}
+
+		if (x < x1) DrawSpanScalar(sprite, y, x, x1, row);
+	}
+#endif
+
+	void DrawTile(int tile, uint32_t clearColor)
+	{
+		int left = (tile % tilesX) * TILE_SIZE;
+		int top = (tile / tilesX) * TILE_SIZE;
+		int right = (std::min)(left + TILE_SIZE, width);
+		int bottom = (std::min)(top + TILE_SIZE, height);
+
+		for (int y = top; y < bottom; y++) std::fill(frame.begin() + (size_t)y * width + left, frame.begin() + (size_t)y * width + right, clearColor);
+
+		for (int n = tileStarts[tile]; n < tileStarts[tile + 1]; n++)
+		{
+			const RasterSprite& sprite = sprites[tileSprites[n]];
+			int x0 = (std::max)(sprite.x0, left), x1 = (std::min)(sprite.x1, right);
+			int y0 = (std::max)(sprite.y0, top), y1 = (std::min)(sprite.y1, bottom);
+			for (int y = y0; y < y1; y++)
+			{
+				uint32_t* row = frame.data() + (size_t)y * width;
+#ifdef SOFTWARE_RASTER_SSE2
+				if (useSimd)
+				{
+					DrawSpanSse(sprite, y, x0, x1, row);
+					continue;
+				}
+#endif
+				DrawSpanScalar(sprite, y, x0, x1, row);
+			}
+		}
+	}
+
+public:
+	void Initialize(int newWidth, int newHeight)
+	{
+		width = newWidth;
+		height = newHeight;
+		tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+		tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+		frame.assign((size_t)width * height, 0);
+	}
+
+	// SSE2를 끄면 전부 스칼라로 그림 (비교 / 디버깅용)
+	void SetSimd(bool enabled) { useSimd = enabled; }
+
+	// instances를 순서대로 그림 (clearColor로 지운 뒤, jobs가 있으면 스프라이트 준비와 타일을 나눠서 병렬)
+	void Render(const SpriteInstance* instances, int count, const float clearColor[4], const SoftwareTextureTable& textures, JobSystem* jobs = nullptr)
+	{
+		// 스프라이트마다 화면 사각형, uv 식, 밉 단계 준비
+		sprites.resize(count);
+		auto setup = [&](int begin, int end)
+		{
+			for (int i = begin; i < end; i++) SetupSprite(instances[i], textures, sprites[i]);
+		};
+		if (jobs != nullptr) jobs->ParallelFor(0, count, 1024, setup);
+		else setup(0, count);
+
+		// 타일마다 걸치는 스프라이트를 그리는 순서대로 모음 (개수 세기 -> 시작 위치 -> 채우기)
+		int tileCount = tilesX * tilesY;
+		tileStarts.assign(tileCount + 1, 0);
+		for (const RasterSprite& sprite : sprites)
+		{
+			if (sprite.x0 == sprite.x1) continue;
+			for (int ty = sprite.y0 / TILE_SIZE; ty <= (sprite.y1 - 1) / TILE_SIZE; ty++)
+			{
+				for (int tx = sprite.x0 / TILE_SIZE; tx <= (sprite.x1 - 1) / TILE_SIZE; tx++) tileStarts[ty * tilesX + tx + 1]++;
+			}
+		}
+		for (int t = 0; t < tileCount; t++) tileStarts[t + 1] += tileStarts[t];
+		tileSprites.resize(tileStarts[tileCount]);
+		tileCursor.assign(tileStarts.begin(), tileStarts.end() - 1);
+		for (int i = 0; i < count; i++)
+		{
+			const RasterSprite& sprite = sprites[i];
+			if (sprite.x0 == sprite.x1) continue;
+			for (int ty = sprite.y0 / TILE_SIZE; ty <= (sprite.y1 - 1) / TILE_SIZE; ty++)
+			{
+				for (int tx = sprite.x0 / TILE_SIZE; tx <= (sprite.x1 - 1) / TILE_SIZE; tx++) tileSprites[tileCursor[ty * tilesX + tx]++] = i;
+			}
+		}
+
+		// 타일마다 지우고 그리기
+		uint32_t clear = PackUnorm(clearColor);
+		auto draw = [&](int begin, int end)
+		{
+			for (int t = begin; t < end; t++) DrawTile(t, clear);
+		};
+		if (jobs != nullptr) jobs->ParallelFor(0, tileCount, 1, draw);
+		else draw(0, tileCount);
+	}
+
+	bool SavePng(const char* path) const { return WritePng(path, (const uint8_t*)frame.data(), width, height, (size_t)width * 4); }
+
+	const uint32_t* GetPixels() const { return frame.data(); }
+	int GetWidth() const { return width; }
+	int GetHeight() const { return height; }
+	int GetTileCount() const { return tilesX * tilesY; }
+	int GetBinnedCount() const { return (int)tileSprites.size(); }	// 마지막 Render에서 (타일, 스프라이트) 쌍 수
+};
+
+// 합친 그리기 명령을 CPU 래스터라이저로 그리는 백엔드 (NullRenderBackend와 같은 자리, 화면이 실제로 나옴)
+class SoftwareRenderBackend
+{
+private:
+	std::vector<SpriteInstance> instanceBuffer;
+	SoftwareRasterizer rasterizer;
+
+public:
+	void Initialize(int width, int height) { rasterizer.Initialize(width, height); }
+
+	void Flush(const RenderCommandMerger& merged, const float clearColor[4], const SoftwareTextureTable& textures, JobSystem* jobs = nullptr)
+	{
+		instanceBuffer.resize(merged.GetSpriteCount());
+		if (!instanceBuffer.empty()) merged.WriteInstances(instanceBuffer.data(), jobs);
+		rasterizer.Render(instanceBuffer.data(), (int)instanceBuffer.size(), clearColor, textures, jobs);
+	}
+
+	SoftwareRasterizer& GetRasterizer() { return rasterizer; }
+	const SoftwareRasterizer& GetRasterizer() const { return rasterizer; }
+};
@@ -0,0 +1,183 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// 스프라이트 하나를 그리는 데 필요한 값 (40바이트)
+// 스프라이트는 2D에서 이동 / 크기 / 좌우 뒤집기만 하므로 4x4 행렬 대신 중심과 절반 크기만 넘기고, 정점 셰이더가 사각형으로 펼침
+// 정점 셰이더가 인스턴스 스트림 (입력 슬롯 1)으로 한 마리씩 읽어감
+struct SpriteInstance
+{
+	float center[2];		// 카메라 기준 중심 위치 (화면 좌표)
+	float halfSize[2];		// 가로 / 세로 절반 크기
+	float uvRect[4];		// x: Offset X, y: Offset Y, z: Scale X, w: Scale Y
+	uint32_t tint;			// RGBA8 색상 필터 (R이 가장 낮은 바이트, 셰이더에서는 0 ~ 1 float4)
+	uint32_t typeFlags;		// 하위 8비트 : 0 텍스처, 1 원형 (미사일), 2 단색 사각형 (HP바) / SPRITE_FLIP_X : 좌우 뒤집기
+							// 9 ~ 15비트 : 팔레트 줄 + 1 (8비트 팔레트 텍스처만, 0이면 보통 텍스처)
+							// 상위 16비트 : 텍스처 번호 (서술자 힙 칸, SpriteBatch::Draw가 채움)
+};
+static_assert(sizeof(SpriteInstance) == 40, "SpriteInstance는 입력 레이아웃 (Survivors.cpp)과 셰이더에 맞춘 40바이트");
+
+static const uint32_t SPRITE_TYPE_MASK = 0xFF;
+static const uint32_t SPRITE_FLIP_X = 0x100;
+static const int SPRITE_PALETTE_SHIFT = 9;
+static const uint32_t SPRITE_PALETTE_MASK = 0x7F;
+static const int MAX_SPRITE_PALETTES = 127;	// 7비트 중 0은 "팔레트 없음"
+static const int SPRITE_TEXTURE_SHIFT = 16;
+
+// 팔레트 줄 번호 (없으면 -1)를 typeFlags 비트로 (PackSprite 뒤에 |= 로 붙임)
+inline uint32_t PackPaletteRow(int row)
+{
+	return row >= 0 && row < MAX_SPRITE_PALETTES ? ((uint32_t)(row + 1) & SPRITE_PALETTE_MASK) << SPRITE_PALETTE_SHIFT : 0u;
+}
+
+// 0 ~ 1 색상을 RGBA8 하나로 압축 (범위 밖은 잘라냄)
+inline uint32_t PackTint(float r, float g, float b, float a)
+{
+	float channels[4] = { r, g, b, a };
+	uint32_t packed = 0;
+	for (int c = 0; c < 4; c++)
+	{
+		float v = channels[c] < 0.0f ? 0.0f : (channels[c] > 1.0f ? 1.0f : channels[c]);
+		packed |= (uint32_t)(v * 255.0f + 0.5f) << (c * 8);
+	}
+	return packed;
+}
+
+// 스프라이트 하나를 압축 (x, y : 카메라 기준 중심, scaleX / scaleY : 전체 크기)
+inline void PackSprite(SpriteInstance& out, float x, float y, float scaleX, float scaleY, bool flipped,
+	const float uvRect[4], uint32_t tint, int objectType)
+{
+	out.center[0] = x;
+	out.center[1] = y;
+	out.halfSize[0] = scaleX * 0.5f;
+	out.halfSize[1] = scaleY * 0.5f;
+	out.uvRect[0] = uvRect[0];
+	out.uvRect[1] = uvRect[1];
+	out.uvRect[2] = uvRect[2];
+	out.uvRect[3] = uvRect[3];
+	out.tint = tint;
+	out.typeFlags = ((uint32_t)objectType & SPRITE_TYPE_MASK) | (flipped ? SPRITE_FLIP_X : 0);
+}
+
+// 키 8비트씩 4번 나눠서 기수 정렬 (LSD Radix Sort, 자리마다 계수 정렬이라 안정 정렬), order에 정렬된 순서의 키 번호를 채움
+// 모든 키의 해당 자리가 같으면 그 자리는 건너뜀 (텍스처 / 레이어 수가 256개 미만이면 윗자리는 거의 다 건너뜀)
+inline void SortKeysStable(const uint32_t* keys, int count, std::vector<int>& order, std::vector<int>& scratch)
+{
+	order.resize(count);
+	scratch.resize(count);
+	for (int i = 0; i < count; i++) order[i] = i;
+	if (count == 0) return;
+
+	for (int shift = 0; shift < 32; shift += 8)
+	{
+		int histogram[256] = {};
+		for (int i = 0; i < count; i++) histogram[(keys[i] >> shift) & 0xFF]++;
+		if (histogram[(keys[0] >> shift) & 0xFF] == count) continue;
+
+		int offset = 0;
+		for (int digit = 0; digit < 256; digit++)
+		{
+			int size = histogram[digit];
+			histogram[digit] = offset;
+			offset += size;
+		}
+
+		for (int n = 0; n < count; n++)
+		{
+			int i = order[n];
+			scratch[histogram[(keys[i] >> shift) & 0xFF]++] = i;
+		}
+		order.swap(scratch);
+	}
+}
+
+// 같은 텍스처가 이어지는 인스턴스 묶음
+// (텍스처 번호는 인스턴스가 들고 가므로 묶음이 나뉘어도 드로우 콜은 하나, 텍스처가 몇 번 바뀌는지 보는 용도)
+struct SpriteRun
+{
+	int texture;		// 0이면 텍스처 없이 그림
+	int layer;			// 묶음의 첫 스프라이트 레이어 (디버깅용)
+	int firstInstance;	// 정렬된 인스턴스 배열 안의 시작 위치
+	int instanceCount;
+};
+
+// 스프라이트 배치 빌더 (그래픽 API와 무관한 부분)
+// 프레임 동안 Draw로 (레이어, 텍스처, 인스턴스)를 모아두고, End에서 레이어 -> 텍스처 순으로 정렬한 뒤
+// 텍스처가 바뀔 때마다 묶음 (Run)을 끊어둠 (같은 텍스처끼리 이어서 읽으므로 GPU 텍스처 캐시에 유리)
+// 정렬은 안정 정렬이라 레이어와 텍스처가 같은 스프라이트끼리는 Draw를 부른 순서대로 그려짐
+// (레이어 안에서는 텍스처가 다른 스프라이트끼리 그리는 순서가 바뀔 수 있으므로, 순서가 중요한 것은 레이어를 나눠야 함)
+class SpriteBatch
+{
+public:
+	static const int MAX_LAYERS = 65536;
+	static const int MAX_TEXTURES = 65536;
+
+private:
+	std::vector<SpriteInstance> pending;	// Draw 순서 그대로
+	std::vector<uint32_t> keys;				// (레이어 << 16) | 텍스처
+	std::vector<int> order;					// 정렬 결과 (pending 번호)
+	std::vector<int> scratch;
+
+	std::vector<SpriteInstance> instances;	// 정렬된 순서로 채운 인스턴스 (GPU로 그대로 복사)
+	std::vector<SpriteRun> runs;
+
+	void SortKeys() { SortKeysStable(keys.data(), (int)keys.size(), order, scratch); }
+
+public:
+	// 프레임 시작 (지난 프레임에 모은 스프라이트를 비움, 메모리는 재사용)
+	void Begin()
+	{
+		pending.clear();
+		keys.clear();
+		instances.clear();
+		runs.clear();
+	}
+
+	// layer : 작은 값부터 그림 (0 ~ MAX_LAYERS-1), texture : 0이면 텍스처 없음 (0 ~ MAX_TEXTURES-1)
+	void Draw(int layer, int texture, const SpriteInstance& instance)
+	{
+		keys.push_back(((uint32_t)layer << 16) | (uint32_t)texture);
+		pending.push_back(instance);
+
+		// 셰이더가 읽을 텍스처 번호를 인스턴스에 새김
+		SpriteInstance& added = pending.back();
+		added.typeFlags = (added.typeFlags & ((1u << SPRITE_TEXTURE_SHIFT) - 1)) | ((uint32_t)texture << SPRITE_TEXTURE_SHIFT);
+	}
+
+	// 정렬, 묶음 나누기, 인스턴스 채우기
+	void End()
+	{
+		int count = (int)keys.size();
+		if (count == 0) return;
+
+		SortKeys();
+
+		instances.resize(count);
+		for (int n = 0; n < count; n++)
+		{
+			int i = order[n];
+			memcpy(&instances[n], &pending[i], sizeof(SpriteInstance));
+
+			// 레이어가 바뀌어도 텍스처가 같으면 바로 이어서 그려도 순서가 그대로이므로 같은 묶음
+			int texture = (int)(keys[i] & 0xFFFF);
+			if (runs.empty() || runs.back().texture != texture)
+			{
+				SpriteRun run;
+				run.texture = texture;
+				run.layer = (int)(keys[i] >> 16);
+				run.firstInstance = n;
+				run.instanceCount = 0;
+				runs.push_back(run);
+			}
+			runs.back().instanceCount++;
+		}
+	}
+
+	const std::vector<SpriteInstance>& GetInstances() const { return instances; }
+	const std::vector<SpriteRun>& GetRuns() const { return runs; }
+	int GetSpriteCount() const { return (int)instances.size(); }
+
+	// n번째로 그려지는 인스턴스가 몇 번째 Draw였는지 (검증용)
+	int GetSubmitIndex(int n) const { return order[n]; }
+};
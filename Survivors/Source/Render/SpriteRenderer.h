@@ -0,0 +1,62 @@
+﻿#pragma once
+#include <d3d12.h>
+#include <wrl.h>
+#include "../Utils/d3dx12.h"
+#include "SpriteBatch.h"
+#include "RenderCommandStream.h"
+#include "UploadHeap.h"
+#include "GlobalDescriptorHeap.h"
+
+// 스프라이트 그리기 명령의 DX12 백엔드 (GPU 없이 돌리는 쪽은 NullRenderBackend)
+// 레이어 순서로 합친 인스턴스를 이번 프레임 업로드 조각 (UploadHeap)에 바로 복사하고, 입력 슬롯 1 (인스턴스 스트림)에 연결
+// 스트림마다 명령 리스트 / 번들을 따로 두지 않는 것은 모든 스프라이트가 같은 PSO라서 합치면 드로우 콜 하나로 끝나기 때문
+// (스레드마다 나눠서 하는 일은 명령 기록과 업로드 버퍼 복사, 명령 리스트에 적는 것은 몇 줄 안 됨)
+// 텍스처는 인스턴스마다 전역 서술자 힙 번호로 고르므로 힙 연결 한 번, DrawInstanced 한 번으로 전부 그림
+class SpriteRenderer
+{
+private:
+	int lastDrawCount = 0;
+	int lastHeapBindCount = 0;
+	int skippedFrames = 0;	// 업로드 버퍼가 모자라서 못 그린 프레임 수
+
+public:
+	// 합친 명령을 그림 (루트 시그니처, PSO, 정점 버퍼 슬롯 0은 미리 세팅되어 있어야 함, 텍스처 테이블은 루트 파라미터 0번)
+	void Flush(ID3D12GraphicsCommandList* commandList, UploadHeap& uploadHeap, const RenderCommandMerger& merged, const GlobalDescriptorHeap& descriptors)
+	{
+		lastDrawCount = 0;
+		lastHeapBindCount = 0;
+		int count = merged.GetSpriteCount();
+		if (count == 0) return;
+
+		// 인스턴스 스트림은 정점 버퍼라 상수 버퍼만큼 크게 정렬할 필요 없음
+		UINT instanceBytes = sizeof(SpriteInstance) * count;
+		UploadSlice slice;
+		if (!uploadHeap.Allocate(instanceBytes, slice, 16))
+		{
+			skippedFrames++;
+			return;
+		}
+		merged.WriteInstances((SpriteInstance*)slice.cpuAddress);
+
+		D3D12_VERTEX_BUFFER_VIEW instanceView = {};
+		instanceView.BufferLocation = slice.gpuAddress;
+		instanceView.StrideInBytes = sizeof(SpriteInstance);
+		instanceView.SizeInBytes = instanceBytes;
+		commandList->IASetVertexBuffers(1, 1, &instanceView);
+
+		// 힙 전체를 텍스처 배열 (t0 ~)로 연결
+		ID3D12DescriptorHeap* descriptorHeaps[] = { descriptors.GetHeap() };
+		commandList->SetDescriptorHeaps(_countof(descriptorHeaps), descriptorHeaps);
+		commandList->SetGraphicsRootDescriptorTable(0, descriptors.GetGPUHandle(0));
+		lastHeapBindCount++;
+
+		// 사각형 정점 6개를 스프라이트 수만큼 (정렬된 순서 그대로 그려짐)
+		commandList->DrawInstanced(6, count, 0, 0);
+		lastDrawCount++;
+	}
+
+	// 마지막 Flush의 드로우 콜 수 (디버깅용)
+	int GetLastDrawCount() const { return lastDrawCount; }
+	int GetLastHeapBindCount() const { return lastHeapBindCount; }
+	int GetSkippedFrames() const { return skippedFrames; }
+};
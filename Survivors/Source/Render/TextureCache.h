@@ -0,0 +1,152 @@
+﻿#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "../Utils/Handle.h"
+#include "../Utils/AssetPath.h"
+
+// 캐시 칸을 가리키는 핸들 (풀 핸들과 같은 세대 핸들, 텍스처가 내려간 뒤 칸이 재사용되면 예전 핸들은 무효)
+typedef EntityHandle TextureHandle;
+
+// 경로를 키로 하는 참조 카운트 텍스처 캐시 (텍스처를 실제로 읽고 올리는 부분은 Loader로 받음, 그래픽 API와 무관)
+// 같은 파일을 몇 번 Acquire해도 Loader는 한 번만 불리고, 모두 Release해서 카운트가 0이 되면 Unloader로 내림
+template <typename Texture>
+class TextureCache
+{
+private:
+	struct Entry
+	{
+		std::string key;
+		Texture texture;
+		int refCount = 0;
+		uint32_t generation = 0;
+	};
+
+	std::vector<Entry> entries;
+	std::vector<int> freeEntries;					// 내려간 텍스처의 칸 (다음 로드 때 재사용)
+	std::unordered_map<std::string, int> lookup;	// 정규화된 경로 -> 칸
+
+	int loadCount = 0;	// Loader 호출 수 (실패 포함)
+	int hitCount = 0;	// 이미 올라가 있어서 Loader 없이 돌려준 수
+	int failCount = 0;
+
+	const Entry* Find(TextureHandle handle) const
+	{
+		if (handle.index < 0 || handle.index >= (int)entries.size()) return nullptr;
+		const Entry& entry = entries[handle.index];
+		if (entry.generation != handle.generation || entry.refCount <= 0) return nullptr;
+		return &entry;
+	}
+
+public:
+	// 텍스처 핸들을 받음 (처음이면 load(path, texture)로 읽음, 실패하면 빈 핸들)
+	// Loader : bool(const char* path, Texture& out), 경로는 처음 요청한 그대로 넘김
+	template <typename Loader>
+	TextureHandle Acquire(const char* path, Loader&& load)
+	{
+		std::string key = NormalizeAssetPath(path);
+
+		TextureHandle handle;
+		auto found = lookup.find(key);
+		if (found != lookup.end())
+		{
+			Entry& entry = entries[found->second];
+			entry.refCount++;
+			hitCount++;
+			handle.index = found->second;
+			handle.generation = entry.generation;
+			return handle;
+		}
+
+		int index;
+		if (!freeEntries.empty())
+		{
+			index = freeEntries.back();
+			freeEntries.pop_back();
+		}
+		else
+		{
+			index = (int)entries.size();
+			entries.emplace_back();
+		}
+
+		Entry& entry = entries[index];
+		loadCount++;
+		if (!load(path, entry.texture))
+		{
+			failCount++;
+			entry.texture = Texture();
+			freeEntries.push_back(index);
+			return handle;
+		}
+
+		entry.key = key;
+		entry.refCount = 1;
+		lookup[key] = index;
+
+		handle.index = index;
+		handle.generation = entry.generation;
+		return handle;
+	}
+
+	// 이미 가진 핸들을 하나 더 나눠줄 때 (텍스처 공유)
+	bool AddRef(TextureHandle handle)
+	{
+		if (Find(handle) == nullptr) return false;
+		entries[handle.index].refCount++;
+		return true;
+	}
+
+	// 핸들 하나 반납, 마지막 핸들이면 unload(texture)로 내리고 칸을 비움
+	// Unloader : void(Texture&)
+	template <typename Unloader>
+	bool Release(TextureHandle handle, Unloader&& unload)
+	{
+		if (Find(handle) == nullptr) return false;
+
+		Entry& entry = entries[handle.index];
+		if (--entry.refCount > 0) return true;
+
+		unload(entry.texture);
+		lookup.erase(entry.key);
+		entry.key.clear();
+		entry.texture = Texture();
+		entry.generation++;		// 예전 핸들은 이제 무효
+		freeEntries.push_back(handle.index);
+		return true;
+	}
+
+	// 핸들이 가리키는 텍스처 (무효한 핸들이면 nullptr)
+	const Texture* Get(TextureHandle handle) const
+	{
+		const Entry* entry = Find(handle);
+		return entry != nullptr ? &entry->texture : nullptr;
+	}
+	Texture* Get(TextureHandle handle)
+	{
+		const Entry* entry = Find(handle);
+		return entry != nullptr ? &entries[handle.index].texture : nullptr;
+	}
+
+	int GetRefCount(TextureHandle handle) const
+	{
+		const Entry* entry = Find(handle);
+		return entry != nullptr ? entry->refCount : 0;
+	}
+
+	// 올라가 있는 텍스처마다 func(texture) 호출
+	template <typename Func>
+	void ForEachLoaded(Func&& func)
+	{
+		for (Entry& entry : entries)
+		{
+			if (entry.refCount > 0) func(entry.texture);
+		}
+	}
+
+	int GetLoadedCount() const { return (int)lookup.size(); }
+	int GetLoadCount() const { return loadCount; }
+	int GetHitCount() const { return hitCount; }
+	int GetFailCount() const { return failCount; }
+};
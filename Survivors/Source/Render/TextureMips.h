@@ -0,0 +1,86 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+// 밉맵 만들기 (그래픽 API와 무관, Tools/AssetPacker가 씀)
+// 작게 그리는 스프라이트 (0.04 크기의 젬, 적 시트 등)가 큰 원본을 점 샘플링하면 화면 픽셀마다 멀리 떨어진 텍셀을 읽어서
+// 텍스처 캐시를 거의 못 씀 (그리고 반짝거림), 밉이 있으면 GPU가 화면 크기에 맞는 작은 단계를 골라 읽음
+// 한 단계는 위 단계의 2x2 픽셀 평균 (박스 필터), 크기는 D3D 규칙대로 max(1, 위 크기 / 2)
+// 색은 알파로 가중 평균해서 투명한 (검은) 픽셀이 윤곽선 색을 어둡게 끌어내리지 않게 함
+
+struct MipLevel
+{
+	int width = 0;
+	int height = 0;
+	std::vector<uint8_t> pixels;	// RGBA8, 줄 간격 width * 4
+};
+
+// width x height의 전체 밉 단계 수 (1x1까지)
+inline int GetFullMipCount(int width, int height)
+{
+	int count = 1;
+	while (width > 1 || height > 1)
+	{
+		width = (std::max)(1, width / 2);
+		height = (std::max)(1, height / 2);
+		count++;
+	}
+	return count;
+}
+
+// 한 단계 줄이기 (홀수 크기의 마지막 줄 / 칸은 2x2 대신 옆 픽셀과 겹쳐서 읽음)
+inline void DownsampleBox(const uint8_t* rgba, int width, int height, size_t pitch, MipLevel& out)
+{
+	out.width = (std::max)(1, width / 2);
+	out.height = (std::max)(1, height / 2);
+	out.pixels.resize((size_t)out.width * out.height * 4);
+
+	for (int y = 0; y < out.height; y++)
+	{
+		const uint8_t* rows[2] = { rgba + (size_t)(std::min)(y * 2, height - 1) * pitch, rgba + (size_t)(std::min)(y * 2 + 1, height - 1) * pitch };
+		uint8_t* dst = &out.pixels[(size_t)y * out.width * 4];
+		for (int x = 0; x < out.width; x++)
+		{
+			int columns[2] = { (std::min)(x * 2, width - 1), (std::min)(x * 2 + 1, width - 1) };
+			uint32_t alpha = 0, color[3] = {}, plain[3] = {};
+			for (const uint8_t* row : rows)
+			{
+				for (int column : columns)
+				{
+					const uint8_t* p = row + (size_t)column * 4;
+					alpha += p[3];
+					for (int c = 0; c < 3; c++)
+					{
+						color[c] += (uint32_t)p[c] * p[3];
+						plain[c] += p[c];
+					}
+				}
+			}
+
+			// 네 픽셀이 모두 투명하면 색은 그냥 평균 (어차피 안 보임)
+			for (int c = 0; c < 3; c++) dst[x * 4 + c] = (uint8_t)(alpha > 0 ? (color[c] + alpha / 2) / alpha : (plain[c] + 2) / 4);
+			dst[x * 4 + 3] = (uint8_t)((alpha + 2) / 4);
+		}
+	}
+}
+
+// 0단계 (원본) 아래로 levels - 1개 단계를 만듦 (out[0]은 비워두고 out[1]부터 채움, 원본을 복사하지 않으려고)
+// levels는 GetFullMipCount보다 크면 잘림
+inline void BuildMipChain(const uint8_t* rgba, int width, int height, size_t pitch, int levels, std::vector<MipLevel>& out)
+{
+	levels = (std::max)(1, (std::min)(levels, GetFullMipCount(width, height)));
+	out.assign(levels, MipLevel());
+	out[0].width = width;
+	out[0].height = height;
+
+	const uint8_t* source = rgba;
+	size_t sourcePitch = pitch;
+	for (int level = 1; level < levels; level++)
+	{
+		DownsampleBox(source, out[level - 1].width, out[level - 1].height, sourcePitch, out[level]);
+		source = out[level].pixels.data();
+		sourcePitch = (size_t)out[level].width * 4;
+	}
+}
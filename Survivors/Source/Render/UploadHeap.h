@@ -0,0 +1,57 @@
+﻿#pragma once
+#include <d3d12.h>
+#include <wrl.h>
+#include "../Utils/d3dx12.h"
+#include "UploadRing.h"
+
+// UploadHeap에서 떼어준 조각 (CPU가 쓸 주소와 GPU가 읽을 주소)
+struct UploadSlice
+{
+	UINT8* cpuAddress = nullptr;
+	D3D12_GPU_VIRTUAL_ADDRESS gpuAddress = 0;
+	UINT64 size = 0;
+};
+
+// 프레임마다 쓰고 버리는 데이터 (인스턴스, 상수 등)를 올리는 업로드 버퍼 하나
+// 객체마다 256바이트짜리 버퍼를 CreateCommittedResource로 만들면 하나에 최소 64KB씩 잡히므로
+// 큰 버퍼 하나를 계속 Map 해두고 UploadRing으로 256바이트 정렬 조각을 잘라서 씀
+class UploadHeap
+{
+private:
+	Microsoft::WRL::ComPtr<ID3D12Resource> buffer;
+	UINT8* mappedData = nullptr;
+	UploadRing ring;
+
+public:
+	void Initialize(ID3D12Device* device, UINT64 capacity)
+	{
+		CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_UPLOAD);
+		CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(capacity);
+		device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &bufferDesc,
+			D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&buffer));
+
+		// 게임 끝날 때 까지 Map 해둠 (CPU가 읽지는 않음)
+		D3D12_RANGE readRange = { 0, 0 };
+		buffer->Map(0, &readRange, reinterpret_cast<void**>(&mappedData));
+
+		ring.Initialize(capacity);
+	}
+
+	// size 바이트 조각을 떼어줌 (아직 GPU가 읽고 있는 프레임과 겹치면 false)
+	bool Allocate(UINT64 size, UploadSlice& outSlice, UINT64 alignment = UploadRing::DEFAULT_ALIGNMENT)
+	{
+		uint64_t offset = 0;
+		if (!ring.Allocate(size, offset, alignment)) return false;
+
+		outSlice.cpuAddress = mappedData + offset;
+		outSlice.gpuAddress = buffer->GetGPUVirtualAddress() + offset;
+		outSlice.size = size;
+		return true;
+	}
+
+	// 이번 프레임에 떼어준 조각들은 fenceValue가 끝나면 다시 씀
+	void FinishFrame(UINT64 fenceValue) { ring.FinishFrame(fenceValue); }
+	void Retire(UINT64 completedFenceValue) { ring.Retire(completedFenceValue); }
+
+	const UploadRing& GetRing() const { return ring; }
+};
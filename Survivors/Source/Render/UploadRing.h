@@ -0,0 +1,124 @@
+﻿#pragma once
+#include <cstdint>
+#include <deque>
+
+// 업로드 버퍼 하나를 프레임마다 잘라 쓰는 링 할당기 (오프셋 계산만, 그래픽 API와 무관)
+// Allocate는 앞 (head)에서 정렬된 조각을 떼어주기만 하고 (포인터 증가라 O(1)), 한 프레임 분량은 FinishFrame으로
+// 그 프레임의 펜스 값과 함께 표시해둠. GPU가 그 펜스를 지나가면 Retire가 뒤 (tail)를 그 프레임 끝까지 당겨서 통째로 반납
+// 끝에 자리가 모자라면 남은 꼬리를 버리고 0번 오프셋부터 다시 씀
+class UploadRing
+{
+public:
+	static const uint64_t DEFAULT_ALIGNMENT = 256;	// DX12 상수 버퍼 뷰 주소 정렬 단위
+
+private:
+	struct FrameMark
+	{
+		uint64_t fenceValue;		// 이 펜스 값을 GPU가 지나가면 반납 가능
+		uint64_t headAtFinish;		// 프레임을 마칠 때의 head (반납하면 tail이 여기로 옴)
+		uint64_t allocatedAtFinish;	// 그때까지 누적으로 떼어준 바이트 (정렬 / 꼬리 버림 포함)
+	};
+
+	uint64_t capacity = 0;
+	uint64_t head = 0;				// 다음에 떼어줄 위치
+	uint64_t tail = 0;				// 아직 GPU가 쓰고 있을 수 있는 가장 오래된 위치
+	uint64_t totalAllocated = 0;	// 지금까지 누적으로 떼어준 바이트
+	uint64_t totalRetired = 0;		// 지금까지 누적으로 반납된 바이트
+	std::deque<FrameMark> frames;
+
+	uint64_t peakUsed = 0;
+	int failedCount = 0;
+
+	static uint64_t AlignUp(uint64_t value, uint64_t alignment) { return (value + alignment - 1) & ~(alignment - 1); }
+
+public:
+	void Initialize(uint64_t newCapacity)
+	{
+		capacity = newCapacity;
+		head = tail = 0;
+		totalAllocated = totalRetired = 0;
+		frames.clear();
+		peakUsed = 0;
+		failedCount = 0;
+	}
+
+	// size 바이트를 alignment (2의 거듭제곱) 경계에 떼어주고 시작 오프셋을 outOffset에 넣음
+	// 아직 반납되지 않은 프레임과 겹치게 되면 실패 (false)
+	bool Allocate(uint64_t size, uint64_t& outOffset, uint64_t alignment = DEFAULT_ALIGNMENT)
+	{
+		uint64_t used = totalAllocated - totalRetired;
+		if (size > capacity)
+		{
+			failedCount++;
+			return false;
+		}
+
+		// 쓰는 곳이 하나도 없으면 처음부터 (정렬 손해도 없음)
+		if (used == 0) head = tail = 0;
+
+		uint64_t start = AlignUp(head, alignment);
+		uint64_t skipped = start - head;	// 정렬 때문에 건너뛰거나, 처음으로 돌아가면서 버리는 꼬리 바이트
+
+		if (used == 0 || head > tail)
+		{
+			// 빈 곳 : [head, capacity)와 [0, tail)
+			if (start + size > capacity)
+			{
+				if (used != 0 && size > tail)
+				{
+					failedCount++;
+					return false;
+				}
+				skipped = capacity - head;
+				start = 0;
+			}
+		}
+		else if (start + size > tail)
+		{
+			// 빈 곳 : [head, tail) (head == tail이면 꽉 참)
+			failedCount++;
+			return false;
+		}
+
+		totalAllocated += skipped + size;
+		head = start + size;
+
+		uint64_t nowUsed = totalAllocated - totalRetired;
+		if (nowUsed > peakUsed) peakUsed = nowUsed;
+
+		outOffset = start;
+		return true;
+	}
+
+	// 이번 프레임에 떼어준 조각들을 fenceValue가 끝나면 반납하도록 표시
+	void FinishFrame(uint64_t fenceValue)
+	{
+		FrameMark mark;
+		mark.fenceValue = fenceValue;
+		mark.headAtFinish = head;
+		mark.allocatedAtFinish = totalAllocated;
+		frames.push_back(mark);
+	}
+
+	// GPU가 completedFenceValue까지 끝냈으면 그 프레임들의 조각을 반납
+	void Retire(uint64_t completedFenceValue)
+	{
+		while (!frames.empty() && frames.front().fenceValue <= completedFenceValue)
+		{
+			// 앞 프레임 이후로 떼어준 게 없는 프레임은 건너뜀 (링이 빈 채로 마친 프레임의 head는
+			// Allocate가 0으로 되돌린 뒤라 낡은 값이므로, tail을 그리로 옮기면 아직 쓰는 조각을 다시 떼어주게 됨)
+			if (frames.front().allocatedAtFinish > totalRetired)
+			{
+				tail = frames.front().headAtFinish;
+				totalRetired = frames.front().allocatedAtFinish;
+			}
+			frames.pop_front();
+		}
+	}
+
+	uint64_t GetCapacity() const { return capacity; }
+	uint64_t GetUsed() const { return totalAllocated - totalRetired; }	// 정렬 / 꼬리 버림 포함
+	uint64_t GetPeakUsed() const { return peakUsed; }
+	int GetFailedCount() const { return failedCount; }
+	int GetFramesInFlight() const { return (int)frames.size(); }
+};
@@ -0,0 +1,889 @@
+﻿#pragma once
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include "../Utils/Pool.h"
+#include "../Utils/SpatialGrid.h"
+#include "../Utils/JobSystem.h"
+#include "../Utils/FlowField.h"
+#include "../Objects/EnemyPool.h"
+
+// 게임 플레이 (PLAY 상태) 시뮬레이션 코어
+// DX12 / Win32 / XAudio2 헤더 없이 표준 C++만 사용하므로 리눅스 빌드 서버의 헤드리스 실행기에서도 그대로 돌아감
+// 게임 쪽 (Game)은 매 틱 입력을 넣고 Tick을 부른 뒤, 나온 이벤트로 소리 / 씬 전환을 처리하고 상태를 그리기만 함
+
+// 재현 가능한 난수 (xorshift32, 같은 시드면 어떤 플랫폼에서든 같은 수열)
+class SimRng
+{
+private:
+	uint32_t state = 2463534242u;
+
+public:
+	void Seed(uint32_t seed) { state = seed != 0 ? seed : 2463534242u; }
+	uint32_t GetState() const { return state; }
+
+	uint32_t Next()
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	// 0 ~ n-1 사이 정수
+	int NextInt(int n) { return (int)(Next() % (uint32_t)n); }
+
+	// 0 ~ 1 사이 실수
+	float NextFloat() { return (Next() >> 8) * (1.0f / 16777216.0f); }
+};
+
+// 시뮬레이션 크기 설정 (게임은 기본값, 벤치마크는 적 수와 스폰 배율을 키워서 사용)
+struct SimConfig
+{
+	int enemyCapacity = 60;
+	int bulletCapacity = 50;
+	int gemCapacity = 200;
+	int damageTextCapacity = 50;
+	int effectCapacity = 30;
+	int spawnMultiplier = 1;		// 웨이브 스폰 한 번에 나오는 적 수 배율
+	bool useFlowField = true;		// 장애물이 있을 때 흐름장으로 돌아가기 (false면 항상 직선 추적)
+	uint32_t seed = 1;
+};
+
+// 한 틱 동안의 입력 (키보드 방향키 상태)
+struct SimInput
+{
+	bool up = false;
+	bool down = false;
+	bool left = false;
+	bool right = false;
+};
+
+// 시뮬레이션이 바깥 (소리, 씬 전환)에 알려야 하는 일
+enum class SimEventType
+{
+	Sound,		// sound에 지정된 효과음 재생
+	LevelUp,	// 경험치가 다 차서 레벨업 (업그레이드를 고르면 ApplyUpgrade 호출)
+	GameOver,	// 플레이어 HP 0
+	Clear,		// 최종 보스 처치
+};
+
+enum class SimSound
+{
+	Gem,
+	AttackMelee,
+	AttackBullet,
+	AttackAura,
+};
+
+struct SimEvent
+{
+	SimEventType type;
+	SimSound sound;
+};
+
+// 플레이어 상태
+struct SimPlayer
+{
+	float x = 0.0f, y = 0.0f;
+	float prevX = 0.0f, prevY = 0.0f;	// 직전 틱 위치 (렌더링 보간용)
+
+	float basespeed = 0.5f;		// 원래 속도
+	float currentSpeed = 0.5f;	// 실제 적용될 현재 속도
+
+	float maxHp = 100.0f;
+	float hp = 100.0f;
+
+	int level = 1;
+	float exp = 0.0f;
+	float maxExp = 100.0f;			// 이 수치가 다 차면 레벨업
+	float damageMultiplier = 1.0f;	// 기본 공격력 100%
+
+	bool isFlipped = false;		// 왼쪽을 보고 있는지
+	bool isHit = false;			// 이번 틱에 적과 부딪혔는지 (빨간색 표시)
+};
+
+// 유도 미사일
+struct SimBullet
+{
+	float x = 0.0f, y = 0.0f;
+	float prevX = 0.0f, prevY = 0.0f;
+	float speed = 1.5f;		// 미사일 속도
+	float damage = 15.0f;	// 미사일 데미지
+	float lifeTime = 0.0f;	// 총알이 살아있는 시간
+	EntityHandle target;	// 고정 (Lock-on)한 적 (그 적이 죽거나 다시 스폰되기 전까지 계속 쫓아감)
+	bool isDead = true;
+};
+
+// 경험치 젬
+struct SimGem
+{
+	float x = 0.0f, y = 0.0f;
+	float expValue = 20.0f;	// 보석 하나 당 경험치
+	bool isDead = true;
+};
+
+// 피격 데미지 숫자
+struct SimDamageText
+{
+	float x = 0.0f, y = 0.0f;
+	float prevX = 0.0f, prevY = 0.0f;
+	float lifeTime = 0.0f;
+	int digit = 0;			// 표시할 숫자 (폰트 시트의 프레임 번호)
+	bool isDead = true;
+};
+
+// 한 번 재생되고 사라지는 타격 이펙트 (프레임 진행도 시뮬레이션이 관리해서 수명이 화면 속도와 무관)
+struct SimEffect
+{
+	float x = 0.0f, y = 0.0f;
+	bool isFlipped = false;
+	int frame = 0;
+	float frameTime = 0.0f;
+	bool isDead = true;
+};
+
+class SimWorld
+{
+public:
+	// 수치들은 기존 D3D12Manager::Update에 있던 값 그대로
+	static constexpr float PLAYER_RADIUS = 0.08f;
+	static constexpr float ENEMY_RADIUS = 0.08f;
+	static constexpr float MAP_LIMIT = 4.5f;
+	static constexpr float SEPARATION_DISTANCE = 0.2f;
+	static constexpr float TARGET_CELL_SIZE = 0.5f;
+	static constexpr float BULLET_HIT_RADIUS = 0.08f;
+	static constexpr float BULLET_LIFETIME = 3.0f;
+	static constexpr float GEM_PICKUP_RADIUS = 0.15f;
+	static constexpr float DAMAGE_TEXT_LIFETIME = 0.5f;
+	static constexpr float EFFECT_FRAME_DURATION = 0.016f;
+	static const int EFFECT_FRAMES = 30;
+
+	// 흐름장 격자 (맵 끝 4.5에서 보스 스폰 거리 2.5까지 덮도록 ±8, 한 칸 0.25)
+	static constexpr float FLOW_EXTENT = 8.0f;
+	static constexpr float FLOW_CELL_SIZE = 0.25f;
+
+	// 병렬 처리 조각 크기 (이보다 적으면 한 조각이라 잡 시스템을 거치지 않고 바로 실행)
+	static const int ENEMY_GRAIN = 1024;	// EnemyPool::LANE_PADDING의 배수여야 함
+	static const int BULLET_GRAIN = 64;
+	static const int GEM_GRAIN = 512;
+	static const int DAMAGE_TEXT_GRAIN = 512;
+
+	SimConfig config;
+	SimRng rng;
+
+	SimPlayer player;
+	EnemyPool enemies;
+	Pool<SimBullet> bullets;		// 가득 차면 발사 취소
+	Pool<SimGem> gems;				// 가득 차면 드롭 취소 (기존 200칸 배열과 같은 동작)
+	Pool<SimDamageText> damageTexts;	// 가득 차면 가장 오래된 숫자를 재사용
+	Pool<SimEffect> meleeEffects;
+	Pool<SimEffect> hitEffects;
+
+	// 무기 상태
+	int selectedWeapon = -1;		// 0 : 근접, 1 : 유도 총, 2 : 오라 (주변)
+	float attackTimer = 0.0f;
+	float attackCooldown = 1.0f;	// 기본 1초마다 공격
+	bool isAuraActive = false;
+	float auraRadius = 0.5f;
+	float auraTextTimer = 0.0f;		// 오라 데미지 숫자 폭주를 막기 위한 틱 타이머
+
+	// 웨이브 상태
+	float gameTimer = 0.0f;
+	float spawnTimer = 0.0f;
+	bool isBossSpawned[4] = { false, false, false, false };
+
+	int totalKills = 0;
+	bool isGameOver = false;	// 한 번이라도 게임 오버 / 클리어 조건이 된 적 있는지
+	bool isCleared = false;
+
+	// 이번 틱에 생긴 이벤트 (다음 Tick 시작 때 비워짐)
+	std::vector<SimEvent> events;
+
+private:
+	SpatialGrid separationGrid;		// 적 밀어내기용
+	SpatialGrid targetGrid;			// 가장 가까운 적 찾기용 (유도탄 등)
+	FlowField flowField;			// 적 이동 방향 (플레이어가 다른 칸으로 넘어갈 때만 다시 계산)
+	std::vector<int> bulletTargets;	// 미사일마다 이번 틱에 쫓아갈 적 번호 (살아있는 미사일 목록 순서)
+
+	JobSystem* jobs = nullptr;		// nullptr이면 전부 호출한 스레드에서 실행
+
+	// [0, count)를 조각으로 나눠 fn(begin, end) 실행 (잡 시스템이 있으면 병렬로)
+	template<typename Fn>
+	void ForRange(int count, int grainSize, Fn&& fn)
+	{
+		if (jobs != nullptr) jobs->ParallelFor(0, count, grainSize, fn);
+		else if (count > 0) fn(0, count);
+	}
+
+public:
+	// 조각끼리 결과를 공유하지 않는 단계만 병렬로 돌리므로 스레드 수가 달라도 결과는 같음
+	void SetJobSystem(JobSystem* newJobs) { jobs = newJobs; }
+
+	// 장애물을 놓을 때 흐름장 칸을 막음 (다음 틱에 흐름장을 다시 계산)
+	FlowField& GetFlowField() { return flowField; }
+	const FlowField& GetFlowField() const { return flowField; }
+
+	void Initialize(const SimConfig& newConfig)
+	{
+		config = newConfig;
+		rng.Seed(config.seed);
+
+		enemies.Initialize(config.enemyCapacity);
+		for (int i = 0; i < config.enemyCapacity; i++) enemies.type[i] = DefaultEnemyType(i, config.enemyCapacity);
+
+		bullets.Initialize(config.bulletCapacity, PoolOverflow::Drop);
+		gems.Initialize(config.gemCapacity, PoolOverflow::Drop);
+		damageTexts.Initialize(config.damageTextCapacity, PoolOverflow::RecycleOldest);
+		meleeEffects.Initialize(config.effectCapacity, PoolOverflow::RecycleOldest);
+		hitEffects.Initialize(config.effectCapacity, PoolOverflow::RecycleOldest);
+
+		int flowCells = (int)(2.0f * FLOW_EXTENT / FLOW_CELL_SIZE);
+		flowField.Initialize(-FLOW_EXTENT, -FLOW_EXTENT, flowCells, flowCells, FLOW_CELL_SIZE);
+	}
+
+	// 적 칸 번호마다 고정된 타입 (마지막 4칸은 보스, 나머지는 기존 60칸 배치 비율대로 노멀 / 스피드 / 탱커)
+	static int DefaultEnemyType(int slot, int capacity)
+	{
+		int normalCount = capacity - 4;
+		if (slot >= normalCount) return 3 + (slot - normalCount);
+
+		int band = slot * 56 / normalCount;
+		if (band < 20) return 0;
+		if (band < 40) return 1;
+		return 2;
+	}
+
+	// 씬 전환 시 게임 데이터 초기화 (기존 ResetGame과 같은 범위)
+	void Reset()
+	{
+		player.hp = player.maxHp;
+		player.exp = 0.0f;
+		player.level = 1;
+		player.x = player.prevX = 0.0f;
+		player.y = player.prevY = 0.0f;
+		gameTimer = 0.0f;
+		selectedWeapon = -1;
+		totalKills = 0;
+		isGameOver = false;
+		isCleared = false;
+
+		enemies.KillAll();
+		bullets.ReleaseAll();
+		gems.ReleaseAll();
+		for (int i = 0; i < 4; i++) isBossSpawned[i] = false;
+		events.clear();
+	}
+
+	// 레벨업 카드 효과 (0 : HP, 1 : 이동 속도, 2 : 데미지, 3 : 쿨타임, 4 : 오라 범위)
+	void ApplyUpgrade(int upgradeId)
+	{
+		if (upgradeId == 0)
+		{
+			player.maxHp += 20.0f; player.hp = player.maxHp; // HP증가 & 풀피
+		}
+		else if (upgradeId == 1)
+		{
+			player.basespeed *= 1.1f;	// 이속 10% 증가
+		}
+		else if (upgradeId == 2)
+		{
+			player.damageMultiplier += 0.2f;	// 모든 무기 데미지 증가
+		}
+		else if (upgradeId == 3)
+		{
+			attackCooldown *= 0.9f;		// 쿨다운 10% 감소
+		}
+		else if (upgradeId == 4)
+		{
+			auraRadius *= 1.2f;			// 오라 범위 증가
+		}
+	}
+
+	// 시뮬레이션 한 틱
+	void Tick(const SimInput& input, float dt)
+	{
+		events.clear();
+		StorePrevPositions();
+
+		// 타이머 증가 및 사망 체크
+		gameTimer += dt;
+
+		// HP가 0인 동안은 매 틱 알림 (레벨업 창에서 돌아와도 다시 게임 오버로 넘어가도록)
+		if (player.hp <= 0.0f)
+		{
+			isGameOver = true;
+			PushEvent(SimEventType::GameOver);
+		}
+
+		UpdatePlayer(input, dt);
+		UpdateWeapons(dt);
+		UpdateEffects(meleeEffects, dt);
+		UpdateEffects(hitEffects, dt);
+		UpdateBullets(dt);
+		UpdateSpawner(dt);
+
+		// 모든 적이 플레이어의 위치를 향해 돌격 (적마다 독립이라 범위를 나눠 병렬 처리)
+		// 장애물이 있으면 흐름장을 플레이어 칸이 바뀐 틱에만 다시 계산하고, 적은 자기 칸의 방향만 읽음
+		// 장애물이 없으면 모든 칸이 플레이어를 볼 수 있어 흐름장 결과가 직선 추적과 같으므로 SIMD 추적 커널을 그대로 사용
+		if (config.useFlowField && flowField.HasObstacles())
+		{
+			flowField.Update(player.x, player.y);
+			ForRange(config.enemyCapacity, ENEMY_GRAIN, [&](int begin, int end)
+				{
+					flowField.SteerRange(enemies.x, enemies.y, enemies.speed, enemies.alive, begin, end, player.x, player.y, dt);
+				});
+		}
+		else
+		{
+			ForRange(enemies.GetPaddedCapacity(), ENEMY_GRAIN, [&](int begin, int end)
+				{
+					enemies.MoveTowardsRange(begin, end, player.x, player.y, dt);
+				});
+		}
+
+		// 적들 끼리 겹치지 않게 서로 밀어내기 (dt를 곱해서 0.5배 속도로 아주 부드럽게)
+		// 격자는 한 번만 빌드하고, 밀림 계산은 빌드 시점 스냅샷만 읽으므로 범위를 나눠 병렬 처리
+		float push = 0.5f * dt;
+		separationGrid.Build(enemies.x, enemies.y, enemies.alive, config.enemyCapacity, SEPARATION_DISTANCE);
+		ForRange(config.enemyCapacity, ENEMY_GRAIN, [&](int begin, int end)
+			{
+				ApplySeparation(separationGrid, enemies.x, enemies.y, enemies.alive, begin, end, SEPARATION_DISTANCE, push);
+			});
+
+		UpdateGems();
+		UpdateDamageTexts(dt);
+
+		// 레벨 업 (남은 경험치는 이월, 다음 레벨은 더 어렵게)
+		if (player.exp >= player.maxExp)
+		{
+			player.exp -= player.maxExp;
+			player.maxExp *= 1.2f;
+			player.level++;
+			PushEvent(SimEventType::LevelUp);
+		}
+	}
+
+	// 시뮬레이션 상태 전체의 해시 (같은 실행 파일, 같은 CPU에서 스레드 수만 바꿨을 때 같은 결과가 나오는지 비교하는 디버깅용)
+	// 적 이동의 SeekBatch는 CPU에 따라 AVX2 / SSE / 스칼라 중 하나를 고르고, SIMD 경로는 rsqrt 근사라 SEEK_KERNEL_TOLERANCE 안에서만 같으므로
+	// SIMD 지원이나 제조사가 다른 CPU끼리는 해시가 달라질 수 있음
+	uint32_t GetStateHash() const
+	{
+		uint32_t hash = 2166136261u;	// FNV-1a
+		auto mix = [&hash](const void* data, size_t size)
+			{
+				const unsigned char* bytes = static_cast<const unsigned char*>(data);
+				for (size_t i = 0; i < size; i++) hash = (hash ^ bytes[i]) * 16777619u;
+			};
+
+		mix(&player.x, sizeof(float)); mix(&player.y, sizeof(float));
+		mix(&player.hp, sizeof(float)); mix(&player.exp, sizeof(float));
+		mix(&player.level, sizeof(int));
+		mix(&gameTimer, sizeof(float));
+		mix(&totalKills, sizeof(int));
+
+		int count = config.enemyCapacity;
+		mix(enemies.x, sizeof(float) * count);
+		mix(enemies.y, sizeof(float) * count);
+		mix(enemies.hp, sizeof(float) * count);
+		mix(enemies.alive, count);
+
+		for (int n = 0; n < bullets.GetLiveCount(); n++) { mix(&bullets.Live(n).x, sizeof(float)); mix(&bullets.Live(n).y, sizeof(float)); }
+		for (int n = 0; n < gems.GetLiveCount(); n++) { mix(&gems.Live(n).x, sizeof(float)); mix(&gems.Live(n).y, sizeof(float)); }
+		for (int n = 0; n < damageTexts.GetLiveCount(); n++) mix(&damageTexts.Live(n).y, sizeof(float));
+
+		uint32_t state = rng.GetState();
+		mix(&state, sizeof(state));
+		return hash;
+	}
+
+	int GetAliveEnemyCount() const
+	{
+		int count = 0;
+		for (int i = 0; i < config.enemyCapacity; i++) count += enemies.alive[i];
+		return count;
+	}
+
+private:
+	void PushEvent(SimEventType type, SimSound sound = SimSound::Gem)
+	{
+		SimEvent e;
+		e.type = type;
+		e.sound = sound;
+		events.push_back(e);
+	}
+
+	void StorePrevPositions()
+	{
+		player.prevX = player.x;
+		player.prevY = player.y;
+		enemies.StorePrevPositions();
+
+		for (int n = 0; n < bullets.GetLiveCount(); n++)
+		{
+			SimBullet& b = bullets.Live(n);
+			b.prevX = b.x; b.prevY = b.y;
+		}
+		for (int n = 0; n < damageTexts.GetLiveCount(); n++)
+		{
+			SimDamageText& t = damageTexts.Live(n);
+			t.prevX = t.x; t.prevY = t.y;
+		}
+	}
+
+	// 데미지 숫자 팝업 (digit : 표시할 숫자)
+	void SpawnDamageText(float x, float y, int digit)
+	{
+		SimDamageText* text = damageTexts.Acquire();
+		if (text == nullptr) return;
+
+		text->isDead = false;
+		text->lifeTime = 0.0f;
+		text->x = text->prevX = x;
+		text->y = text->prevY = y + 0.1f;
+		text->digit = digit;
+	}
+
+	// 적이 죽은 자리에 경험치 젬 드롭
+	void DropGem(float x, float y)
+	{
+		SimGem* gem = gems.Acquire();
+		if (gem == nullptr) return;
+
+		gem->isDead = false;
+		gem->x = x;
+		gem->y = y;
+	}
+
+	// 한 번 재생되는 이펙트를 처음 프레임부터 띄우기
+	void SpawnEffect(Pool<SimEffect>& pool, float x, float y, bool flipped)
+	{
+		SimEffect* effect = pool.Acquire();
+		if (effect == nullptr) return;
+
+		effect->isDead = false;
+		effect->x = x;
+		effect->y = y;
+		effect->isFlipped = flipped;
+		effect->frame = 0;
+		effect->frameTime = 0.0f;
+	}
+
+	// 적 처치 공통 처리 (최종 보스면 클리어, 젬 드롭)
+	void OnEnemyKilled(int i, float ex, float ey)
+	{
+		if (enemies.type[i] == 6) SetCleared();
+		DropGem(ex, ey);
+	}
+
+	void SetCleared()
+	{
+		isCleared = true;
+		PushEvent(SimEventType::Clear);
+	}
+
+	// 적과 부딪히면 느려지고 초당 데미지, 그 다음 키보드 이동과 투명 벽
+	void UpdatePlayer(const SimInput& input, float dt)
+	{
+		// 매 틱 플레이어의 속도를 원래 속도로 원상복구
+		player.currentSpeed = player.basespeed;
+		player.isHit = false;
+
+		float hitDistance = PLAYER_RADIUS + ENEMY_RADIUS;
+		for (int i = 0; i < config.enemyCapacity; i++)
+		{
+			if (!enemies.alive[i]) continue; // 죽은 적과는 부딪히지 않음
+
+			float dx = player.x - enemies.x[i];
+			float dy = player.y - enemies.y[i];
+			if (std::sqrt((dx * dx) + (dy * dy)) < hitDistance)
+			{
+				player.isHit = true;
+				break;	// 하나라도 부딪히면 느려지므로 더 검사할 필요 없음
+			}
+		}
+
+		if (player.isHit)
+		{
+			player.currentSpeed = player.basespeed * 0.6f;
+			player.hp -= 5.0f * dt;		// 피격 시 dt(시간)을 곱해서 초당 데미지(DPS)를 줌
+			if (player.hp < 0.0f) player.hp = 0.0f;
+		}
+
+		if (input.up) player.y += player.currentSpeed * dt;
+		if (input.down) player.y -= player.currentSpeed * dt;
+		if (input.left)
+		{
+			player.x -= player.currentSpeed * dt;
+			player.isFlipped = true;	// 왼쪽 볼 땐 뒤집기
+		}
+		if (input.right)
+		{
+			player.x += player.currentSpeed * dt;
+			player.isFlipped = false;	// 오른쪽 볼 땐 원상 복구
+		}
+
+		// 플레이어 투명 벽 (카메라 마지노선보다 조금 크게 설정)
+		if (player.x > MAP_LIMIT) player.x = MAP_LIMIT;
+		if (player.x < -MAP_LIMIT) player.x = -MAP_LIMIT;
+		if (player.y > MAP_LIMIT) player.y = MAP_LIMIT;
+		if (player.y < -MAP_LIMIT) player.y = -MAP_LIMIT;
+	}
+
+	// 무기 쿨타임, 근접 베기, 미사일 발사, 오라 지속 데미지
+	void UpdateWeapons(float dt)
+	{
+		float px = player.x;
+		float py = player.y;
+
+		attackTimer += dt;
+
+		if (attackTimer >= attackCooldown)
+		{
+			attackTimer = 0.0f; // 쿨타임 리셋
+
+			if (selectedWeapon == 0)
+			{
+				PushEvent(SimEventType::Sound, SimSound::AttackMelee);
+
+				// 플레이어가 보는 방향에 따라 이펙트 위치 결정
+				float dir = player.isFlipped ? -1.0f : 1.0f;
+				float attackX = px + (0.2f * dir);
+				SpawnEffect(meleeEffects, attackX, py, player.isFlipped);
+
+				for (int i = 0; i < config.enemyCapacity; i++)
+				{
+					if (!enemies.alive[i]) continue;
+
+					float ex = enemies.x[i];
+					float ey = enemies.y[i];
+
+					// 방향이 맞고 거리가 가까우면 hit
+					if (((dir > 0 && ex > px) || (dir < 0 && ex < px)) && std::fabs(ex - px) < 0.5f && std::fabs(ey - py) < 0.3f)
+					{
+						// 기본 15 데미지에 -1 ~ +1 랜덤 오차 적용
+						int baseDmg = (int)(15.0f * player.damageMultiplier);
+						int randomDmg = baseDmg + (rng.NextInt(3) - 1);
+						bool isKilled = enemies.ApplyDamage(i, (float)randomDmg);
+
+						SpawnDamageText(ex, ey, randomDmg % 10);
+						if (isKilled) OnEnemyKilled(i, ex, ey);
+					}
+				}
+			}
+			else if (selectedWeapon == 1)
+			{
+				PushEvent(SimEventType::Sound, SimSound::AttackBullet);
+
+				// 풀에서 빈 미사일을 하나 꺼내서 플레이어 위치에서 발사 (가득 차 있으면 이번 발사는 취소)
+				SimBullet* bullet = bullets.Acquire();
+				if (bullet != nullptr)
+				{
+					bullet->isDead = false;
+					bullet->lifeTime = 0.0f;
+					bullet->target = EntityHandle();
+					bullet->x = bullet->prevX = px;
+					bullet->y = bullet->prevY = py;
+				}
+			}
+			else if (selectedWeapon == 2)
+			{
+				PushEvent(SimEventType::Sound, SimSound::AttackAura);
+
+				// 쿨타임이 돌 때마다 오라가 잠깐 켜졌다가 꺼짐 (지속 데미지)
+				isAuraActive = true;
+			}
+		}
+
+		if (selectedWeapon == 2 && isAuraActive)
+		{
+			auraTextTimer += dt;
+			bool shouldPopText = false;
+
+			if (auraTextTimer >= 0.2f)
+			{
+				shouldPopText = true;
+				auraTextTimer = 0.0f;
+			}
+
+			for (int i = 0; i < config.enemyCapacity; i++)
+			{
+				if (!enemies.alive[i]) continue;
+
+				float ex = enemies.x[i];
+				float ey = enemies.y[i];
+				float dx = ex - px;
+				float dy = ey - py;
+
+				if (std::sqrt(dx * dx + dy * dy) < auraRadius)
+				{
+					// 데미지는 매 틱 부드럽게 들어감
+					bool isKilled = enemies.ApplyDamage(i, 15.0f * dt);
+
+					if (shouldPopText)
+					{
+						int baseAuraDmg = (int)(3.0f * player.damageMultiplier);
+						int randomAuraDmg = baseAuraDmg + rng.NextInt(2);
+						SpawnDamageText(ex, ey, randomAuraDmg);
+					}
+
+					if (isKilled)
+					{
+						totalKills++;
+						OnEnemyKilled(i, ex, ey);
+					}
+				}
+			}
+
+			// 0.5초 켜져있다가 꺼짐
+			if (attackTimer > 0.5f) isAuraActive = false;
+		}
+	}
+
+	void UpdateEffects(Pool<SimEffect>& pool, float dt)
+	{
+		for (int n = 0; n < pool.GetLiveCount(); n++)
+		{
+			SimEffect& effect = pool.Live(n);
+
+			effect.frameTime += dt;
+			if (effect.frameTime >= EFFECT_FRAME_DURATION)
+			{
+				effect.frame++;
+				effect.frameTime = 0.0f;
+
+				// 마지막 프레임에 도달하면 이펙트 파괴
+				if (effect.frame >= EFFECT_FRAMES) effect.isDead = true;
+			}
+		}
+
+		pool.ReleaseIf([](SimEffect& e) { return e.isDead; });
+	}
+
+	// 유도 미사일 : 가장 가까운 적을 향해 날아가고 닿으면 데미지
+	void UpdateBullets(float dt)
+	{
+		// 미사일은 한 번 고정한 적을 핸들로 기억해두고, 그 적이 죽거나 칸이 다른 적으로 재사용됐을 때만 새로 찾음
+		// 새로 찾을 미사일이 있을 때만 적 위치로 타겟 격자를 만들고, 주변 칸부터 넓혀가며 가장 가까운 적을 찾음
+		int bulletCount = bullets.GetLiveCount();
+		bulletTargets.resize(bulletCount);
+
+		bool needsSearch = false;
+		for (int n = 0; n < bulletCount && !needsSearch; n++) needsSearch = enemies.Resolve(bullets.Live(n).target) == -1;
+		if (needsSearch) targetGrid.Build(enemies.x, enemies.y, enemies.alive, config.enemyCapacity, TARGET_CELL_SIZE);
+
+		// 1단계 (병렬) : 고정한 적이 없는 미사일만 가장 가까운 적을 미리 찾아둠 (격자와 적 풀은 읽기만 함)
+		ForRange(bulletCount, BULLET_GRAIN, [&](int begin, int end)
+			{
+				for (int n = begin; n < end; n++)
+				{
+					const SimBullet& bullet = bullets.Live(n);
+					int targetIdx = enemies.Resolve(bullet.target);
+					if (targetIdx == -1) targetIdx = targetGrid.FindNearest(bullet.x, bullet.y, 9999.0f, [&](int j) { return enemies.alive[j] != 0; });
+					bulletTargets[n] = targetIdx;
+				}
+			});
+
+		// 2단계 (순서대로) : 이동, 명중, 데미지 (앞선 미사일이 죽인 적은 다음 미사일이 노리지 않아야 하므로 순서 유지)
+		for (int n = 0; n < bulletCount; n++)
+		{
+			SimBullet& bullet = bullets.Live(n);
+
+			// 이번 틱에 앞선 미사일이 죽인 적이면 그때만 다시 찾음 (격자가 아직 없으면 여기서 만듦, 이 단계에선 적이 움직이지 않음)
+			int targetIdx = bulletTargets[n];
+			if (targetIdx != -1 && !enemies.alive[targetIdx])
+			{
+				if (!needsSearch)
+				{
+					targetGrid.Build(enemies.x, enemies.y, enemies.alive, config.enemyCapacity, TARGET_CELL_SIZE);
+					needsSearch = true;
+				}
+				targetIdx = targetGrid.FindNearest(bullet.x, bullet.y, 9999.0f, [&](int j) { return enemies.alive[j] != 0; });
+			}
+			bullet.target = targetIdx != -1 ? enemies.GetHandle(targetIdx) : EntityHandle();
+
+			if (targetIdx != -1)
+			{
+				float ex = enemies.x[targetIdx];
+				float ey = enemies.y[targetIdx];
+				float dx = ex - bullet.x;
+				float dy = ey - bullet.y;
+				float dist = std::sqrt((dx * dx) + (dy * dy));
+
+				if (dist > 0.0f)
+				{
+					bullet.x += (dx / dist) * bullet.speed * dt;
+					bullet.y += (dy / dist) * bullet.speed * dt;
+				}
+
+				if (dist < BULLET_HIT_RADIUS)
+				{
+					// 총알 기본 데미지에 -1 ~ +1 랜덤 오차 적용
+					int baseDmg = (int)(bullet.damage * player.damageMultiplier);
+					int randomDmg = baseDmg + (rng.NextInt(3) - 1);
+					bool isKilled = enemies.ApplyDamage(targetIdx, (float)randomDmg);
+					bullet.isDead = true;
+
+					SpawnEffect(hitEffects, ex, ey, false);
+					SpawnDamageText(ex, ey, randomDmg % 10);
+
+					// 최종 보스에 명중하면 클리어 (기존 판정 그대로)
+					if (enemies.type[targetIdx] == 6) SetCleared();
+					if (isKilled) DropGem(ex, ey);
+				}
+			}
+			else
+			{
+				// 적이 없으면 위로 직진
+				bullet.y += bullet.speed * dt;
+			}
+
+			// 3초 이상 날아가면 화면 밖으로 나간 것으로 간주하고 파괴
+			if (!bullet.isDead)
+			{
+				bullet.lifeTime += dt;
+				if (bullet.lifeTime > BULLET_LIFETIME) bullet.isDead = true;
+			}
+		}
+
+		bullets.ReleaseIf([](SimBullet& b) { return b.isDead; });
+	}
+
+	// 창고에서 targetType의 죽은 적을 꺼내 (x, y)에 스폰 (시간이 지날수록 체력 증가)
+	void SpawnEnemy(int targetType, float x, float y)
+	{
+		for (int copy = 0; copy < config.spawnMultiplier; copy++)
+		{
+			int idx = enemies.FindDead(targetType, rng.NextInt(config.enemyCapacity));
+			if (idx == -1) return;
+
+			// 배율로 늘어난 복제본은 완전히 겹치면 밀어내기가 안 되므로 살짝 흩뿌림
+			float jitterX = copy == 0 ? 0.0f : (rng.NextFloat() - 0.5f) * 0.3f;
+			float jitterY = copy == 0 ? 0.0f : (rng.NextFloat() - 0.5f) * 0.3f;
+
+			// 1초마다 체력 0.1씩 증가 (5분이 되면 기본몹 체력이 15 + 30 = 45로 상승)
+			enemies.Spawn(idx, x + jitterX, y + jitterY, gameTimer * 0.1f);
+		}
+	}
+
+	// 5분 (300초) 웨이브 & 보스 매니저
+	void UpdateSpawner(float dt)
+	{
+		const float twoPi = 6.283185307f;
+		float px = player.x;
+		float py = player.y;
+
+		spawnTimer += dt;
+		int currentMinute = (int)(gameTimer / 60.0f);
+		float spawnInterval = 2.0f - (currentMinute * 0.4f);
+		if (spawnInterval < 0.15f) spawnInterval = 0.15f;
+
+		// 보스 스폰 로직 (1분, 2분, 3분에 중간 보스 / 4분 30초에 최종 보스)
+		if (currentMinute == 1 && !isBossSpawned[0])
+		{
+			SpawnEnemy(3, px + 2.5f, py); isBossSpawned[0] = true;
+		}
+		else if (currentMinute == 2 && !isBossSpawned[1])
+		{
+			SpawnEnemy(4, px - 2.5f, py); isBossSpawned[1] = true;
+		}
+		else if (currentMinute == 3 && !isBossSpawned[2])
+		{
+			SpawnEnemy(5, px, py + 2.5f); isBossSpawned[2] = true;
+		}
+		else if (gameTimer >= 270.0f && !isBossSpawned[3])	// 270초 = 4분 30초
+		{
+			SpawnEnemy(6, px, py - 2.5f); isBossSpawned[3] = true;
+		}
+
+		// 일반 웨이브 스폰 로직 (분 단위로 패턴 변경)
+		if (spawnTimer < spawnInterval) return;
+		spawnTimer = 0.0f;
+
+		if (currentMinute < 1)	// 0 ~ 1분: 몸풀기 원형 포위
+		{
+			for (int k = 0; k < 6; k++)
+			{
+				float angle = k * (twoPi / 6.0f);
+				SpawnEnemy(0, px + std::cos(angle) * 1.5f, py + std::sin(angle) * 1.5f);
+			}
+		}
+		else if (currentMinute < 2)	// 1 ~ 2분: 위아래 양각
+		{
+			for (int k = 0; k < 6; k++)
+			{
+				float offsetX = (px - 2.0f) + (k * 0.8f);
+				SpawnEnemy(1, offsetX, py + 1.5f);
+				SpawnEnemy(1, offsetX, py - 1.5f);
+			}
+		}
+		else if (currentMinute < 3)	// 2 ~ 3분: 혼합 난전
+		{
+			SpawnEnemy(2, px + 1.5f, py);
+			SpawnEnemy(2, px - 1.5f, py);
+			for (int k = 0; k < 5; k++)
+			{
+				float angle = k * (twoPi / 5.0f) + 0.5f;
+				SpawnEnemy(1, px + std::cos(angle) * 1.5f, py + std::sin(angle) * 1.5f);
+			}
+		}
+		else	// 3분 이후: 대규모 물량 공세
+		{
+			for (int k = 0; k < 12; k++)
+			{
+				float angle = k * (twoPi / 12.0f);
+				SpawnEnemy(k % 3, px + std::cos(angle) * 1.5f, py + std::sin(angle) * 1.5f);
+			}
+		}
+	}
+
+	// 젬 : 플레이어 몸에 닿으면 경험치 획득
+	void UpdateGems()
+	{
+		// 거리 검사는 젬마다 독립이라 병렬로 표시만 해두고
+		int gemCount = gems.GetLiveCount();
+		float px = player.x;
+		float py = player.y;
+		ForRange(gemCount, GEM_GRAIN, [&](int begin, int end)
+			{
+				for (int n = begin; n < end; n++)
+				{
+					SimGem& gem = gems.Live(n);
+
+					float dx = px - gem.x;
+					float dy = py - gem.y;
+					if (std::sqrt((dx * dx) + (dy * dy)) < GEM_PICKUP_RADIUS) gem.isDead = true;
+				}
+			});
+
+		// 경험치와 효과음은 목록 순서대로 (누적 순서가 항상 같도록)
+		for (int n = 0; n < gemCount; n++)
+		{
+			SimGem& gem = gems.Live(n);
+			if (!gem.isDead) continue;
+
+			PushEvent(SimEventType::Sound, SimSound::Gem);
+			player.exp += gem.expValue;
+		}
+
+		gems.ReleaseIf([](SimGem& g) { return g.isDead; });
+	}
+
+	// 데미지 숫자 : 위로 살살 떠오르다가 수명이 다하면 삭제
+	void UpdateDamageTexts(float dt)
+	{
+		ForRange(damageTexts.GetLiveCount(), DAMAGE_TEXT_GRAIN, [&](int begin, int end)
+			{
+				for (int n = begin; n < end; n++)
+				{
+					SimDamageText& text = damageTexts.Live(n);
+
+					text.lifeTime += dt;
+					text.y += 0.5f * dt;
+					if (text.lifeTime >= DAMAGE_TEXT_LIFETIME) text.isDead = true;
+				}
+			});
+
+		damageTexts.ReleaseIf([](SimDamageText& t) { return t.isDead; });
+	}
+};
@@ -0,0 +1,257 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <algorithm>
+#include "AssetPath.h"
+#include "MappedFile.h"
+
+// 에셋 팩 (.pack) : 텍스처와 사운드를 미리 풀어서 파일 하나에 담은 것 (Tools/AssetPacker가 만듦)
+// 실행할 때마다 PNG를 다시 풀지 않고, 팩을 메모리 맵으로 열어서 본문 포인터를 그대로 GPU 업로드 / XAudio2 버퍼로 넘김
+//
+// [헤더 64B][목차 : 항목 80B x N, 이름순][이름 표 : '\0'로 끝나는 정규화 경로들][본문들 ...]
+// 본문은 파일 시작 기준 ASSET_PACK_DATA_ALIGNMENT 단위로 정렬
+// 텍스처 본문 : RGBA8, BC7 / BC3 블록 또는 8비트 팔레트 번호, 줄 (블록 압축이면 블록 줄) 간격은 256바이트 정렬
+//               (D3D12 업로드 버퍼의 줄 정렬과 같아서 줄마다 그대로 복사됨)
+//               밉이 있으면 단계마다 512바이트 정렬로 이어 붙이고 (GetTextureLevel), 팔레트 텍스처는 그 뒤에 팔레트 (RGBA8 x 256)
+// 스프라이트 시트는 프레임마다 트림 / 중복 제거해서 2D 아틀라스 페이지로 다시 배치하고 (Source/Utils/SpriteAtlas.h),
+// 픽셀 뒤에 프레임 표 (AssetPackFrame x frameCount)를 붙여서 frameTableOffset에 위치를 기록
+// 아틀라스에 안 들어가는 시트를 블록 압축할 때는 프레임마다 4픽셀 단위 칸에 다시 배치해서 한 블록에 두 프레임이 섞이지 않게 함
+// (칸 오른쪽 / 아래 남는 자리는 가장자리 픽셀을 늘려 채우고, 원래 그림이 칸에서 차지하는 비율을 uvScale로 기록)
+// 사운드 본문 : WAV data 청크의 PCM 그대로, 형식은 항목에 (WAVEFORMATEX와 같은 값)
+// 모든 정수는 리틀 엔디언 (x86 / ARM 공통)
+static const uint32_t ASSET_PACK_MAGIC = 0x4B505653;	// "SVPK"
+static const uint32_t ASSET_PACK_VERSION = 4;
+static const uint32_t ASSET_PACK_DATA_ALIGNMENT = 512;	// D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT
+static const uint32_t ASSET_PACK_PITCH_ALIGNMENT = 256;	// D3D12_TEXTURE_DATA_PITCH_ALIGNMENT
+
+enum AssetType : uint32_t
+{
+	ASSET_TEXTURE = 1,
+	ASSET_SOUND = 2,
+};
+
+enum AssetTextureFormat : uint32_t
+{
+	ASSET_FORMAT_RGBA8 = 0,
+	ASSET_FORMAT_BC3 = 1,
+	ASSET_FORMAT_BC7 = 2,
+	ASSET_FORMAT_PALETTE8 = 3,	// 픽셀마다 팔레트 번호 1바이트 + 팔레트 256색
+};
+
+static const uint32_t ASSET_PACK_PALETTE_SIZE = 256;
+static const uint32_t ASSET_PACK_MAX_MIP_LEVELS = 15;	// 16384 -> 1
+
+struct AssetPackHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t entryCount;
+	uint32_t namesSize;		// 이름 표 바이트 수
+	uint64_t tocOffset;
+	uint64_t namesOffset;
+	uint64_t fileSize;		// 잘린 파일을 알아보려고 기록
+	uint8_t reserved[24];
+};
+
+struct AssetPackEntry
+{
+	uint32_t type;			// AssetType
+	uint32_t nameOffset;	// 이름 표 안의 위치
+	uint32_t nameLength;	// '\0' 제외
+	uint32_t format;		// ASSET_TEXTURE : AssetTextureFormat
+	uint64_t dataOffset;	// 파일 시작 기준
+	uint64_t dataSize;
+
+	// ASSET_TEXTURE
+	uint32_t width;			// 저장된 크기 (블록 압축이면 프레임 칸을 붙인 4의 배수 크기)
+	uint32_t height;
+	uint32_t rowPitch;		// 0단계의 줄 (블록 압축이면 블록 4줄) 간격
+	uint32_t frameCount;	// 애니메이션 프레임 수
+	float uvScale[2];		// 프레임 칸에서 원래 그림이 차지하는 비율 (게임의 uv 크기에 곱함, 아틀라스면 1)
+	uint32_t frameTableOffset;	// 아틀라스면 본문 시작 기준 프레임 표 위치 (0이면 가로 한 줄 시트)
+
+	// ASSET_SOUND (WAVEFORMATEX 필드 그대로)
+	uint16_t formatTag;
+	uint16_t channels;
+	uint32_t samplesPerSec;
+	uint32_t avgBytesPerSec;
+	uint16_t blockAlign;
+	uint16_t bitsPerSample;
+
+	uint32_t mipLevels;		// ASSET_TEXTURE : 밉 단계 수 (1이면 원본만)
+};
+
+// 아틀라스 프레임 하나 (SpriteAtlas의 AtlasFrame과 같은 값)
+struct AssetPackFrame
+{
+	float uvRect[4];	// 아틀라스 기준 (u, v, 폭, 높이)
+	float quadRect[4];	// 원래 프레임 기준 (0 ~ 1)으로 그림이 차지하는 (x, y, 폭, 높이), 폭이 0이면 빈 프레임
+};
+
+static_assert(sizeof(AssetPackHeader) == 64, "AssetPackHeader는 64바이트");
+static_assert(sizeof(AssetPackEntry) == 80, "AssetPackEntry는 80바이트");
+static_assert(sizeof(AssetPackFrame) == 32, "AssetPackFrame은 32바이트");
+
+// 텍스처 본문의 한 밉 단계 (offset은 본문 시작 기준)
+struct AssetTextureLevel
+{
+	uint64_t offset;
+	uint32_t width;
+	uint32_t height;
+	uint32_t rows;			// 줄 수 (블록 압축이면 블록 줄 수)
+	uint32_t rowBytes;		// 줄 하나의 실제 바이트 수
+	uint32_t rowPitch;		// 줄 간격 (256바이트 정렬, 0단계는 항목의 rowPitch)
+};
+
+// level번째 밉 단계의 크기와 위치 (크기는 max(1, 위 단계 / 2), 블록 압축은 4x4 블록 단위로 올림)
+inline AssetTextureLevel GetTextureLevel(const AssetPackEntry& entry, uint32_t level)
+{
+	AssetTextureLevel result = {};
+	for (uint32_t i = 0; i <= level; i++)
+	{
+		if (i > 0) result.offset = (result.offset + (uint64_t)result.rows * result.rowPitch + ASSET_PACK_DATA_ALIGNMENT - 1) & ~(uint64_t)(ASSET_PACK_DATA_ALIGNMENT - 1);
+		result.width = (std::max)(1u, entry.width >> i);
+		result.height = (std::max)(1u, entry.height >> i);
+		bool blocks = entry.format == ASSET_FORMAT_BC3 || entry.format == ASSET_FORMAT_BC7;
+		result.rows = blocks ? (result.height + 3) / 4 : result.height;
+		result.rowBytes = blocks ? (result.width + 3) / 4 * 16 : result.width * (entry.format == ASSET_FORMAT_PALETTE8 ? 1 : 4);
+		result.rowPitch = i == 0 ? entry.rowPitch : (result.rowBytes + ASSET_PACK_PITCH_ALIGNMENT - 1) & ~(ASSET_PACK_PITCH_ALIGNMENT - 1);
+	}
+	return result;
+}
+
+// 픽셀 (모든 밉 단계)이 끝나는 위치 / 팔레트 위치 (팔레트 텍스처만, 본문 시작 기준)
+inline uint64_t GetTexturePixelsEnd(const AssetPackEntry& entry)
+{
+	AssetTextureLevel last = GetTextureLevel(entry, entry.mipLevels - 1);
+	return last.offset + (uint64_t)last.rows * last.rowPitch;
+}
+
+inline uint64_t GetTexturePaletteOffset(const AssetPackEntry& entry)
+{
+	return (GetTexturePixelsEnd(entry) + 15) & ~(uint64_t)15;
+}
+
+// 픽셀 + 팔레트가 끝나는 위치 (아틀라스 프레임 표는 이 뒤에)
+inline uint64_t GetTextureContentEnd(const AssetPackEntry& entry)
+{
+	return entry.format == ASSET_FORMAT_PALETTE8 ? GetTexturePaletteOffset(entry) + ASSET_PACK_PALETTE_SIZE * 4 : GetTexturePixelsEnd(entry);
+}
+
+// 에셋 팩 읽기 (메모리 맵, 열 때 헤더 / 목차 / 본문 범위만 검사하고 본문은 건드리지 않음)
+// Find로 받은 항목과 GetData 포인터는 Close 전까지 유효
+class AssetPack
+{
+private:
+	MappedFile file;
+	const AssetPackHeader* header = nullptr;
+	const AssetPackEntry* entries = nullptr;
+	const char* names = nullptr;
+
+	static bool ValidateTexture(const AssetPackEntry& entry)
+	{
+		if (entry.format > ASSET_FORMAT_PALETTE8 || entry.width == 0 || entry.height == 0 || entry.width > 16384 || entry.height > 16384) return false;
+		if ((entry.format == ASSET_FORMAT_BC3 || entry.format == ASSET_FORMAT_BC7) && (entry.width % 4 != 0 || entry.height % 4 != 0)) return false;
+		if (entry.mipLevels < 1 || entry.mipLevels > ASSET_PACK_MAX_MIP_LEVELS || ((std::max)(entry.width, entry.height) >> (entry.mipLevels - 1)) == 0) return false;	// 1x1 아래로는 없음
+		if (GetTextureLevel(entry, 0).rowBytes > entry.rowPitch || GetTextureContentEnd(entry) > entry.dataSize) return false;
+		if (entry.frameTableOffset != 0)
+		{
+			uint64_t tableEnd = (uint64_t)entry.frameTableOffset + (uint64_t)entry.frameCount * sizeof(AssetPackFrame);
+			if (entry.frameTableOffset % 4 != 0 || entry.frameTableOffset < GetTextureContentEnd(entry) || tableEnd > entry.dataSize) return false;
+		}
+		return true;
+	}
+
+	bool Validate() const
+	{
+		size_t size = file.GetSize();
+		if (size < sizeof(AssetPackHeader)) return false;
+		if (header->magic != ASSET_PACK_MAGIC || header->version != ASSET_PACK_VERSION || header->fileSize != size) return false;
+
+		if (header->tocOffset > size || header->namesOffset > size || header->entryCount > size / sizeof(AssetPackEntry)) return false;
+		uint64_t tocEnd = header->tocOffset + (uint64_t)header->entryCount * sizeof(AssetPackEntry);
+		if (header->tocOffset % 8 != 0 || tocEnd > size) return false;
+		if (header->namesOffset + header->namesSize > size) return false;
+
+		for (uint32_t i = 0; i < header->entryCount; i++)
+		{
+			const AssetPackEntry& entry = entries[i];
+			if ((uint64_t)entry.nameOffset + entry.nameLength >= header->namesSize) return false;
+			if (names[entry.nameOffset + entry.nameLength] != '\0') return false;
+			if (entry.dataOffset % ASSET_PACK_DATA_ALIGNMENT != 0 || entry.dataOffset + entry.dataSize > size) return false;
+			if (entry.type == ASSET_TEXTURE && !ValidateTexture(entry)) return false;
+			if (i > 0 && strcmp(GetName(entries[i - 1]), GetName(entry)) >= 0) return false;	// 이름순이어야 이진 탐색 가능
+		}
+		return true;
+	}
+
+public:
+	bool Open(const char* path)
+	{
+		Close();
+		if (!file.Open(path)) return false;
+
+		const uint8_t* base = file.GetData();
+		header = (const AssetPackHeader*)base;
+		if (file.GetSize() >= sizeof(AssetPackHeader))
+		{
+			entries = (const AssetPackEntry*)(base + header->tocOffset);
+			names = (const char*)(base + header->namesOffset);
+		}
+		if (!Validate())
+		{
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+	void Close()
+	{
+		file.Close();
+		header = nullptr;
+		entries = nullptr;
+		names = nullptr;
+	}
+
+	// 경로로 항목 찾기 (경로는 NormalizeAssetPath로 맞춰서 비교, 없으면 nullptr)
+	const AssetPackEntry* Find(const char* path) const
+	{
+		if (header == nullptr) return nullptr;
+
+		std::string key = NormalizeAssetPath(path);
+		int low = 0, high = (int)header->entryCount - 1;
+		while (low <= high)
+		{
+			int mid = (low + high) / 2;
+			int order = strcmp(GetName(entries[mid]), key.c_str());
+			if (order == 0) return &entries[mid];
+			if (order < 0) low = mid + 1;
+			else high = mid - 1;
+		}
+		return nullptr;
+	}
+
+	const uint8_t* GetData(const AssetPackEntry& entry) const { return file.GetData() + entry.dataOffset; }
+	const char* GetName(const AssetPackEntry& entry) const { return names + entry.nameOffset; }
+
+	// 팔레트 텍스처의 팔레트 (RGBA8 x ASSET_PACK_PALETTE_SIZE, 팔레트 텍스처가 아니면 nullptr)
+	const uint32_t* GetPalette(const AssetPackEntry& entry) const
+	{
+		if (entry.type != ASSET_TEXTURE || entry.format != ASSET_FORMAT_PALETTE8) return nullptr;
+		return (const uint32_t*)(GetData(entry) + GetTexturePaletteOffset(entry));
+	}
+
+	// 아틀라스 텍스처의 프레임 표 (frameCount개, 아틀라스가 아니면 nullptr)
+	const AssetPackFrame* GetFrames(const AssetPackEntry& entry) const
+	{
+		if (entry.type != ASSET_TEXTURE || entry.frameTableOffset == 0) return nullptr;
+		return (const AssetPackFrame*)(GetData(entry) + entry.frameTableOffset);
+	}
+
+	bool IsOpen() const { return header != nullptr; }
+	int GetEntryCount() const { return header != nullptr ? (int)header->entryCount : 0; }
+	const AssetPackEntry& GetEntry(int index) const { return entries[index]; }
+	size_t GetFileSize() const { return file.GetSize(); }
+};
@@ -0,0 +1,521 @@
+﻿#pragma once
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <cctype>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <map>
+#include <cmath>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+#include "stb_image.h"
+#include "AssetPack.h"
+#include "../Render/BlockCompress.h"
+#include "../Render/TextureMips.h"
+#include "../Render/PaletteTexture.h"
+#include "SpriteAtlas.h"
+
+// 에셋 팩 만들기 (Tools/AssetPacker와 벤치마크가 같이 씀, stb_image 구현은 부르는 쪽 .cpp에서 정의)
+
+// 폴더 안에서 확장자가 extension (소문자, 점 포함)인 파일 이름들 (이름순)
+inline std::vector<std::string> ListAssetFiles(const std::string& folder, const char* extension)
+{
+	std::vector<std::string> files;
+	size_t extensionLength = strlen(extension);
+	auto matches = [&](const std::string& name)
+	{
+		if (name.size() <= extensionLength) return false;
+		std::string tail = name.substr(name.size() - extensionLength);
+		for (char& c : tail) c = (char)tolower((unsigned char)c);
+		return tail == extension;
+	};
+
+#ifdef _WIN32
+	WIN32_FIND_DATAA found;
+	HANDLE search = FindFirstFileA((folder + "/*").c_str(), &found);
+	if (search != INVALID_HANDLE_VALUE)
+	{
+		do
+		{
+			if (!(found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) && matches(found.cFileName)) files.push_back(found.cFileName);
+		} while (FindNextFileA(search, &found));
+		FindClose(search);
+	}
+#else
+	DIR* dir = opendir(folder.c_str());
+	if (dir != nullptr)
+	{
+		while (dirent* entry = readdir(dir))
+		{
+			if (matches(entry->d_name)) files.push_back(entry->d_name);
+		}
+		closedir(dir);
+	}
+#endif
+
+	std::sort(files.begin(), files.end());
+	return files;
+}
+
+inline bool ReadWholeFile(const char* path, std::vector<uint8_t>& out)
+{
+	out.clear();
+	FILE* file = fopen(path, "rb");
+	if (file == nullptr) return false;
+
+	uint8_t buffer[64 * 1024];
+	size_t count;
+	while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) out.insert(out.end(), buffer, buffer + count);
+	fclose(file);
+	return true;
+}
+
+// WAV 파일의 fmt / data 청크 찾기 (PCM 본문은 복사하지 않고 bytes 안의 위치만 돌려줌)
+struct WavInfo
+{
+	uint16_t formatTag = 0;
+	uint16_t channels = 0;
+	uint32_t samplesPerSec = 0;
+	uint32_t avgBytesPerSec = 0;
+	uint16_t blockAlign = 0;
+	uint16_t bitsPerSample = 0;
+	size_t dataOffset = 0;
+	size_t dataSize = 0;
+};
+
+inline bool ParseWav(const std::vector<uint8_t>& bytes, WavInfo& out)
+{
+	auto read16 = [&](size_t at) { return (uint16_t)(bytes[at] | bytes[at + 1] << 8); };
+	auto read32 = [&](size_t at) { return (uint32_t)read16(at) | (uint32_t)read16(at + 2) << 16; };
+
+	if (bytes.size() < 12 || memcmp(&bytes[0], "RIFF", 4) != 0 || memcmp(&bytes[8], "WAVE", 4) != 0) return false;
+
+	bool hasFormat = false;
+	size_t cursor = 12;
+	while (cursor + 8 <= bytes.size())
+	{
+		uint32_t chunkSize = read32(cursor + 4);
+		size_t body = cursor + 8;
+		if (chunkSize > bytes.size() - body) return false;
+
+		if (memcmp(&bytes[cursor], "fmt ", 4) == 0 && chunkSize >= 16)
+		{
+			out.formatTag = read16(body);
+			out.channels = read16(body + 2);
+			out.samplesPerSec = read32(body + 4);
+			out.avgBytesPerSec = read32(body + 8);
+			out.blockAlign = read16(body + 12);
+			out.bitsPerSample = read16(body + 14);
+			hasFormat = true;
+		}
+		else if (memcmp(&bytes[cursor], "data", 4) == 0)
+		{
+			out.dataOffset = body;
+			out.dataSize = chunkSize;
+			return hasFormat;
+		}
+
+		cursor = body + chunkSize + (chunkSize & 1);	// 청크는 2바이트 정렬
+	}
+	return false;
+}
+
+// 텍스처마다 팩에 넣을 때의 설정 (Textures/frames.txt, 한 줄에 "파일 이름 프레임 수 [mips]", '#'부터는 주석)
+// mips : 작게 그리는 스프라이트라 밉 단계를 만듦
+// 키는 소문자 파일 이름, 목록에 없는 텍스처는 프레임 1개에 밉 없음
+struct TextureSettings
+{
+	int frames = 1;
+	bool mips = false;
+};
+
+inline std::map<std::string, TextureSettings> LoadTextureSettings(const std::string& path)
+{
+	std::map<std::string, TextureSettings> settings;
+	std::vector<uint8_t> bytes;
+	if (!ReadWholeFile(path.c_str(), bytes)) return settings;
+
+	std::string text(bytes.begin(), bytes.end());
+	if (text.compare(0, 3, "\xEF\xBB\xBF") == 0) text.erase(0, 3);
+
+	size_t lineStart = 0;
+	while (lineStart < text.size())
+	{
+		size_t lineEnd = text.find('\n', lineStart);
+		if (lineEnd == std::string::npos) lineEnd = text.size();
+		std::string line = text.substr(lineStart, lineEnd - lineStart);
+		lineStart = lineEnd + 1;
+
+		line = line.substr(0, line.find('#'));
+		char name[256], flag[32] = {};
+		int count = 0;
+		if (sscanf(line.c_str(), "%255s %d %31s", name, &count, flag) >= 2 && count > 0)
+		{
+			std::string key = name;
+			for (char& c : key) c = (char)tolower((unsigned char)c);
+			settings[key].frames = count;
+			settings[key].mips = strcmp(flag, "mips") == 0;
+		}
+	}
+	return settings;
+}
+
+// 가로로 frames개 늘어선 프레임을 4픽셀 배수 칸에 하나씩 다시 배치 (블록 하나에 두 프레임이 섞이지 않게)
+// 프레임 폭이 정수가 아니면 (15760 / 30 등) 게임이 uv로 읽던 것처럼 칸마다 올림한 폭만큼 가져오고,
+// 칸의 남는 오른쪽 / 아래는 가장자리 픽셀을 늘려 채움 (uv 밖이라 보이지 않고, 블록 끝점이 투명 검정으로 끌려가지 않음)
+// uvScale : 게임의 프레임 uv 크기에 곱할 값 (칸 안에서 원래 그림이 차지하는 비율)
+inline void LayoutFrameCells(const uint8_t* rgba, int width, int height, int frames, std::vector<uint8_t>& out, int& outWidth, int& outHeight, float uvScale[2])
+{
+	double frameWidth = (double)width / frames;
+	int copyWidth = (int)std::ceil(frameWidth);
+	int cellWidth = (copyWidth + 3) & ~3;
+	outWidth = cellWidth * frames;
+	outHeight = (height + 3) & ~3;
+	out.resize((size_t)outWidth * outHeight * 4);
+
+	for (int y = 0; y < outHeight; y++)
+	{
+		const uint8_t* srcRow = rgba + (size_t)(std::min)(y, height - 1) * width * 4;
+		uint8_t* dstRow = &out[(size_t)y * outWidth * 4];
+		for (int frame = 0; frame < frames; frame++)
+		{
+			int srcStart = (int)std::floor(frame * frameWidth);
+			for (int x = 0; x < cellWidth; x++)
+			{
+				int srcX = (std::min)(srcStart + (std::min)(x, copyWidth - 1), width - 1);
+				memcpy(dstRow + (size_t)(frame * cellWidth + x) * 4, srcRow + (size_t)srcX * 4, 4);
+			}
+		}
+	}
+
+	uvScale[0] = (float)(frameWidth / cellWidth);
+	uvScale[1] = (float)height / outHeight;
+}
+
+struct AssetPackOptions
+{
+	bool compress = true;				// 큰 텍스처를 블록 압축 (false면 전부 RGBA8)
+	BlockFormat blockFormat = BLOCK_BC7;
+	int minCompressPixels = 256 * 256;	// 이보다 작은 텍스처 (픽셀 글꼴, 작은 UI)는 RGBA8 그대로
+	double minPsnr = 32.0;				// 압축 결과가 이보다 나쁘면 (dB) RGBA8로 둠
+	bool simd = true;
+	JobSystem* jobs = nullptr;			// 있으면 블록 줄 단위로 병렬 압축
+	bool atlas = true;					// 여러 프레임 시트를 트림 / 중복 제거해서 2D 아틀라스로
+	SpriteAtlasOptions atlasOptions;
+	bool palette = true;				// 색이 256개 이하인 텍스처는 8비트 팔레트로 (손실 없음)
+	bool mips = true;					// frames.txt에 mips가 붙은 텍스처의 밉 단계를 만듦
+	int maxFrameMipLevels = 3;			// 여러 프레임 시트의 밉 단계 수 한계 (칸이 4픽셀 단위라 1/4까지만 칸끼리 섞이지 않음)
+};
+
+struct AssetPackTextureReport
+{
+	std::string name;
+	AssetTextureFormat format = ASSET_FORMAT_RGBA8;
+	int width = 0;			// 원본 크기
+	int height = 0;
+	int frames = 1;
+	int uniqueFrames = 0;	// 아틀라스로 만들었을 때만 (중복 제거 뒤 프레임 수)
+	int storedWidth = 0;	// 팩에 들어간 크기 (아틀라스 / 프레임 칸)
+	int storedHeight = 0;
+	int mipLevels = 1;
+	int colors = 0;			// 팔레트로 만들었을 때만 (팔레트 색 수)
+	double psnr = 0.0;		// 블록 압축을 시도했을 때만
+	uint64_t rgbaBytes = 0;	// RGBA8로 올렸을 때 VRAM
+	uint64_t gpuBytes = 0;	// 실제로 올라가는 VRAM (밉 / 팔레트 포함)
+};
+
+struct AssetPackStats
+{
+	int textures = 0;
+	int sounds = 0;
+	std::vector<std::string> failed;	// 읽지 못해서 빠진 파일
+	std::vector<AssetPackTextureReport> textureReports;
+	uint64_t sourceBytes = 0;			// 원본 PNG / WAV 합계
+	uint64_t packBytes = 0;
+};
+
+// 텍스처 하나를 팩 본문으로 (entry의 텍스처 필드를 채우고, payload는 본문 시작 기준 바이트)
+// 여러 프레임 시트는 아틀라스로 바꾼 뒤, 색이 256개 이하면 팔레트 / 크면 블록 압축 (화질이 기준보다 나쁘면) / 나머지는 RGBA8
+struct PackTextureScratch
+{
+	SpriteAtlas atlas;
+	std::vector<uint8_t> cells, blocks, decoded, padded;
+	std::vector<MipLevel> mips;
+};
+
+inline void EncodePackTexture(const uint8_t* pixels, int width, int height, const TextureSettings& settings, const AssetPackOptions& options,
+	AssetPackEntry& entry, std::vector<uint8_t>& payload, AssetPackTextureReport& report, PackTextureScratch& scratch)
+{
+	report.width = width;
+	report.height = height;
+	report.frames = (std::min)(settings.frames, width);
+	report.rgbaBytes = (uint64_t)width * height * 4;
+
+	entry.frameCount = (uint32_t)report.frames;
+	entry.uvScale[0] = 1.0f;
+	entry.uvScale[1] = 1.0f;
+
+	// 여러 프레임 시트는 아틀라스 페이지로 바꿔서 씀 (한 페이지에 안 들어가거나 작은 글꼴처럼 오히려 커지면 원래 시트 그대로)
+	const uint8_t* image = pixels;
+	int imageWidth = width, imageHeight = height;
+	bool atlased = options.atlas && report.frames > 1 && BuildSpriteAtlas(pixels, width, height, report.frames, scratch.atlas, options.atlasOptions) &&
+		(uint64_t)scratch.atlas.width * scratch.atlas.height < (uint64_t)width * height;
+	if (atlased)
+	{
+		image = scratch.atlas.pixels.data();
+		imageWidth = scratch.atlas.width;
+		imageHeight = scratch.atlas.height;
+		report.uniqueFrames = scratch.atlas.uniqueFrames;
+	}
+
+	int mipLevels = 1;
+	if (options.mips && settings.mips)
+	{
+		mipLevels = GetFullMipCount(imageWidth, imageHeight);
+		if (report.frames > 1) mipLevels = (std::min)(mipLevels, options.maxFrameMipLevels);
+	}
+
+	// 형식 고르기 : 팔레트 -> 블록 압축 (아틀라스는 칸이 이미 4픽셀 단위, 아니면 프레임 칸으로 다시 배치) -> RGBA8
+	uint32_t palette[PALETTE_SIZE];
+	const uint8_t* base = image;
+	int baseWidth = imageWidth, baseHeight = imageHeight;
+	size_t blockPitch = 0;
+	entry.format = ASSET_FORMAT_RGBA8;
+	if (options.palette && BuildPalette(image, imageWidth, imageHeight, (size_t)imageWidth * 4, palette, report.colors))
+	{
+		entry.format = ASSET_FORMAT_PALETTE8;
+	}
+	else if (options.compress && imageWidth * imageHeight >= options.minCompressPixels)
+	{
+		const uint8_t* cellPixels = image;
+		int cellsWidth = imageWidth, cellsHeight = imageHeight;
+		float uvScale[2] = { 1.0f, 1.0f };
+		if (!atlased)
+		{
+			LayoutFrameCells(pixels, width, height, report.frames, scratch.cells, cellsWidth, cellsHeight, uvScale);
+			cellPixels = scratch.cells.data();
+		}
+
+		size_t blockRowBytes = (size_t)cellsWidth / 4 * BLOCK_BYTES;
+		blockPitch = (blockRowBytes + ASSET_PACK_PITCH_ALIGNMENT - 1) & ~(size_t)(ASSET_PACK_PITCH_ALIGNMENT - 1);
+		scratch.blocks.assign(blockPitch * (cellsHeight / 4), 0);
+		CompressImage(cellPixels, cellsWidth, cellsHeight, cellsWidth * 4, options.blockFormat, scratch.blocks.data(), blockPitch, options.simd, options.jobs);
+
+		scratch.decoded.resize((size_t)cellsWidth * cellsHeight * 4);
+		DecompressImage(scratch.blocks.data(), blockPitch, cellsWidth, cellsHeight, options.blockFormat, scratch.decoded.data(), cellsWidth * 4);
+		report.psnr = ComputePsnr(cellPixels, scratch.decoded.data(), cellsWidth, cellsHeight, cellsWidth * 4);
+
+		if (report.psnr >= options.minPsnr)
+		{
+			entry.format = options.blockFormat == BLOCK_BC7 ? ASSET_FORMAT_BC7 : ASSET_FORMAT_BC3;
+			entry.uvScale[0] = uvScale[0];
+			entry.uvScale[1] = uvScale[1];
+			base = cellPixels;
+			baseWidth = cellsWidth;
+			baseHeight = cellsHeight;
+		}
+	}
+
+	entry.width = (uint32_t)baseWidth;
+	entry.height = (uint32_t)baseHeight;
+	entry.mipLevels = (uint32_t)(std::min)(mipLevels, GetFullMipCount(baseWidth, baseHeight));
+	entry.rowPitch = (GetTextureLevel(entry, 0).rowBytes + ASSET_PACK_PITCH_ALIGNMENT - 1) & ~(ASSET_PACK_PITCH_ALIGNMENT - 1);
+	BuildMipChain(base, baseWidth, baseHeight, (size_t)baseWidth * 4, (int)entry.mipLevels, scratch.mips);
+
+	// 단계마다 형식대로 채움 (줄 간격 사이 남는 바이트는 0)
+	payload.assign((size_t)GetTextureContentEnd(entry), 0);
+	report.gpuBytes = 0;
+	for (uint32_t level = 0; level < entry.mipLevels; level++)
+	{
+		AssetTextureLevel layout = GetTextureLevel(entry, level);
+		const uint8_t* levelPixels = level == 0 ? base : scratch.mips[level].pixels.data();
+		uint8_t* dst = &payload[(size_t)layout.offset];
+		report.gpuBytes += (uint64_t)layout.rows * layout.rowBytes;
+
+		if (entry.format == ASSET_FORMAT_PALETTE8)
+		{
+			IndexPaletteImage(levelPixels, (int)layout.width, (int)layout.height, (size_t)layout.width * 4, palette, report.colors, dst, layout.rowPitch);
+		}
+		else if (entry.format == ASSET_FORMAT_RGBA8)
+		{
+			for (uint32_t y = 0; y < layout.height; y++) memcpy(dst + (size_t)y * layout.rowPitch, levelPixels + (size_t)y * layout.rowBytes, layout.rowBytes);
+		}
+		else if (level == 0)
+		{
+			for (uint32_t y = 0; y < layout.rows; y++) memcpy(dst + (size_t)y * layout.rowPitch, &scratch.blocks[y * blockPitch], layout.rowBytes);
+		}
+		else
+		{
+			// 4의 배수가 아닌 작은 단계는 가장자리를 늘려서 블록을 채움 (늘린 부분은 텍스처 밖이라 안 읽힘)
+			int paddedWidth = 0, paddedHeight = 0;
+			float unusedScale[2];
+			LayoutFrameCells(levelPixels, (int)layout.width, (int)layout.height, 1, scratch.padded, paddedWidth, paddedHeight, unusedScale);
+			CompressImage(scratch.padded.data(), paddedWidth, paddedHeight, paddedWidth * 4, options.blockFormat, dst, layout.rowPitch, options.simd, options.jobs);
+		}
+	}
+	if (entry.format == ASSET_FORMAT_PALETTE8)
+	{
+		memcpy(&payload[(size_t)GetTexturePaletteOffset(entry)], palette, sizeof(palette));
+		report.gpuBytes += sizeof(palette);
+	}
+
+	// 아틀라스 프레임 표는 맨 뒤에
+	if (atlased)
+	{
+		entry.frameTableOffset = (uint32_t)((payload.size() + 3) & ~(size_t)3);
+		payload.resize(entry.frameTableOffset + scratch.atlas.frames.size() * sizeof(AssetPackFrame), 0);
+		for (size_t i = 0; i < scratch.atlas.frames.size(); i++)
+		{
+			AssetPackFrame frame;
+			memcpy(frame.uvRect, scratch.atlas.frames[i].uvRect, sizeof(frame.uvRect));
+			memcpy(frame.quadRect, scratch.atlas.frames[i].quadRect, sizeof(frame.quadRect));
+			memcpy(&payload[entry.frameTableOffset + i * sizeof(AssetPackFrame)], &frame, sizeof(frame));
+		}
+	}
+	entry.dataSize = payload.size();
+
+	report.format = (AssetTextureFormat)entry.format;
+	report.storedWidth = baseWidth;
+	report.storedHeight = baseHeight;
+	report.mipLevels = (int)entry.mipLevels;
+}
+
+// assetsRoot/Textures/*.png와 assetsRoot/Sounds/*.wav를 팩 하나로 씀
+// 항목 이름은 게임이 부르는 경로 ("Assets/Textures/gem.png")를 정규화한 것이라 assetsRoot 위치와 상관없음
+// 이미지는 하나씩 풀어서 바로 쓰므로 메모리는 가장 큰 이미지 하나만큼만 씀 (목차는 마지막에 앞으로 돌아가서 채움)
+inline bool BuildAssetPack(const std::string& assetsRoot, const char* outPath, AssetPackStats& stats, const AssetPackOptions& options = AssetPackOptions())
+{
+	std::map<std::string, TextureSettings> textureSettings = LoadTextureSettings(assetsRoot + "/Textures/frames.txt");
+
+	struct Source
+	{
+		std::string key;
+		std::string path;
+		std::string file;
+		AssetType type;
+	};
+
+	std::vector<Source> sources;
+	for (const std::string& file : ListAssetFiles(assetsRoot + "/Textures", ".png"))
+	{
+		sources.push_back({ NormalizeAssetPath(("Assets/Textures/" + file).c_str()), assetsRoot + "/Textures/" + file, file, ASSET_TEXTURE });
+	}
+	for (const std::string& file : ListAssetFiles(assetsRoot + "/Sounds", ".wav"))
+	{
+		sources.push_back({ NormalizeAssetPath(("Assets/Sounds/" + file).c_str()), assetsRoot + "/Sounds/" + file, file, ASSET_SOUND });
+	}
+	std::sort(sources.begin(), sources.end(), [](const Source& a, const Source& b) { return a.key < b.key; });
+
+	FILE* file = fopen(outPath, "wb");
+	if (file == nullptr) return false;
+
+	uint64_t offset = 0;
+	bool ok = true;
+	auto write = [&](const void* data, size_t size)
+	{
+		if (fwrite(data, 1, size, file) != size) ok = false;
+		offset += size;
+	};
+	auto padTo = [&](uint64_t alignment)
+	{
+		static const uint8_t zeros[ASSET_PACK_DATA_ALIGNMENT] = {};
+		while (offset % alignment != 0) write(zeros, (size_t)(std::min)((uint64_t)sizeof(zeros), alignment - offset % alignment));
+	};
+
+	// 자리만 잡아두는 헤더 / 목차 (못 읽은 파일은 빠지므로 목차는 최대 개수만큼)
+	std::vector<AssetPackEntry> entries;
+	std::vector<char> names;
+	AssetPackHeader header = {};
+	std::vector<uint8_t> placeholder(sizeof(AssetPackHeader) + sources.size() * sizeof(AssetPackEntry));
+	write(placeholder.data(), placeholder.size());
+
+	std::vector<uint8_t> bytes, payload;
+	PackTextureScratch scratch;
+	for (const Source& source : sources)
+	{
+		AssetPackEntry entry = {};
+		entry.type = source.type;
+
+		if (source.type == ASSET_TEXTURE)
+		{
+			int width = 0, height = 0, channels = 0;
+			unsigned char* pixels = nullptr;
+			if (ReadWholeFile(source.path.c_str(), bytes))
+			{
+				pixels = stbi_load_from_memory(bytes.data(), (int)bytes.size(), &width, &height, &channels, STBI_rgb_alpha);
+			}
+			if (pixels == nullptr)
+			{
+				stats.failed.push_back(source.path);
+				continue;
+			}
+
+			std::string lowerFile = source.file;
+			for (char& c : lowerFile) c = (char)tolower((unsigned char)c);
+			auto found = textureSettings.find(lowerFile);
+			AssetPackTextureReport report;
+			report.name = source.file;
+			EncodePackTexture(pixels, width, height, found != textureSettings.end() ? found->second : TextureSettings(), options, entry, payload, report, scratch);
+			stbi_image_free(pixels);
+
+			padTo(ASSET_PACK_DATA_ALIGNMENT);
+			entry.dataOffset = offset;
+			write(payload.data(), payload.size());
+			stats.textureReports.push_back(report);
+			stats.textures++;
+		}
+		else
+		{
+			WavInfo wav;
+			if (!ReadWholeFile(source.path.c_str(), bytes) || !ParseWav(bytes, wav))
+			{
+				stats.failed.push_back(source.path);
+				continue;
+			}
+
+			padTo(ASSET_PACK_DATA_ALIGNMENT);
+			entry.formatTag = wav.formatTag;
+			entry.channels = wav.channels;
+			entry.samplesPerSec = wav.samplesPerSec;
+			entry.avgBytesPerSec = wav.avgBytesPerSec;
+			entry.blockAlign = wav.blockAlign;
+			entry.bitsPerSample = wav.bitsPerSample;
+			entry.dataOffset = offset;
+			entry.dataSize = wav.dataSize;
+			write(bytes.data() + wav.dataOffset, wav.dataSize);
+			stats.sounds++;
+		}
+
+		stats.sourceBytes += bytes.size();
+		entry.nameOffset = (uint32_t)names.size();
+		entry.nameLength = (uint32_t)source.key.size();
+		names.insert(names.end(), source.key.begin(), source.key.end());
+		names.push_back('\0');
+		entries.push_back(entry);
+	}
+
+	// 이름 표는 본문 뒤에 붙이고, 헤더와 목차는 맨 앞 자리에 덮어씀
+	padTo(8);
+	header.namesOffset = offset;
+	header.namesSize = (uint32_t)names.size();
+	write(names.data(), names.size());
+
+	header.magic = ASSET_PACK_MAGIC;
+	header.version = ASSET_PACK_VERSION;
+	header.entryCount = (uint32_t)entries.size();
+	header.tocOffset = sizeof(AssetPackHeader);
+	header.fileSize = offset;
+
+	ok = ok && fseek(file, 0, SEEK_SET) == 0;
+	ok = ok && fwrite(&header, sizeof(header), 1, file) == 1;
+	ok = ok && (entries.empty() || fwrite(entries.data(), sizeof(AssetPackEntry), entries.size(), file) == entries.size());
+	ok = fclose(file) == 0 && ok;
+
+	stats.packBytes = offset;
+	return ok;
+}
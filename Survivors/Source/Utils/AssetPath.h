@@ -0,0 +1,43 @@
+﻿#pragma once
+#include <string>
+#include <vector>
+
+// 같은 파일을 가리키는 경로를 하나로 맞춤 (텍스처 캐시와 에셋 팩의 키)
+// '\'는 '/'로, 영문은 소문자로 (Windows 파일 시스템은 대소문자 구분 없음), "./"와 "폴더/../"는 접고, 겹친 '/'는 하나로
+inline std::string NormalizeAssetPath(const char* path)
+{
+	std::vector<std::string> parts;
+	std::string part;
+	for (const char* cursor = path; ; cursor++)
+	{
+		char c = *cursor;
+		if (c != '\0' && c != '/' && c != '\\')
+		{
+			if (c >= 'A' && c <= 'Z') c = (char)(c - 'A' + 'a');
+			part += c;
+			continue;
+		}
+
+		// 조각 하나 끝
+		if (part == "..")
+		{
+			if (!parts.empty() && parts.back() != "..") parts.pop_back();
+			else parts.push_back(part);	// 더 거슬러 올라갈 폴더가 없으면 그대로 둠
+		}
+		else if (!part.empty() && part != ".")
+		{
+			parts.push_back(part);
+		}
+		part.clear();
+
+		if (c == '\0') break;
+	}
+
+	std::string result = (path[0] == '/' || path[0] == '\\') ? "/" : "";
+	for (size_t i = 0; i < parts.size(); i++)
+	{
+		if (i > 0) result += '/';
+		result += parts[i];
+	}
+	return result;
+}
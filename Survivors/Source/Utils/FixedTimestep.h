@@ -0,0 +1,49 @@
+﻿#pragma once
+
+// 고정 간격 시뮬레이션 시계 (Fixed Timestep + Accumulator)
+// 실제 프레임 시간을 누적해두고, 고정된 틱 간격 (예: 1/60초)만큼 쌓일 때마다 시뮬레이션을 한 번씩 돌림
+// 프레임 속도와 상관없이 매 틱 같은 dt를 쓰므로 밀어내기 세기, 오라 DPS, 총알 명중이 항상 같게 나옴
+// 렌더링은 마지막 두 틱 사이를 GetAlpha() 비율만큼 보간해서 그리면 틱 속도보다 빠른 화면에서도 부드러움
+class FixedTimestep
+{
+private:
+	double tickDt = 1.0 / 60.0;
+	double accumulator = 0.0;
+	double timeScale = 1.0;		// 1보다 크면 실제 시간보다 빠르게 시뮬레이션
+	int maxStepsPerFrame = 5;	// 한 프레임에 따라잡을 수 있는 최대 틱 수
+	double droppedTime = 0.0;	// 최대 틱 수를 넘어서 버린 시간 (디버깅용)
+	long long tickCount = 0;
+
+public:
+	void SetTickRate(double ticksPerSecond) { tickDt = 1.0 / ticksPerSecond; }
+	void SetMaxStepsPerFrame(int steps) { maxStepsPerFrame = steps; }
+	void SetTimeScale(double scale) { timeScale = scale; }
+
+	// 이번 프레임에 흐른 실제 시간을 넣으면 돌려야 할 틱 수를 반환
+	// 렉 (창 드래그, 로딩 등)으로 프레임 시간이 튀어도 maxStepsPerFrame 틱까지만 돌리고 나머지는 버림
+	// (따라잡으려고 틱을 더 돌리다 그 프레임이 또 느려지는 악순환 방지)
+	int Advance(double frameSeconds)
+	{
+		if (frameSeconds < 0.0) frameSeconds = 0.0;
+		accumulator += frameSeconds * timeScale;
+
+		int steps = (int)(accumulator / tickDt);
+		if (steps > maxStepsPerFrame)
+		{
+			droppedTime += accumulator - maxStepsPerFrame * tickDt;
+			accumulator = maxStepsPerFrame * tickDt;
+			steps = maxStepsPerFrame;
+		}
+
+		accumulator -= steps * tickDt;
+		tickCount += steps;
+		return steps;
+	}
+
+	// 직전 틱과 현재 틱 사이 어디쯤을 그려야 하는지 (0 : 직전 틱, 1 : 현재 틱)
+	float GetAlpha() const { return (float)(accumulator / tickDt); }
+
+	float GetTickDt() const { return (float)tickDt; }
+	long long GetTickCount() const { return tickCount; }
+	double GetDroppedTime() const { return droppedTime; }
+};
@@ -0,0 +1,309 @@
+﻿#pragma once
+#include <vector>
+#include <queue>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
+#include <functional>
+
+// 플레이어를 향한 격자 흐름장 (Flow Field)
+// 목표 (플레이어)가 있는 칸에서 다익스트라로 모든 칸까지의 이동 비용 (Integration Field)을 한 번 퍼뜨리고
+// 칸마다 비용이 줄어드는 방향 (Direction Field)을 저장해두면, 적은 자기 칸의 방향만 읽으면 되므로 한 마리당 O(1)
+// 플레이어가 다른 칸으로 넘어가거나 벽이 바뀔 때만 다시 계산하므로 적 수가 늘어도 길찾기 비용은 그대로
+// 목표 칸이 벽에 가리지 않고 보이는 칸 (Line of Sight)은 격자 방향 대신 플레이어를 향해 직선으로 이동하므로
+// 장애물이 없는 지금 맵에서는 예전 직선 추적과 똑같이 움직이고, 벽 뒤에 있는 칸만 비용 기울기를 따라 돌아감
+class FlowField
+{
+public:
+	static constexpr float UNREACHABLE = 1e30f;
+
+private:
+	static const int NO_CELL = -2147483647;	// 아직 목표 칸이 없음
+
+	float originX = 0.0f;		// 격자 왼쪽 아래 모서리 월드 좌표
+	float originY = 0.0f;
+	float cellSize = 0.25f;
+	float invCellSize = 4.0f;
+	int width = 0;
+	int height = 0;
+
+	std::vector<uint8_t> blocked;		// 1 : 지나갈 수 없는 칸 (장애물 자리)
+	std::vector<float> integration;		// 목표 칸까지의 이동 비용
+	std::vector<float> dirX;			// 비용이 줄어드는 방향 (단위 벡터, 갈 수 없는 칸은 0)
+	std::vector<float> dirY;
+	std::vector<uint8_t> lineOfSight;	// 1 : 목표 칸이 보임 (직선 추적)
+	int blockedCount = 0;				// 막힌 칸 수 (0이면 시야 검사 없이 전부 보임)
+
+	int targetCx = NO_CELL;
+	int targetCy = NO_CELL;
+	bool isDirty = true;			// 벽이 바뀌어서 다음 Update 때 다시 계산해야 함
+	int rebuildCount = 0;
+
+	int ToCellX(float x) const { return (int)std::floor((x - originX) * invCellSize); }
+	int ToCellY(float y) const { return (int)std::floor((y - originY) * invCellSize); }
+	bool IsInside(int cx, int cy) const { return cx >= 0 && cy >= 0 && cx < width && cy < height; }
+	bool IsOpen(int cx, int cy) const { return IsInside(cx, cy) && !blocked[cy * width + cx]; }
+
+	// 목표 칸에서 시작하는 다익스트라 (직선 이웃 1칸, 대각선 이웃 √2칸, 벽 모서리를 가로지르는 대각선은 금지)
+	void BuildIntegration()
+	{
+		static const int offsetX[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+		static const int offsetY[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+		static const float stepCost[8] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.41421356f, 1.41421356f, 1.41421356f, 1.41421356f };
+
+		integration.assign(width * height, (float)UNREACHABLE);	// 참조로 넘기면 C++14에서 정의가 따로 필요해서 값으로 복사
+		if (!IsOpen(targetCx, targetCy)) return;
+
+		// (비용, 칸 번호) 최소 힙, 비용이 같으면 칸 번호가 작은 쪽이 먼저라 항상 같은 결과
+		typedef std::pair<float, int> Node;
+		std::priority_queue<Node, std::vector<Node>, std::greater<Node>> open;
+
+		int start = targetCy * width + targetCx;
+		integration[start] = 0.0f;
+		open.push(Node(0.0f, start));
+
+		while (!open.empty())
+		{
+			Node node = open.top();
+			open.pop();
+			if (node.first > integration[node.second]) continue;	// 더 싼 길로 이미 처리된 칸
+
+			int cx = node.second % width;
+			int cy = node.second / width;
+
+			for (int k = 0; k < 8; k++)
+			{
+				int nx = cx + offsetX[k];
+				int ny = cy + offsetY[k];
+				if (!IsOpen(nx, ny)) continue;
+				if (k >= 4 && (!IsOpen(nx, cy) || !IsOpen(cx, ny))) continue;
+
+				int next = ny * width + nx;
+				float cost = node.first + stepCost[k];
+				if (cost < integration[next])
+				{
+					integration[next] = cost;
+					open.push(Node(cost, next));
+				}
+			}
+		}
+	}
+
+	// 칸 중심에서 목표 칸 중심까지 선분이 지나는 칸이 전부 열려있는지 (Amanatides-Woo 격자 순회)
+	// 꼭짓점을 정확히 지나면 양 옆 칸이 둘 다 열려있어야 함 (벽 모서리 사이로 빠져나가지 않게)
+	bool HasLineOfSight(int cx, int cy) const
+	{
+		int dx = targetCx - cx;
+		int dy = targetCy - cy;
+		int stepX = dx > 0 ? 1 : -1;
+		int stepY = dy > 0 ? 1 : -1;
+
+		// 칸 중심에서 출발하므로 처음 경계까지는 반 칸
+		float tDeltaX = dx != 0 ? 1.0f / std::abs(dx) : UNREACHABLE;
+		float tDeltaY = dy != 0 ? 1.0f / std::abs(dy) : UNREACHABLE;
+		float tMaxX = 0.5f * tDeltaX;
+		float tMaxY = 0.5f * tDeltaY;
+
+		int x = cx, y = cy;
+		int stepsLeft = std::abs(dx) + std::abs(dy);
+		while (stepsLeft > 0)
+		{
+			if (tMaxX < tMaxY)
+			{
+				x += stepX; tMaxX += tDeltaX; stepsLeft--;
+			}
+			else if (tMaxY < tMaxX)
+			{
+				y += stepY; tMaxY += tDeltaY; stepsLeft--;
+			}
+			else
+			{
+				if (!IsOpen(x + stepX, y) || !IsOpen(x, y + stepY)) return false;
+				x += stepX; tMaxX += tDeltaX;
+				y += stepY; tMaxY += tDeltaY;
+				stepsLeft -= 2;
+			}
+
+			if (!IsOpen(x, y)) return false;
+		}
+		return true;
+	}
+
+	void BuildLineOfSight()
+	{
+		lineOfSight.assign(width * height, 0);
+		for (int cy = 0; cy < height; cy++)
+		{
+			for (int cx = 0; cx < width; cx++)
+			{
+				int index = cy * width + cx;
+				if (integration[index] >= UNREACHABLE) continue;
+				lineOfSight[index] = (blockedCount == 0 || HasLineOfSight(cx, cy)) ? 1 : 0;
+			}
+		}
+	}
+
+	float CostAt(int cx, int cy) const { return IsOpen(cx, cy) ? integration[cy * width + cx] : UNREACHABLE; }
+
+	// 칸마다 비용이 줄어드는 방향 계산
+	// 네 방향 이웃이 모두 열려있으면 중앙 차분 기울기 (대각선 방향도 부드럽게 나옴)
+	// 벽이나 격자 끝에 붙어있으면 가장 싼 이웃 칸 쪽으로 (벽을 따라 돌아감)
+	void BuildDirections()
+	{
+		dirX.assign(width * height, 0.0f);
+		dirY.assign(width * height, 0.0f);
+
+		for (int cy = 0; cy < height; cy++)
+		{
+			for (int cx = 0; cx < width; cx++)
+			{
+				int index = cy * width + cx;
+				float here = integration[index];
+				if (here >= UNREACHABLE || here == 0.0f) continue;
+
+				float left = CostAt(cx - 1, cy), right = CostAt(cx + 1, cy);
+				float down = CostAt(cx, cy - 1), up = CostAt(cx, cy + 1);
+
+				float gx = 0.0f, gy = 0.0f;
+				if (left < UNREACHABLE && right < UNREACHABLE && down < UNREACHABLE && up < UNREACHABLE)
+				{
+					gx = left - right;
+					gy = down - up;
+				}
+				else
+				{
+					float best = here;
+					for (int oy = -1; oy <= 1; oy++)
+					{
+						for (int ox = -1; ox <= 1; ox++)
+						{
+							if (ox == 0 && oy == 0) continue;
+							if (ox != 0 && oy != 0 && (!IsOpen(cx + ox, cy) || !IsOpen(cx, cy + oy))) continue;
+
+							float cost = CostAt(cx + ox, cy + oy);
+							if (cost < best)
+							{
+								best = cost;
+								gx = (float)ox;
+								gy = (float)oy;
+							}
+						}
+					}
+				}
+
+				float length = std::sqrt(gx * gx + gy * gy);
+				if (length > 0.0f)
+				{
+					dirX[index] = gx / length;
+					dirY[index] = gy / length;
+				}
+			}
+		}
+	}
+
+public:
+	// (originX, originY)에서 시작하는 cellsX x cellsY 칸 격자 (처음엔 모든 칸이 열려있음)
+	void Initialize(float newOriginX, float newOriginY, int cellsX, int cellsY, float newCellSize)
+	{
+		originX = newOriginX;
+		originY = newOriginY;
+		width = cellsX;
+		height = cellsY;
+		cellSize = newCellSize;
+		invCellSize = 1.0f / newCellSize;
+
+		blocked.assign(width * height, 0);
+		integration.assign(width * height, (float)UNREACHABLE);
+		dirX.assign(width * height, 0.0f);
+		dirY.assign(width * height, 0.0f);
+		lineOfSight.assign(width * height, 0);
+		blockedCount = 0;
+
+		targetCx = targetCy = NO_CELL;
+		isDirty = true;
+		rebuildCount = 0;
+	}
+
+	// 장애물 칸 지정 (다음 Update 때 흐름장을 다시 계산)
+	void SetBlocked(int cx, int cy, bool isBlocked)
+	{
+		if (!IsInside(cx, cy)) return;
+
+		uint8_t& cell = blocked[cy * width + cx];
+		if (cell == (isBlocked ? 1 : 0)) return;
+
+		cell = isBlocked ? 1 : 0;
+		blockedCount += isBlocked ? 1 : -1;
+		isDirty = true;
+	}
+
+	bool HasObstacles() const { return blockedCount > 0; }
+
+	// 목표 위치가 다른 칸으로 넘어갔거나 벽이 바뀌었을 때만 다시 계산, 다시 계산했으면 true
+	bool Update(float targetX, float targetY)
+	{
+		int cx = ToCellX(targetX);
+		int cy = ToCellY(targetY);
+		if (!isDirty && cx == targetCx && cy == targetCy) return false;
+
+		targetCx = cx;
+		targetCy = cy;
+		isDirty = false;
+		rebuildCount++;
+
+		BuildIntegration();
+		BuildDirections();
+		BuildLineOfSight();
+		return true;
+	}
+
+	// [begin, end) 번호의 살아있는 적을 흐름장 방향으로 speed * dt 만큼 이동
+	// 목표가 보이는 칸, 격자 밖, 목표에 갈 수 없는 칸에서는 (targetX, targetY)를 향해 직선으로 이동
+	void SteerRange(float* xs, float* ys, const float* speeds, const uint8_t* alive, int begin, int end,
+		float targetX, float targetY, float dt) const
+	{
+		for (int i = begin; i < end; i++)
+		{
+			if (!alive[i]) continue;
+
+			float x = xs[i];
+			float y = ys[i];
+
+			// 격자 안이면 좌표가 0 이상이라 floor 대신 정수 변환으로 충분
+			float gridX = (x - originX) * invCellSize;
+			float gridY = (y - originY) * invCellSize;
+			if (gridX >= 0.0f && gridY >= 0.0f && gridX < (float)width && gridY < (float)height)
+			{
+				int index = (int)gridY * width + (int)gridX;
+				if (!lineOfSight[index] && (dirX[index] != 0.0f || dirY[index] != 0.0f))
+				{
+					xs[i] = x + dirX[index] * speeds[i] * dt;
+					ys[i] = y + dirY[index] * speeds[i] * dt;
+					continue;
+				}
+			}
+
+			float dx = targetX - x;
+			float dy = targetY - y;
+			// 직선 추적은 SeekBatchScalar와 같은 식이라 장애물이 없으면 예전과 비트 단위로 같은 결과
+			float dist = std::sqrt((dx * dx) + (dy * dy));
+			if (dist > 0.0f)
+			{
+				xs[i] = x + (dx / dist) * speeds[i] * dt;
+				ys[i] = y + (dy / dist) * speeds[i] * dt;
+			}
+		}
+	}
+
+	// 디버깅 / 벤치마크용 조회
+	float GetIntegration(int cx, int cy) const { return IsInside(cx, cy) ? integration[cy * width + cx] : UNREACHABLE; }
+	float GetDirX(int cx, int cy) const { return IsInside(cx, cy) ? dirX[cy * width + cx] : 0.0f; }
+	float GetDirY(int cx, int cy) const { return IsInside(cx, cy) ? dirY[cy * width + cx] : 0.0f; }
+	bool HasSight(int cx, int cy) const { return IsInside(cx, cy) && lineOfSight[cy * width + cx] != 0; }
+	int GetWidth() const { return width; }
+	int GetHeight() const { return height; }
+	float GetCellSize() const { return cellSize; }
+	float GetOriginX() const { return originX; }
+	float GetOriginY() const { return originY; }
+	int GetRebuildCount() const { return rebuildCount; }
+};
@@ -0,0 +1,16 @@
+﻿#pragma once
+#include <cstdint>
+
+// 풀 칸을 가리키는 세대 (Generation) 핸들
+// 칸 번호만 들고 있으면 그 칸이 반환된 뒤 다른 객체로 재사용됐을 때 엉뚱한 객체를 가리키게 되므로
+// 칸마다 재사용될 때마다 올라가는 세대 번호를 같이 저장해두고, 꺼낼 때 세대가 같은지 확인해서 O(1)로 검증
+struct EntityHandle
+{
+	int index = -1;				// 칸 번호 (-1 : 아무것도 가리키지 않음)
+	uint32_t generation = 0;	// 핸들을 만들 때의 칸 세대
+
+	bool IsNull() const { return index < 0; }
+
+	bool operator==(const EntityHandle& other) const { return index == other.index && generation == other.generation; }
+	bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+};
@@ -0,0 +1,217 @@
+﻿#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <type_traits>
+
+// 작업 훔치기 (Work Stealing) 잡 시스템
+// 스레드마다 자기 작업 큐 (deque)를 가지고, 자기 큐는 뒤에서 꺼내고 (방금 넣은 작업이라 캐시에 남아있음)
+// 할 일이 없으면 다른 스레드 큐의 앞쪽에서 훔쳐옴 (가장 오래 기다린 큰 덩어리부터 가져감)
+// ParallelFor는 범위를 grainSize 단위 조각으로 나누는데, 조각 경계는 스레드 수와 상관없이 항상 같으므로
+// 조각끼리 서로의 결과를 읽지 않는 작업이라면 스레드가 몇 개든 결과가 비트 단위로 같음
+class JobSystem
+{
+private:
+	struct Job
+	{
+		void (*run)(void* context, int begin, int end) = nullptr;
+		void* context = nullptr;
+		int begin = 0;
+		int end = 0;
+		std::atomic<int>* remaining = nullptr;	// 같은 ParallelFor에서 아직 안 끝난 조각 수
+	};
+
+	struct WorkQueue
+	{
+		std::mutex mutex;
+		std::deque<Job> jobs;
+	};
+
+	// 0번 큐는 워커가 아닌 스레드 (게임 루프 등)가 ParallelFor를 부를 때 사용, 1번부터 워커 스레드 전용
+	std::vector<std::unique_ptr<WorkQueue>> queues;
+	std::vector<std::thread> workers;
+
+	std::mutex sleepMutex;
+	std::condition_variable wakeUp;
+	std::atomic<int> pendingJobs{ 0 };	// 모든 큐에 쌓여있는 작업 수 (워커를 재울지 판단)
+	std::atomic<bool> isRunning{ false };
+
+	// 워커 스레드가 어느 잡 시스템의 몇 번 큐를 쓰는지 (thread_local은 모든 JobSystem이 같이 씀)
+	struct WorkerSlot
+	{
+		const JobSystem* owner = nullptr;
+		int index = 0;
+	};
+
+	static WorkerSlot& CurrentSlot()
+	{
+		static thread_local WorkerSlot slot;
+		return slot;
+	}
+
+	// 지금 스레드가 이 잡 시스템에서 쓸 큐 번호 (워커가 아니거나 다른 잡 시스템의 워커면 바깥 스레드처럼 0)
+	int CurrentQueue() const
+	{
+		const WorkerSlot& slot = CurrentSlot();
+		return slot.owner == this ? slot.index : 0;
+	}
+
+	bool PopLocal(int self, Job& outJob)
+	{
+		WorkQueue& queue = *queues[self];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.jobs.empty()) return false;
+
+		outJob = queue.jobs.back();
+		queue.jobs.pop_back();
+		return true;
+	}
+
+	bool Steal(int victim, Job& outJob)
+	{
+		WorkQueue& queue = *queues[victim];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.jobs.empty()) return false;
+
+		outJob = queue.jobs.front();
+		queue.jobs.pop_front();
+		return true;
+	}
+
+	// 자기 큐 먼저, 비어있으면 옆 번호부터 차례로 훔치기
+	bool TryGetJob(int self, Job& outJob)
+	{
+		if (pendingJobs.load(std::memory_order_acquire) == 0) return false;
+
+		bool found = PopLocal(self, outJob);
+		int queueCount = (int)queues.size();
+		for (int n = 1; n < queueCount && !found; n++)
+		{
+			found = Steal((self + n) % queueCount, outJob);
+		}
+
+		if (found) pendingJobs.fetch_sub(1, std::memory_order_relaxed);
+		return found;
+	}
+
+	static void Execute(const Job& job)
+	{
+		job.run(job.context, job.begin, job.end);
+		job.remaining->fetch_sub(1, std::memory_order_release);
+	}
+
+	void WorkerLoop(int self)
+	{
+		CurrentSlot().owner = this;
+		CurrentSlot().index = self;
+
+		while (isRunning.load(std::memory_order_acquire))
+		{
+			Job job;
+			if (TryGetJob(self, job))
+			{
+				Execute(job);
+				continue;
+			}
+
+			// 할 일이 없으면 새 작업이 들어오거나 종료될 때까지 잠듦
+			std::unique_lock<std::mutex> lock(sleepMutex);
+			wakeUp.wait(lock, [this]() { return pendingJobs.load() > 0 || !isRunning.load(); });
+		}
+	}
+
+public:
+	~JobSystem() { Shutdown(); }
+
+	// workerCount : 부르는 스레드 말고 따로 만들 워커 수 (음수면 코어 수 - 1, 0이면 전부 부른 스레드에서 실행)
+	void Initialize(int workerCount = -1)
+	{
+		Shutdown();
+
+		if (workerCount < 0)
+		{
+			int cores = (int)std::thread::hardware_concurrency();
+			workerCount = cores > 1 ? cores - 1 : 0;
+		}
+
+		queues.clear();
+		for (int i = 0; i <= workerCount; i++) queues.emplace_back(new WorkQueue());
+
+		isRunning = true;
+		for (int i = 1; i <= workerCount; i++) workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+	}
+
+	void Shutdown()
+	{
+		if (!isRunning.exchange(false)) return;
+
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex);
+		}
+		wakeUp.notify_all();
+
+		for (std::thread& worker : workers) worker.join();
+		workers.clear();
+	}
+
+	int GetWorkerCount() const { return (int)workers.size(); }
+
+	// [begin, end) 범위를 grainSize 크기 조각으로 나눠 fn(chunkBegin, chunkEnd)를 병렬 실행하고, 전부 끝날 때까지 기다림
+	// 기다리는 동안 부른 스레드도 조각을 처리함 (워커 안에서 다시 ParallelFor를 불러도 됨)
+	template<typename Fn>
+	void ParallelFor(int begin, int end, int grainSize, Fn&& fn)
+	{
+		if (end <= begin) return;
+		if (grainSize < 1) grainSize = 1;
+
+		int chunkCount = (end - begin + grainSize - 1) / grainSize;
+
+		// 워커가 없거나 조각이 하나뿐이면 큐를 거치지 않고 바로 실행 (조각 경계는 똑같이 유지)
+		if (workers.empty() || chunkCount == 1)
+		{
+			for (int chunkBegin = begin; chunkBegin < end; chunkBegin += grainSize)
+			{
+				fn(chunkBegin, chunkBegin + grainSize < end ? chunkBegin + grainSize : end);
+			}
+			return;
+		}
+
+		typedef typename std::remove_reference<Fn>::type FnType;
+		std::atomic<int> remaining(chunkCount);
+		int self = CurrentQueue();
+
+		{
+			// 자기 큐는 뒤에서 꺼내므로 마지막 조각부터 넣어서 부른 스레드가 앞쪽 조각부터 처리하게 함
+			WorkQueue& queue = *queues[self];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			for (int c = chunkCount - 1; c >= 0; c--)
+			{
+				Job job;
+				job.run = [](void* context, int chunkBegin, int chunkEnd) { (*static_cast<FnType*>(context))(chunkBegin, chunkEnd); };
+				job.context = (void*)&fn;
+				job.begin = begin + c * grainSize;
+				job.end = job.begin + grainSize < end ? job.begin + grainSize : end;
+				job.remaining = &remaining;
+				queue.jobs.push_back(job);
+			}
+		}
+
+		pendingJobs.fetch_add(chunkCount, std::memory_order_release);
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex);
+		}
+		wakeUp.notify_all();
+
+		// 내 조각이 다 끝날 때까지 나도 일하면서 기다림 (다른 ParallelFor의 조각을 도와줄 수도 있음)
+		while (remaining.load(std::memory_order_acquire) > 0)
+		{
+			Job job;
+			if (TryGetJob(self, job)) Execute(job);
+			else std::this_thread::yield();
+		}
+	}
+};
@@ -0,0 +1,99 @@
+﻿#pragma once
+#include <cstddef>
+#include <cstdint>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// 읽기 전용 메모리 맵 파일
+// 파일을 읽어서 버퍼에 복사하지 않고 주소 공간에 그대로 붙이므로, 실제로 건드린 페이지만 OS가 디스크 (또는 파일 캐시)에서 가져옴
+// 열려있는 동안 GetData() 포인터는 그대로 유효하고, 복사 / 이동은 막아둠 (맵을 두 번 해제하지 않도록)
+class MappedFile
+{
+private:
+	const uint8_t* data = nullptr;
+	size_t size = 0;
+#ifdef _WIN32
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = nullptr;
+#endif
+
+public:
+	MappedFile() = default;
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	~MappedFile() { Close(); }
+
+	bool Open(const char* path)
+	{
+		Close();
+#ifdef _WIN32
+		file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return false;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+		{
+			Close();
+			return false;
+		}
+
+		mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping == nullptr)
+		{
+			Close();
+			return false;
+		}
+
+		data = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (data == nullptr)
+		{
+			Close();
+			return false;
+		}
+		size = (size_t)fileSize.QuadPart;
+#else
+		int fd = open(path, O_RDONLY);
+		if (fd < 0) return false;
+
+		struct stat info;
+		if (fstat(fd, &info) != 0 || info.st_size == 0)
+		{
+			close(fd);
+			return false;
+		}
+
+		void* view = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);	// 맵은 파일 디스크립터를 닫아도 유지됨
+		if (view == MAP_FAILED) return false;
+
+		data = (const uint8_t*)view;
+		size = (size_t)info.st_size;
+#endif
+		return true;
+	}
+
+	void Close()
+	{
+#ifdef _WIN32
+		if (data != nullptr) UnmapViewOfFile(data);
+		if (mapping != nullptr) CloseHandle(mapping);
+		if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+		mapping = nullptr;
+		file = INVALID_HANDLE_VALUE;
+#else
+		if (data != nullptr) munmap((void*)data, size);
+#endif
+		data = nullptr;
+		size = 0;
+	}
+
+	bool IsOpen() const { return data != nullptr; }
+	const uint8_t* GetData() const { return data; }
+	size_t GetSize() const { return size; }
+};
@@ -0,0 +1,16 @@
+﻿#pragma once
+
+// 위치 / 크기 / 카메라용 float 묶음 (DirectXMath의 XMFLOAT2 / XMFLOAT3처럼 값만 담고 연산은 없음)
+// 게임 코드가 DirectXMath 없이도 (헤드리스 리눅스 빌드) 그대로 컴파일되도록 직접 둠
+struct Float2
+{
+	float x;
+	float y;
+};
+
+struct Float3
+{
+	float x;
+	float y;
+	float z;
+};
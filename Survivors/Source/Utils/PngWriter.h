@@ -0,0 +1,113 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// RGBA8 이미지를 PNG 파일로 저장 (외부 라이브러리 없이, 화면 덤프 / 눈으로 확인하는 용도)
+// 압축은 하지 않음 : zlib 스트림을 "저장만 하는" deflate 블록 (최대 65535바이트)으로 채우므로 크기는 픽셀 바이트와 거의 같지만
+// 어떤 PNG 뷰어 / stb_image로도 그대로 읽힘
+
+struct PngCrcTable
+{
+	uint32_t values[256];
+
+	PngCrcTable()
+	{
+		for (uint32_t n = 0; n < 256; n++)
+		{
+			uint32_t c = n;
+			for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			values[n] = c;
+		}
+	}
+};
+
+inline uint32_t PngCrc32(uint32_t crc, const uint8_t* data, size_t size)
+{
+	static const PngCrcTable table;	// 처음 부를 때 한 번만 만듦 (여러 스레드에서 불러도 안전)
+	crc = ~crc;
+	for (size_t i = 0; i < size; i++) crc = table.values[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+inline void PngPutU32(std::vector<uint8_t>& out, uint32_t value)
+{
+	out.push_back((uint8_t)(value >> 24));
+	out.push_back((uint8_t)(value >> 16));
+	out.push_back((uint8_t)(value >> 8));
+	out.push_back((uint8_t)value);
+}
+
+// 청크 하나 (길이, 종류, 내용, 종류 + 내용의 CRC)
+inline void PngPutChunk(std::vector<uint8_t>& out, const char type[4], const std::vector<uint8_t>& data)
+{
+	PngPutU32(out, (uint32_t)data.size());
+	size_t start = out.size();
+	out.insert(out.end(), type, type + 4);
+	out.insert(out.end(), data.begin(), data.end());
+	PngPutU32(out, PngCrc32(0, out.data() + start, out.size() - start));
+}
+
+// pitch : 줄 간격 (바이트), 실패하면 false
+inline bool WritePng(const char* path, const uint8_t* rgba, int width, int height, size_t pitch)
+{
+	if (width <= 0 || height <= 0) return false;
+
+	// 줄마다 필터 종류 (0 : 없음) 1바이트 + RGBA
+	size_t rowBytes = (size_t)width * 4;
+	std::vector<uint8_t> raw;
+	raw.reserve((rowBytes + 1) * height);
+	for (int y = 0; y < height; y++)
+	{
+		raw.push_back(0);
+		const uint8_t* row = rgba + (size_t)y * pitch;
+		raw.insert(raw.end(), row, row + rowBytes);
+	}
+
+	// zlib 헤더 + 저장 블록들 + Adler-32
+	std::vector<uint8_t> zlib;
+	zlib.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+	zlib.push_back(0x78);
+	zlib.push_back(0x01);
+	size_t offset = 0;
+	do
+	{
+		size_t size = raw.size() - offset < 65535 ? raw.size() - offset : 65535;
+		bool last = offset + size == raw.size();
+		zlib.push_back(last ? 1 : 0);
+		zlib.push_back((uint8_t)size);
+		zlib.push_back((uint8_t)(size >> 8));
+		zlib.push_back((uint8_t)~size);
+		zlib.push_back((uint8_t)(~size >> 8));
+		zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + size);
+		offset += size;
+	} while (offset < raw.size());
+
+	uint32_t a = 1, b = 0;
+	for (uint8_t value : raw)
+	{
+		a = (a + value) % 65521;
+		b = (b + a) % 65521;
+	}
+	PngPutU32(zlib, (b << 16) | a);
+
+	std::vector<uint8_t> header;
+	PngPutU32(header, (uint32_t)width);
+	PngPutU32(header, (uint32_t)height);
+	header.push_back(8);	// 채널당 8비트
+	header.push_back(6);	// RGBA
+	header.push_back(0);
+	header.push_back(0);
+	header.push_back(0);	// 인터레이스 없음
+
+	static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	std::vector<uint8_t> file(signature, signature + 8);
+	PngPutChunk(file, "IHDR", header);
+	PngPutChunk(file, "IDAT", zlib);
+	PngPutChunk(file, "IEND", std::vector<uint8_t>());
+
+	FILE* fp = fopen(path, "wb");
+	if (fp == nullptr) return false;
+	bool ok = fwrite(file.data(), 1, file.size(), fp) == file.size();
+	return fclose(fp) == 0 && ok;
+}
@@ -0,0 +1,223 @@
+﻿#pragma once
+#include <vector>
+#include <memory>
+#include <functional>
+#include "Handle.h"
+
+// 풀이 가득 찼을 때 새로 꺼내달라는 요청을 어떻게 처리할지
+enum class PoolOverflow
+{
+	Drop,			// 요청을 버리고 nullptr 반환 (기존 배열 풀과 같은 동작)
+	RecycleOldest,	// 가장 오래 전에 꺼낸 객체를 강제로 회수해서 다시 사용
+	Grow,			// 처음 용량만큼 칸을 더 만들어서 늘림
+};
+
+// 고정 용량 객체 풀 (Free List)
+// 빈 칸 찾기 / 반환은 O(1), 살아있는 객체만 빽빽한 목록으로 따로 관리해서 순회할 때 죽은 칸을 건너뛰지 않음
+// 객체는 덩어리(chunk) 단위로 만들어두고 절대 옮기지 않으므로 꺼낸 포인터는 Grow 이후에도 그대로 유효
+// 칸이 반환 / 재사용될 때마다 세대가 올라가므로, 다른 객체를 오래 가리킬 때는 포인터 대신 EntityHandle을 저장
+template<typename T>
+class Pool
+{
+private:
+	std::vector<std::unique_ptr<T[]>> chunks;	// 덩어리 하나 = chunkSize 칸
+	int chunkSize = 0;
+	int capacity = 0;
+	PoolOverflow overflow = PoolOverflow::Drop;
+
+	std::vector<int> freeSlots;		// 빈 칸 번호 스택
+	std::vector<int> liveSlots;		// 살아있는 칸 번호 (빽빽하게, 순서는 보장 안 함)
+	std::vector<int> livePos;		// 칸 번호 -> liveSlots 안의 위치 (-1 : 빈 칸)
+	std::vector<uint32_t> generations;	// 칸마다 반환 / 강제 회수된 횟수 (오래된 핸들 판별용)
+
+	// 꺼낸 순서대로 이어진 양방향 연결 리스트 (가장 오래된 객체를 O(1)에 찾기 위함)
+	std::vector<int> olderSlot;
+	std::vector<int> newerSlot;
+	int oldest = -1;
+	int newest = -1;
+
+	int droppedCount = 0;
+
+	// Grow로 새 칸이 생길 때마다 호출 (GPU 자원 생성, 텍스처 공유 등 초기 세팅)
+	std::function<void(T&)> onCreate;
+
+	void AddChunk()
+	{
+		int first = capacity;
+		chunks.emplace_back(new T[chunkSize]);
+		capacity += chunkSize;
+
+		livePos.resize(capacity, -1);
+		generations.resize(capacity, 0);
+		olderSlot.resize(capacity, -1);
+		newerSlot.resize(capacity, -1);
+
+		// 번호가 작은 칸부터 나가도록 역순으로 쌓음
+		for (int slot = capacity - 1; slot >= first; slot--) freeSlots.push_back(slot);
+
+		if (onCreate)
+		{
+			for (int slot = first; slot < capacity; slot++) onCreate(Slot(slot));
+		}
+	}
+
+	void Unlink(int slot)
+	{
+		int older = olderSlot[slot];
+		int newer = newerSlot[slot];
+
+		if (older != -1) newerSlot[older] = newer; else oldest = newer;
+		if (newer != -1) olderSlot[newer] = older; else newest = older;
+
+		olderSlot[slot] = newerSlot[slot] = -1;
+	}
+
+	void LinkNewest(int slot)
+	{
+		olderSlot[slot] = newest;
+		newerSlot[slot] = -1;
+
+		if (newest != -1) newerSlot[newest] = slot; else oldest = slot;
+		newest = slot;
+	}
+
+	void ReleaseSlot(int slot)
+	{
+		// 마지막 살아있는 칸을 지운 자리로 옮겨서 목록을 빽빽하게 유지
+		int pos = livePos[slot];
+		int last = liveSlots.back();
+		liveSlots[pos] = last;
+		livePos[last] = pos;
+		liveSlots.pop_back();
+		livePos[slot] = -1;
+
+		Unlink(slot);
+		generations[slot]++;
+		freeSlots.push_back(slot);
+	}
+
+public:
+	// count 칸을 만들고 전부 빈 칸으로 시작 (Grow 정책이면 이후 늘어날 때도 count 칸씩 늘어남)
+	void Initialize(int count, PoolOverflow policy)
+	{
+		chunks.clear();
+		freeSlots.clear();
+		liveSlots.clear();
+		livePos.clear();
+		generations.clear();
+		olderSlot.clear();
+		newerSlot.clear();
+		oldest = newest = -1;
+		droppedCount = 0;
+
+		chunkSize = count;
+		capacity = 0;
+		overflow = policy;
+
+		freeSlots.reserve(count);
+		liveSlots.reserve(count);
+		AddChunk();
+	}
+
+	// Grow 때 새 칸을 초기화할 함수 (Initialize로 처음 만든 칸은 ForEachSlot으로 직접 세팅)
+	void SetOnCreate(std::function<void(T&)> fn) { onCreate = fn; }
+
+	// 빈 칸 하나를 꺼냄, 꽉 찼으면 정책에 따라 처리 (Drop이면 nullptr)
+	// 꺼낸 객체는 이전에 쓰던 상태가 남아있으므로 부르는 쪽에서 다시 세팅해야 함
+	// outHandle을 넘기면 꺼낸 칸의 핸들을 채워줌 (실패하면 빈 핸들)
+	T* Acquire(EntityHandle* outHandle = nullptr)
+	{
+		if (outHandle != nullptr) *outHandle = EntityHandle();
+
+		if (freeSlots.empty())
+		{
+			if (overflow == PoolOverflow::RecycleOldest && oldest != -1)
+			{
+				// 살아있는 객체를 다른 용도로 덮어쓰므로 세대를 올려서 예전 핸들을 무효로 만듦
+				int slot = oldest;
+				Unlink(slot);
+				LinkNewest(slot);
+				generations[slot]++;
+				if (outHandle != nullptr) *outHandle = GetHandle(slot);
+				return &Slot(slot);
+			}
+
+			if (overflow != PoolOverflow::Grow)
+			{
+				droppedCount++;
+				return nullptr;
+			}
+
+			AddChunk();
+		}
+
+		int slot = freeSlots.back();
+		freeSlots.pop_back();
+
+		livePos[slot] = (int)liveSlots.size();
+		liveSlots.push_back(slot);
+		LinkNewest(slot);
+
+		if (outHandle != nullptr) *outHandle = GetHandle(slot);
+		return &Slot(slot);
+	}
+
+	// 칸 번호의 현재 세대로 핸들 생성
+	EntityHandle GetHandle(int slot) const
+	{
+		EntityHandle handle;
+		handle.index = slot;
+		handle.generation = generations[slot];
+		return handle;
+	}
+
+	// 핸들이 가리키던 객체가 아직 살아있는지 (그 사이 반환 / 재사용됐으면 false)
+	bool IsValid(EntityHandle handle) const
+	{
+		return handle.index >= 0 && handle.index < capacity && livePos[handle.index] != -1 && generations[handle.index] == handle.generation;
+	}
+
+	// 핸들이 가리키는 객체 (무효면 nullptr)
+	T* Get(EntityHandle handle) { return IsValid(handle) ? &Slot(handle.index) : nullptr; }
+	const T* Get(EntityHandle handle) const { return IsValid(handle) ? &chunks[handle.index / chunkSize][handle.index % chunkSize] : nullptr; }
+
+	// 살아있는 객체 목록의 n번째 (0 <= n < GetLiveCount(), 순회 도중 같은 풀에서 반환하려면 ReleaseIf 사용)
+	T& Live(int n) { return Slot(liveSlots[n]); }
+	const T& Live(int n) const { return chunks[liveSlots[n] / chunkSize][liveSlots[n] % chunkSize]; }
+
+	// 살아있는 객체 목록의 n번째가 들어있는 칸 번호 (렌더링용 객체를 칸 번호로 짝지을 때 사용)
+	int LiveSlot(int n) const { return liveSlots[n]; }
+
+	// 칸에 살아있는 객체가 들어있는지 (살아있는 목록은 반환 때마다 순서가 바뀌므로, 순서가 보이는 곳은 칸 번호로 돌면서 확인)
+	bool IsLiveSlot(int slot) const { return livePos[slot] != -1; }
+
+	// pred(T&)가 true인 살아있는 객체를 전부 풀에 반환
+	template<typename Pred>
+	void ReleaseIf(Pred&& pred)
+	{
+		// 뒤에서부터 돌면 지운 자리에 채워지는 객체는 이미 검사한 것이라 빠짐없이 훑을 수 있음
+		for (int n = (int)liveSlots.size() - 1; n >= 0; n--)
+		{
+			int slot = liveSlots[n];
+			if (pred(Slot(slot))) ReleaseSlot(slot);
+		}
+	}
+
+	void ReleaseAll()
+	{
+		ReleaseIf([](T&) { return true; });
+	}
+
+	// 빈 칸 포함 모든 칸마다 fn(T&) 호출 (리소스 로딩 같은 초기 세팅용)
+	template<typename Fn>
+	void ForEachSlot(Fn&& fn)
+	{
+		for (int slot = 0; slot < capacity; slot++) fn(Slot(slot));
+	}
+
+	T& Slot(int slot) { return chunks[slot / chunkSize][slot % chunkSize]; }
+
+	int GetLiveCount() const { return (int)liveSlots.size(); }
+	int GetCapacity() const { return capacity; }
+	int GetDroppedCount() const { return droppedCount; }	// Drop 정책으로 버려진 요청 수 (디버깅용)
+};
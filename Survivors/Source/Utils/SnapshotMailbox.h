@@ -0,0 +1,56 @@
+﻿#pragma once
+#include <atomic>
+#include <cstdint>
+
+// 스레드 하나가 쓰고 다른 스레드 하나가 읽는 세 칸짜리 우편함 (Triple Buffer, 락 없음)
+// 칸 셋을 "쓰는 칸 / 가장 최근에 다 쓴 칸 / 읽는 칸"으로 나눠 갖고, 넘겨줄 때는 칸 번호만 원자적으로 맞바꿈
+// 쓰는 쪽은 읽는 쪽을 기다리지 않고 (읽기 전에 새로 쓰면 예전 것은 버려짐), 읽는 쪽은 항상 가장 최근에 다 쓴 것만 받음
+// 칸의 내용은 복사하지 않으므로 칸마다 잡아둔 메모리 (벡터 등)를 계속 재사용
+template <typename T>
+class SnapshotMailbox
+{
+private:
+	static const uint32_t INDEX_MASK = 0x3;
+	static const uint32_t FRESH = 0x4;	// 가운데 칸을 아직 아무도 안 읽음
+
+	T slots[3];
+	int writeIndex = 0;							// 쓰는 쪽 전용
+	int readIndex = 1;							// 읽는 쪽 전용
+	std::atomic<uint32_t> middle{ 2 };			// 가장 최근에 다 쓴 칸 번호 | FRESH
+
+	// 통계 (각자 자기 스레드에서만 씀)
+	uint64_t published = 0;
+	uint64_t dropped = 0;	// 읽히기 전에 새 것으로 덮인 수
+	uint64_t acquired = 0;
+
+public:
+	// 쓸 칸 (Publish 전까지 쓰는 쪽만 만짐, 예전에 쓰던 내용이 남아있을 수 있음)
+	T& BeginWrite() { return slots[writeIndex]; }
+
+	// 다 쓴 칸을 가장 최근 것으로 내놓고 다른 칸을 받아서 다음에 씀
+	// (release : 칸에 쓴 내용이 번호보다 먼저 보이게, acquire : 읽는 쪽이 다 읽고 돌려준 칸을 받음)
+	void Publish()
+	{
+		uint32_t previous = middle.exchange((uint32_t)writeIndex | FRESH, std::memory_order_acq_rel);
+		if (previous & FRESH) dropped++;
+		writeIndex = (int)(previous & INDEX_MASK);
+		published++;
+	}
+
+	// 새로 다 쓴 칸이 있으면 읽는 칸과 맞바꾸고 true (없으면 읽던 칸 그대로, false)
+	bool Acquire()
+	{
+		if ((middle.load(std::memory_order_relaxed) & FRESH) == 0) return false;
+		uint32_t previous = middle.exchange((uint32_t)readIndex, std::memory_order_acq_rel);
+		readIndex = (int)(previous & INDEX_MASK);
+		acquired++;
+		return true;
+	}
+
+	// 읽는 칸 (다음 Acquire 전까지 읽는 쪽만 만짐, 한 번도 못 받았으면 빈 칸)
+	const T& Read() const { return slots[readIndex]; }
+
+	uint64_t GetPublished() const { return published; }
+	uint64_t GetDropped() const { return dropped; }
+	uint64_t GetAcquired() const { return acquired; }
+};
@@ -5,11 +5,13 @@
 #include <string>
 #include <fstream>
 #include <wrl.h>
+#include "AssetPack.h"
+#include "../Platform/Platform.h"
 
 using namespace Microsoft::WRL;
 
-// XAudio2   Ŵ
-class SoundManager
+// XAudio2   Ŵ (Windows IAudio)
+class SoundManager : public IAudio
 {
 private:
     ComPtr<IXAudio2> pXAudio2;
@@ -24,18 +26,46 @@ private:
     };
 
     std::map<std::string, SoundData> sounds;
+    const AssetPack* pack = nullptr;
+
+    //  ѿ  Ҹ PCM  ʰ ޸  ּҸ ״ XAudio2 ۷ 
+    bool LoadPacked(const std::string& name, const char* filename)
+    {
+        const AssetPackEntry* entry = pack->Find(filename);
+        if (entry == nullptr || entry->type != ASSET_SOUND) return false;
+
+        SoundData sd = {};
+        sd.wfx.wFormatTag = entry->formatTag;
+        sd.wfx.nChannels = entry->channels;
+        sd.wfx.nSamplesPerSec = entry->samplesPerSec;
+        sd.wfx.nAvgBytesPerSec = entry->avgBytesPerSec;
+        sd.wfx.nBlockAlign = entry->blockAlign;
+        sd.wfx.wBitsPerSample = entry->bitsPerSample;
+        sd.pData = nullptr;     //  ޸𸮶  
+        sd.buffer.AudioBytes = (UINT32)entry->dataSize;
+        sd.buffer.pAudioData = pack->GetData(*entry);
+        sd.buffer.Flags = XAUDIO2_END_OF_STREAM;
+
+        pXAudio2->CreateSourceVoice(&sd.pVoice, &sd.wfx);
+        sounds[name] = sd;
+        return true;
+    }
 
 public:
-    void Initialize()
+    // newPack : ִ   ( nullptr,  Ŵ  ־ )
+    void Initialize(const AssetPack* newPack = nullptr)
     {
+        pack = newPack != nullptr && newPack->IsOpen() ? newPack : nullptr;
         CoInitializeEx(nullptr, COINIT_MULTITHREADED);
         XAudio2Create(&pXAudio2, 0, XAUDIO2_DEFAULT_PROCESSOR);
         pXAudio2->CreateMasteringVoice(&pMasterVoice);
     }
 
     // WAV  мؼ ޸𸮿 ø Լ
-    bool LoadWAV(const std::string& name, const char* filename)
+    bool LoadWAV(const std::string& name, const char* filename) override
     {
+        if (pack != nullptr && LoadPacked(name, filename)) return true;
+
         std::ifstream file(filename, std::ios::binary);
         if (!file) return false;
 
@@ -76,7 +106,7 @@ public:
         return true;
     }
 
-    void Play(const std::string& name, bool loop = false, float volume = 1.0f)
+    void Play(const std::string& name, bool loop = false, float volume = 1.0f) override
     {
         if (sounds.find(name) == sounds.end()) return;
 
@@ -0,0 +1,289 @@
+﻿#pragma once
+#include <vector>
+#include <cmath>
+#include <climits>
+
+// 균일 격자 공간 해시 (Uniform Spatial Hash Grid)
+// 매 틱 적 위치로 다시 빌드하고, 질의할 때는 주변 칸에 들어있는 적들만 검사
+// 모든 적 쌍을 비교하던 O(n²) 밀어내기를 O(n)에 가깝게 줄이기 위한 브로드페이즈
+class SpatialGrid
+{
+private:
+	float cellSize = 0.2f;
+	float invCellSize = 5.0f;
+
+	// 칸 좌표 (cx, cy)를 해시해서 찾아가는 버킷 테이블 (크기는 항상 2의 거듭제곱)
+	unsigned int tableMask = 0;
+	std::vector<int> bucketStart;	// 버킷별 시작 위치 (카운팅 정렬 결과, 크기 = 테이블 + 1)
+
+	// 버킷 순서대로 정렬된 아이템 정보 (질의할 때 연속된 메모리만 읽도록 위치도 같이 복사)
+	std::vector<int> sortedIds;
+	std::vector<int> sortedCellX;
+	std::vector<int> sortedCellY;
+	std::vector<float> sortedX;
+	std::vector<float> sortedY;
+
+	// 빌드 중에만 쓰는 임시 버퍼 (매 틱 재할당하지 않도록 멤버로 보관)
+	std::vector<unsigned int> itemBucket;
+	std::vector<int> writeCursor;
+
+	int itemCount = 0;
+
+	// 아이템이 들어있는 칸 좌표의 범위 (링 탐색이 더 바깥으로 나가지 않게 막는 용도)
+	int boundsMinCx = 0, boundsMaxCx = -1;
+	int boundsMinCy = 0, boundsMaxCy = -1;
+
+	int ToCell(float v) const { return (int)std::floor(v * invCellSize); }
+
+	unsigned int Hash(int cx, int cy) const
+	{
+		return (((unsigned int)cx * 73856093u) ^ ((unsigned int)cy * 19349663u)) & tableMask;
+	}
+
+public:
+	// 살아있는 아이템(alive[i] != 0)만 격자에 넣음
+	// 셀 크기는 질의 반경과 같게 잡으면 주변 3x3 칸만 보면 됨
+	void Build(const float* xs, const float* ys, const unsigned char* alive, int count, float newCellSize)
+	{
+		cellSize = newCellSize;
+		invCellSize = 1.0f / newCellSize;
+
+		// 버킷 수는 아이템 수의 2배 이상인 2의 거듭제곱 (충돌 확률을 낮게 유지)
+		unsigned int tableSize = 16;
+		while (tableSize < (unsigned int)count * 2) tableSize <<= 1;
+		tableMask = tableSize - 1;
+
+		bucketStart.assign(tableSize + 1, 0);
+		itemBucket.resize(count);
+
+		// 1단계 : 버킷마다 몇 개가 들어가는지 세기
+		itemCount = 0;
+		boundsMinCx = boundsMinCy = INT_MAX;
+		boundsMaxCx = boundsMaxCy = INT_MIN;
+		for (int i = 0; i < count; i++)
+		{
+			if (!alive[i]) continue;
+
+			int cx = ToCell(xs[i]);
+			int cy = ToCell(ys[i]);
+			if (cx < boundsMinCx) boundsMinCx = cx;
+			if (cx > boundsMaxCx) boundsMaxCx = cx;
+			if (cy < boundsMinCy) boundsMinCy = cy;
+			if (cy > boundsMaxCy) boundsMaxCy = cy;
+
+			unsigned int bucket = Hash(cx, cy);
+			itemBucket[i] = bucket;
+			bucketStart[bucket + 1]++;
+			itemCount++;
+		}
+
+		// 2단계 : 누적 합으로 버킷별 시작 위치 계산
+		for (unsigned int b = 0; b < tableSize; b++)
+		{
+			bucketStart[b + 1] += bucketStart[b];
+		}
+
+		// 3단계 : 각 아이템을 자기 버킷 자리에 배치
+		sortedIds.resize(itemCount);
+		sortedCellX.resize(itemCount);
+		sortedCellY.resize(itemCount);
+		sortedX.resize(itemCount);
+		sortedY.resize(itemCount);
+		writeCursor.assign(bucketStart.begin(), bucketStart.end() - 1);
+
+		for (int i = 0; i < count; i++)
+		{
+			if (!alive[i]) continue;
+
+			int slot = writeCursor[itemBucket[i]]++;
+			sortedIds[slot] = i;
+			sortedCellX[slot] = ToCell(xs[i]);
+			sortedCellY[slot] = ToCell(ys[i]);
+			sortedX[slot] = xs[i];
+			sortedY[slot] = ys[i];
+		}
+	}
+
+	// (x, y)에서 radius 안쪽에 있는 아이템마다 fn(id, itemX, itemY) 호출 (자기 자신도 포함됨)
+	// 아이템 위치는 빌드 시점의 스냅샷이므로 질의 도중에 원본을 수정해도 결과가 흔들리지 않음
+	template<typename Fn>
+	void ForEachNeighbor(float x, float y, float radius, Fn&& fn) const
+	{
+		if (itemCount == 0) return;
+
+		int minCx = ToCell(x - radius), maxCx = ToCell(x + radius);
+		int minCy = ToCell(y - radius), maxCy = ToCell(y + radius);
+		float radiusSq = radius * radius;
+
+		for (int cy = minCy; cy <= maxCy; cy++)
+		{
+			for (int cx = minCx; cx <= maxCx; cx++)
+			{
+				unsigned int bucket = Hash(cx, cy);
+
+				for (int s = bucketStart[bucket]; s < bucketStart[bucket + 1]; s++)
+				{
+					// 해시 충돌로 같은 버킷에 섞인 다른 칸의 아이템은 건너뜀 (중복 방문 방지)
+					if (sortedCellX[s] != cx || sortedCellY[s] != cy) continue;
+
+					float dx = sortedX[s] - x;
+					float dy = sortedY[s] - y;
+					if ((dx * dx) + (dy * dy) < radiusSq)
+					{
+						fn(sortedIds[s], sortedX[s], sortedY[s]);
+					}
+				}
+			}
+		}
+	}
+
+	// (x, y)에서 maxRadius 안쪽에 있고 accept(id)가 true인 아이템 중 가장 가까운 것의 id (없으면 -1)
+	// 자기 칸부터 바깥쪽 링(체비셰프 거리 r인 칸들)을 하나씩 넓혀가며 검사하고,
+	// 지금까지 찾은 최단 거리가 다음 링까지의 최소 거리 (r * cellSize)보다 가까워지면 바로 멈춤
+	// 거리가 같으면 id가 작은 쪽을 골라서 검사 순서와 상관없이 항상 같은 결과를 냄
+	template<typename Filter>
+	int FindNearest(float x, float y, float maxRadius, Filter&& accept, float* outDistSq = nullptr) const
+	{
+		if (itemCount == 0) return -1;
+
+		int bestId = -1;
+		float bestDistSq = maxRadius * maxRadius;
+
+		auto Consider = [&](int s)
+			{
+				float dx = sortedX[s] - x;
+				float dy = sortedY[s] - y;
+				float distSq = (dx * dx) + (dy * dy);
+
+				// 처음 찾을 때는 maxRadius와 같은 거리도 제외 (기존 dist < minDist 비교와 동일)
+				if (distSq > bestDistSq) return;
+				if (distSq == bestDistSq && (bestId == -1 || sortedIds[s] > bestId)) return;
+				if (!accept(sortedIds[s])) return;
+
+				bestDistSq = distSq;
+				bestId = sortedIds[s];
+			};
+
+		int qx = ToCell(x);
+		int qy = ToCell(y);
+
+		// 아이템 범위 밖의 빈 링은 건너뛰고, 범위를 전부 덮는 링까지만 돌면 됨
+		int gapX = qx < boundsMinCx ? boundsMinCx - qx : (qx > boundsMaxCx ? qx - boundsMaxCx : 0);
+		int gapY = qy < boundsMinCy ? boundsMinCy - qy : (qy > boundsMaxCy ? qy - boundsMaxCy : 0);
+		int firstRing = gapX > gapY ? gapX : gapY;
+
+		int farX = (qx - boundsMinCx > boundsMaxCx - qx) ? qx - boundsMinCx : boundsMaxCx - qx;
+		int farY = (qy - boundsMinCy > boundsMaxCy - qy) ? qy - boundsMinCy : boundsMaxCy - qy;
+		int lastRing = farX > farY ? farX : farY;
+
+		// maxRadius 밖의 링은 볼 필요가 없음
+		float ringLimit = maxRadius * invCellSize + 1.0f;
+		if (ringLimit < (float)lastRing) lastRing = (int)ringLimit;
+
+		int visitedCells = 0;
+
+		auto VisitCell = [&](int cx, int cy)
+			{
+				unsigned int bucket = Hash(cx, cy);
+				visitedCells++;
+
+				for (int s = bucketStart[bucket]; s < bucketStart[bucket + 1]; s++)
+				{
+					// 해시 충돌로 섞인 다른 칸의 아이템은 건너뜀
+					if (sortedCellX[s] != cx || sortedCellY[s] != cy) continue;
+					Consider(s);
+				}
+			};
+
+		for (int r = firstRing; r <= lastRing; r++)
+		{
+			// 적이 아주 드문드문 퍼져 있어서 빈 칸만 계속 보게 되면 전체를 한 번 훑는 쪽이 더 쌈
+			if (visitedCells > itemCount * 2)
+			{
+				for (int s = 0; s < itemCount; s++) Consider(s);
+				break;
+			}
+
+			int minCx = qx - r, maxCx = qx + r;
+			int minCy = qy - r, maxCy = qy + r;
+
+			int rowBegin = minCy > boundsMinCy ? minCy : boundsMinCy;
+			int rowEnd = maxCy < boundsMaxCy ? maxCy : boundsMaxCy;
+			int colBegin = minCx > boundsMinCx ? minCx : boundsMinCx;
+			int colEnd = maxCx < boundsMaxCx ? maxCx : boundsMaxCx;
+
+			for (int cy = rowBegin; cy <= rowEnd; cy++)
+			{
+				// 링의 위 / 아래 줄은 전부, 가운데 줄은 양 끝 칸만 검사
+				if (cy == minCy || cy == maxCy)
+				{
+					for (int cx = colBegin; cx <= colEnd; cx++) VisitCell(cx, cy);
+				}
+				else
+				{
+					if (minCx >= boundsMinCx) VisitCell(minCx, cy);
+					if (maxCx <= boundsMaxCx) VisitCell(maxCx, cy);
+				}
+			}
+
+			// 링 r 바깥의 아이템은 최소 r * cellSize 만큼 떨어져 있음
+			float reach = r * cellSize;
+			if (bestId != -1 && bestDistSq < reach * reach) break;
+		}
+
+		if (outDistSq && bestId != -1) *outDistSq = bestDistSq;
+		return bestId;
+	}
+
+	int GetItemCount() const { return itemCount; }
+	float GetCellSize() const { return cellSize; }
+};
+
+// 이미 빌드된 격자로 [begin, end) 번호의 적들만 밀어내기
+// 격자 안의 위치는 빌드 시점 스냅샷이라 각 적의 결과가 다른 적의 처리 순서와 무관하므로
+// 범위를 나눠서 여러 스레드가 동시에 처리해도 결과가 같음
+inline void ApplySeparation(const SpatialGrid& grid, float* xs, float* ys, const unsigned char* alive, int begin, int end,
+	float minDistance, float pushStrength)
+{
+	for (int i = begin; i < end; i++)
+	{
+		if (!alive[i]) continue;
+
+		float x = xs[i];
+		float y = ys[i];
+		float pushX = 0.0f;
+		float pushY = 0.0f;
+
+		grid.ForEachNeighbor(x, y, minDistance, [&](int j, float otherX, float otherY)
+			{
+				if (j == i) return;
+
+				float dx = otherX - x;
+				float dy = otherY - y;
+				float dist = std::sqrt((dx * dx) + (dy * dy));
+
+				// 0.0001f 체크는 둘이 완벽하게 겹쳐서 거리가 0이 될 때 생기는 나눗셈 오류 방지
+				if (dist > 0.0001f)
+				{
+					// 겹친 만큼 상대 반대 방향으로 밀려남
+					float overlap = minDistance - dist;
+					pushX -= (dx / dist) * (overlap * pushStrength);
+					pushY -= (dy / dist) * (overlap * pushStrength);
+				}
+			});
+
+		// 빌드 시점 위치 + 누적 밀림 (격자 안의 스냅샷은 그대로라 다른 적 계산에 영향 없음)
+		xs[i] = x + pushX;
+		ys[i] = y + pushY;
+	}
+}
+
+// 적들 끼리 겹치지 않게 서로 밀어내기 (군집 형성의 핵심)
+// 격자를 적 위치로 다시 빌드한 뒤, 각 적은 minDistance 안쪽의 이웃에게서만 밀림을 받음
+// 모든 밀림은 빌드 시점 위치 기준으로 계산한 뒤 한 번에 적용 (처리 순서에 따라 결과가 달라지지 않음)
+inline void SolveSeparation(SpatialGrid& grid, float* xs, float* ys, const unsigned char* alive, int count,
+	float minDistance, float pushStrength)
+{
+	grid.Build(xs, ys, alive, count, minDistance);
+	ApplySeparation(grid, xs, ys, alive, 0, count, minDistance, pushStrength);
+}
@@ -0,0 +1,328 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+// 스프라이트 시트 아틀라스 (Tools/AssetPacker와 벤치마크가 씀, 그래픽 API와 무관)
+// 가로 한 줄로 늘어선 시트의 프레임마다 알파가 0이 아닌 영역만 잘라내고 (트림), 픽셀이 똑같은 프레임은 하나만 남긴 뒤 (중복 제거)
+// MaxRects로 2D 페이지 하나에 채워 넣음 (긴 애니메이션도 16384 폭 제한에 걸리지 않고, 투명한 여백은 VRAM을 먹지 않음)
+// 칸은 4픽셀 단위 (블록 압축 블록이 두 프레임에 걸치지 않게), 칸 둘레에는 원래 시트의 이웃 픽셀을 padding만큼 같이 옮김
+// (트림 경계에서 선형 필터가 원래 시트와 똑같은 픽셀을 섞음)
+
+// 아틀라스 안의 사각형 (픽셀)
+struct AtlasRect
+{
+	int x = 0;
+	int y = 0;
+	int width = 0;
+	int height = 0;
+};
+
+// MaxRects 패커 (Best Short Side Fit)
+// 비어있는 사각형 목록을 들고 있다가, 넣을 사각형이 남는 짧은 변이 가장 작게 들어가는 자리에 넣고
+// 겹치는 빈 사각형을 나눈 뒤 다른 빈 사각형에 포함되는 것은 지움
+class MaxRectsPacker
+{
+private:
+	int binWidth = 0;
+	int binHeight = 0;
+	std::vector<AtlasRect> freeRects;
+
+	static bool Contains(const AtlasRect& outer, const AtlasRect& inner)
+	{
+		return inner.x >= outer.x && inner.y >= outer.y && inner.x + inner.width <= outer.x + outer.width && inner.y + inner.height <= outer.y + outer.height;
+	}
+
+	// used와 겹치는 빈 사각형을 겹치지 않는 최대 사각형 (최대 4개)으로 나눔
+	void SplitFreeRects(const AtlasRect& used)
+	{
+		std::vector<AtlasRect> next;
+		next.reserve(freeRects.size() + 4);
+		for (const AtlasRect& free : freeRects)
+		{
+			if (used.x >= free.x + free.width || used.x + used.width <= free.x || used.y >= free.y + free.height || used.y + used.height <= free.y)
+			{
+				next.push_back(free);
+				continue;
+			}
+
+			if (used.x > free.x) next.push_back({ free.x, free.y, used.x - free.x, free.height });
+			if (used.x + used.width < free.x + free.width) next.push_back({ used.x + used.width, free.y, free.x + free.width - used.x - used.width, free.height });
+			if (used.y > free.y) next.push_back({ free.x, free.y, free.width, used.y - free.y });
+			if (used.y + used.height < free.y + free.height) next.push_back({ free.x, used.y + used.height, free.width, free.y + free.height - used.y - used.height });
+		}
+
+		// 다른 빈 사각형 안에 들어가는 것은 버림 (똑같은 것이 둘이면 앞의 것만 남김)
+		freeRects.clear();
+		for (size_t i = 0; i < next.size(); i++)
+		{
+			bool redundant = false;
+			for (size_t j = 0; j < next.size() && !redundant; j++)
+			{
+				if (i == j || !Contains(next[j], next[i])) continue;
+				redundant = !Contains(next[i], next[j]) || j < i;
+			}
+			if (!redundant) freeRects.push_back(next[i]);
+		}
+	}
+
+public:
+	void Initialize(int width, int height)
+	{
+		binWidth = width;
+		binHeight = height;
+		freeRects.clear();
+		freeRects.push_back({ 0, 0, width, height });
+	}
+
+	// width x height 자리를 찾아서 out에 (들어갈 곳이 없으면 false)
+	bool Insert(int width, int height, AtlasRect& out)
+	{
+		int bestShort = INT32_MAX, bestLong = INT32_MAX;
+		for (const AtlasRect& free : freeRects)
+		{
+			if (free.width < width || free.height < height) continue;
+			int leftoverX = free.width - width, leftoverY = free.height - height;
+			int shortSide = (std::min)(leftoverX, leftoverY), longSide = (std::max)(leftoverX, leftoverY);
+			if (shortSide < bestShort || (shortSide == bestShort && longSide < bestLong))
+			{
+				out = { free.x, free.y, width, height };
+				bestShort = shortSide;
+				bestLong = longSide;
+			}
+		}
+		if (bestShort == INT32_MAX) return false;
+
+		SplitFreeRects(out);
+		return true;
+	}
+
+	int GetWidth() const { return binWidth; }
+	int GetHeight() const { return binHeight; }
+};
+
+// 프레임 하나가 아틀라스에서 어디 있는지
+// uvRect : 아틀라스 페이지 기준 (u, v, 폭, 높이), 게임의 uvRect 자리에 그대로 씀
+// quadRect : 원래 프레임 기준 (0 ~ 1)으로 잘라낸 그림이 차지하는 (x, y, 폭, 높이), 사각형을 이만큼 줄이고 옮겨서 그림 (피벗 유지)
+// 완전히 투명한 프레임은 폭 / 높이가 0 (그리지 않음)
+struct AtlasFrame
+{
+	int unique = -1;		// 중복 제거 뒤 칸 번호 (투명 프레임은 -1)
+	AtlasRect trim;			// 시트 안에서 잘라낸 영역 (픽셀)
+	float uvRect[4] = {};
+	float quadRect[4] = {};
+};
+
+struct SpriteAtlasOptions
+{
+	int padding = 2;			// 칸 둘레에 같이 옮기는 원래 시트 픽셀 (선형 필터가 경계 밖을 한 픽셀 섞음)
+	int maxSize = 16384;		// 페이지 한 변 최대 (D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION)
+	uint8_t alphaThreshold = 0;	// 알파가 이보다 커야 그림으로 봄
+};
+
+struct SpriteAtlas
+{
+	int width = 0;				// 페이지 크기 (4의 배수)
+	int height = 0;
+	std::vector<uint8_t> pixels;	// RGBA8, 줄 간격 width * 4
+	std::vector<AtlasFrame> frames;	// 시트의 프레임 순서 그대로
+	std::vector<AtlasRect> cells;	// 칸마다 페이지 안의 자리 (padding 포함)
+	int uniqueFrames = 0;
+	int emptyFrames = 0;
+};
+
+// 시트의 frame번째 프레임이 차지하는 가로 구간 [start, end) (폭이 정수가 아니면 게임이 uv로 읽던 것처럼 내림)
+inline void GetSheetFrameSpan(int width, int frames, int frame, int& start, int& end)
+{
+	double frameWidth = (double)width / frames;
+	start = (int)std::floor(frame * frameWidth);
+	end = frame + 1 == frames ? width : (int)std::floor((frame + 1) * frameWidth);
+}
+
+// 프레임 영역에서 알파가 threshold보다 큰 픽셀을 모두 담는 최소 사각형 (없으면 폭 0)
+inline AtlasRect TrimFrame(const uint8_t* rgba, int width, int x0, int x1, int height, uint8_t threshold)
+{
+	int minX = x1, maxX = x0 - 1, minY = height, maxY = -1;
+	for (int y = 0; y < height; y++)
+	{
+		const uint8_t* row = rgba + (size_t)y * width * 4;
+		for (int x = x0; x < x1; x++)
+		{
+			if (row[x * 4 + 3] <= threshold) continue;
+			minX = (std::min)(minX, x);
+			maxX = (std::max)(maxX, x);
+			minY = (std::min)(minY, y);
+			maxY = (std::max)(maxY, y);
+		}
+	}
+	if (maxY < 0) return AtlasRect();
+	return { minX, minY, maxX - minX + 1, maxY - minY + 1 };
+}
+
+inline uint64_t HashTrimmedFrame(const uint8_t* rgba, int width, const AtlasRect& rect)
+{
+	uint64_t hash = 14695981039346656037ull;	// FNV-1a
+	for (int y = rect.y; y < rect.y + rect.height; y++)
+	{
+		const uint8_t* row = rgba + ((size_t)y * width + rect.x) * 4;
+		for (int i = 0; i < rect.width * 4; i++) hash = (hash ^ row[i]) * 1099511628211ull;
+	}
+	return hash ^ ((uint64_t)rect.width << 32 | (uint32_t)rect.height);
+}
+
+inline bool SameTrimmedFrame(const uint8_t* rgba, int width, const AtlasRect& a, const AtlasRect& b)
+{
+	if (a.width != b.width || a.height != b.height) return false;
+	for (int y = 0; y < a.height; y++)
+	{
+		if (memcmp(rgba + ((size_t)(a.y + y) * width + a.x) * 4, rgba + ((size_t)(b.y + y) * width + b.x) * 4, (size_t)a.width * 4) != 0) return false;
+	}
+	return true;
+}
+
+// 칸들을 binWidth x binHeight 안에 넣어봄 (4픽셀 단위로 나눠서 패킹, 모두 들어가면 true)
+inline bool PackAtlasCells(const std::vector<AtlasRect>& sizes, const std::vector<int>& order, int binWidth, int binHeight, std::vector<AtlasRect>& out)
+{
+	MaxRectsPacker packer;
+	packer.Initialize(binWidth / 4, binHeight / 4);
+	out.assign(sizes.size(), AtlasRect());
+	for (int index : order)
+	{
+		AtlasRect placed;
+		if (!packer.Insert(sizes[index].width / 4, sizes[index].height / 4, placed)) return false;
+		out[index] = { placed.x * 4, placed.y * 4, placed.width * 4, placed.height * 4 };
+	}
+	return true;
+}
+
+// 가로로 frames개 늘어선 시트를 아틀라스 페이지 하나로 (maxSize 안에 안 들어가면 false)
+inline bool BuildSpriteAtlas(const uint8_t* rgba, int width, int height, int frames, SpriteAtlas& atlas, const SpriteAtlasOptions& options = SpriteAtlasOptions())
+{
+	atlas = SpriteAtlas();
+	atlas.frames.resize(frames);
+	std::vector<int> framesOfCell;	// 칸마다 대표 프레임
+	std::vector<uint64_t> hashes;
+
+	// 트림 + 중복 제거
+	for (int frame = 0; frame < frames; frame++)
+	{
+		int x0, x1;
+		GetSheetFrameSpan(width, frames, frame, x0, x1);
+		AtlasFrame& out = atlas.frames[frame];
+		out.trim = TrimFrame(rgba, width, x0, x1, height, options.alphaThreshold);
+		if (out.trim.width == 0)
+		{
+			atlas.emptyFrames++;
+			continue;
+		}
+
+		uint64_t hash = HashTrimmedFrame(rgba, width, out.trim);
+		for (size_t cell = 0; cell < framesOfCell.size() && out.unique < 0; cell++)
+		{
+			if (hashes[cell] == hash && SameTrimmedFrame(rgba, width, atlas.frames[framesOfCell[cell]].trim, out.trim)) out.unique = (int)cell;
+		}
+		if (out.unique < 0)
+		{
+			out.unique = (int)framesOfCell.size();
+			framesOfCell.push_back(frame);
+			hashes.push_back(hash);
+		}
+	}
+	atlas.uniqueFrames = (int)framesOfCell.size();
+
+	// 칸 크기 : 트림 + 둘레 padding을 4의 배수로 올림
+	std::vector<AtlasRect> sizes(framesOfCell.size());
+	uint64_t area = 0;
+	int widest = 4, tallest = 4;
+	for (size_t cell = 0; cell < framesOfCell.size(); cell++)
+	{
+		const AtlasRect& trim = atlas.frames[framesOfCell[cell]].trim;
+		sizes[cell].width = (trim.width + options.padding * 2 + 3) & ~3;
+		sizes[cell].height = (trim.height + options.padding * 2 + 3) & ~3;
+		area += (uint64_t)sizes[cell].width * sizes[cell].height;
+		widest = (std::max)(widest, sizes[cell].width);
+		tallest = (std::max)(tallest, sizes[cell].height);
+	}
+	if (widest > options.maxSize || tallest > options.maxSize) return false;
+
+	// 큰 칸부터 (긴 변, 넓이 순)
+	std::vector<int> order(sizes.size());
+	for (size_t i = 0; i < order.size(); i++) order[i] = (int)i;
+	std::stable_sort(order.begin(), order.end(), [&](int a, int b)
+		{
+			int longA = (std::max)(sizes[a].width, sizes[a].height), longB = (std::max)(sizes[b].width, sizes[b].height);
+			if (longA != longB) return longA > longB;
+			return sizes[a].width * sizes[a].height > sizes[b].width * sizes[b].height;
+		});
+
+	// 페이지 폭을 넓이의 제곱근 근처에서 여러 개 해보고, 다 넣은 뒤 실제로 쓴 넓이가 가장 작은 배치를 고름 (높이는 쓴 만큼만 남김)
+	int maxSize = options.maxSize & ~3;
+	int root = (int)std::ceil(std::sqrt((double)area));
+	int firstWidth = (std::max)(widest, root / 2), lastWidth = (std::min)(maxSize, root * 2);
+	int step = (std::max)(4, ((lastWidth - firstWidth) / 32 + 3) & ~3);
+	uint64_t bestArea = UINT64_MAX;
+	std::vector<AtlasRect> placed;
+	for (int binWidth = (firstWidth + 3) & ~3; binWidth <= lastWidth || (bestArea == UINT64_MAX && binWidth <= maxSize); binWidth += step)
+	{
+		if (!PackAtlasCells(sizes, order, binWidth, maxSize, placed)) continue;
+
+		int usedWidth = 4, usedHeight = 4;
+		for (const AtlasRect& cell : placed)
+		{
+			usedWidth = (std::max)(usedWidth, cell.x + cell.width);
+			usedHeight = (std::max)(usedHeight, cell.y + cell.height);
+		}
+		uint64_t usedArea = (uint64_t)usedWidth * usedHeight;
+		if (usedArea < bestArea)
+		{
+			bestArea = usedArea;
+			atlas.cells = placed;
+			atlas.width = usedWidth;
+			atlas.height = usedHeight;
+		}
+	}
+	if (bestArea == UINT64_MAX) return false;
+
+	// 칸 채우기 : 트림 영역과 둘레 padding (같은 프레임 구간 안의 원래 픽셀), 구간 밖은 투명
+	atlas.pixels.assign((size_t)atlas.width * atlas.height * 4, 0);
+	for (size_t cell = 0; cell < framesOfCell.size(); cell++)
+	{
+		int frame = framesOfCell[cell];
+		const AtlasRect& trim = atlas.frames[frame].trim;
+		const AtlasRect& place = atlas.cells[cell];
+		int x0, x1;
+		GetSheetFrameSpan(width, frames, frame, x0, x1);
+
+		for (int y = 0; y < place.height; y++)
+		{
+			int srcY = trim.y - options.padding + y;
+			if (srcY < 0 || srcY >= height) continue;
+			for (int x = 0; x < place.width; x++)
+			{
+				int srcX = trim.x - options.padding + x;
+				if (srcX < x0 || srcX >= x1) continue;
+				memcpy(&atlas.pixels[((size_t)(place.y + y) * atlas.width + place.x + x) * 4], rgba + ((size_t)srcY * width + srcX) * 4, 4);
+			}
+		}
+	}
+
+	// 프레임마다 uv / 사각형 비율
+	double frameWidth = (double)width / frames;
+	for (int frame = 0; frame < frames; frame++)
+	{
+		AtlasFrame& out = atlas.frames[frame];
+		if (out.unique < 0) continue;
+		const AtlasRect& place = atlas.cells[out.unique];
+		out.uvRect[0] = (float)(place.x + options.padding) / atlas.width;
+		out.uvRect[1] = (float)(place.y + options.padding) / atlas.height;
+		out.uvRect[2] = (float)out.trim.width / atlas.width;
+		out.uvRect[3] = (float)out.trim.height / atlas.height;
+		out.quadRect[0] = (float)((out.trim.x - frame * frameWidth) / frameWidth);
+		out.quadRect[1] = (float)out.trim.y / height;
+		out.quadRect[2] = (float)(out.trim.width / frameWidth);
+		out.quadRect[3] = (float)out.trim.height / height;
+	}
+	return true;
+}
@@ -1,38 +0,0 @@
-#pragma once
-#include <windows.h>
-
-// ð  ϴ Ŭ Tick 
-class TimeManager
-{
-private:
-	LARGE_INTEGER prevTime, currentTime, frequency;
-	float deltaTime = 0.0f;
-
-public:
-	void Initialize()
-	{
-		QueryPerformanceFrequency(&frequency);
-		QueryPerformanceCounter(&prevTime);
-	}
-
-	void Update()
-	{
-		QueryPerformanceCounter(&currentTime);
-		//  Ӻ  ӱ ɸ ð() 
-		deltaTime = static_cast<float>(currentTime.QuadPart - prevTime.QuadPart) / frequency.QuadPart;
-		prevTime = currentTime;
-	}
-
-	float GetDeltaTime() const { return deltaTime; }
-};
-
-// Ű Է ϴ Ŭ
-class InputManager
-{
-public:
-	// Ư Ű  ִ Ȯ (W, A, S, D)
-	bool IsKeyPressed(int vKey)
-	{
-		return (GetAsyncKeyState(vKey) & 0x8000) != 0;
-	}
-};
\ No newline at end of file
@@ -0,0 +1,98 @@
+﻿// 에셋 패커
+// Assets/Textures의 PNG를 풀어서 큰 텍스처는 BC7 (--bc3이면 BC3)로 압축하고 나머지는 RGBA8로,
+// Assets/Sounds의 WAV에서는 PCM만 떼어서 에셋 팩 파일 하나로 씀 (형식은 Source/Utils/AssetPack.h)
+// 스프라이트 시트의 프레임 수는 Assets/Textures/frames.txt에서 읽고, 시트는 프레임을 트림 / 중복 제거해서 2D 아틀라스로 다시 배치함 (--no-atlas면 그대로)
+// 색이 256개 이하인 도트 그림은 8비트 팔레트로 (--no-palette면 안 함), frames.txt에 mips가 붙은 텍스처는 밉 단계를 만듦 (--no-mips면 안 함)
+// 게임은 실행할 때 Assets/assets.pack이 있으면 PNG / WAV 대신 팩을 메모리 맵으로 열어서 씀 (에셋을 바꾸면 다시 만들어야 함)
+// 빌드 : 저장소 최상위에서 cmake -S . -B build && cmake --build build (또는 g++ -O2 -std=c++14 -pthread Tools/AssetPacker.cpp -o AssetPacker)
+// 사용 : AssetPacker [--bc3 | --rgba] [--no-atlas] [--no-palette] [--no-mips] [--threads N] [에셋 폴더 (기본 Assets)] [출력 파일 (기본 <에셋 폴더>/assets.pack)]
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <vector>
+#include <string>
+#define STB_IMAGE_IMPLEMENTATION
+#include "../Source/Utils/AssetPackBuilder.h"
+
+static void Usage()
+{
+	printf("usage : AssetPacker [--bc3 | --rgba] [--no-atlas] [--no-palette] [--no-mips] [--threads N] [assets folder (default Assets)] [output (default <assets folder>/assets.pack)]\n");
+}
+
+int main(int argc, char** argv)
+{
+	AssetPackOptions options;
+	int threads = 0;
+	std::vector<std::string> positional;
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		if (strcmp(arg, "--bc3") == 0) options.blockFormat = BLOCK_BC3;
+		else if (strcmp(arg, "--rgba") == 0) options.compress = false;
+		else if (strcmp(arg, "--no-atlas") == 0) options.atlas = false;
+		else if (strcmp(arg, "--no-palette") == 0) options.palette = false;
+		else if (strcmp(arg, "--no-mips") == 0) options.mips = false;
+		else if (strcmp(arg, "--threads") == 0 && i + 1 < argc) threads = atoi(argv[++i]);
+		else if (arg[0] == '-')
+		{
+			Usage();
+			return 1;
+		}
+		else positional.push_back(arg);
+	}
+	if (positional.size() > 2)
+	{
+		Usage();
+		return 1;
+	}
+
+	std::string assetsRoot = positional.size() > 0 ? positional[0] : "Assets";
+	while (assetsRoot.size() > 1 && (assetsRoot.back() == '/' || assetsRoot.back() == '\\')) assetsRoot.pop_back();
+	std::string outPath = positional.size() > 1 ? positional[1] : assetsRoot + "/assets.pack";
+
+	// 압축은 블록 줄 단위로 병렬 (기본 코어 수만큼)
+	JobSystem jobs;
+	jobs.Initialize(threads > 0 ? threads - 1 : -1);
+	options.jobs = &jobs;
+
+	AssetPackStats stats;
+	if (!BuildAssetPack(assetsRoot, outPath.c_str(), stats, options))
+	{
+		printf("failed to write %s\n", outPath.c_str());
+		return 1;
+	}
+
+	static const char* FORMAT_NAMES[] = { "RGBA8", "BC3", "BC7", "PAL8" };
+	uint64_t rgbaBytes = 0, gpuBytes = 0;
+	for (const AssetPackTextureReport& report : stats.textureReports)
+	{
+		// 시트마다 원본 RGBA8 대비 VRAM (아틀라스면 중복 제거 뒤 프레임 수와 페이지 크기도)
+		char frames[32], stored[32];
+		if (report.uniqueFrames > 0) snprintf(frames, sizeof(frames), "%d -> %d", report.frames, report.uniqueFrames);
+		else snprintf(frames, sizeof(frames), "%d", report.frames);
+		snprintf(stored, sizeof(stored), "%dx%d", report.storedWidth, report.storedHeight);
+		printf("%-24s %6dx%-5d %9s frames  %-6s %-11s %7.2f MB -> %6.2f MB (%+4.0f%%)", report.name.c_str(), report.width, report.height, frames,
+			report.uniqueFrames > 0 ? "atlas" : "", stored, report.rgbaBytes / (1024.0 * 1024.0), report.gpuBytes / (1024.0 * 1024.0),
+			100.0 * report.gpuBytes / report.rgbaBytes - 100.0);
+		printf("  %-5s", FORMAT_NAMES[report.format]);
+		if (report.mipLevels > 1) printf(" %2d mips", report.mipLevels);
+		if (report.format == ASSET_FORMAT_PALETTE8) printf(" %d colors", report.colors);
+		else if (report.psnr > 0.0) printf(" %.1f dB", report.psnr);
+		printf("\n");
+		rgbaBytes += report.rgbaBytes;
+		gpuBytes += report.gpuBytes;
+	}
+	for (const std::string& path : stats.failed) printf("skipped %s (cannot read)\n", path.c_str());
+	printf("texture VRAM %.1f MB (RGBA8 %.1f MB)\n", gpuBytes / (1024.0 * 1024.0), rgbaBytes / (1024.0 * 1024.0));
+	printf("%s : %d textures, %d sounds, %.1f MB (sources %.1f MB)\n", outPath.c_str(), stats.textures, stats.sounds,
+		stats.packBytes / (1024.0 * 1024.0), stats.sourceBytes / (1024.0 * 1024.0));
+
+	// 방금 쓴 팩을 다시 열어서 검사
+	AssetPack pack;
+	if (!pack.Open(outPath.c_str()) || pack.GetEntryCount() != stats.textures + stats.sounds)
+	{
+		printf("written pack does not validate\n");
+		return 1;
+	}
+	return 0;
+}
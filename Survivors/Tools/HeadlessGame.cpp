@@ -0,0 +1,252 @@
+﻿// 헤드리스 게임 실행기
+// 창, GPU, 사운드 장치 없이 게임 전체 (타이틀 / 무기 선택 / 레벨업 / 일시정지 / 결과 창 포함)를 NullPlatform으로 돌림
+// 시계는 프레임마다 1/60초씩 흐르는 가짜 시계라 실제로는 최대한 빨리 돌고, 입력은 그 시계를 기준으로 스크립트가 넣음
+// 업데이트 / 스냅샷 / 렌더를 한 스레드에서 차례로 불러서 단계마다 걸린 시간과 초당 프레임 수를 측정 (리눅스 빌드 서버용)
+// 빌드 : 저장소 최상위에서 cmake -S . -B build && cmake --build build (또는 g++ -O2 -std=c++14 -pthread Tools/HeadlessGame.cpp -o HeadlessGame)
+// 사용 : HeadlessGame [--frames N] [--seed N] [--threads N] [--script 파일] [--software 0|1] [--png 접두사] [--png-every N]
+// Survivors 폴더 (Assets가 있는 곳)에서 실행 (Assets/assets.pack이 있으면 팩을 씀)
+// --threads는 시뮬레이션 / 렌더에 쓸 스레드 수 (기본 1, 0이면 코어 수만큼)
+// --software 1은 CPU 래스터라이저로 화면을 실제로 그림 (기본은 인스턴스만 만드는 NullRenderer)
+// --png는 소프트웨어 렌더러의 마지막 화면을 <접두사>final.png로 저장, --png-every N이면 N프레임마다 <접두사><프레임 번호>.png도 저장
+// 스크립트 형식은 NullPlatform.h의 ScriptedInput 참고 (없으면 아래 기본 스크립트)
+#define STB_IMAGE_IMPLEMENTATION
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "../Source/Core/Game.h"
+#include "../Source/Platform/NullPlatform.h"
+#include "../Source/Platform/SoftwareRenderer.h"
+
+// 기본 입력 : 시작 버튼을 누르고, 화면 가운데 조금 아래를 계속 클릭 (무기 선택 / 레벨업의 가운데 카드, 결과 창의 다시 시작 버튼이 모두 걸리는 자리)
+// 이동은 1초마다 8방향을 돌아가며 원을 그리고, 20초에 일시정지했다가 22초에 다시 시작
+static const char* DEFAULT_SCRIPT =
+	"0.5 click 640 396\n"
+	"1.0 every 0.25 click 640 450\n"
+	"2.0 every 8 keys D\n"
+	"3.0 every 8 keys WD\n"
+	"4.0 every 8 keys W\n"
+	"5.0 every 8 keys WA\n"
+	"6.0 every 8 keys A\n"
+	"7.0 every 8 keys SA\n"
+	"8.0 every 8 keys S\n"
+	"9.0 every 8 keys SD\n"
+	"20.0 press ESC\n"
+	"20.1 release ESC\n"
+	"22.0 press ESC\n"
+	"22.1 release ESC\n";
+
+static const char* STATE_NAMES[] = { "TITLE", "WEAPON_SELECT", "PLAY", "LEVEL_UP", "PAUSE", "GAME_OVER", "CLEAR" };
+static const int STATE_COUNT = sizeof(STATE_NAMES) / sizeof(STATE_NAMES[0]);
+
+struct PhaseTimes
+{
+	std::vector<double> update;
+	std::vector<double> snapshot;
+	std::vector<double> render;
+	std::vector<double> frame;
+};
+
+static void PrintPercentiles(const char* name, std::vector<double> ms)
+{
+	if (ms.empty()) return;
+	std::sort(ms.begin(), ms.end());
+	double p50 = ms[(ms.size() - 1) / 2];
+	double p99 = ms[(size_t)((ms.size() - 1) * 0.99)];
+	printf("%-8s : p50 %.4f  p99 %.4f  max %.4f ms\n", name, p50, p99, ms.back());
+}
+
+static void Usage()
+{
+	printf("usage : HeadlessGame [--frames N] [--seed N] [--threads N] [--script file] [--software 0|1] [--png prefix] [--png-every N]\n");
+}
+
+int main(int argc, char** argv)
+{
+	long long frameLimit = 60 * 60 * 6;		// 기본 6분 (메뉴 + 한 판 전체)
+	uint32_t seed = 1;
+	int workerCount = 0;	// 잡 시스템 워커 수 (0이면 전부 메인 스레드, -1이면 코어 수 - 1)
+	const char* scriptPath = nullptr;
+	bool useSoftware = false;
+	const char* pngPrefix = nullptr;
+	long long pngEvery = 0;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+		if (value != nullptr && strcmp(arg, "--frames") == 0) frameLimit = atoll(value);
+		else if (value != nullptr && strcmp(arg, "--seed") == 0) seed = (uint32_t)strtoul(value, nullptr, 10);
+		else if (value != nullptr && strcmp(arg, "--threads") == 0) workerCount = atoi(value) - 1;
+		else if (value != nullptr && strcmp(arg, "--script") == 0) scriptPath = value;
+		else if (value != nullptr && strcmp(arg, "--software") == 0) useSoftware = atoi(value) != 0;
+		else if (value != nullptr && strcmp(arg, "--png") == 0) pngPrefix = value;
+		else if (value != nullptr && strcmp(arg, "--png-every") == 0) pngEvery = atoll(value);
+		else
+		{
+			Usage();
+			return 2;
+		}
+		i++;
+	}
+
+	if (frameLimit < 1 || pngEvery < 0 || (pngPrefix != nullptr && !useSoftware))
+	{
+		Usage();
+		return 2;
+	}
+
+	NullWindow window(1280, 720);
+	ManualTimer timer(1.0 / 60.0);
+	ScriptedInput input;
+	input.Initialize(&timer);
+	if (scriptPath != nullptr)
+	{
+		if (!input.LoadScript(scriptPath))
+		{
+			printf("cannot open script : %s\n", scriptPath);
+			return 2;
+		}
+	}
+	else
+	{
+		input.AddScript(DEFAULT_SCRIPT);
+	}
+	NullAudio audio;
+
+	// Tools/AssetPacker로 만든 에셋 팩이 있으면 씀 (없으면 PNG 파일을 직접 읽음)
+	g_AssetPack.Open("Assets/assets.pack");
+
+	// 렌더러의 인스턴스 쓰기 / 타일 래스터는 시뮬레이션과 번갈아 도므로 잡 시스템을 따로 둠
+	JobSystem renderJobs;
+	renderJobs.Initialize(workerCount);
+
+	static NullRenderer nullRenderer;
+	static SoftwareRenderer softwareRenderer;
+	NullRenderer* renderer = &nullRenderer;
+	if (useSoftware)
+	{
+		softwareRenderer.Initialize(window.GetWidth(), window.GetHeight(), &g_AssetPack, &renderJobs);
+		renderer = &softwareRenderer;
+	}
+	else
+	{
+		nullRenderer.Initialize(&g_AssetPack, &renderJobs);
+	}
+
+	Platform platform;
+	platform.window = &window;
+	platform.input = &input;
+	platform.timer = &timer;
+	platform.audio = &audio;
+	platform.renderer = renderer;
+
+	// 게임 객체 전체가 크므로 스택 대신 static
+	static Game game;
+	using Clock = std::chrono::steady_clock;
+	auto initStart = Clock::now();
+	game.Initialize(platform, seed, workerCount);
+	double initSeconds = std::chrono::duration<double>(Clock::now() - initStart).count();
+
+	PhaseTimes times;
+	times.update.reserve((size_t)frameLimit);
+	times.snapshot.reserve((size_t)frameLimit);
+	times.render.reserve((size_t)frameLimit);
+	times.frame.reserve((size_t)frameLimit);
+
+	int stateEntries[STATE_COUNT] = {};
+	Game::GameState lastState = game.currentState;
+	stateEntries[(int)lastState]++;
+	std::string transitions = STATE_NAMES[(int)lastState];
+	int shownTransitions = 0;
+	double firstOutcomeTime = -1.0;
+	Game::GameState firstOutcome = Game::GameState::TITLE;
+	int peakSprites = 0;
+	char pngPath[512];
+
+	long long frame = 0;
+	auto runStart = Clock::now();
+	while (frame < frameLimit && window.PumpMessages())
+	{
+		auto frameStart = Clock::now();
+		game.Update();
+		auto updateEnd = Clock::now();
+		game.PublishSnapshot();
+		auto snapshotEnd = Clock::now();
+		renderer->Render(game.AcquireSnapshot());
+		auto renderEnd = Clock::now();
+
+		times.update.push_back(std::chrono::duration<double, std::milli>(updateEnd - frameStart).count());
+		times.snapshot.push_back(std::chrono::duration<double, std::milli>(snapshotEnd - updateEnd).count());
+		times.render.push_back(std::chrono::duration<double, std::milli>(renderEnd - snapshotEnd).count());
+		times.frame.push_back(std::chrono::duration<double, std::milli>(renderEnd - frameStart).count());
+		peakSprites = (std::max)(peakSprites, renderer->GetLastSpriteCount());
+		frame++;
+
+		if (game.currentState != lastState)
+		{
+			lastState = game.currentState;
+			stateEntries[(int)lastState]++;
+			if (shownTransitions++ < 12)
+			{
+				char step[64];
+				snprintf(step, sizeof(step), " -> %s %.2fs", STATE_NAMES[(int)lastState], timer.GetTime());
+				transitions += step;
+			}
+			if (firstOutcomeTime < 0.0 && (lastState == Game::GameState::GAME_OVER || lastState == Game::GameState::CLEAR))
+			{
+				firstOutcomeTime = timer.GetTime();
+				firstOutcome = lastState;
+			}
+		}
+
+		if (useSoftware && pngPrefix != nullptr && pngEvery > 0 && frame % pngEvery == 0)
+		{
+			snprintf(pngPath, sizeof(pngPath), "%s%06lld.png", pngPrefix, frame);
+			softwareRenderer.GetRasterizer().SavePng(pngPath);
+		}
+
+		if (game.IsQuitRequested() || input.IsQuitRequested()) window.RequestClose();
+	}
+	double totalSeconds = std::chrono::duration<double>(Clock::now() - runStart).count();
+	renderer->WaitForIdle();
+
+	if (shownTransitions > 12) transitions += " ...";
+
+	printf("config   : seed %u, threads %d, renderer %s, assets %s, input %s\n", seed, game.jobs.GetWorkerCount() + 1,
+		useSoftware ? "software" : "null", g_AssetPack.IsOpen() ? "pack" : "files", scriptPath != nullptr ? scriptPath : "(default)");
+	printf("init     : %.3f s, %d textures\n", initSeconds, renderer->GetTextureCount());
+	printf("frames   : %lld (%.1f s of game time) in %.3f s -> %.0f frames/sec\n", frame, timer.GetTime(), totalSeconds, frame / totalSeconds);
+	PrintPercentiles("update", times.update);
+	PrintPercentiles("snapshot", times.snapshot);
+	PrintPercentiles("render", times.render);
+	PrintPercentiles("frame", times.frame);
+	printf("sprites  : peak %d, average %.0f per frame\n", peakSprites, frame > 0 ? (double)renderer->GetTotalSprites() / frame : 0.0);
+
+	printf("states   : %s\n", transitions.c_str());
+	printf("entered  :");
+	for (int i = 0; i < STATE_COUNT; i++) printf(" %s %d", STATE_NAMES[i], stateEntries[i]);
+	printf("\n");
+
+	printf("sounds   :");
+	for (const auto& entry : audio.GetPlayCounts()) printf(" %s %d", entry.first.c_str(), entry.second);
+	printf("\n");
+
+	if (firstOutcomeTime >= 0.0) printf("outcome  : %s at %.2f s", firstOutcome == Game::GameState::CLEAR ? "clear" : "game over", firstOutcomeTime);
+	else printf("outcome  : alive");
+	printf(", now %s, level %d, kills %d, hp %.1f / %.1f\n", STATE_NAMES[(int)game.currentState],
+		game.world.player.level, game.world.totalKills, game.world.player.hp, game.world.player.maxHp);
+	printf("state    : %08x\n", game.world.GetStateHash());
+
+	if (useSoftware && pngPrefix != nullptr)
+	{
+		snprintf(pngPath, sizeof(pngPath), "%sfinal.png", pngPrefix);
+		if (!softwareRenderer.GetRasterizer().SavePng(pngPath)) printf("cannot write %s\n", pngPath);
+	}
+
+	return 0;
+}
@@ -0,0 +1,237 @@
+﻿// 헤드리스 시뮬레이션 실행기
+// 창, GPU, 사운드 없이 SimWorld만 고정 틱으로 돌려서 틱 처리 속도와 엔티티 수를 측정 (리눅스 빌드 서버용)
+// 빌드 : 저장소 최상위에서 cmake -S . -B build && cmake --build build (또는 g++ -O2 -std=c++14 -pthread Tools/HeadlessSim.cpp -o HeadlessSim)
+// 사용 : HeadlessSim [--ticks N] [--enemies N] [--weapon 0|1|2] [--spawn-mult N] [--seed N] [--threads N] [--obstacles 0|1] [--script 파일]
+// --threads는 시뮬레이션에 쓸 스레드 수 (기본 1, 0이면 코어 수만큼)
+// --obstacles 1은 맵 네 귀퉁이에 기둥을 세워서 적이 흐름장을 따라 돌아가게 함 (흐름장 부하 측정용)
+// 스크립트 파일은 한 줄에 "<틱 번호> <WASD 조합 또는 ->" 형식, 다음 줄의 틱까지 그 입력을 유지
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "../Source/Sim/SimWorld.h"
+
+struct ScriptKey
+{
+	long long tick;
+	SimInput input;
+};
+
+static SimInput ParseKeys(const char* keys)
+{
+	SimInput input;
+	for (const char* c = keys; *c != '\0'; c++)
+	{
+		if (*c == 'W' || *c == 'w') input.up = true;
+		if (*c == 'S' || *c == 's') input.down = true;
+		if (*c == 'A' || *c == 'a') input.left = true;
+		if (*c == 'D' || *c == 'd') input.right = true;
+	}
+	return input;
+}
+
+static bool LoadScript(const char* path, std::vector<ScriptKey>& outKeys)
+{
+	FILE* file = fopen(path, "r");
+	if (file == nullptr) return false;
+
+	char line[256];
+	while (fgets(line, sizeof(line), file) != nullptr)
+	{
+		long long tick = 0;
+		char keys[64] = "";
+		if (line[0] == '#' || sscanf(line, "%lld %63s", &tick, keys) < 1) continue;
+
+		ScriptKey key;
+		key.tick = tick;
+		key.input = ParseKeys(keys);
+		outKeys.push_back(key);
+	}
+
+	fclose(file);
+	std::stable_sort(outKeys.begin(), outKeys.end(), [](const ScriptKey& a, const ScriptKey& b) { return a.tick < b.tick; });
+	return true;
+}
+
+// 스크립트가 없을 때 기본 입력 : 1초마다 8방향을 돌아가며 움직여서 맵을 크게 원을 그리듯 돌아다님
+static SimInput DefaultInput(long long tick)
+{
+	static const char* directions[] = { "D", "WD", "W", "WA", "A", "SA", "S", "SD" };
+	return ParseKeys(directions[(tick / 60) % 8]);
+}
+
+struct EntityCounts
+{
+	int enemies = 0;
+	int bullets = 0;
+	int gems = 0;
+	int damageTexts = 0;
+	int effects = 0;
+};
+
+static EntityCounts CountEntities(const SimWorld& world)
+{
+	EntityCounts counts;
+	counts.enemies = world.GetAliveEnemyCount();
+	counts.bullets = world.bullets.GetLiveCount();
+	counts.gems = world.gems.GetLiveCount();
+	counts.damageTexts = world.damageTexts.GetLiveCount();
+	counts.effects = world.meleeEffects.GetLiveCount() + world.hitEffects.GetLiveCount();
+	return counts;
+}
+
+// 맵 네 귀퉁이 (±2, ±2)에 1 x 1 크기 기둥
+static void PlacePillars(SimWorld& world)
+{
+	FlowField& field = world.GetFlowField();
+	for (int corner = 0; corner < 4; corner++)
+	{
+		float centerX = (corner & 1) ? 2.0f : -2.0f;
+		float centerY = (corner & 2) ? 2.0f : -2.0f;
+
+		int beginX = (int)std::floor((centerX - 0.5f - field.GetOriginX()) / field.GetCellSize());
+		int beginY = (int)std::floor((centerY - 0.5f - field.GetOriginY()) / field.GetCellSize());
+		int cells = (int)(1.0f / field.GetCellSize());
+		for (int cy = beginY; cy < beginY + cells; cy++)
+		{
+			for (int cx = beginX; cx < beginX + cells; cx++) field.SetBlocked(cx, cy, true);
+		}
+	}
+}
+
+static void Usage()
+{
+	printf("usage : HeadlessSim [--ticks N] [--enemies N] [--weapon 0|1|2] [--spawn-mult N] [--seed N] [--threads N] [--obstacles 0|1] [--script file]\n");
+}
+
+int main(int argc, char** argv)
+{
+	long long tickLimit = 60 * 60 * 5;		// 기본 5분 (한 판 전체)
+	int weapon = 1;
+	int workerCount = 0;	// 잡 시스템 워커 수 (0이면 전부 메인 스레드, -1이면 코어 수 - 1)
+	const char* scriptPath = nullptr;
+	bool hasObstacles = false;
+
+	SimConfig config;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+		if (value != nullptr && strcmp(arg, "--ticks") == 0) tickLimit = atoll(value);
+		else if (value != nullptr && strcmp(arg, "--enemies") == 0) config.enemyCapacity = atoi(value);
+		else if (value != nullptr && strcmp(arg, "--weapon") == 0) weapon = atoi(value);
+		else if (value != nullptr && strcmp(arg, "--spawn-mult") == 0) config.spawnMultiplier = atoi(value);
+		else if (value != nullptr && strcmp(arg, "--seed") == 0) config.seed = (uint32_t)strtoul(value, nullptr, 10);
+		else if (value != nullptr && strcmp(arg, "--threads") == 0) workerCount = atoi(value) - 1;
+		else if (value != nullptr && strcmp(arg, "--obstacles") == 0) hasObstacles = atoi(value) != 0;
+		else if (value != nullptr && strcmp(arg, "--script") == 0) scriptPath = value;
+		else
+		{
+			Usage();
+			return 2;
+		}
+		i++;
+	}
+
+	// 보스 4칸 + 노멀 / 스피드 / 탱커가 최소 한 칸씩은 있어야 함
+	if (config.enemyCapacity < 7 || weapon < 0 || weapon > 2 || config.spawnMultiplier < 1 || tickLimit < 1)
+	{
+		Usage();
+		return 2;
+	}
+
+	std::vector<ScriptKey> script;
+	if (scriptPath != nullptr && !LoadScript(scriptPath, script))
+	{
+		printf("cannot open script : %s\n", scriptPath);
+		return 2;
+	}
+
+	JobSystem jobs;
+	jobs.Initialize(workerCount);
+
+	SimWorld world;
+	world.Initialize(config);
+	world.SetJobSystem(&jobs);
+	world.Reset();
+	world.selectedWeapon = weapon;
+	if (hasObstacles) PlacePillars(world);
+
+	const float dt = 1.0f / 60.0f;
+	std::vector<double> tickMs;
+	tickMs.reserve((size_t)tickLimit);
+
+	EntityCounts peak;
+	SimInput input;
+	size_t scriptCursor = 0;
+	int upgradeCount = 0;
+	long long gameOverTick = -1;
+	long long clearTick = -1;
+
+	using Clock = std::chrono::steady_clock;
+	auto runStart = Clock::now();
+
+	for (long long tick = 0; tick < tickLimit; tick++)
+	{
+		if (scriptPath != nullptr)
+		{
+			while (scriptCursor < script.size() && script[scriptCursor].tick <= tick) input = script[scriptCursor++].input;
+		}
+		else
+		{
+			input = DefaultInput(tick);
+		}
+
+		auto tickStart = Clock::now();
+		world.Tick(input, dt);
+
+		// 레벨업 카드는 0 ~ 4번을 차례대로 고름 (게임 오버 / 클리어 이후에도 부하 측정을 위해 계속 진행)
+		for (const SimEvent& e : world.events)
+		{
+			if (e.type == SimEventType::LevelUp) world.ApplyUpgrade(upgradeCount++ % 5);
+			else if (e.type == SimEventType::GameOver && gameOverTick < 0) gameOverTick = tick;
+			else if (e.type == SimEventType::Clear && clearTick < 0) clearTick = tick;
+		}
+		tickMs.push_back(std::chrono::duration<double, std::milli>(Clock::now() - tickStart).count());
+
+		EntityCounts now = CountEntities(world);
+		peak.enemies = (std::max)(peak.enemies, now.enemies);
+		peak.bullets = (std::max)(peak.bullets, now.bullets);
+		peak.gems = (std::max)(peak.gems, now.gems);
+		peak.damageTexts = (std::max)(peak.damageTexts, now.damageTexts);
+		peak.effects = (std::max)(peak.effects, now.effects);
+	}
+
+	double totalSeconds = std::chrono::duration<double>(Clock::now() - runStart).count();
+
+	std::vector<double> sorted = tickMs;
+	std::sort(sorted.begin(), sorted.end());
+	double p50 = sorted[(sorted.size() - 1) / 2];
+	double p99 = sorted[(size_t)((sorted.size() - 1) * 0.99)];
+
+	EntityCounts last = CountEntities(world);
+
+	printf("config   : enemies %d, weapon %d, spawn-mult %d, seed %u, threads %d, obstacles %s, input %s\n",
+		config.enemyCapacity, weapon, config.spawnMultiplier, config.seed, jobs.GetWorkerCount() + 1, hasObstacles ? "on" : "off",
+		scriptPath != nullptr ? scriptPath : "(default circle)");
+	printf("ticks    : %lld (%.1f s of game time) in %.3f s -> %.0f ticks/sec\n", tickLimit, tickLimit * dt, totalSeconds, tickLimit / totalSeconds);
+	printf("tick ms  : p50 %.4f  p99 %.4f  max %.4f\n", p50, p99, sorted.back());
+	printf("%-8s %8s %8s %8s %8s %8s\n", "entities", "enemies", "bullets", "gems", "texts", "effects");
+	printf("%-8s %8d %8d %8d %8d %8d\n", "peak", peak.enemies, peak.bullets, peak.gems, peak.damageTexts, peak.effects);
+	printf("%-8s %8d %8d %8d %8d %8d\n", "final", last.enemies, last.bullets, last.gems, last.damageTexts, last.effects);
+
+	if (clearTick >= 0) printf("outcome  : clear at tick %lld", clearTick);
+	else if (gameOverTick >= 0) printf("outcome  : game over at tick %lld", gameOverTick);
+	else printf("outcome  : alive");
+	printf(", level %d, kills %d, hp %.1f / %.1f\n", world.player.level, world.totalKills, world.player.hp, world.player.maxHp);
+	printf("state    : %08x\n", world.GetStateHash());
+	if (hasObstacles) printf("flow     : %d field rebuilds\n", world.GetFlowField().GetRebuildCount());
+
+	return 0;
+}